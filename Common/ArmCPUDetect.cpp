@@ -318,6 +318,7 @@ void CPUInfo::Detect()
 	bIDIVt = isVFP4;
 	bFP = false;
 	bASIMD = false;
+	bCRC32 = false;
 #else // PPSSPP_PLATFORM(LINUX)
 	truncate_cpy(cpu_string, GetCPUString().c_str());
 	truncate_cpy(brand_string, GetCPUBrandString().c_str());
@@ -342,15 +343,20 @@ void CPUInfo::Detect()
 	// Vero4k supports NEON but doesn't report it. Check for Arm Cortex-A53.
 	if (GetCPUImplementer() == 0x41 && CPUPart == 0xd03)
 		bNEON = true;
-	// These two require ARMv8 or higher
+	// These require ARMv8 or higher
 	bFP = CheckCPUFeature("fp");
 	bASIMD = CheckCPUFeature("asimd");
+	bCRC32 = CheckCPUFeature("crc32");
 	num_cores = GetCoreCount();
 #endif
 #if PPSSPP_ARCH(ARM64)
 	// Whether the above detection failed or not, on ARM64 we do have ASIMD/NEON.
 	bNEON = true;
 	bASIMD = true;
+#if !PPSSPP_PLATFORM(LINUX)
+	// Apple chips and Windows-on-ARM devices all have the CRC32 instructions.
+	bCRC32 = true;
+#endif
 #endif
 
 #if PPSSPP_ARCH(ARM) && defined(USE_CPU_FEATURES)
@@ -376,6 +382,7 @@ void CPUInfo::Detect()
 	bSVE = info.features.sve;
 	bSVE2 = info.features.sve2;
 	bFRINT = info.features.frint;
+	bCRC32 = info.features.crc32;
 #endif
 }
 
@@ -401,6 +408,7 @@ std::vector<std::string> CPUInfo::Features() {
 		{ bIDIVa, "IDIVa" },
 		{ bIDIVt, "IDIVt" },
 		{ bFRINT, "FRINT" },
+		{ bCRC32, "CRC32" },
 		{ bSVE, "SVE" },
 		{ bSVE2, "SVE2" },
 		{ CPU64bit, "64-bit" },
@@ -21,6 +21,25 @@ inline uint32_t clz32(uint32_t value) {
 	return 31 ^ (uint32_t)index;
 }
 
+// Use this if you know the value is non-zero.
+inline uint32_t ctz32_nonzero(uint32_t value) {
+	DWORD index;
+	BitScanForward(&index, value);
+	return (uint32_t)index;
+}
+
+// Use this if you know the value is non-zero.
+inline uint32_t ctz64_nonzero(uint64_t value) {
+#if PPSSPP_ARCH(64BIT)
+	DWORD index;
+	BitScanForward64(&index, value);
+	return (uint32_t)index;
+#else
+	uint32_t lo = (uint32_t)value;
+	return lo != 0 ? ctz32_nonzero(lo) : 32 + ctz32_nonzero((uint32_t)(value >> 32));
+#endif
+}
+
 #else
 
 // Use this if you know the value is non-zero.
@@ -34,4 +53,14 @@ inline uint32_t clz32(uint32_t value) {
 	return __builtin_clz(value);
 }
 
+// Use this if you know the value is non-zero.
+inline uint32_t ctz32_nonzero(uint32_t value) {
+	return __builtin_ctz(value);
+}
+
+// Use this if you know the value is non-zero.
+inline uint32_t ctz64_nonzero(uint64_t value) {
+	return __builtin_ctzll(value);
+}
+
 #endif
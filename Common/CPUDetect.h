@@ -97,6 +97,7 @@ struct CPUInfo {
 	bool bSVE;
 	bool bSVE2;
 	bool bFRINT;
+	bool bCRC32;
 
 	// MIPS specific
 	bool bXBurst1;
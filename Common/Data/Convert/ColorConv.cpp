@@ -121,6 +121,32 @@ void ConvertRGBA8888ToRGBA5551(u16 *dst, const u32 *src, u32 numPixels) {
 
 	// The remainder starts right after those done via SSE.
 	u32 i = sseChunks * 4;
+#elif PPSSPP_ARCH(ARM_NEON)
+	const uint32x4_t maskR = vdupq_n_u32(0x001F);
+	const uint32x4_t maskG = vdupq_n_u32(0x03E0);
+	const uint32x4_t maskB = vdupq_n_u32(0x7C00);
+	const uint32x4_t maskA = vdupq_n_u32(0x8000);
+
+	u32 i = 0;
+	if (((uintptr_t)dst & 15) == 0 && ((uintptr_t)src & 15) == 0) {
+		const u32 simdable = (numPixels / 8) * 8;
+		for (; i < simdable; i += 8) {
+			const uint32x4_t c1 = vld1q_u32(src + i);
+			const uint32x4_t c2 = vld1q_u32(src + i + 4);
+
+			uint32x4_t v1 = vandq_u32(vshrq_n_u32(c1, 3), maskR);
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 6), maskG));
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 9), maskB));
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 16), maskA));
+
+			uint32x4_t v2 = vandq_u32(vshrq_n_u32(c2, 3), maskR);
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 6), maskG));
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 9), maskB));
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 16), maskA));
+
+			vst1q_u16(dst + i, vcombine_u16(vmovn_u32(v1), vmovn_u32(v2)));
+		}
+	}
 #else
 	u32 i = 0;
 #endif
@@ -174,6 +200,32 @@ void ConvertBGRA8888ToRGBA5551(u16 *dst, const u32 *src, u32 numPixels) {
 
 	// The remainder starts right after those done via SSE.
 	u32 i = sseChunks * 4;
+#elif PPSSPP_ARCH(ARM_NEON)
+	const uint32x4_t maskR = vdupq_n_u32(0x001F);
+	const uint32x4_t maskG = vdupq_n_u32(0x03E0);
+	const uint32x4_t maskB = vdupq_n_u32(0x7C00);
+	const uint32x4_t maskA = vdupq_n_u32(0x8000);
+
+	u32 i = 0;
+	if (((uintptr_t)dst & 15) == 0 && ((uintptr_t)src & 15) == 0) {
+		const u32 simdable = (numPixels / 8) * 8;
+		for (; i < simdable; i += 8) {
+			const uint32x4_t c1 = vld1q_u32(src + i);
+			const uint32x4_t c2 = vld1q_u32(src + i + 4);
+
+			uint32x4_t v1 = vandq_u32(vshrq_n_u32(c1, 19), maskR);
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 6), maskG));
+			v1 = vorrq_u32(v1, vandq_u32(vshlq_n_u32(c1, 7), maskB));
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 16), maskA));
+
+			uint32x4_t v2 = vandq_u32(vshrq_n_u32(c2, 19), maskR);
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 6), maskG));
+			v2 = vorrq_u32(v2, vandq_u32(vshlq_n_u32(c2, 7), maskB));
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 16), maskA));
+
+			vst1q_u16(dst + i, vcombine_u16(vmovn_u32(v1), vmovn_u32(v2)));
+		}
+	}
 #else
 	u32 i = 0;
 #endif
@@ -183,7 +235,63 @@ void ConvertBGRA8888ToRGBA5551(u16 *dst, const u32 *src, u32 numPixels) {
 }
 
 void ConvertBGRA8888ToRGB565(u16 *dst, const u32 *src, u32 numPixels) {
-	for (u32 i = 0; i < numPixels; i++) {
+#ifdef _M_SSE
+	const __m128i maskR = _mm_set1_epi32(0x001F);
+	const __m128i maskG = _mm_set1_epi32(0x07E0);
+	const __m128i maskB = _mm_set1_epi32(0xF800);
+
+	const __m128i *srcp = (const __m128i *)src;
+	__m128i *dstp = (__m128i *)dst;
+	u32 sseChunks = (numPixels / 4) & ~1;
+	if (((intptr_t)src & 0xF) || ((intptr_t)dst & 0xF)) {
+		sseChunks = 0;
+	}
+	for (u32 i = 0; i < sseChunks; i += 2) {
+		const __m128i c1 = _mm_load_si128(&srcp[i + 0]);
+		const __m128i c2 = _mm_load_si128(&srcp[i + 1]);
+
+		__m128i v1 = _mm_and_si128(_mm_srli_epi32(c1, 19), maskR);
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_srli_epi32(c1, 5), maskG));
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_slli_epi32(c1, 8), maskB));
+
+		__m128i v2 = _mm_and_si128(_mm_srli_epi32(c2, 19), maskR);
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_srli_epi32(c2, 5), maskG));
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_slli_epi32(c2, 8), maskB));
+
+		// Sign-extending pack - exact for 16-bit values, unlike packus this needs no SSE4.
+		v1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+		v2 = _mm_srai_epi32(_mm_slli_epi32(v2, 16), 16);
+		_mm_store_si128(&dstp[i / 2], _mm_packs_epi32(v1, v2));
+	}
+	// The remainder starts right after those done via SSE.
+	u32 i = sseChunks * 4;
+#elif PPSSPP_ARCH(ARM_NEON)
+	const uint32x4_t maskR = vdupq_n_u32(0x001F);
+	const uint32x4_t maskG = vdupq_n_u32(0x07E0);
+	const uint32x4_t maskB = vdupq_n_u32(0xF800);
+
+	u32 i = 0;
+	if (((uintptr_t)dst & 15) == 0 && ((uintptr_t)src & 15) == 0) {
+		const u32 simdable = (numPixels / 8) * 8;
+		for (; i < simdable; i += 8) {
+			const uint32x4_t c1 = vld1q_u32(src + i);
+			const uint32x4_t c2 = vld1q_u32(src + i + 4);
+
+			uint32x4_t v1 = vandq_u32(vshrq_n_u32(c1, 19), maskR);
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 5), maskG));
+			v1 = vorrq_u32(v1, vandq_u32(vshlq_n_u32(c1, 8), maskB));
+
+			uint32x4_t v2 = vandq_u32(vshrq_n_u32(c2, 19), maskR);
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 5), maskG));
+			v2 = vorrq_u32(v2, vandq_u32(vshlq_n_u32(c2, 8), maskB));
+
+			vst1q_u16(dst + i, vcombine_u16(vmovn_u32(v1), vmovn_u32(v2)));
+		}
+	}
+#else
+	u32 i = 0;
+#endif
+	for (; i < numPixels; i++) {
 		dst[i] = BGRA8888toRGB565(src[i]);
 	}
 }
@@ -195,13 +303,131 @@ void ConvertBGRA8888ToRGBA4444(u16 *dst, const u32 *src, u32 numPixels) {
 }
 
 void ConvertRGBA8888ToRGB565(u16 *dst, const u32 *src, u32 numPixels) {
-	for (u32 x = 0; x < numPixels; ++x) {
+#ifdef _M_SSE
+	const __m128i maskR = _mm_set1_epi32(0x001F);
+	const __m128i maskG = _mm_set1_epi32(0x07E0);
+	const __m128i maskB = _mm_set1_epi32(0xF800);
+
+	const __m128i *srcp = (const __m128i *)src;
+	__m128i *dstp = (__m128i *)dst;
+	u32 sseChunks = (numPixels / 4) & ~1;
+	if (((intptr_t)src & 0xF) || ((intptr_t)dst & 0xF)) {
+		sseChunks = 0;
+	}
+	for (u32 i = 0; i < sseChunks; i += 2) {
+		const __m128i c1 = _mm_load_si128(&srcp[i + 0]);
+		const __m128i c2 = _mm_load_si128(&srcp[i + 1]);
+
+		__m128i v1 = _mm_and_si128(_mm_srli_epi32(c1, 3), maskR);
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_srli_epi32(c1, 5), maskG));
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_srli_epi32(c1, 8), maskB));
+
+		__m128i v2 = _mm_and_si128(_mm_srli_epi32(c2, 3), maskR);
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_srli_epi32(c2, 5), maskG));
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_srli_epi32(c2, 8), maskB));
+
+		// Sign-extending pack - exact for 16-bit values, unlike packus this needs no SSE4.
+		v1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+		v2 = _mm_srai_epi32(_mm_slli_epi32(v2, 16), 16);
+		_mm_store_si128(&dstp[i / 2], _mm_packs_epi32(v1, v2));
+	}
+	// The remainder starts right after those done via SSE.
+	u32 x = sseChunks * 4;
+#elif PPSSPP_ARCH(ARM_NEON)
+	const uint32x4_t maskR = vdupq_n_u32(0x001F);
+	const uint32x4_t maskG = vdupq_n_u32(0x07E0);
+	const uint32x4_t maskB = vdupq_n_u32(0xF800);
+
+	u32 x = 0;
+	if (((uintptr_t)dst & 15) == 0 && ((uintptr_t)src & 15) == 0) {
+		const u32 simdable = (numPixels / 8) * 8;
+		for (; x < simdable; x += 8) {
+			const uint32x4_t c1 = vld1q_u32(src + x);
+			const uint32x4_t c2 = vld1q_u32(src + x + 4);
+
+			uint32x4_t v1 = vandq_u32(vshrq_n_u32(c1, 3), maskR);
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 5), maskG));
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 8), maskB));
+
+			uint32x4_t v2 = vandq_u32(vshrq_n_u32(c2, 3), maskR);
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 5), maskG));
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 8), maskB));
+
+			vst1q_u16(dst + x, vcombine_u16(vmovn_u32(v1), vmovn_u32(v2)));
+		}
+	}
+#else
+	u32 x = 0;
+#endif
+	for (; x < numPixels; ++x) {
 		dst[x] = RGBA8888toRGB565(src[x]);
 	}
 }
 
 void ConvertRGBA8888ToRGBA4444(u16 *dst, const u32 *src, u32 numPixels) {
-	for (u32 x = 0; x < numPixels; ++x) {
+#ifdef _M_SSE
+	const __m128i maskR = _mm_set1_epi32(0x000F);
+	const __m128i maskG = _mm_set1_epi32(0x00F0);
+	const __m128i maskB = _mm_set1_epi32(0x0F00);
+	const __m128i maskA = _mm_set1_epi32(0xF000);
+
+	const __m128i *srcp = (const __m128i *)src;
+	__m128i *dstp = (__m128i *)dst;
+	u32 sseChunks = (numPixels / 4) & ~1;
+	if (((intptr_t)src & 0xF) || ((intptr_t)dst & 0xF)) {
+		sseChunks = 0;
+	}
+	for (u32 i = 0; i < sseChunks; i += 2) {
+		const __m128i c1 = _mm_load_si128(&srcp[i + 0]);
+		const __m128i c2 = _mm_load_si128(&srcp[i + 1]);
+
+		__m128i v1 = _mm_and_si128(_mm_srli_epi32(c1, 4), maskR);
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_srli_epi32(c1, 8), maskG));
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_srli_epi32(c1, 12), maskB));
+		v1 = _mm_or_si128(v1, _mm_and_si128(_mm_srli_epi32(c1, 16), maskA));
+
+		__m128i v2 = _mm_and_si128(_mm_srli_epi32(c2, 4), maskR);
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_srli_epi32(c2, 8), maskG));
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_srli_epi32(c2, 12), maskB));
+		v2 = _mm_or_si128(v2, _mm_and_si128(_mm_srli_epi32(c2, 16), maskA));
+
+		// Sign-extending pack - exact for 16-bit values, unlike packus this needs no SSE4.
+		v1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+		v2 = _mm_srai_epi32(_mm_slli_epi32(v2, 16), 16);
+		_mm_store_si128(&dstp[i / 2], _mm_packs_epi32(v1, v2));
+	}
+	// The remainder starts right after those done via SSE.
+	u32 x = sseChunks * 4;
+#elif PPSSPP_ARCH(ARM_NEON)
+	const uint32x4_t maskR = vdupq_n_u32(0x000F);
+	const uint32x4_t maskG = vdupq_n_u32(0x00F0);
+	const uint32x4_t maskB = vdupq_n_u32(0x0F00);
+	const uint32x4_t maskA = vdupq_n_u32(0xF000);
+
+	u32 x = 0;
+	if (((uintptr_t)dst & 15) == 0 && ((uintptr_t)src & 15) == 0) {
+		const u32 simdable = (numPixels / 8) * 8;
+		for (; x < simdable; x += 8) {
+			const uint32x4_t c1 = vld1q_u32(src + x);
+			const uint32x4_t c2 = vld1q_u32(src + x + 4);
+
+			uint32x4_t v1 = vandq_u32(vshrq_n_u32(c1, 4), maskR);
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 8), maskG));
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 12), maskB));
+			v1 = vorrq_u32(v1, vandq_u32(vshrq_n_u32(c1, 16), maskA));
+
+			uint32x4_t v2 = vandq_u32(vshrq_n_u32(c2, 4), maskR);
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 8), maskG));
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 12), maskB));
+			v2 = vorrq_u32(v2, vandq_u32(vshrq_n_u32(c2, 16), maskA));
+
+			vst1q_u16(dst + x, vcombine_u16(vmovn_u32(v1), vmovn_u32(v2)));
+		}
+	}
+#else
+	u32 x = 0;
+#endif
+	for (; x < numPixels; ++x) {
 		dst[x] = RGBA8888toRGBA4444(src[x]);
 	}
 }
@@ -252,6 +478,23 @@ void ConvertRGB565ToRGBA8888(u32 *dst32, const u16 *src, u32 numPixels) {
 		_mm_store_si128(&dstp[i * 2 + 1], _mm_unpackhi_epi16(rg, ba));
 	}
 	u32 i = sseChunks * 8;
+#elif PPSSPP_ARCH(ARM_NEON)
+	u32 i = (numPixels / 8) * 8;
+	for (u32 x = 0; x < i; x += 8) {
+		const uint16x8_t c = vld1q_u16(src + x);
+
+		// Expand 5 to 8 bits via (x << 3) | (x >> 2), 6 to 8 via (x << 2) | (x >> 4).
+		const uint16x8_t r5 = vandq_u16(c, vdupq_n_u16(0x1F));
+		const uint16x8_t g6 = vandq_u16(vshrq_n_u16(c, 5), vdupq_n_u16(0x3F));
+		const uint16x8_t b5 = vshrq_n_u16(c, 11);
+
+		uint8x8x4_t rgba;
+		rgba.val[0] = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+		rgba.val[1] = vmovn_u16(vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4)));
+		rgba.val[2] = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+		rgba.val[3] = vdup_n_u8(0xFF);
+		vst4_u8((u8 *)(dst32 + x), rgba);
+	}
 #else
 	u32 i = 0;
 #endif
@@ -306,6 +549,24 @@ void ConvertRGBA5551ToRGBA8888(u32 *dst32, const u16 *src, u32 numPixels) {
 		_mm_store_si128(&dstp[i * 2 + 1], _mm_unpackhi_epi16(rg, ba));
 	}
 	u32 i = sseChunks * 8;
+#elif PPSSPP_ARCH(ARM_NEON)
+	u32 i = (numPixels / 8) * 8;
+	for (u32 x = 0; x < i; x += 8) {
+		const uint16x8_t c = vld1q_u16(src + x);
+
+		const uint16x8_t r5 = vandq_u16(c, vdupq_n_u16(0x1F));
+		const uint16x8_t g5 = vandq_u16(vshrq_n_u16(c, 5), vdupq_n_u16(0x1F));
+		const uint16x8_t b5 = vandq_u16(vshrq_n_u16(c, 10), vdupq_n_u16(0x1F));
+		// Arithmetic shift smears the top bit into 0x0000/0xFFFF.
+		const uint16x8_t a = vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(c), 15));
+
+		uint8x8x4_t rgba;
+		rgba.val[0] = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+		rgba.val[1] = vmovn_u16(vorrq_u16(vshlq_n_u16(g5, 3), vshrq_n_u16(g5, 2)));
+		rgba.val[2] = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+		rgba.val[3] = vmovn_u16(a);
+		vst4_u8((u8 *)(dst32 + x), rgba);
+	}
 #else
 	u32 i = 0;
 #endif
@@ -355,6 +616,24 @@ void ConvertRGBA4444ToRGBA8888(u32 *dst32, const u16 *src, u32 numPixels) {
 		_mm_store_si128(&dstp[i * 2 + 1], _mm_unpackhi_epi16(rg, ba));
 	}
 	u32 i = sseChunks * 8;
+#elif PPSSPP_ARCH(ARM_NEON)
+	u32 i = (numPixels / 8) * 8;
+	for (u32 x = 0; x < i; x += 8) {
+		const uint16x8_t c = vld1q_u16(src + x);
+
+		const uint16x8_t r4 = vandq_u16(c, vdupq_n_u16(0x0F));
+		const uint16x8_t g4 = vandq_u16(vshrq_n_u16(c, 4), vdupq_n_u16(0x0F));
+		const uint16x8_t b4 = vandq_u16(vshrq_n_u16(c, 8), vdupq_n_u16(0x0F));
+		const uint16x8_t a4 = vshrq_n_u16(c, 12);
+
+		// Expand 4 to 8 bits by replicating the nibble.
+		uint8x8x4_t rgba;
+		rgba.val[0] = vmovn_u16(vorrq_u16(vshlq_n_u16(r4, 4), r4));
+		rgba.val[1] = vmovn_u16(vorrq_u16(vshlq_n_u16(g4, 4), g4));
+		rgba.val[2] = vmovn_u16(vorrq_u16(vshlq_n_u16(b4, 4), b4));
+		rgba.val[3] = vmovn_u16(vorrq_u16(vshlq_n_u16(a4, 4), a4));
+		vst4_u8((u8 *)(dst32 + x), rgba);
+	}
 #else
 	u32 i = 0;
 #endif
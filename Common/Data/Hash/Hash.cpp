@@ -1,6 +1,18 @@
 #include <cstdint>
+#include <cstring>
+
+#include "ppsspp_config.h"
+#include "Common/CPUDetect.h"
 #include "Common/Data/Hash/Hash.h"
 
+#if PPSSPP_ARCH(ARM64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <arm_acle.h>
+#endif
+#endif
+
 namespace hash {
 
 // Implementation from Wikipedia
@@ -34,4 +46,75 @@ uint32_t Adler32(const uint8_t *data, size_t len) {
 	return (b << 16) | a;
 }
 
+#if PPSSPP_ARCH(ARM64)
+
+#if !defined(_MSC_VER)
+__attribute__((target("+crc")))
+#endif
+static uint32_t Crc32HW(uint32_t crc, const uint8_t *data, size_t len) {
+	crc = ~crc;
+	while (len >= 8) {
+		uint64_t chunk;
+		memcpy(&chunk, data, 8);
+		crc = __crc32d(crc, chunk);
+		data += 8;
+		len -= 8;
+	}
+	while (len--) {
+		crc = __crc32b(crc, *data++);
+	}
+	return ~crc;
+}
+
+#endif
+
+// Slice-by-8, processes one 8-byte chunk per iteration through eight tables.
+struct Crc32Tables {
+	uint32_t t[8][256];
+	Crc32Tables() {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t crc = i;
+			for (int j = 0; j < 8; j++) {
+				crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+			}
+			t[0][i] = crc;
+		}
+		for (uint32_t i = 0; i < 256; i++) {
+			for (int j = 1; j < 8; j++) {
+				t[j][i] = (t[j - 1][i] >> 8) ^ t[0][t[j - 1][i] & 0xFF];
+			}
+		}
+	}
+};
+
+static uint32_t Crc32Soft(uint32_t crc, const uint8_t *data, size_t len) {
+	static const Crc32Tables tables;
+	const uint32_t (&t)[8][256] = tables.t;
+
+	crc = ~crc;
+	while (len >= 8) {
+		uint32_t lo, hi;
+		memcpy(&lo, data, 4);
+		memcpy(&hi, data + 4, 4);
+		lo ^= crc;
+		crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+			t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+		data += 8;
+		len -= 8;
+	}
+	while (len--) {
+		crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+	}
+	return ~crc;
+}
+
+uint32_t Crc32(uint32_t crc, const uint8_t *data, size_t len) {
+#if PPSSPP_ARCH(ARM64)
+	if (cpu_info.bCRC32) {
+		return Crc32HW(crc, data, len);
+	}
+#endif
+	return Crc32Soft(crc, data, len);
+}
+
 }  // namespace hash
@@ -7,5 +7,11 @@ namespace hash {
 // Fairly decent function for hashing strings.
 uint32_t Adler32(const uint8_t *data, size_t len);
 
+// Zlib-compatible CRC-32 (reflected polynomial 0xEDB88320). Pass 0 as the initial crc,
+// chain by passing the previous result. Uses the ARMv8 CRC32 instructions when the CPU
+// has them (same polynomial), otherwise a slice-by-8 table implementation. The x86 CRC32
+// instruction computes CRC-32C (a different polynomial) so it's of no use here.
+uint32_t Crc32(uint32_t crc, const uint8_t *data, size_t len);
+
 }  // namespace hash
 
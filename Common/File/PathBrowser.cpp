@@ -134,7 +134,23 @@ void PathBrowser::RestrictToRoot(const Path &root) {
 	restrictedRoot_ = root;
 }
 
-void PathBrowser::HandlePath() {
+// How long a cached listing may be served without revalidation having completed.
+// Short, since directories do change - this mostly papers over the multi-second
+// round trips of network storage while navigating back and forth.
+static const double LISTING_CACHE_TTL = 10.0;
+
+void PathBrowser::TrimListingCacheLocked() {
+	while (listingCache_.size() > 20) {
+		auto oldest = listingCache_.begin();
+		for (auto iter = listingCache_.begin(); iter != listingCache_.end(); ++iter) {
+			if (iter->second.time < oldest->second.time)
+				oldest = iter;
+		}
+		listingCache_.erase(oldest);
+	}
+}
+
+void PathBrowser::HandlePath(bool useCache) {
 	if (!path_.empty() && path_.ToString()[0] == '!') {
 		if (pendingActive_)
 			ResetPending();
@@ -145,9 +161,24 @@ void PathBrowser::HandlePath() {
 	std::lock_guard<std::mutex> guard(pendingLock_);
 	ready_ = false;
 	pendingActive_ = true;
-	pendingCancel_ = false;
+	// Abort any listing that's still in flight for a path we've left. The worker
+	// clears this again when it picks up the new path.
+	pendingCancel_ = true;
 	pendingFiles_.clear();
 	pendingPath_ = path_;
+
+	auto cached = listingCache_.find(path_.ToString());
+	if (cached != listingCache_.end()) {
+		if (useCache && time_now_d() - cached->second.time < LISTING_CACHE_TTL) {
+			// Show the recent listing immediately, and let the worker revalidate it
+			// in the background - GetListingGeneration() ticks when that lands.
+			pendingFiles_ = cached->second.files;
+			success_ = true;
+			ready_ = true;
+		} else {
+			listingCache_.erase(cached);
+		}
+	}
 	pendingCond_.notify_all();
 
 	if (pendingThread_.joinable())
@@ -169,6 +200,7 @@ void PathBrowser::HandlePath() {
 				break;
 			}
 			lastPath = pendingPath_;
+			pendingCancel_ = false;
 			if (lastPath.Type() == PathType::HTTP) {
 				guard.unlock();
 				results.clear();
@@ -187,9 +219,17 @@ void PathBrowser::HandlePath() {
 				guard.lock();
 			}
 
+			if (success_ && !pendingCancel_ && !lastPath.empty()) {
+				// Cache the result even if the user has already navigated away -
+				// coming back shortly is common.
+				listingCache_[lastPath.ToString()] = CachedListing{ results, time_now_d() };
+				TrimListingCacheLocked();
+			}
+
 			if (pendingPath_ == lastPath) {
 				if (success_ && !pendingCancel_) {
 					pendingFiles_ = results;
+					listingGeneration_++;
 				}
 				pendingPath_.clear();
 				lastPath.clear();
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <string>
 #include <cstring>
@@ -21,11 +23,17 @@ public:
 
 	void SetPath(const Path &path);
 	void Refresh() {
-		HandlePath();
+		// The user asked for it, so don't serve anything stale.
+		HandlePath(false);
 	}
 	bool IsListingReady() const {
 		return ready_;
 	}
+	// Bumped every time a completed listing lands in pendingFiles_. Lets the UI
+	// notice when a background revalidation of a cached listing brings new data.
+	int GetListingGeneration() const {
+		return listingGeneration_;
+	}
 	bool GetListing(std::vector<File::FileInfo> &fileInfo, const char *filter = nullptr, bool *cancel = nullptr);
 
 	bool CanNavigateUp();
@@ -54,9 +62,17 @@ public:
 	}
 
 private:
-	void HandlePath();
+	void HandlePath(bool useCache = true);
 	void ResetPending();
 	void ApplyRestriction();
+	void TrimListingCacheLocked();
+
+	// Recently completed listings, so navigating back and forth doesn't hit slow
+	// (network) storage again every time. Guarded by pendingLock_.
+	struct CachedListing {
+		std::vector<File::FileInfo> files;
+		double time;
+	};
 
 	Path path_;
 	Path pendingPath_;
@@ -65,6 +81,8 @@ private:
 	std::string aliasDisplay_;
 	Path aliasMatch_;
 	std::vector<File::FileInfo> pendingFiles_;
+	std::map<std::string, CachedListing> listingCache_;
+	std::atomic<int> listingGeneration_{};
 	std::condition_variable pendingCond_;
 	std::mutex pendingLock_;
 	std::thread pendingThread_;
@@ -1,3 +1,5 @@
+#include "ppsspp_config.h"
+
 #include <algorithm>
 #include <ctype.h>
 #include <set>
@@ -10,25 +12,125 @@
 #include "ext/libzip/zip.h"
 #endif
 
+#if PPSSPP_PLATFORM(WINDOWS)
+#include "Common/CommonWindows.h"
+#elif !PPSSPP_PLATFORM(SWITCH)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "Common/Common.h"
 #include "Common/Log.h"
 #include "Common/File/VFS/ZipFileReader.h"
 #include "Common/StringUtils.h"
 
+// Maps the whole archive read-only, if the platform allows. A file-backed read-only
+// mapping is what lets multiple PPSSPP instances (adhoc multiplayer setups) share one
+// copy of big texture packs and the asset zip: every process mapping the same file
+// shares the clean page-cache pages, where private read buffers get duplicated per
+// instance. Returns nullptr when mapping isn't possible - callers fall back to plain
+// libzip file I/O.
+static const uint8_t *MapZipFile(const Path &zipFile, size_t *mappedSize) {
+#if !PPSSPP_ARCH(64BIT) || defined(HAVE_LIBRETRO_VFS) || PPSSPP_PLATFORM(SWITCH) || PPSSPP_PLATFORM(UWP)
+	// Big texture packs don't reliably fit in a 32-bit address space.
+	return nullptr;
+#elif PPSSPP_PLATFORM(WINDOWS)
+	HANDLE file = CreateFile(zipFile.ToWString().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		CloseHandle(file);
+		return nullptr;
+	}
+	HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	const uint8_t *view = nullptr;
+	if (mapping) {
+		view = (const uint8_t *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		// The view holds its own reference to the mapping object.
+		CloseHandle(mapping);
+	}
+	CloseHandle(file);
+	if (view)
+		*mappedSize = (size_t)size.QuadPart;
+	return view;
+#else
+	int fd;
+	if (zipFile.Type() == PathType::CONTENT_URI) {
+		fd = File::OpenFD(zipFile, File::OPEN_READ);
+		if (fd <= 0)
+			return nullptr;
+	} else {
+		fd = open(zipFile.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return nullptr;
+	}
+	struct stat st{};
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return nullptr;
+	}
+	void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	// The mapping keeps the file alive.
+	close(fd);
+	if (map == MAP_FAILED)
+		return nullptr;
+	*mappedSize = (size_t)st.st_size;
+	return (const uint8_t *)map;
+#endif
+}
+
+static void UnmapZipFile(const uint8_t *mapped, size_t mappedSize) {
+#if !PPSSPP_ARCH(64BIT) || defined(HAVE_LIBRETRO_VFS) || PPSSPP_PLATFORM(SWITCH) || PPSSPP_PLATFORM(UWP)
+	// Never mapped.
+#elif PPSSPP_PLATFORM(WINDOWS)
+	UnmapViewOfFile((void *)mapped);
+#else
+	munmap((void *)mapped, mappedSize);
+#endif
+}
+
 ZipFileReader *ZipFileReader::Create(const Path &zipFile, const char *inZipPath, bool logErrors) {
 	int error = 0;
-	zip *zip_file;
-	if (zipFile.Type() == PathType::CONTENT_URI) {
-		int fd = File::OpenFD(zipFile, File::OPEN_READ);
-		if (!fd) {
-			if (logErrors) {
-				ERROR_LOG(Log::IO, "Failed to open FD for '%s' as zip file", zipFile.c_str());
+	zip *zip_file = nullptr;
+
+	size_t mappedSize = 0;
+	const uint8_t *mapped = MapZipFile(zipFile, &mappedSize);
+	if (mapped) {
+		zip_error_t zipError;
+		zip_error_init(&zipError);
+		zip_source_t *source = zip_source_buffer_create(mapped, mappedSize, 0, &zipError);
+		if (source) {
+			zip_file = zip_open_from_source(source, ZIP_RDONLY, &zipError);
+			if (!zip_file) {
+				zip_source_free(source);
 			}
-			return nullptr;
 		}
-		zip_file = zip_fdopen(fd, 0, &error);
-	} else {
-		zip_file = zip_open(zipFile.c_str(), 0, &error);
+		zip_error_fini(&zipError);
+		if (!zip_file) {
+			// Corrupt archive, most likely. Let the plain I/O path have a go at it
+			// (and produce the error if it also fails).
+			UnmapZipFile(mapped, mappedSize);
+			mapped = nullptr;
+			mappedSize = 0;
+		}
+	}
+
+	if (!zip_file) {
+		if (zipFile.Type() == PathType::CONTENT_URI) {
+			int fd = File::OpenFD(zipFile, File::OPEN_READ);
+			if (!fd) {
+				if (logErrors) {
+					ERROR_LOG(Log::IO, "Failed to open FD for '%s' as zip file", zipFile.c_str());
+				}
+				return nullptr;
+			}
+			zip_file = zip_fdopen(fd, 0, &error);
+		} else {
+			zip_file = zip_open(zipFile.c_str(), 0, &error);
+		}
 	}
 
 	if (!zip_file) {
@@ -44,32 +146,171 @@ ZipFileReader *ZipFileReader::Create(const Path &zipFile, const char *inZipPath,
 	if (!path.empty() && path.back() != '/') {
 		path.push_back('/');
 	}
-	return new ZipFileReader(zip_file, path);
+	ZipFileReader *reader = new ZipFileReader(zip_file, path);
+	reader->mapped_ = mapped;
+	reader->mappedSize_ = mappedSize;
+	reader->BuildIndex();
+	if (mapped) {
+		reader->ResolveMappedPointers();
+	}
+	return reader;
+}
+
+static inline uint16_t ReadLE16(const uint8_t *p) {
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t ReadLE32(const uint8_t *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Walks the central directory of the mapped archive and, for every stored
+// (uncompressed) entry, records a pointer directly to its data in the mapping.
+// Asset zips deliberately store most files uncompressed (Android requires it for
+// mmap-able APK assets anyway), so this turns the bulk of startup asset reads
+// into plain memcpys with no libzip call and no lock.
+//
+// Anything we can't resolve - compressed entries, zip64 fields, short or
+// malformed records - just keeps a null pointer and takes the libzip path.
+void ZipFileReader::ResolveMappedPointers() {
+	// Find the end-of-central-directory record. It's at the very end except for
+	// the variable-length comment, so scan back over the largest possible one.
+	if (mappedSize_ < 22)
+		return;
+	const size_t maxScan = std::min(mappedSize_ - 21, (size_t)65536 + 1);
+	const uint8_t *eocd = nullptr;
+	for (size_t back = 0; back < maxScan; back++) {
+		const uint8_t *p = mapped_ + mappedSize_ - 22 - back;
+		if (ReadLE32(p) == 0x06054b50) {
+			eocd = p;
+			break;
+		}
+	}
+	if (!eocd)
+		return;
+	uint32_t numEntries = ReadLE16(eocd + 10);
+	uint32_t cdOffset = ReadLE32(eocd + 16);
+	if (numEntries == 0xFFFF || cdOffset == 0xFFFFFFFF) {
+		// Zip64. Asset zips never get close to these limits.
+		return;
+	}
+
+	// libzip indexes entries in central directory order, so position in this walk
+	// matches IndexEntry::zi.
+	std::vector<const uint8_t *> dataByZipIndex(numEntries, nullptr);
+	size_t pos = cdOffset;
+	for (uint32_t i = 0; i < numEntries; i++) {
+		if (pos + 46 > mappedSize_ || ReadLE32(mapped_ + pos) != 0x02014b50)
+			return;
+		const uint8_t *cd = mapped_ + pos;
+		uint16_t method = ReadLE16(cd + 10);
+		uint32_t compSize = ReadLE32(cd + 20);
+		uint32_t uncompSize = ReadLE32(cd + 24);
+		uint16_t nameLen = ReadLE16(cd + 28);
+		uint16_t extraLen = ReadLE16(cd + 30);
+		uint16_t commentLen = ReadLE16(cd + 32);
+		uint32_t localOffset = ReadLE32(cd + 42);
+		pos += 46 + nameLen + extraLen + commentLen;
+
+		if (method != 0 || compSize != uncompSize || localOffset == 0xFFFFFFFF)
+			continue;
+		// The local header repeats the name/extra lengths and the extra field can
+		// differ from the central one, so read them from the local copy.
+		if ((size_t)localOffset + 30 > mappedSize_ || ReadLE32(mapped_ + localOffset) != 0x04034b50)
+			continue;
+		uint16_t localNameLen = ReadLE16(mapped_ + localOffset + 26);
+		uint16_t localExtraLen = ReadLE16(mapped_ + localOffset + 28);
+		size_t dataOffset = (size_t)localOffset + 30 + localNameLen + localExtraLen;
+		if (dataOffset + uncompSize > mappedSize_)
+			continue;
+		dataByZipIndex[i] = mapped_ + dataOffset;
+	}
+
+	for (IndexEntry &entry : index_) {
+		if (entry.zi >= 0 && (size_t)entry.zi < dataByZipIndex.size()) {
+			entry.mappedData = dataByZipIndex[entry.zi];
+		}
+	}
+}
+
+static std::string LowerASCII(const char *name) {
+	std::string lowered = name;
+	for (auto &c : lowered) {
+		c = tolower((uint8_t)c);
+	}
+	return lowered;
+}
+
+void ZipFileReader::BuildIndex() {
+	int numFiles = zip_get_num_files(zip_file_);
+	index_.reserve(numFiles);
+	for (int i = 0; i < numFiles; i++) {
+		zip_stat_t zstat;
+		if (zip_stat_index(zip_file_, i, 0, &zstat) != 0)
+			continue;
+		if (!(zstat.valid & ZIP_STAT_NAME) || !zstat.name)
+			continue;
+		IndexEntry entry;
+		entry.nameLowered = LowerASCII(zstat.name);
+		entry.name = zstat.name;
+		entry.size = (zstat.valid & ZIP_STAT_SIZE) ? zstat.size : 0;
+		entry.zi = i;
+		index_.push_back(std::move(entry));
+	}
+	std::sort(index_.begin(), index_.end(), [](const IndexEntry &a, const IndexEntry &b) {
+		return a.nameLowered < b.nameLowered;
+	});
+}
+
+const ZipFileReader::IndexEntry *ZipFileReader::FindEntry(const char *path) const {
+	std::string needle = LowerASCII(path);
+	auto iter = std::lower_bound(index_.begin(), index_.end(), needle, [](const IndexEntry &entry, const std::string &name) {
+		return entry.nameLowered < name;
+	});
+	if (iter == index_.end() || iter->nameLowered != needle)
+		return nullptr;
+	return &*iter;
 }
 
 ZipFileReader::~ZipFileReader() {
 	std::lock_guard<std::mutex> guard(lock_);
 	zip_close(zip_file_);
+	if (mapped_) {
+		UnmapZipFile(mapped_, mappedSize_);
+	}
 }
 
 uint8_t *ZipFileReader::ReadFile(const char *path, size_t *size) {
 	std::string temp_path = inZipPath_ + path;
 
+	const IndexEntry *entry = FindEntry(temp_path.c_str());
+	if (!entry) {
+		ERROR_LOG(Log::IO, "Error opening %s from ZIP", temp_path.c_str());
+		return 0;
+	}
+
+	if (entry->mappedData) {
+		// Stored entry in a mapped archive - copy straight out of the mapping,
+		// no libzip and no lock.
+		uint8_t *contents = new uint8_t[entry->size + 1];
+		memcpy(contents, entry->mappedData, entry->size);
+		contents[entry->size] = 0;
+		*size = entry->size;
+		return contents;
+	}
+
 	std::lock_guard<std::mutex> guard(lock_);
-	// Figure out the file size first.
-	struct zip_stat zstat;
-	zip_stat(zip_file_, temp_path.c_str(), ZIP_FL_NOCASE | ZIP_FL_UNCHANGED, &zstat);
-	zip_file *file = zip_fopen(zip_file_, temp_path.c_str(), ZIP_FL_NOCASE | ZIP_FL_UNCHANGED);
+	zip_file *file = zip_fopen_index(zip_file_, entry->zi, ZIP_FL_UNCHANGED);
 	if (!file) {
 		ERROR_LOG(Log::IO, "Error opening %s from ZIP", temp_path.c_str());
 		return 0;
 	}
-	uint8_t *contents = new uint8_t[zstat.size + 1];
-	zip_fread(file, contents, zstat.size);
+	uint8_t *contents = new uint8_t[entry->size + 1];
+	zip_fread(file, contents, entry->size);
 	zip_fclose(file);
-	contents[zstat.size] = 0;
+	contents[entry->size] = 0;
 
-	*size = zstat.size;
+	*size = entry->size;
 	return contents;
 }
 
@@ -150,13 +391,10 @@ bool ZipFileReader::GetFileListing(const char *orig_path, std::vector<File::File
 bool ZipFileReader::GetZipListings(const std::string &path, std::set<std::string> &files, std::set<std::string> &directories) {
 	_dbg_assert_(path.empty() || path.back() == '/');
 
-	std::lock_guard<std::mutex> guard(lock_);
-	int numFiles = zip_get_num_files(zip_file_);
+	// No lock needed - the index is immutable after creation.
 	bool anyPrefixMatched = false;
-	for (int i = 0; i < numFiles; i++) {
-		const char* name = zip_get_name(zip_file_, i, 0);
-		if (!name)
-			continue;  // shouldn't happen, I think
+	for (const IndexEntry &entry : index_) {
+		const char *name = entry.name.c_str();
 		if (startsWith(name, path)) {
 			if (strlen(name) == path.size()) {
 				// Don't want to return the same folder.
@@ -182,7 +420,6 @@ bool ZipFileReader::GetZipListings(const std::string &path, std::set<std::string
 }
 
 bool ZipFileReader::GetFileInfo(const char *path, File::FileInfo *info) {
-	struct zip_stat zstat;
 	std::string temp_path = inZipPath_ + path;
 
 	// Clear some things to start.
@@ -190,23 +427,19 @@ bool ZipFileReader::GetFileInfo(const char *path, File::FileInfo *info) {
 	info->isWritable = false;
 	info->size = 0;
 
-	{
-		std::lock_guard<std::mutex> guard(lock_);
-		if (0 != zip_stat(zip_file_, temp_path.c_str(), ZIP_FL_NOCASE | ZIP_FL_UNCHANGED, &zstat)) {
-			// ZIP files do not have real directories, so we'll end up here if we
-			// try to stat one. For now that's fine.
-			info->exists = false;
-			return false;
-		}
+	const IndexEntry *entry = FindEntry(temp_path.c_str());
+	if (!entry) {
+		// ZIP files do not have real directories, so we'll end up here if we
+		// try to stat one. For now that's fine.
+		info->exists = false;
+		return false;
 	}
 
 	// Zips usually don't contain directory entries, but they may.
-	if ((zstat.valid & ZIP_STAT_NAME) != 0 && zstat.name) {
-		info->isDirectory = zstat.name[strlen(zstat.name) - 1] == '/';
-	}
-	if ((zstat.valid & ZIP_STAT_SIZE) != 0) {
-		info->size = zstat.size;
+	if (!entry->name.empty()) {
+		info->isDirectory = entry->name.back() == '/';
 	}
+	info->size = entry->size;
 
 	info->fullName = Path(path);
 	info->exists = true;
@@ -216,6 +449,8 @@ bool ZipFileReader::GetFileInfo(const char *path, File::FileInfo *info) {
 class ZipFileReaderFileReference : public VFSFileReference {
 public:
 	int zi;
+	uint64_t size;
+	const uint8_t *mappedData = nullptr;
 };
 
 class ZipFileReaderOpenFile : public VFSOpenFile {
@@ -226,33 +461,32 @@ public:
 	}
 	ZipFileReaderFileReference *reference;
 	zip_file_t *zf = nullptr;
+	// Read position when serving directly from the mapping (zf stays null,
+	// and the reader's lock isn't held).
+	uint64_t mappedPos = 0;
 };
 
 VFSFileReference *ZipFileReader::GetFile(const char *path) {
-	std::lock_guard<std::mutex> guard(lock_);
-	int zi = zip_name_locate(zip_file_, path, ZIP_FL_NOCASE);
-	if (zi < 0) {
+	// Binary search in the index - no lock or zip access needed.
+	const IndexEntry *entry = FindEntry(path);
+	if (!entry) {
 		// Not found.
 		return nullptr;
 	}
 	ZipFileReaderFileReference *ref = new ZipFileReaderFileReference();
-	ref->zi = zi;
+	ref->zi = entry->zi;
+	ref->size = entry->size;
+	ref->mappedData = entry->mappedData;
 	return ref;
 }
 
 bool ZipFileReader::GetFileInfo(VFSFileReference *vfsReference, File::FileInfo *fileInfo) {
 	ZipFileReaderFileReference *reference = (ZipFileReaderFileReference *)vfsReference;
-	// If you crash here, you called this while having the lock held by having the file open.
-	// Don't do that, check the info before you open the file.
-	std::lock_guard<std::mutex> guard(lock_);
-	zip_stat_t zstat;
-	if (zip_stat_index(zip_file_, reference->zi, 0, &zstat) != 0)
-		return false;
+	// The size was captured at GetFile() time, so this is safe to call even while
+	// the file is open (and the lock is held).
 	*fileInfo = File::FileInfo{};
-	fileInfo->size = 0;
-	if (zstat.valid & ZIP_STAT_SIZE)
-		fileInfo->size = zstat.size;
-	return zstat.size;
+	fileInfo->size = reference->size;
+	return reference->size != 0;
 }
 
 void ZipFileReader::ReleaseFile(VFSFileReference *vfsReference) {
@@ -265,17 +499,16 @@ VFSOpenFile *ZipFileReader::OpenFileForRead(VFSFileReference *vfsReference, size
 	ZipFileReaderFileReference *reference = (ZipFileReaderFileReference *)vfsReference;
 	ZipFileReaderOpenFile *openFile = new ZipFileReaderOpenFile();
 	openFile->reference = reference;
+	if (reference->mappedData) {
+		// Served directly from the mapping - any number of these can be open at
+		// once, since they don't touch libzip state.
+		*size = reference->size;
+		return openFile;
+	}
 	*size = 0;
 	// We only allow one file to be open for read concurrently. It's possible that this can be improved,
 	// especially if we only access by index like this.
 	lock_.lock();
-	zip_stat_t zstat;
-	if (zip_stat_index(zip_file_, reference->zi, 0, &zstat) != 0) {
-		lock_.unlock();
-		delete openFile;
-		return nullptr;
-	}
-
 	openFile->zf = zip_fopen_index(zip_file_, reference->zi, 0);
 	if (!openFile->zf) {
 		WARN_LOG(Log::G3D, "File with index %d not found in zip", reference->zi);
@@ -284,7 +517,7 @@ VFSOpenFile *ZipFileReader::OpenFileForRead(VFSFileReference *vfsReference, size
 		return nullptr;
 	}
 
-	*size = zstat.size;
+	*size = reference->size;
 	// Intentionally leaving the mutex locked, will be closed in CloseFile.
 	return openFile;
 }
@@ -292,6 +525,10 @@ VFSOpenFile *ZipFileReader::OpenFileForRead(VFSFileReference *vfsReference, size
 void ZipFileReader::Rewind(VFSOpenFile *vfsOpenFile) {
 	ZipFileReaderOpenFile *file = (ZipFileReaderOpenFile *)vfsOpenFile;
 	_assert_(file);
+	if (file->reference->mappedData) {
+		file->mappedPos = 0;
+		return;
+	}
 	_dbg_assert_(file->zf != nullptr);
 	zip_fseek(file->zf, 0, SEEK_SET);
 }
@@ -299,6 +536,14 @@ void ZipFileReader::Rewind(VFSOpenFile *vfsOpenFile) {
 size_t ZipFileReader::Read(VFSOpenFile *vfsOpenFile, void *buffer, size_t length) {
 	ZipFileReaderOpenFile *file = (ZipFileReaderOpenFile *)vfsOpenFile;
 	_assert_(file);
+	if (file->reference->mappedData) {
+		size_t avail = (size_t)(file->reference->size - file->mappedPos);
+		if (length > avail)
+			length = avail;
+		memcpy(buffer, file->reference->mappedData + file->mappedPos, length);
+		file->mappedPos += length;
+		return length;
+	}
 	_dbg_assert_(file->zf != nullptr);
 	return zip_fread(file->zf, buffer, length);
 }
@@ -306,6 +551,11 @@ size_t ZipFileReader::Read(VFSOpenFile *vfsOpenFile, void *buffer, size_t length
 void ZipFileReader::CloseFile(VFSOpenFile *vfsOpenFile) {
 	ZipFileReaderOpenFile *file = (ZipFileReaderOpenFile *)vfsOpenFile;
 	_assert_(file);
+	if (file->reference->mappedData) {
+		// Never took the lock or opened a zip_file.
+		delete file;
+		return;
+	}
 	_dbg_assert_(file->zf != nullptr);
 	zip_fclose(file->zf);
 	file->zf = nullptr;
@@ -6,9 +6,11 @@
 #include "ext/libzip/zip.h"
 #endif
 
+#include <cstdint>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "Common/File/VFS/VFS.h"
 #include "Common/File/FileUtil.h"
@@ -44,7 +46,32 @@ private:
 	// Path has to be either an empty string, or a string ending with a /.
 	bool GetZipListings(const std::string &path, std::set<std::string> &files, std::set<std::string> &directories);
 
+	// Flat index over the zip's central directory, built once at creation.
+	// zip_name_locate with ZIP_FL_NOCASE is a linear scan per call, which adds up
+	// badly when texture replacement opens hundreds of files. Sorted by the
+	// lowercased name so lookups are a binary search, and immutable after Create()
+	// so it can be read without taking lock_.
+	struct IndexEntry {
+		std::string nameLowered;  // sort key
+		std::string name;         // original case, for listings
+		uint64_t size;
+		int zi;
+		// For stored (uncompressed) entries in a mapped archive, points straight at
+		// the file data inside the mapping. Reads of these entries are a memcpy and
+		// don't need libzip or lock_ at all. Null for compressed entries.
+		const uint8_t *mappedData = nullptr;
+	};
+	void BuildIndex();
+	void ResolveMappedPointers();
+	const IndexEntry *FindEntry(const char *path) const;
+
 	zip *zip_file_ = nullptr;
 	std::mutex lock_;
 	std::string inZipPath_;
+	std::vector<IndexEntry> index_;
+
+	// Set when the archive was opened through a read-only file mapping instead of
+	// plain file I/O. See MapZipFile in the .cpp for why.
+	const uint8_t *mapped_ = nullptr;
+	size_t mappedSize_ = 0;
 };
@@ -11,6 +11,7 @@
 #include "Common/Data/Convert/ColorConv.h"
 #include "Common/Data/Convert/SmallDataConvert.h"
 #include "Common/Data/Encoding/Utf8.h"
+#include "Common/StringUtils.h"
 #include "Common/TimeUtil.h"
 #include "Common/Log.h"
 
@@ -142,6 +143,10 @@ public:
 
 	int GetFrameCount() override { return frameCount_; }
 
+	std::string GetGpuProfileString() const override {
+		return profileSummary_;
+	}
+
 	std::string GetInfoString(InfoField info) const override {
 		switch (info) {
 		case InfoField::APIVERSION: return "Direct3D 11";
@@ -235,11 +240,47 @@ private:
 
 	bool stencilDirty_ = true;
 
+	// Staging textures for readbacks are pooled and reused - allocating and freeing
+	// one per readback costs more than the GPU copy itself. Entries used with
+	// ReadbackMode::OLD_DATA_OK get a second texture so we can map the previous
+	// readback's copy instead of stalling on the one issued this frame.
+	struct StagingTexture {
+		ID3D11Texture2D *tex[2]{};
+		DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+		int width = 0;
+		int height = 0;
+		int lastUsedFrame = 0;
+		int flip = 0;
+	};
+	StagingTexture *GetStagingTexture(int w, int h, DXGI_FORMAT format, bool exactSize, bool doubleBuffer);
+	void TrimStagingPool();
+	std::vector<StagingTexture> stagingPool_;
+
 	// Temporaries
-	ID3D11Texture2D *packTexture_ = nullptr;
 	Buffer *upBuffer_ = nullptr;
 	Buffer *upIBuffer_ = nullptr;
 
+	// GPU timestamps for the GPU profile overlay. D3D11 queries are polled rather
+	// than collected at a known-safe point, so we keep a small ring of per-frame
+	// query batches and harvest each batch when its slot comes around again.
+	enum {
+		MAX_TIMESTAMP_QUERIES = 128,
+		NUM_PROFILE_FRAMES = 4,
+	};
+	struct ProfileFrame {
+		ID3D11Query *disjoint = nullptr;
+		ID3D11Query *timestamps[MAX_TIMESTAMP_QUERIES]{};
+		std::string names[MAX_TIMESTAMP_QUERIES];
+		int count = 0;
+		bool pending = false;
+	};
+	void ProfileTimestamp(const char *name);
+	void HarvestProfileFrame(ProfileFrame &frame);
+	ProfileFrame profileFrames_[NUM_PROFILE_FRAMES];
+	int curProfileFrame_ = 0;
+	bool profileThisFrame_ = false;
+	std::string profileSummary_;
+
 	// System info
 	D3D_FEATURE_LEVEL featureLevel_;
 	std::string adapterDesc_;
@@ -337,21 +378,6 @@ D3D11DrawContext::D3D11DrawContext(ID3D11Device *device, ID3D11DeviceContext *de
 		caps_.supportsD3D9 = false;
 	}
 
-	// Temp texture for read-back of small images. Custom textures are created on demand for larger ones.
-	// TODO: Should really benchmark if this extra complexity has any benefit.
-	D3D11_TEXTURE2D_DESC packDesc{};
-	packDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-	packDesc.BindFlags = 0;
-	packDesc.Width = 512;
-	packDesc.Height = 512;
-	packDesc.ArraySize = 1;
-	packDesc.MipLevels = 1;
-	packDesc.Usage = D3D11_USAGE_STAGING;
-	packDesc.SampleDesc.Count = 1;
-	packDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-	hr = device_->CreateTexture2D(&packDesc, nullptr, &packTexture_);
-	_assert_(SUCCEEDED(hr));
-
 	shaderLanguageDesc_.Init(HLSL_D3D11);
 
 	const size_t UP_MAX_BYTES = 65536 * 24;
@@ -370,9 +396,23 @@ D3D11DrawContext::D3D11DrawContext(ID3D11Device *device, ID3D11DeviceContext *de
 D3D11DrawContext::~D3D11DrawContext() {
 	DestroyPresets();
 
+	for (ProfileFrame &frame : profileFrames_) {
+		if (frame.disjoint)
+			frame.disjoint->Release();
+		for (ID3D11Query *query : frame.timestamps) {
+			if (query)
+				query->Release();
+		}
+	}
+
 	upBuffer_->Release();
 	upIBuffer_->Release();
-	packTexture_->Release();
+	for (StagingTexture &staging : stagingPool_) {
+		for (ID3D11Texture2D *tex : staging.tex) {
+			if (tex)
+				tex->Release();
+		}
+	}
 
 	// Release references.
 	ID3D11RenderTargetView *view = nullptr;
@@ -440,6 +480,14 @@ void D3D11DrawContext::HandleEvent(Event ev, int width, int height, void *param1
 }
 
 void D3D11DrawContext::EndFrame() {
+	if (profileThisFrame_) {
+		ProfileTimestamp("end");
+		ProfileFrame &frame = profileFrames_[curProfileFrame_];
+		context_->End(frame.disjoint);
+		frame.pending = true;
+		profileThisFrame_ = false;
+	}
+
 	// Fake a submit time.
 	frameTimeHistory_[frameCount_].firstSubmit = time_now_d();
 	curPipeline_ = nullptr;
@@ -459,6 +507,7 @@ void D3D11DrawContext::Present(PresentMode presentMode, int vblanks) {
 	curRenderTargetView_ = nullptr;
 	curDepthStencilView_ = nullptr;
 	frameCount_++;
+	TrimStagingPool();
 }
 
 void D3D11DrawContext::SetViewport(const Viewport &viewport) {
@@ -1577,11 +1626,72 @@ void D3D11DrawContext::Clear(int mask, uint32_t colorval, float depthVal, int st
 	}
 }
 
+void D3D11DrawContext::ProfileTimestamp(const char *name) {
+	ProfileFrame &frame = profileFrames_[curProfileFrame_];
+	if (frame.count >= MAX_TIMESTAMP_QUERIES)
+		return;
+	if (!frame.timestamps[frame.count]) {
+		D3D11_QUERY_DESC desc{ D3D11_QUERY_TIMESTAMP };
+		device_->CreateQuery(&desc, &frame.timestamps[frame.count]);
+		if (!frame.timestamps[frame.count])
+			return;
+	}
+	frame.names[frame.count] = name;
+	context_->End(frame.timestamps[frame.count]);
+	frame.count++;
+}
+
+void D3D11DrawContext::HarvestProfileFrame(ProfileFrame &frame) {
+	frame.pending = false;
+
+	// With several frames of latency the results are normally long done. If they
+	// somehow aren't, we drop this frame's data rather than stalling the GPU -
+	// the overlay just keeps showing the previous summary.
+	D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+	if (context_->GetData(frame.disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		return;
+	if (disjoint.Disjoint || frame.count < 2)
+		return;
+
+	uint64_t ts[MAX_TIMESTAMP_QUERIES];
+	for (int i = 0; i < frame.count; i++) {
+		if (context_->GetData(frame.timestamps[i], &ts[i], sizeof(uint64_t), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+			return;
+	}
+
+	double toMs = 1000.0 / (double)disjoint.Frequency;
+	std::string summary = StringFromFormat("GPU time this frame: %0.3f ms\n", (double)(ts[frame.count - 1] - ts[0]) * toMs);
+	for (int i = 0; i < frame.count - 1; i++) {
+		summary += StringFromFormat("%s: %0.3f ms\n", frame.names[i].c_str(), (double)(ts[i + 1] - ts[i]) * toMs);
+	}
+	profileSummary_ = summary;
+}
+
 void D3D11DrawContext::BeginFrame(DebugFlags debugFlags) {
 	FrameTimeData &frameTimeData = frameTimeHistory_.Add(frameCount_);
 	frameTimeData.afterFenceWait = time_now_d();
 	frameTimeData.frameBegin = frameTimeData.afterFenceWait;
 
+	profileThisFrame_ = debugFlags & DebugFlags::PROFILE_TIMESTAMPS;
+	if (profileThisFrame_) {
+		curProfileFrame_ = (curProfileFrame_ + 1) % NUM_PROFILE_FRAMES;
+		ProfileFrame &frame = profileFrames_[curProfileFrame_];
+		if (frame.pending)
+			HarvestProfileFrame(frame);
+		frame.count = 0;
+		if (!frame.disjoint) {
+			D3D11_QUERY_DESC desc{ D3D11_QUERY_TIMESTAMP_DISJOINT };
+			device_->CreateQuery(&desc, &frame.disjoint);
+		}
+		if (frame.disjoint) {
+			context_->Begin(frame.disjoint);
+			ProfileTimestamp("pre-pass");
+		} else {
+			// No timestamp support on this feature level.
+			profileThisFrame_ = false;
+		}
+	}
+
 	context_->OMSetRenderTargets(1, &curRenderTargetView_, curDepthStencilView_);
 
 	if (curBlend_ != nullptr) {
@@ -1665,6 +1775,84 @@ bool D3D11DrawContext::BlitFramebuffer(Framebuffer *srcfb, int srcX1, int srcY1,
 	return false;
 }
 
+D3D11DrawContext::StagingTexture *D3D11DrawContext::GetStagingTexture(int w, int h, DXGI_FORMAT format, bool exactSize, bool doubleBuffer) {
+	if (!exactSize) {
+		// Round up to a size class so readbacks of slightly different sizes share an entry.
+		w = (w + 127) & ~127;
+		h = (h + 127) & ~127;
+	}
+
+	StagingTexture *entry = nullptr;
+	for (StagingTexture &staging : stagingPool_) {
+		if (staging.format != format)
+			continue;
+		if (exactSize ? (staging.width == w && staging.height == h) : (staging.width >= w && staging.height >= h)) {
+			entry = &staging;
+			break;
+		}
+	}
+
+	if (!entry) {
+		constexpr size_t MAX_STAGING_TEXTURES = 8;
+		if (stagingPool_.size() >= MAX_STAGING_TEXTURES) {
+			size_t lru = 0;
+			for (size_t i = 1; i < stagingPool_.size(); i++) {
+				if (stagingPool_[i].lastUsedFrame < stagingPool_[lru].lastUsedFrame)
+					lru = i;
+			}
+			for (ID3D11Texture2D *tex : stagingPool_[lru].tex) {
+				if (tex)
+					tex->Release();
+			}
+			stagingPool_.erase(stagingPool_.begin() + lru);
+		}
+		StagingTexture staging;
+		staging.format = format;
+		staging.width = w;
+		staging.height = h;
+		stagingPool_.push_back(staging);
+		entry = &stagingPool_.back();
+	}
+
+	D3D11_TEXTURE2D_DESC desc{};
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+	desc.BindFlags = 0;
+	desc.Width = entry->width;
+	desc.Height = entry->height;
+	desc.ArraySize = 1;
+	desc.MipLevels = 1;
+	desc.Usage = D3D11_USAGE_STAGING;
+	desc.SampleDesc.Count = 1;
+	desc.Format = format;
+	if (!entry->tex[0]) {
+		if (FAILED(device_->CreateTexture2D(&desc, nullptr, &entry->tex[0])))
+			return nullptr;
+	}
+	// The second texture of the pair is only needed by stale-data-tolerant readbacks,
+	// so create it lazily. On failure we simply fall back to the blocking path.
+	if (doubleBuffer && !entry->tex[1]) {
+		device_->CreateTexture2D(&desc, nullptr, &entry->tex[1]);
+	}
+	entry->lastUsedFrame = frameCount_;
+	return entry;
+}
+
+void D3D11DrawContext::TrimStagingPool() {
+	// Readbacks often stop entirely when the game changes scenes - drop staging
+	// textures that haven't been touched in a while.
+	for (size_t i = 0; i < stagingPool_.size(); ) {
+		if (frameCount_ - stagingPool_[i].lastUsedFrame > 120) {
+			for (ID3D11Texture2D *tex : stagingPool_[i].tex) {
+				if (tex)
+					tex->Release();
+			}
+			stagingPool_.erase(stagingPool_.begin() + i);
+		} else {
+			i++;
+		}
+	}
+}
+
 bool D3D11DrawContext::CopyFramebufferToMemory(Framebuffer *src, int channelBits, int bx, int by, int bw, int bh, Draw::DataFormat destFormat, void *pixels, int pixelStride, ReadbackMode mode, const char *tag) {
 	D3D11Framebuffer *fb = (D3D11Framebuffer *)src;
 
@@ -1683,50 +1871,32 @@ bool D3D11DrawContext::CopyFramebufferToMemory(Framebuffer *src, int channelBits
 	if (bh <= 0 || bw <= 0)
 		return true;
 
-	bool useGlobalPacktex = (bx + bw <= 512 && by + bh <= 512) && channelBits == FB_COLOR_BIT;
-
-	ID3D11Texture2D *packTex = nullptr;
-	if (!useGlobalPacktex) {
-		D3D11_TEXTURE2D_DESC packDesc{};
-		packDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-		packDesc.BindFlags = 0;
-		packDesc.Width = bw;
-		packDesc.Height = bh;
-		packDesc.ArraySize = 1;
-		packDesc.MipLevels = 1;
-		packDesc.Usage = D3D11_USAGE_STAGING;
-		packDesc.SampleDesc.Count = 1;
-		switch (channelBits) {
-		case FB_COLOR_BIT:
-			packDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;  // TODO: fb->colorFormat;
-			break;
-		case FB_DEPTH_BIT:
-		case FB_STENCIL_BIT:
-			if (!fb) {
-				// Not supported.
-				return false;
-			}
-			packDesc.Format = fb->depthStencilFormat;
-			break;
-		default:
-			_assert_(false);
-		}
-		device_->CreateTexture2D(&packDesc, nullptr, &packTex);
-	} else {
-		switch (channelBits) {
-		case FB_DEPTH_BIT:
-		case FB_STENCIL_BIT:
-			if (!fb)
-				return false;
-		default:
-			break;
+	// Depth/stencil is copied with CopyResource below, which requires matching
+	// dimensions, so those entries are exact-size. Color copies preserve coordinates,
+	// so the staging texture just has to cover the source rectangle.
+	StagingTexture *staging = nullptr;
+	switch (channelBits) {
+	case FB_COLOR_BIT:
+		// TODO: fb->colorFormat
+		staging = GetStagingTexture(bx + bw, by + bh, DXGI_FORMAT_R8G8B8A8_UNORM, false, mode == ReadbackMode::OLD_DATA_OK);
+		break;
+	case FB_DEPTH_BIT:
+	case FB_STENCIL_BIT:
+		if (!fb) {
+			// Not supported.
+			return false;
 		}
-		packTex = packTexture_;
+		staging = GetStagingTexture(fb->Width(), fb->Height(), fb->depthStencilFormat, true, mode == ReadbackMode::OLD_DATA_OK);
+		break;
+	default:
+		_assert_(false);
 	}
 
-	if (!packTex)
+	if (!staging)
 		return false;
 
+	ID3D11Texture2D *packTex = staging->tex[staging->flip];
+
 	D3D11_BOX srcBox{ (UINT)bx, (UINT)by, 0, (UINT)(bx + bw), (UINT)(by + bh), 1 };
 	DataFormat srcFormat = DataFormat::UNDEFINED;
 	switch (channelBits) {
@@ -1746,10 +1916,16 @@ bool D3D11DrawContext::CopyFramebufferToMemory(Framebuffer *src, int channelBits
 		break;
 	}
 
-	// Ideally, we'd round robin between two packTexture_, and simply use the other one. Though if the game
-	// does a once-off copy, that won't work at all.
+	// If stale data is acceptable, map the other texture of the pair - it holds the
+	// previous readback of this target, which the GPU finished long ago, so the Map
+	// below won't stall. The very first readback returns zero-initialized data, which
+	// the mode explicitly permits.
+	if (mode == ReadbackMode::OLD_DATA_OK && staging->tex[staging->flip ^ 1]) {
+		packTex = staging->tex[staging->flip ^ 1];
+		staging->flip ^= 1;
+	}
 
-	// BIG GPU STALL
+	// BIG GPU STALL (unless we swapped to the previous copy above)
 	D3D11_MAPPED_SUBRESOURCE map;
 	HRESULT result = context_->Map(packTex, 0, D3D11_MAP_READ, 0, &map);
 	if (FAILED(result)) {
@@ -1806,14 +1982,14 @@ bool D3D11DrawContext::CopyFramebufferToMemory(Framebuffer *src, int channelBits
 	}
 
 	context_->Unmap(packTex, 0);
-
-	if (!useGlobalPacktex) {
-		packTex->Release();
-	}
 	return true;
 }
 
 void D3D11DrawContext::BindFramebufferAsRenderTarget(Framebuffer *fbo, const RenderPassInfo &rp, const char *tag) {
+	// Each render target bind starts a new "pass" as far as the profiler is concerned.
+	if (profileThisFrame_)
+		ProfileTimestamp(tag ? tag : "?");
+
 	// TODO: deviceContext1 can actually discard. Useful on Windows Mobile.
 	if (fbo) {
 		D3D11Framebuffer *fb = (D3D11Framebuffer *)fbo;
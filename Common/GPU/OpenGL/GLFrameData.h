@@ -57,6 +57,10 @@ struct GLFrameData {
 	std::condition_variable fenceCondVar;
 	bool readyForFence = true;
 
+	// Set when fence-tracked push buffer reuse is enabled, see GLRenderManager::ThreadStart.
+	// Only touched from the render thread.
+	GLsync fence = nullptr;
+
 	// Swapchain.
 	bool hasBegun = false;
 
@@ -96,6 +96,14 @@ void GLRenderManager::ThreadStart(Draw::DrawContext *draw) {
 	} else {
 		bufferStrategy_ = GLBufferStrategy::SUBDATA;
 	}
+
+	// Drivers that are slow at mapping tend to also be the ones that ignore the orphaning
+	// hint and stall glBufferSubData when the target buffer is still in flight - mostly
+	// old Android GL drivers. When sync objects are available, don't trust implicit
+	// renaming on those: gate push buffer reuse on an explicit fence instead, see Run().
+	bool hasFenceSync = gl_extensions.IsGLES ? gl_extensions.GLES3 : gl_extensions.VersionGEThan(3, 2, 0);
+	useFenceSync_ = hasFenceSync && (bufferStrategy_ != GLBufferStrategy::SUBDATA ||
+		(gl_extensions.IsGLES && draw->GetBugs().Has(Draw::Bugs::ANY_MAP_BUFFER_RANGE_SLOW)));
 }
 
 void GLRenderManager::ThreadEnd() {
@@ -109,6 +117,12 @@ void GLRenderManager::ThreadEnd() {
 		// Since we're in shutdown, we should skip the GL calls on Android.
 		frameData_[i].deleter.Perform(this, skipGLCalls_);
 		frameData_[i].deleter_prev.Perform(this, skipGLCalls_);
+		if (frameData_[i].fence) {
+			if (!skipGLCalls_) {
+				glDeleteSync(frameData_[i].fence);
+			}
+			frameData_[i].fence = nullptr;
+		}
 	}
 	deleter_.Perform(this, skipGLCalls_);
 	for (int i = 0; i < (int)steps_.size(); i++) {
@@ -365,7 +379,6 @@ void GLRenderManager::BeginFrame(bool enableProfiling) {
 
 	FrameTimeData &frameTimeData = frameTimeHistory_.Add(frameIdGen_);
 	frameTimeData.frameBegin = time_now_d();
-	frameTimeData.afterFenceWait = frameTimeData.frameBegin;
 
 	GLFrameData &frameData = frameData_[curFrame];
 	frameData.frameId = frameIdGen_;
@@ -381,6 +394,10 @@ void GLRenderManager::BeginFrame(bool enableProfiling) {
 		frameData.readyForFence = false;
 	}
 
+	// With fence sync enabled, this wait covers the GPU actually finishing with the frame's
+	// push buffers, not just the render thread presenting - so record how long it took.
+	frameTimeData.afterFenceWait = time_now_d();
+
 	insideFrame_ = true;
 }
 
@@ -470,6 +487,24 @@ bool GLRenderManager::Run(GLRRenderThreadTask &task) {
 		}
 		frameData.hasBegun = false;
 
+		if (frameData.fence) {
+			// Wait for the GPU to be done with the frame's push buffers before handing them
+			// back for reuse - this is what makes reuse safe on drivers that ignore orphaning.
+			// The swap above normally absorbs the wait; when it doesn't, the extra time shows
+			// up as fence latency in the frame time data.
+			if (!skipGLCalls_) {
+				GLenum result = glClientWaitSync(frameData.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ULL);
+				if (result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED) {
+					WARN_LOG(Log::G3D, "glClientWaitSync on frame %d returned %04x", task.frame, result);
+				}
+				glDeleteSync(frameData.fence);
+				for (auto iter : frameData.activePushBuffers) {
+					iter->MapDevice(bufferStrategy_);
+				}
+			}
+			frameData.fence = nullptr;
+		}
+
 		VLOG("  PULL: Frame %d.readyForFence = true", task.frame);
 
 		{
@@ -519,8 +554,16 @@ bool GLRenderManager::Run(GLRRenderThreadTask &task) {
 	}
 
 	if (!skipGLCalls_) {
-		for (auto iter : frameData.activePushBuffers) {
-			iter->MapDevice(bufferStrategy_);
+		if (useFenceSync_ && task.runType == GLRRunType::SUBMIT) {
+			// Don't remap the push buffers yet - the GPU is still reading them, so on drivers
+			// that ignore the orphaning hint, mapping here blocks right behind the frame we
+			// just submitted. Drop a fence instead and remap in the PRESENT task, once the
+			// fence proves the GPU is actually done with the buffers.
+			frameData.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		} else {
+			for (auto iter : frameData.activePushBuffers) {
+				iter->MapDevice(bufferStrategy_);
+			}
 		}
 	}
 
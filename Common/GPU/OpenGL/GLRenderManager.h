@@ -896,6 +896,9 @@ private:
 	std::function<void()> swapFunction_;
 	std::function<void(int)> swapIntervalFunction_;
 	GLBufferStrategy bufferStrategy_ = GLBufferStrategy::SUBDATA;
+	// When set, push buffer reuse is gated on a GLsync fence instead of trusting the driver
+	// to orphan on invalidating maps. Decided per-driver in ThreadStart.
+	bool useFenceSync_ = false;
 
 	int inflightFrames_ = MAX_INFLIGHT_FRAMES;
 	int newInflightFrames_ = -1;
@@ -17,7 +17,9 @@
 
 #include "ppsspp_config.h"
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <sstream>
 
@@ -34,9 +36,11 @@
 #undef free
 #endif
 
+#include "Common/File/FileUtil.h"
 #include "Common/Log.h"
 #include "Common/StringUtils.h"
 #include "Common/GPU/Shader.h"
+#include "ext/xxhash.h"
 
 #include "Common/GPU/ShaderTranslation.h"
 #include "ext/glslang/SPIRV/GlslangToSpv.h"
@@ -62,11 +66,98 @@ static EShLanguage GetShLanguageFromStage(const ShaderStage stage) {
 	}
 }
 
+// Persistent cache of translation results. The glslang + SPIRV-Cross round trip is expensive
+// and fully deterministic given the source and target settings, so there's no reason to redo
+// it across boots. The string-level GLSL -> Vulkan conversion is cheap and not cached.
+// Bump the version whenever the translation code or any of the prologues change.
+static const uint32_t TRANSLATION_CACHE_MAGIC = 0x53545043;  // "CPTS"
+static const uint32_t TRANSLATION_CACHE_VERSION = 1;
+// Postshaders are small - anything bigger than this is a corrupt file, not a shader.
+static const uint32_t TRANSLATION_CACHE_MAX_SHADER_SIZE = 1024 * 1024;
+
+static std::mutex g_translationCacheLock;
+static std::map<uint64_t, std::string> g_translationCache;
+static Path g_translationCachePath;
+static bool g_translationCacheDirty = false;
+
+static uint64_t TranslationCacheKey(const std::string &src, ShaderLanguage destLang, ShaderLanguage srcLang, ShaderStage stage, const ShaderLanguageDesc &desc) {
+	// Everything that can affect the generated output has to go into the key - notably the
+	// GL context caps, since the GLSL_3xx path bakes them into the result.
+	const uint32_t flags[6] = {
+		(uint32_t)destLang,
+		(uint32_t)srcLang,
+		(uint32_t)stage,
+		(uint32_t)desc.gles,
+		(uint32_t)gl_extensions.GLSLVersion(),
+		(uint32_t)gl_extensions.ARB_shading_language_420pack,
+	};
+	uint64_t hash = XXH3_64bits(src.data(), src.size());
+	return XXH3_64bits_withSeed(flags, sizeof(flags), hash);
+}
+
 void ShaderTranslationInit() {
 	glslang::InitializeProcess();
 }
+
 void ShaderTranslationShutdown() {
 	glslang::FinalizeProcess();
+
+	std::lock_guard<std::mutex> guard(g_translationCacheLock);
+	if (g_translationCacheDirty && !g_translationCachePath.empty()) {
+		FILE *f = File::OpenCFile(g_translationCachePath, "wb");
+		if (f) {
+			const uint32_t header[3] = { TRANSLATION_CACHE_MAGIC, TRANSLATION_CACHE_VERSION, (uint32_t)g_translationCache.size() };
+			fwrite(header, sizeof(header), 1, f);
+			for (const auto &iter : g_translationCache) {
+				const uint64_t key = iter.first;
+				const uint32_t size = (uint32_t)iter.second.size();
+				fwrite(&key, sizeof(key), 1, f);
+				fwrite(&size, sizeof(size), 1, f);
+				fwrite(iter.second.data(), 1, size, f);
+			}
+			fclose(f);
+		}
+	}
+	g_translationCache.clear();
+	g_translationCachePath.clear();
+	g_translationCacheDirty = false;
+}
+
+void ShaderTranslationSetCacheDir(const Path &cacheDir) {
+	std::lock_guard<std::mutex> guard(g_translationCacheLock);
+	g_translationCachePath = cacheDir / "ShaderTranslation.cache";
+	g_translationCache.clear();
+	g_translationCacheDirty = false;
+
+	FILE *f = File::OpenCFile(g_translationCachePath, "rb");
+	if (!f) {
+		return;
+	}
+	uint32_t header[3]{};
+	bool valid = fread(header, sizeof(header), 1, f) == 1 &&
+		header[0] == TRANSLATION_CACHE_MAGIC && header[1] == TRANSLATION_CACHE_VERSION;
+	for (uint32_t i = 0; valid && i < header[2]; i++) {
+		uint64_t key;
+		uint32_t size;
+		valid = fread(&key, sizeof(key), 1, f) == 1 && fread(&size, sizeof(size), 1, f) == 1 &&
+			size <= TRANSLATION_CACHE_MAX_SHADER_SIZE;
+		if (valid) {
+			std::string data;
+			data.resize(size);
+			valid = fread(&data[0], 1, size, f) == size;
+			if (valid) {
+				g_translationCache[key] = std::move(data);
+			}
+		}
+	}
+	fclose(f);
+	if (!valid) {
+		// Corrupt or stale format - start over, it'll be rewritten on shutdown.
+		WARN_LOG(Log::G3D, "Ignoring bad shader translation cache '%s'", g_translationCachePath.c_str());
+		g_translationCache.clear();
+	} else {
+		INFO_LOG(Log::G3D, "Loaded %d translated shaders from '%s'", (int)g_translationCache.size(), g_translationCachePath.c_str());
+	}
 }
 
 struct Builtin {
@@ -210,22 +301,7 @@ bool ConvertToVulkanGLSL(std::string *dest, TranslatedShaderMetadata *destMetada
 	return true;
 }
 
-bool TranslateShader(std::string *dest, ShaderLanguage destLang, const ShaderLanguageDesc &desc, TranslatedShaderMetadata *destMetadata, std::string src, ShaderLanguage srcLang, ShaderStage stage, std::string *errorMessage) {
-	_assert_(errorMessage != nullptr);
-
-	if (srcLang != GLSL_3xx && srcLang != GLSL_1xx) {
-		*errorMessage = StringFromFormat("Bad src shader language: %s", ShaderLanguageAsString(srcLang));
-		return false;
-	}
-
-	if ((srcLang == GLSL_1xx || srcLang == GLSL_3xx) && destLang == GLSL_VULKAN) {
-		// Let's just mess about at the string level, no need to recompile.
-		bool result = ConvertToVulkanGLSL(dest, destMetadata, src, stage, errorMessage);
-		return result;
-	}
-
-	errorMessage->clear();
-
+static bool TranslateShaderUncached(std::string *dest, ShaderLanguage destLang, const ShaderLanguageDesc &desc, const std::string &src, ShaderStage stage, std::string *errorMessage) {
 	glslang::TProgram program;
 	const char *shaderStrings[1]{};
 
@@ -357,3 +433,40 @@ bool TranslateShader(std::string *dest, ShaderLanguage destLang, const ShaderLan
 		return false;
 	}
 }
+
+bool TranslateShader(std::string *dest, ShaderLanguage destLang, const ShaderLanguageDesc &desc, TranslatedShaderMetadata *destMetadata, std::string src, ShaderLanguage srcLang, ShaderStage stage, std::string *errorMessage) {
+	_assert_(errorMessage != nullptr);
+
+	if (srcLang != GLSL_3xx && srcLang != GLSL_1xx) {
+		*errorMessage = StringFromFormat("Bad src shader language: %s", ShaderLanguageAsString(srcLang));
+		return false;
+	}
+
+	if ((srcLang == GLSL_1xx || srcLang == GLSL_3xx) && destLang == GLSL_VULKAN) {
+		// Let's just mess about at the string level, no need to recompile.
+		bool result = ConvertToVulkanGLSL(dest, destMetadata, src, stage, errorMessage);
+		return result;
+	}
+
+	errorMessage->clear();
+
+	// The full glslang + SPIRV-Cross round trip is the expensive part - check the cache first.
+	const uint64_t cacheKey = TranslationCacheKey(src, destLang, srcLang, stage, desc);
+	{
+		std::lock_guard<std::mutex> guard(g_translationCacheLock);
+		auto iter = g_translationCache.find(cacheKey);
+		if (iter != g_translationCache.end()) {
+			*dest = iter->second;
+			return true;
+		}
+	}
+
+	if (!TranslateShaderUncached(dest, destLang, desc, src, stage, errorMessage)) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> guard(g_translationCacheLock);
+	g_translationCache[cacheKey] = *dest;
+	g_translationCacheDirty = true;
+	return true;
+}
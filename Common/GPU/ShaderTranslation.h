@@ -19,6 +19,7 @@
 
 #include <string>
 
+#include "Common/File/Path.h"
 #include "Common/GPU/Shader.h"
 #include "Common/GPU/thin3d.h"
 
@@ -29,4 +30,9 @@ struct TranslatedShaderMetadata {
 void ShaderTranslationInit();
 void ShaderTranslationShutdown();
 
+// Optional. Points the translation cache at a directory (we use the same one as the shader
+// caches), loading any previous contents. Translated shaders are persisted there on shutdown,
+// so the glslang + SPIRV-Cross round trip runs once per shader per install instead of per boot.
+void ShaderTranslationSetCacheDir(const Path &cacheDir);
+
 bool TranslateShader(std::string *dst, ShaderLanguage destLang, const ShaderLanguageDesc &desc, TranslatedShaderMetadata *destMetadata, std::string src, ShaderLanguage srcLang, ShaderStage stage, std::string *errorMessage);
@@ -346,6 +346,11 @@ void VulkanContext::EndFrame() {
 
 void VulkanContext::UpdateInflightFrames(int n) {
 	_dbg_assert_(n >= 1 && n <= MAX_INFLIGHT_FRAMES);
+	// Frames past the new cycle length won't come around again, so hand any deletes they
+	// were holding to the global list. The caller must have waited out the GPU first.
+	for (int i = n; i < inflightFrames_; i++) {
+		globalDeleteList_.Take(frame_[i].deleteList);
+	}
 	inflightFrames_ = n;
 	if (curFrame_ >= inflightFrames_) {
 		curFrame_ = 0;
@@ -654,20 +659,39 @@ VkResult VulkanContext::CreateDevice(int physical_device) {
 		return VK_ERROR_INITIALIZATION_FAILED;
 	}
 
-	VkDeviceQueueCreateInfo queue_info{ VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+	VkDeviceQueueCreateInfo queue_info[2]{};
+	queue_info[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 	float queue_priorities[1] = { 1.0f };
-	queue_info.queueCount = 1;
-	queue_info.pQueuePriorities = queue_priorities;
+	queue_info[0].queueCount = 1;
+	queue_info[0].pQueuePriorities = queue_priorities;
 	bool found = false;
 	for (int i = 0; i < (int)queue_count; i++) {
 		if (queueFamilyProperties_[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
-			queue_info.queueFamilyIndex = i;
+			queue_info[0].queueFamilyIndex = i;
 			found = true;
 			break;
 		}
 	}
 	_dbg_assert_(found);
 
+	// Also look for a dedicated transfer queue family (maps to the DMA engine on desktop
+	// GPUs), so uploads can run overlapped with rendering. Only families without graphics
+	// or compute capability count as dedicated here.
+	uint32_t queueCreateCount = 1;
+	for (int i = 0; i < (int)queue_count; i++) {
+		const VkQueueFlags flags = queueFamilyProperties_[i].queueFlags;
+		if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+			transfer_queue_family_index_ = i;
+			queue_info[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+			queue_info[1].queueFamilyIndex = i;
+			queue_info[1].queueCount = 1;
+			queue_info[1].pQueuePriorities = queue_priorities;
+			queueCreateCount = 2;
+			INFO_LOG(Log::G3D, "Found dedicated transfer queue family: %d", i);
+			break;
+		}
+	}
+
 	// TODO: A lot of these are on by default in later Vulkan versions, should check for that, technically.
 	extensionsLookup_.KHR_maintenance1 = EnableDeviceExtension(VK_KHR_MAINTENANCE1_EXTENSION_NAME, VK_API_VERSION_1_1);
 	extensionsLookup_.KHR_maintenance2 = EnableDeviceExtension(VK_KHR_MAINTENANCE2_EXTENSION_NAME, VK_API_VERSION_1_1);
@@ -774,8 +798,8 @@ VkResult VulkanContext::CreateDevice(int physical_device) {
 	VkPhysicalDeviceFeatures2 features2{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2 };
 
 	VkDeviceCreateInfo device_info{ VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
-	device_info.queueCreateInfoCount = 1;
-	device_info.pQueueCreateInfos = &queue_info;
+	device_info.queueCreateInfoCount = queueCreateCount;
+	device_info.pQueueCreateInfos = queue_info;
 	device_info.enabledLayerCount = (uint32_t)device_layer_names_.size();
 	device_info.ppEnabledLayerNames = device_info.enabledLayerCount ? device_layer_names_.data() : nullptr;
 	device_info.enabledExtensionCount = (uint32_t)device_extensions_enabled_.size();
@@ -804,6 +828,9 @@ VkResult VulkanContext::CreateDevice(int physical_device) {
 		ERROR_LOG(Log::G3D, "%s", init_error_.c_str());
 	} else {
 		VulkanLoadDeviceFunctions(device_, extensionsLookup_, vulkanDeviceApiVersion_);
+		if (transfer_queue_family_index_ != VK_QUEUE_FAMILY_IGNORED) {
+			vkGetDeviceQueue(device_, transfer_queue_family_index_, 0, &transfer_queue_);
+		}
 	}
 	INFO_LOG(Log::G3D, "Vulkan Device created: %s", physicalDeviceProperties_[physical_device_].properties.deviceName);
 
@@ -272,6 +272,20 @@ public:
 		return graphics_queue_family_index_;
 	}
 
+	// Only valid if HasDedicatedTransferQueue(). Useful for overlapping uploads
+	// with rendering - note that resources then need queue family ownership transfers.
+	bool HasDedicatedTransferQueue() const {
+		return transfer_queue_ != VK_NULL_HANDLE;
+	}
+
+	VkQueue GetTransferQueue() const {
+		return transfer_queue_;
+	}
+
+	int GetTransferQueueFamilyIndex() const {
+		return transfer_queue_family_index_;
+	}
+
 	struct PhysicalDeviceProps {
 		VkPhysicalDeviceProperties properties;
 		VkPhysicalDevicePushDescriptorPropertiesKHR pushDescriptorProperties;
@@ -449,6 +463,7 @@ private:
 	VkInstance instance_ = VK_NULL_HANDLE;
 	VkDevice device_ = VK_NULL_HANDLE;
 	VkQueue gfx_queue_ = VK_NULL_HANDLE;
+	VkQueue transfer_queue_ = VK_NULL_HANDLE;
 	VkSurfaceKHR surface_ = VK_NULL_HANDLE;
 	u32 vulkanInstanceApiVersion_ = 0;
 	u32 vulkanDeviceApiVersion_ = 0;
@@ -472,6 +487,7 @@ private:
 	int physical_device_ = -1;
 
 	uint32_t graphics_queue_family_index_ = -1;
+	uint32_t transfer_queue_family_index_ = VK_QUEUE_FAMILY_IGNORED;
 	std::vector<PhysicalDeviceProps> physicalDeviceProperties_;
 	std::vector<VkQueueFamilyProperties> queueFamilyProperties_;
 
@@ -66,6 +66,14 @@ void FrameData::Destroy(VulkanContext *vulkan) {
 	VkDevice device = vulkan->GetDevice();
 	vkDestroyCommandPool(device, cmdPoolInit, nullptr);
 	vkDestroyCommandPool(device, cmdPoolMain, nullptr);
+	for (auto &secondary : secondaries) {
+		if (secondary.pool != VK_NULL_HANDLE) {
+			vkDestroyCommandPool(device, secondary.pool, nullptr);
+			secondary.pool = VK_NULL_HANDLE;
+		}
+		secondary.bufs.clear();
+		secondary.used = 0;
+	}
 	vkDestroyFence(device, fence, nullptr);
 	vkDestroyQueryPool(device, profile.queryPool, nullptr);
 	vkDestroySemaphore(device, acquireSemaphore, nullptr);
@@ -169,6 +177,44 @@ VkCommandBuffer FrameData::GetInitCmd(VulkanContext *vulkan) {
 	return initCmd;
 }
 
+VkCommandBuffer FrameData::GetSecondaryCmdBuf(VulkanContext *vulkan, int slot) {
+	_dbg_assert_(slot >= 0 && slot < MAX_SECONDARY_CMD_BUFFERS);
+	SecondaryCmdPool &secondary = secondaries[slot];
+	VkDevice device = vulkan->GetDevice();
+
+	if (secondary.pool == VK_NULL_HANDLE) {
+		VkCommandPoolCreateInfo cmd_pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+		cmd_pool_info.queueFamilyIndex = vulkan->GetGraphicsQueueFamilyIndex();
+		cmd_pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		VkResult res = vkCreateCommandPool(device, &cmd_pool_info, nullptr, &secondary.pool);
+		_dbg_assert_(res == VK_SUCCESS);
+		vulkan->SetDebugName(secondary.pool, VK_OBJECT_TYPE_COMMAND_POOL, StringFromFormat("secondaryPool%d_%d", index, slot).c_str());
+	}
+
+	if (secondary.used == (int)secondary.bufs.size()) {
+		VkCommandBufferAllocateInfo cmd_alloc = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+		cmd_alloc.commandPool = secondary.pool;
+		cmd_alloc.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+		cmd_alloc.commandBufferCount = 1;
+		VkCommandBuffer cmdBuf;
+		VkResult res = vkAllocateCommandBuffers(device, &cmd_alloc, &cmdBuf);
+		_dbg_assert_(res == VK_SUCCESS);
+		vulkan->SetDebugName(cmdBuf, VK_OBJECT_TYPE_COMMAND_BUFFER, StringFromFormat("secondaryCmd%d_%d_%d", index, slot, secondary.used).c_str());
+		secondary.bufs.push_back(cmdBuf);
+	}
+
+	return secondary.bufs[secondary.used++];
+}
+
+void FrameData::ResetSecondaryCmdPools(VulkanContext *vulkan) {
+	for (auto &secondary : secondaries) {
+		if (secondary.pool != VK_NULL_HANDLE && secondary.used > 0) {
+			vkResetCommandPool(vulkan->GetDevice(), secondary.pool, 0);
+		}
+		secondary.used = 0;
+	}
+}
+
 void FrameData::Submit(VulkanContext *vulkan, FrameSubmitType type, FrameDataShared &sharedData) {
 	VkCommandBuffer cmdBufs[3];
 	int numCmdBufs = 0;
@@ -4,6 +4,7 @@
 
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 #include "Common/GPU/Vulkan/VulkanContext.h"
 #include "Common/Data/Collections/Hashmaps.h"
@@ -12,6 +13,12 @@ enum {
 	MAX_TIMESTAMP_QUERIES = 128,
 };
 
+enum {
+	// Maximum number of chunks a large render pass can be split into for parallel
+	// recording into secondary command buffers. See VulkanQueueRunner::PerformRenderPass.
+	MAX_SECONDARY_CMD_BUFFERS = 4,
+};
+
 enum class VKRRunType {
 	SUBMIT,
 	PRESENT,
@@ -104,6 +111,16 @@ struct FrameData {
 	// Also used for indexing into the frame timing history buffer.
 	uint64_t frameId = 0;
 
+	// Secondary command buffers for parallel render pass recording. Each slot has its own
+	// pool since pools can only be recorded from one thread at a time. Allocated lazily -
+	// most games never hit the split threshold. Reset together with cmdPoolMain.
+	struct SecondaryCmdPool {
+		VkCommandPool pool = VK_NULL_HANDLE;
+		std::vector<VkCommandBuffer> bufs;
+		int used = 0;
+	};
+	SecondaryCmdPool secondaries[MAX_SECONDARY_CMD_BUFFERS];
+
 	// Profiling.
 	QueueProfileContext profile{};
 
@@ -121,6 +138,12 @@ struct FrameData {
 	// Generally called from the main thread, unlike most of the rest.
 	VkCommandBuffer GetInitCmd(VulkanContext *vulkan);
 
+	// Grabs the next unused secondary command buffer in the given slot, allocating the pool
+	// and buffer if needed. Only called from the render thread - the returned buffer is then
+	// safe to record from a worker thread since each slot has a dedicated pool.
+	VkCommandBuffer GetSecondaryCmdBuf(VulkanContext *vulkan, int slot);
+	void ResetSecondaryCmdPools(VulkanContext *vulkan);
+
 	// Submits pending command buffers.
 	void Submit(VulkanContext *vulkan, FrameSubmitType type, FrameDataShared &shared);
 
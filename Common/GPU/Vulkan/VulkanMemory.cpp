@@ -32,8 +32,11 @@
 
 using namespace PPSSPP_VK;
 
-// Always keep around push buffers at least this long (seconds).
-static const double PUSH_GARBAGE_COLLECTION_DELAY = 10.0;
+// Always keep around push buffers at least this long (seconds), by size class.
+// Small blocks are cheap to keep resident, while huge blocks created by allocation
+// spikes (big texture uploads) should go back to the system quickly once the spike
+// has passed - on 3GB devices every resident MB matters.
+static const double PUSH_GARBAGE_COLLECTION_DELAY[3] = { 10.0, 3.0, 1.0 };
 
 VulkanPushPool::VulkanPushPool(VulkanContext *vulkan, const char *name, size_t originalBlockSize, VkBufferUsageFlags usage)
 	: vulkan_(vulkan), name_(name), originalBlockSize_(originalBlockSize), usage_(usage) {
@@ -88,9 +91,19 @@ void VulkanPushPool::Block::Destroy(VulkanContext *vulkan) {
 	vulkan->Delete().QueueDeleteBufferAllocation(buffer, allocation);
 }
 
+// Block size classes, for trimming purposes only - allocation doesn't care.
+int VulkanPushPool::SizeClass(VkDeviceSize size) const {
+	if (size <= originalBlockSize_ * 2)
+		return 0;  // small
+	if (size < originalBlockSize_ * 8)
+		return 1;  // medium
+	return 2;  // huge
+}
+
 void VulkanPushPool::BeginFrame() {
 	double now = time_now_d();
 	curBlockIndex_ = -1;
+	VkDeviceSize classUsed[NUM_SIZE_CLASSES]{};
 	for (auto &block : blocks_) {
 		if (block.frameIndex == vulkan_->GetCurFrame()) {
 			if (curBlockIndex_ == -1) {
@@ -99,6 +112,7 @@ void VulkanPushPool::BeginFrame() {
 				curBlockIndex_ = block.frameIndex;
 				block.lastUsed = now;
 			}
+			classUsed[SizeClass(block.size)] += block.used;
 			block.used = 0;
 			if (!block.original) {
 				// Return block to the common pool
@@ -107,6 +121,13 @@ void VulkanPushPool::BeginFrame() {
 		}
 	}
 
+	// Record what the finishing frame slot actually used, per size class. The high-water
+	// marks over this window drive the trim policy below.
+	for (int c = 0; c < NUM_SIZE_CLASSES; c++) {
+		classUsedHistory_[c][historyIndex_] = classUsed[c];
+	}
+	historyIndex_ = (historyIndex_ + 1) % HIGH_WATER_FRAMES;
+
 	// Do a single pass of bubblesort to move the bigger buffers earlier in the sequence.
 	// Over multiple frames this will quickly converge to the right order.
 	for (size_t i = 3; i < blocks_.size() - 1; i++) {
@@ -115,14 +136,36 @@ void VulkanPushPool::BeginFrame() {
 		}
 	}
 
-	// If we have lots of little buffers and the last one hasn't been used in a while, drop it.
-	// Still, let's keep around a few big ones (6 - 3).
-	if (blocks_.size() > 6 && blocks_.back().lastUsed < now - PUSH_GARBAGE_COLLECTION_DELAY) {
-		double start = time_now_d();
-		size_t size = blocks_.back().size;
-		blocks_.back().Destroy(vulkan_);
-		blocks_.pop_back();
-		DEBUG_LOG(Log::G3D, "%s: Garbage collected block of size %s in %0.2f ms", name_, NiceSizeFormat(size).c_str(), time_now_d() - start);
+	// Trim at most one block per frame to avoid hitches. A pooled block is surplus when its
+	// class's capacity minus the block still covers the class's recent high-water mark, and it
+	// hasn't been used for a while - with much shorter patience for huge blocks, which are
+	// usually left over from a one-off upload spike.
+	VkDeviceSize classCapacity[NUM_SIZE_CLASSES]{};
+	for (auto &block : blocks_) {
+		if (!block.original) {
+			classCapacity[SizeClass(block.size)] += block.size;
+		}
+	}
+	VkDeviceSize classHighWater[NUM_SIZE_CLASSES]{};
+	for (int c = 0; c < NUM_SIZE_CLASSES; c++) {
+		for (int i = 0; i < HIGH_WATER_FRAMES; i++) {
+			classHighWater[c] = std::max(classHighWater[c], classUsedHistory_[c][i]);
+		}
+	}
+
+	for (int i = (int)blocks_.size() - 1; i >= 0; i--) {
+		Block &block = blocks_[i];
+		if (block.original || block.frameIndex != -1)
+			continue;
+		const int c = SizeClass(block.size);
+		if (classCapacity[c] - block.size >= classHighWater[c] && block.lastUsed < now - PUSH_GARBAGE_COLLECTION_DELAY[c]) {
+			double start = time_now_d();
+			size_t size = block.size;
+			block.Destroy(vulkan_);
+			blocks_.erase(blocks_.begin() + i);
+			DEBUG_LOG(Log::G3D, "%s: Garbage collected block of size %s in %0.2f ms", name_, NiceSizeFormat(size).c_str(), 1000.0 * (time_now_d() - start));
+			break;
+		}
 	}
 }
 
@@ -170,10 +213,19 @@ size_t VulkanPushPool::GetUsedThisFrame() const {
 void VulkanPushPool::GetDebugString(char *buffer, size_t bufSize) const {
 	size_t used = 0;
 	size_t capacity = 0;
+	VkDeviceSize classUsed[NUM_SIZE_CLASSES]{};
+	VkDeviceSize classCapacity[NUM_SIZE_CLASSES]{};
 	for (auto &block : blocks_) {
 		used += block.used;
 		capacity += block.size;
+		const int c = SizeClass(block.size);
+		classUsed[c] += block.used;
+		classCapacity[c] += block.size;
 	}
 
-	snprintf(buffer, bufSize, "Pool %s: %s / %s (%d extra blocks)", name_, NiceSizeFormat(used).c_str(), NiceSizeFormat(capacity).c_str(), (int)blocks_.size() - 3);
+	snprintf(buffer, bufSize, "Pool %s: %s / %s (%d extra blocks, S %s/%s M %s/%s H %s/%s)",
+		name_, NiceSizeFormat(used).c_str(), NiceSizeFormat(capacity).c_str(), (int)blocks_.size() - 3,
+		NiceSizeFormat(classUsed[0]).c_str(), NiceSizeFormat(classCapacity[0]).c_str(),
+		NiceSizeFormat(classUsed[1]).c_str(), NiceSizeFormat(classCapacity[1]).c_str(),
+		NiceSizeFormat(classUsed[2]).c_str(), NiceSizeFormat(classCapacity[2]).c_str());
 }
@@ -63,6 +63,15 @@ public:
 		return bindOffset;
 	}
 
+	// Shrinks the most recent allocation, handing back space that wasn't needed. Useful when
+	// generating data directly into the buffer and only a worst-case size is known up front.
+	// Must be called before the next Allocate, with the bindOffset the allocation returned.
+	void TrimLastAllocation(uint32_t bindOffset, VkDeviceSize actualBytes) {
+		Block &block = blocks_[curBlockIndex_];
+		_dbg_assert_(bindOffset + actualBytes <= block.used);
+		block.used = bindOffset + actualBytes;
+	}
+
 	size_t GetUsedThisFrame() const;
 
 private:
@@ -86,6 +95,12 @@ private:
 	};
 
 	Block CreateBlock(size_t sz);
+	int SizeClass(VkDeviceSize size) const;
+
+	enum {
+		NUM_SIZE_CLASSES = 3,  // small / medium / huge, see SizeClass().
+		HIGH_WATER_FRAMES = 60,
+	};
 
 	VulkanContext *vulkan_;
 	VkDeviceSize originalBlockSize_;
@@ -93,4 +108,9 @@ private:
 	VkBufferUsageFlags usage_;
 	int curBlockIndex_ = -1;
 	const char *name_;
+
+	// Rolling window of per-frame usage per size class, used to decide when blocks
+	// left over from an allocation spike can be trimmed. See BeginFrame.
+	VkDeviceSize classUsedHistory_[NUM_SIZE_CLASSES][HIGH_WATER_FRAMES]{};
+	int historyIndex_ = 0;
 };
@@ -1,14 +1,24 @@
+#include <algorithm>
 #include <unordered_map>
 
 #include "Common/GPU/DataFormat.h"
 #include "Common/GPU/Vulkan/VulkanQueueRunner.h"
 #include "Common/GPU/Vulkan/VulkanRenderManager.h"
+#include "Common/Thread/ParallelLoop.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Common/VR/PPSSPPVR.h"
 #include "Common/Log.h"
 #include "Common/TimeUtil.h"
 
 using namespace PPSSPP_VK;
 
+// A render pass with at least this many draws gets split into chunks, recorded in parallel
+// into pooled secondary command buffers and executed with vkCmdExecuteCommands. Recording
+// cost is roughly proportional to the draw count, so small passes aren't worth the overhead.
+constexpr int MIN_DRAWS_FOR_PARALLEL_RECORD = 300;
+// Don't bother with chunks smaller than this many commands.
+constexpr int MIN_COMMANDS_PER_RECORD_CHUNK = 200;
+
 // Debug help: adb logcat -s DEBUG AndroidRuntime PPSSPPNativeActivity PPSSPP NativeGLView NativeRenderer NativeSurfaceView PowerSaveModeReceiver InputDeviceState PpssppActivity CameraHelper
 
 static void MergeRenderAreaRectInto(VkRect2D *dest, const VkRect2D &src) {
@@ -336,6 +346,360 @@ void VulkanQueueRunner::PreprocessSteps(std::vector<VKRStep *> &steps) {
 			ApplyRenderPassMerge(steps);
 		}
 	}
+
+	// Group provably non-overlapping draws by pipeline to cut down on pipeline switches.
+	numPipelineSwitchesAvoided_ = ApplyDrawReorder(steps);
+
+	// Runs last so the load ops it inspects are final.
+	numStoresDemoted_ = ApplyStoreDemotion(steps);
+
+	// Every transform above marks the passes it merged away as RENDER_SKIP, so this
+	// counts all of them. For the profiler stats line.
+	numPassesMerged_ = 0;
+	for (const VKRStep *step : steps) {
+		if (step->stepType == VKRStepType::RENDER_SKIP)
+			numPassesMerged_++;
+	}
+}
+
+// Demotes STORE to DONT_CARE on render passes whose results we can prove are never read:
+// nothing samples, copies, blits or reads back from the framebuffer before a later step in
+// the same list overwrites it - either a render pass that doesn't KEEP the aspect, or a
+// copy/blit that covers the whole target. Tiler GPUs can then skip writing the tile
+// contents back to memory entirely. Conservative across frames: if nothing in this list
+// overwrites the attachment, the store stays, since a later frame may read it.
+int VulkanQueueRunner::ApplyStoreDemotion(std::vector<VKRStep *> &steps) {
+	int demoted = 0;
+	for (int i = 0; i < (int)steps.size(); i++) {
+		if (steps[i]->stepType != VKRStepType::RENDER || !steps[i]->render.framebuffer)
+			continue;
+		auto &render = steps[i]->render;
+		VKRFramebuffer *fb = render.framebuffer;
+		const bool colorPending = render.colorStore == VKRRenderPassStoreAction::STORE;
+		const bool depthPending = RenderPassTypeHasDepth(render.renderPassType) && fb->depth.image != VK_NULL_HANDLE &&
+			(render.depthStore == VKRRenderPassStoreAction::STORE || render.stencilStore == VKRRenderPassStoreAction::STORE);
+		if (!colorPending && !depthPending)
+			continue;
+
+		for (int j = i + 1; j < (int)steps.size(); j++) {
+			const VKRStep &later = *steps[j];
+			// We can't attribute a dependency to a specific aspect, so treat any as reading both.
+			if (later.dependencies.contains(fb))
+				break;
+			bool stop = false;
+			switch (later.stepType) {
+			case VKRStepType::RENDER:
+				if (later.render.framebuffer == fb) {
+					// Aspects the later pass loads with CLEAR or DONT_CARE never see our output.
+					if (colorPending && later.render.colorLoad != VKRRenderPassLoadAction::KEEP) {
+						render.colorStore = VKRRenderPassStoreAction::DONT_CARE;
+						demoted++;
+					}
+					if (depthPending && RenderPassTypeHasDepth(later.render.renderPassType)) {
+						if (render.depthStore == VKRRenderPassStoreAction::STORE && later.render.depthLoad != VKRRenderPassLoadAction::KEEP) {
+							render.depthStore = VKRRenderPassStoreAction::DONT_CARE;
+							demoted++;
+						}
+						if (render.stencilStore == VKRRenderPassStoreAction::STORE && later.render.stencilLoad != VKRRenderPassLoadAction::KEEP) {
+							render.stencilStore = VKRRenderPassStoreAction::DONT_CARE;
+							demoted++;
+						}
+					}
+					stop = true;
+				}
+				break;
+			case VKRStepType::COPY:
+				if (later.copy.src == fb) {
+					stop = true;
+				} else if (later.copy.dst == fb) {
+					// A copy that covers the whole target overwrites it just like a
+					// discarding load op would. Partial copies keep the rest alive.
+					bool fullCover = later.copy.dstPos.x == 0 && later.copy.dstPos.y == 0 &&
+						(int)later.copy.srcRect.extent.width >= fb->width &&
+						(int)later.copy.srcRect.extent.height >= fb->height;
+					if (fullCover) {
+						if (colorPending && (later.copy.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT)) {
+							render.colorStore = VKRRenderPassStoreAction::DONT_CARE;
+							demoted++;
+						}
+						if (depthPending && (later.copy.aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT))) {
+							if (render.depthStore == VKRRenderPassStoreAction::STORE) {
+								render.depthStore = VKRRenderPassStoreAction::DONT_CARE;
+								demoted++;
+							}
+							if (render.stencilStore == VKRRenderPassStoreAction::STORE) {
+								render.stencilStore = VKRRenderPassStoreAction::DONT_CARE;
+								demoted++;
+							}
+						}
+					}
+					stop = true;
+				}
+				break;
+			case VKRStepType::BLIT:
+				if (later.blit.src == fb) {
+					stop = true;
+				} else if (later.blit.dst == fb) {
+					bool fullCover = later.blit.dstRect.offset.x == 0 && later.blit.dstRect.offset.y == 0 &&
+						(int)later.blit.dstRect.extent.width >= fb->width &&
+						(int)later.blit.dstRect.extent.height >= fb->height;
+					if (fullCover && colorPending && (later.blit.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT)) {
+						render.colorStore = VKRRenderPassStoreAction::DONT_CARE;
+						demoted++;
+					}
+					stop = true;
+				}
+				break;
+			case VKRStepType::READBACK:
+				if (later.readback.src == fb)
+					stop = true;
+				break;
+			case VKRStepType::READBACK_IMAGE:
+				if (later.readback_image.image == fb->color.image)
+					stop = true;
+				break;
+			case VKRStepType::RENDER_SKIP:
+				break;
+			}
+			if (stop)
+				break;
+		}
+	}
+	return demoted;
+}
+
+// A single deferred draw, together with the state it runs with.
+struct ReorderBundle {
+	VkRenderData bind;     // The BIND_GRAPHICS_PIPELINE in effect at the time of the draw.
+	VkRenderData draw;     // DRAW or DRAW_INDEXED.
+	VkRect2D scissor;      // Scissor rect in effect for the draw.
+};
+
+static inline VKRGraphicsPipeline *BundlePipeline(const ReorderBundle &b) {
+	return b.bind.graphics_pipeline.pipeline;
+}
+
+static inline bool ScissorsDisjoint(const VkRect2D &a, const VkRect2D &b) {
+	return a.offset.x + (int)a.extent.width <= b.offset.x ||
+		b.offset.x + (int)b.extent.width <= a.offset.x ||
+		a.offset.y + (int)a.extent.height <= b.offset.y ||
+		b.offset.y + (int)b.extent.height <= a.offset.y;
+}
+
+static inline bool ScissorsEqual(const VkRect2D &a, const VkRect2D &b) {
+	return a.offset.x == b.offset.x && a.offset.y == b.offset.y &&
+		a.extent.width == b.extent.width && a.extent.height == b.extent.height;
+}
+
+// Within a render pass, draws stay in submission order, so a game that keeps alternating
+// between two pipelines (2D overlays interleaved with world geometry is the common case)
+// pays for a pipeline bind on almost every draw. Where two draws provably can't touch the
+// same pixels - their scissor rects are disjoint, and the scissor bounds all attachment
+// writes including depth/stencil - swapping them is invisible, so we stably pull draws up
+// next to earlier draws with the same pipeline and let the redundant-bind elimination in
+// RecordRenderPassCommands drop the binds. Mobile drivers in particular pay dearly per
+// pipeline switch.
+//
+// We only reorder within runs of commands consisting purely of pipeline binds, scissor
+// changes and draws. Any other command (viewport, stencil, blend, push constants, clears)
+// ends the run, which keeps the proof obligation trivial: draws within a run differ only
+// by pipeline, scissor, and the buffers/descriptors carried by the draw itself. The last
+// draw of a run never moves, so the state left behind for whatever follows is unchanged.
+// Returns the number of pipeline switches eliminated, for the profiler stats line.
+int VulkanQueueRunner::ApplyDrawReorder(std::vector<VKRStep *> &steps) {
+	int totalAvoided = 0;
+
+	std::vector<ReorderBundle> bundles;
+	std::vector<int> order;
+
+	for (VKRStep *step : steps) {
+		if (step->stepType != VKRStepType::RENDER || step->render.numDraws < 3)
+			continue;
+
+		// Cheap pre-scan. Without at least two scissor rects nothing can be proven
+		// disjoint, and without at least three binds there's no switch to save.
+		int numBinds = 0;
+		int numScissors = 0;
+		for (const VkRenderData &c : step->commands) {
+			switch (c.cmd) {
+			case VKRRenderCommand::BIND_GRAPHICS_PIPELINE: numBinds++; break;
+			case VKRRenderCommand::SCISSOR: numScissors++; break;
+			default: break;
+			}
+		}
+		if (numBinds < 3 || numScissors < 2)
+			continue;
+
+		const FastVec<VkRenderData> &cmds = step->commands;
+		FastVec<VkRenderData> newCommands;
+		newCommands.reserve(cmds.size());
+		bool stepChanged = false;
+
+		// State tracking through the step. We don't assume any state carries over from
+		// previous steps - draws before the step's first bind or scissor never reorder.
+		VkRenderData curBind{ VKRRenderCommand::BIND_GRAPHICS_PIPELINE };
+		VkRect2D curScissor{};
+		bool haveBind = false;
+		bool haveScissor = false;
+
+		int runStart = -1;
+		int lastDrawEnd = -1;  // One past the last draw in the current run.
+		VKRGraphicsPipeline *enterPipeline = nullptr;
+		VkRect2D enterScissor{};
+		bool haveEnterScissor = false;
+		bundles.clear();
+
+		auto flushRun = [&](int end) {
+			if (runStart < 0)
+				return;
+
+			int n = (int)bundles.size();
+			bool sorted = false;
+			if (n >= 3) {
+				// Only worth looking at with more than one pipeline and more than one rect.
+				bool multiPipeline = false;
+				bool multiScissor = false;
+				for (int i = 1; i < n; i++) {
+					if (BundlePipeline(bundles[i]) != BundlePipeline(bundles[0]))
+						multiPipeline = true;
+					if (!ScissorsEqual(bundles[i].scissor, bundles[0].scissor))
+						multiScissor = true;
+				}
+				if (multiPipeline && multiScissor) {
+					order.resize(n);
+					for (int i = 0; i < n; i++)
+						order[i] = i;
+					// Greedily pull each draw up next to the previous draw with the same
+					// pipeline, if it provably overlaps nothing in between. Same-pipeline
+					// draws keep their relative order, and the last draw stays put.
+					for (int p = 1; p < n - 1; p++) {
+						int i = order[p];
+						int q = -1;
+						for (int r = p - 1; r >= 0; r--) {
+							if (BundlePipeline(bundles[order[r]]) == BundlePipeline(bundles[i])) {
+								q = r;
+								break;
+							}
+						}
+						if (q < 0 || q == p - 1)
+							continue;
+						bool disjoint = true;
+						for (int r = q + 1; r < p; r++) {
+							if (!ScissorsDisjoint(bundles[order[r]].scissor, bundles[i].scissor)) {
+								disjoint = false;
+								break;
+							}
+						}
+						if (!disjoint)
+							continue;
+						for (int r = p; r > q + 1; r--)
+							order[r] = order[r - 1];
+						order[q + 1] = i;
+						sorted = true;
+					}
+				}
+			}
+
+			if (!sorted) {
+				newCommands.extend(&cmds[runStart], end - runStart);
+			} else {
+				stepChanged = true;
+				int before = 0;
+				VKRGraphicsPipeline *prev = enterPipeline;
+				for (int i = 0; i < n; i++) {
+					if (BundlePipeline(bundles[i]) != prev) {
+						before++;
+						prev = BundlePipeline(bundles[i]);
+					}
+				}
+				// Re-emit the run from the bundles, skipping binds and scissor sets that
+				// the new order made redundant.
+				int after = 0;
+				VKRGraphicsPipeline *lastPipeline = enterPipeline;
+				VkRect2D lastScissor = enterScissor;
+				bool haveLastScissor = haveEnterScissor;
+				for (int p = 0; p < n; p++) {
+					const ReorderBundle &b = bundles[order[p]];
+					if (BundlePipeline(b) != lastPipeline) {
+						newCommands.push_back(b.bind);
+						lastPipeline = BundlePipeline(b);
+						after++;
+					}
+					if (!haveLastScissor || !ScissorsEqual(b.scissor, lastScissor)) {
+						VkRenderData data{ VKRRenderCommand::SCISSOR };
+						data.scissor.scissor = b.scissor;
+						newCommands.push_back(data);
+						lastScissor = b.scissor;
+						haveLastScissor = true;
+					}
+					newCommands.push_back(b.draw);
+				}
+				totalAvoided += before - after;
+				// Binds/scissors trailing the run's last draw re-assert state for what follows.
+				if (lastDrawEnd < end)
+					newCommands.extend(&cmds[lastDrawEnd], end - lastDrawEnd);
+			}
+			runStart = -1;
+			bundles.clear();
+		};
+
+		for (int i = 0; i < (int)cmds.size(); i++) {
+			const VkRenderData &c = cmds[i];
+			bool inRun;
+			switch (c.cmd) {
+			case VKRRenderCommand::BIND_GRAPHICS_PIPELINE:
+			case VKRRenderCommand::SCISSOR:
+				inRun = true;
+				break;
+			case VKRRenderCommand::DRAW:
+			case VKRRenderCommand::DRAW_INDEXED:
+				inRun = haveBind && haveScissor;
+				break;
+			default:
+				inRun = false;
+				break;
+			}
+
+			if (!inRun) {
+				flushRun(i);
+				newCommands.push_back(c);
+				continue;
+			}
+
+			if (runStart < 0) {
+				runStart = i;
+				lastDrawEnd = i;
+				enterPipeline = haveBind ? curBind.graphics_pipeline.pipeline : nullptr;
+				enterScissor = curScissor;
+				haveEnterScissor = haveScissor;
+			}
+
+			switch (c.cmd) {
+			case VKRRenderCommand::BIND_GRAPHICS_PIPELINE:
+				curBind = c;
+				haveBind = true;
+				break;
+			case VKRRenderCommand::SCISSOR:
+				curScissor = c.scissor.scissor;
+				haveScissor = true;
+				break;
+			default:
+				// DRAW / DRAW_INDEXED.
+				bundles.push_back(ReorderBundle{ curBind, c, curScissor });
+				lastDrawEnd = i + 1;
+				if ((int)bundles.size() >= 64) {
+					// Keep the pairwise overlap checks bounded.
+					flushRun(i + 1);
+				}
+				break;
+			}
+		}
+		flushRun((int)cmds.size());
+
+		if (stepChanged)
+			step->commands = std::move(newCommands);
+	}
+	return totalAvoided;
 }
 
 void VulkanQueueRunner::RunSteps(std::vector<VKRStep *> &steps, int curFrame, FrameData &frameData, FrameDataShared &frameDataShared, bool keepSteps) {
@@ -348,6 +712,10 @@ void VulkanQueueRunner::RunSteps(std::vector<VKRStep *> &steps, int curFrame, Fr
 
 	VkCommandBuffer cmd = frameData.hasPresentCommands ? frameData.presentCmd : frameData.mainCmd;
 
+	// Tracks how far ahead QueueTransferBarriers has already queued layout transitions,
+	// so runs of copy/blit steps share one pipeline barrier instead of getting one each.
+	size_t barrierGroupEnd = 0;
+
 	for (size_t i = 0; i < steps.size(); i++) {
 		const VKRStep &step = *steps[i];
 		if (emitLabels) {
@@ -393,12 +761,16 @@ void VulkanQueueRunner::RunSteps(std::vector<VKRStep *> &steps, int curFrame, Fr
 					vkCmdBeginDebugUtilsLabelEXT(cmd, &labelInfo);
 				}
 			}
-			PerformRenderPass(step, cmd, curFrame, frameData.profile);
+			PerformRenderPass(step, cmd, curFrame, frameData, frameDataShared);
 			break;
 		case VKRStepType::COPY:
+			if (i >= barrierGroupEnd)
+				barrierGroupEnd = QueueTransferBarriers(steps, i);
 			PerformCopy(step, cmd);
 			break;
 		case VKRStepType::BLIT:
+			if (i >= barrierGroupEnd)
+				barrierGroupEnd = QueueTransferBarriers(steps, i);
 			PerformBlit(step, cmd);
 			break;
 		case VKRStepType::READBACK:
@@ -939,7 +1311,7 @@ void VulkanQueueRunner::LogReadbackImage(const VKRStep &step) {
 	INFO_LOG(Log::G3D, "%s", StepToString(vulkan_, step).c_str());
 }
 
-void VulkanQueueRunner::PerformRenderPass(const VKRStep &step, VkCommandBuffer cmd, int curFrame, QueueProfileContext &profile) {
+void VulkanQueueRunner::PerformRenderPass(const VKRStep &step, VkCommandBuffer cmd, int curFrame, FrameData &frameData, FrameDataShared &frameDataShared) {
 	for (size_t i = 0; i < step.preTransitions.size(); i++) {
 		const TransitionRequest &iter = step.preTransitions[i];
 		if (iter.aspect == VK_IMAGE_ASPECT_COLOR_BIT && iter.fb->color.layout != iter.targetLayout) {
@@ -1009,8 +1381,77 @@ void VulkanQueueRunner::PerformRenderPass(const VKRStep &step, VkCommandBuffer c
 	// image layouts as part of the passes.
 	//
 	// NOTE: Unconditionally flushes recordBarrier_.
-	VKRRenderPass *renderPass = PerformBindFramebufferAsRenderTarget(step, cmd);
 
+	// Large render passes get split into chunks, recorded on worker threads into pooled
+	// secondary command buffers and stitched together with vkCmdExecuteCommands. The per-pass
+	// draw count we already track decides whether the record cost is worth the dispatch overhead.
+	const int numCommands = (int)step.commands.size();
+	int numChunks = 1;
+	if (frameDataShared.useMultiThreading && step.render.framebuffer && step.render.numDraws >= MIN_DRAWS_FOR_PARALLEL_RECORD) {
+		numChunks = std::min(numCommands / MIN_COMMANDS_PER_RECORD_CHUNK, (int)MAX_SECONDARY_CMD_BUFFERS);
+		if (numChunks < 2) {
+			numChunks = 1;
+		}
+	}
+
+	VKRRenderPass *renderPass = PerformBindFramebufferAsRenderTarget(step, cmd,
+		numChunks > 1 ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+
+	VKRFramebuffer *fb = step.render.framebuffer;
+
+	if (numChunks > 1) {
+		const RenderPassType rpType = step.render.renderPassType;
+
+		VkCommandBufferInheritanceInfo inherit{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
+		inherit.renderPass = renderPass->Get(vulkan_, rpType, fb->sampleCount);
+		inherit.subpass = 0;
+		inherit.framebuffer = fb->Get(renderPass, rpType);
+
+		VkCommandBufferBeginInfo begin{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+		begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+		begin.pInheritanceInfo = &inherit;
+
+		// Grab the command buffers on this thread - each slot has a dedicated pool, which is
+		// what makes it safe to record them concurrently.
+		VkCommandBuffer chunkCmds[MAX_SECONDARY_CMD_BUFFERS];
+		for (int i = 0; i < numChunks; i++) {
+			chunkCmds[i] = frameData.GetSecondaryCmdBuf(vulkan_, i);
+		}
+
+		const int chunkSize = (numCommands + numChunks - 1) / numChunks;
+		ParallelRangeLoop(&g_threadManager, [&](int l, int h) {
+			for (int chunk = l; chunk < h; chunk++) {
+				const int start = chunk * chunkSize;
+				const int end = std::min(start + chunkSize, numCommands);
+				vkBeginCommandBuffer(chunkCmds[chunk], &begin);
+				RecordRenderPassCommands(step, chunkCmds[chunk], curFrame, renderPass, start, end, nullptr);
+				vkEndCommandBuffer(chunkCmds[chunk]);
+			}
+		}, 0, numChunks, 1);
+
+		vkCmdExecuteCommands(cmd, numChunks, chunkCmds);
+	} else {
+		RecordRenderPassCommands(step, cmd, curFrame, renderPass, 0, numCommands, &frameData.profile);
+	}
+	vkCmdEndRenderPass(cmd);
+
+	_dbg_assert_(recordBarrier_.empty());
+
+	if (fb) {
+		// If the desired final layout aren't the optimal layout needed next, early-transition the image.
+		if (step.render.finalColorLayout != fb->color.layout) {
+			recordBarrier_.TransitionColorImageAuto(&fb->color, step.render.finalColorLayout);
+		}
+		if (fb->depth.image && step.render.finalDepthStencilLayout != fb->depth.layout) {
+			recordBarrier_.TransitionDepthStencilImageAuto(&fb->depth, step.render.finalDepthStencilLayout);
+		}
+	}
+}
+
+// Records the drawing commands of a render pass step. Called either for the whole command list,
+// recording inline into the primary command buffer, or for a chunk [first, last) going into a
+// secondary command buffer when the pass has been split for parallel recording.
+void VulkanQueueRunner::RecordRenderPassCommands(const VKRStep &step, VkCommandBuffer cmd, int curFrame, VKRRenderPass *renderPass, int first, int last, QueueProfileContext *profile) {
 	int curWidth = step.render.framebuffer ? step.render.framebuffer->width : vulkan_->GetBackbufferWidth();
 	int curHeight = step.render.framebuffer ? step.render.framebuffer->height : vulkan_->GetBackbufferHeight();
 
@@ -1036,12 +1477,11 @@ void VulkanQueueRunner::PerformRenderPass(const VKRStep &step, VkCommandBuffer c
 
 	const RenderPassType rpType = step.render.renderPassType;
 
-	for (size_t i = 0; i < commands.size(); i++) {
-		const VkRenderData &c = commands[i];
+	auto record = [&](const VkRenderData &c) {
 #ifdef _DEBUG
-		if (profile.enabled) {
-			if ((size_t)step.stepType < ARRAY_SIZE(profile.commandCounts)) {
-				profile.commandCounts[(size_t)c.cmd]++;
+		if (profile && profile->enabled) {
+			if ((size_t)step.stepType < ARRAY_SIZE(profile->commandCounts)) {
+				profile->commandCounts[(size_t)c.cmd]++;
 			}
 		}
 #endif
@@ -1230,23 +1670,43 @@ void VulkanQueueRunner::PerformRenderPass(const VKRStep &step, VkCommandBuffer c
 			ERROR_LOG(Log::G3D, "Unimpl queue command");
 			break;
 		}
-	}
-	vkCmdEndRenderPass(cmd);
-
-	_dbg_assert_(recordBarrier_.empty());
+	};
 
-	if (fb) {
-		// If the desired final layout aren't the optimal layout needed next, early-transition the image.
-		if (step.render.finalColorLayout != fb->color.layout) {
-			recordBarrier_.TransitionColorImageAuto(&fb->color, step.render.finalColorLayout);
+	if (first > 0) {
+		// Secondary command buffers inherit no state from the primary, so replay the most
+		// recent state-setting commands from before this chunk, in their original order.
+		int stateCmds[8];
+		int numStateCmds = 0;
+		uint32_t seen = 0;
+		auto consider = [&](int index, uint32_t bit) {
+			if (!(seen & bit)) {
+				seen |= bit;
+				stateCmds[numStateCmds++] = index;
+			}
+		};
+		for (int i = first - 1; i >= 0 && seen != 0x3F; i--) {
+			switch (commands[i].cmd) {
+			case VKRRenderCommand::BIND_GRAPHICS_PIPELINE: consider(i, 1); break;
+			case VKRRenderCommand::VIEWPORT: consider(i, 2); break;
+			case VKRRenderCommand::SCISSOR: consider(i, 4); break;
+			case VKRRenderCommand::BLEND: consider(i, 8); break;
+			case VKRRenderCommand::STENCIL: consider(i, 16); break;
+			case VKRRenderCommand::PUSH_CONSTANTS: consider(i, 32); break;
+			default: break;
+			}
 		}
-		if (fb->depth.image && step.render.finalDepthStencilLayout != fb->depth.layout) {
-			recordBarrier_.TransitionDepthStencilImageAuto(&fb->depth, step.render.finalDepthStencilLayout);
+		std::sort(stateCmds, stateCmds + numStateCmds);
+		for (int i = 0; i < numStateCmds; i++) {
+			record(commands[stateCmds[i]]);
 		}
 	}
+
+	for (int i = first; i < last; i++) {
+		record(commands[i]);
+	}
 }
 
-VKRRenderPass *VulkanQueueRunner::PerformBindFramebufferAsRenderTarget(const VKRStep &step, VkCommandBuffer cmd) {
+VKRRenderPass *VulkanQueueRunner::PerformBindFramebufferAsRenderTarget(const VKRStep &step, VkCommandBuffer cmd, VkSubpassContents contents) {
 	VKRRenderPass *renderPass;
 	int numClearVals = 0;
 	VkClearValue clearVal[4]{};
@@ -1366,21 +1826,15 @@ VKRRenderPass *VulkanQueueRunner::PerformBindFramebufferAsRenderTarget(const VKR
 	rp_begin.renderArea = rc;
 	rp_begin.clearValueCount = numClearVals;
 	rp_begin.pClearValues = numClearVals ? clearVal : nullptr;
-	vkCmdBeginRenderPass(cmd, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+	vkCmdBeginRenderPass(cmd, &rp_begin, contents);
 
 	return renderPass;
 }
 
-void VulkanQueueRunner::PerformCopy(const VKRStep &step, VkCommandBuffer cmd) {
-	// The barrier code doesn't handle this case. We'd need to transition to GENERAL to do an intra-image copy.
-	_dbg_assert_(step.copy.src != step.copy.dst);
-
+void VulkanQueueRunner::QueueCopyBarriers(const VKRStep &step) {
 	VKRFramebuffer *src = step.copy.src;
 	VKRFramebuffer *dst = step.copy.dst;
 
-	int layerCount = std::min(step.copy.src->numLayers, step.copy.dst->numLayers);
-	_dbg_assert_(step.copy.src->numLayers >= step.copy.dst->numLayers);
-
 	// TODO: If dst covers exactly the whole destination, we can set up a UNDEFINED->TRANSFER_DST_OPTIMAL transition,
 	// which can potentially be more efficient.
 
@@ -1418,7 +1872,22 @@ void VulkanQueueRunner::PerformCopy(const VKRStep &step, VkCommandBuffer cmd) {
 			recordBarrier_.TransitionDepthStencilImageAuto(&dst->msaaDepth, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 		}
 	}
+}
 
+void VulkanQueueRunner::PerformCopy(const VKRStep &step, VkCommandBuffer cmd) {
+	// The barrier code doesn't handle this case. We'd need to transition to GENERAL to do an intra-image copy.
+	_dbg_assert_(step.copy.src != step.copy.dst);
+
+	VKRFramebuffer *src = step.copy.src;
+	VKRFramebuffer *dst = step.copy.dst;
+
+	int layerCount = std::min(step.copy.src->numLayers, step.copy.dst->numLayers);
+	_dbg_assert_(step.copy.src->numLayers >= step.copy.dst->numLayers);
+
+	bool multisampled = src->sampleCount != VK_SAMPLE_COUNT_1_BIT && dst->sampleCount != VK_SAMPLE_COUNT_1_BIT;
+
+	// The layout transitions were queued by QueueTransferBarriers - a no-op here if an
+	// earlier step in the same barrier group already flushed them.
 	recordBarrier_.Flush(cmd);
 
 	VkImageCopy copy{};
@@ -1524,13 +1993,7 @@ void VulkanQueueRunner::PerformCopy(const VKRStep &step, VkCommandBuffer cmd) {
 	}
 }
 
-void VulkanQueueRunner::PerformBlit(const VKRStep &step, VkCommandBuffer cmd) {
-	// The barrier code doesn't handle this case. We'd need to transition to GENERAL to do an intra-image copy.
-	_dbg_assert_(step.blit.src != step.blit.dst);
-
-	int layerCount = std::min(step.blit.src->numLayers, step.blit.dst->numLayers);
-	_dbg_assert_(step.blit.src->numLayers >= step.blit.dst->numLayers);
-
+void VulkanQueueRunner::QueueBlitBarriers(const VKRStep &step) {
 	VKRFramebuffer *src = step.blit.src;
 	VKRFramebuffer *dst = step.blit.dst;
 
@@ -1547,7 +2010,82 @@ void VulkanQueueRunner::PerformBlit(const VKRStep &step, VkCommandBuffer cmd) {
 		recordBarrier_.TransitionDepthStencilImageAuto(&src->depth, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 		recordBarrier_.TransitionDepthStencilImageAuto(&dst->depth, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 	}
+}
+
+// Queues the layout transitions for a run of consecutive copy/blit steps into recordBarrier_,
+// so the whole run shares one vkCmdPipelineBarrier (flushed by the first Perform* below)
+// instead of getting one per step. Depal and framebuffer-copy sequences otherwise emit long
+// chains of tiny barriers that mobile drivers serialize on. A step only joins the run while
+// its images are disjoint from the ones already queued - a step that touches an image an
+// earlier member used needs the execution dependency from its own barrier, so it starts a
+// new run. Returns the index one past the last step that was queued.
+size_t VulkanQueueRunner::QueueTransferBarriers(const std::vector<VKRStep *> &steps, size_t first) {
+	TinySet<VkImage, 8> groupImages;
+	size_t i = first;
+	for (; i < steps.size(); i++) {
+		const VKRStep &step = *steps[i];
+		VKRFramebuffer *src;
+		VKRFramebuffer *dst;
+		VkImageAspectFlags aspectMask;
+		if (step.stepType == VKRStepType::COPY) {
+			src = step.copy.src;
+			dst = step.copy.dst;
+			aspectMask = step.copy.aspectMask;
+		} else if (step.stepType == VKRStepType::BLIT) {
+			src = step.blit.src;
+			dst = step.blit.dst;
+			aspectMask = step.blit.aspectMask;
+		} else {
+			break;
+		}
+
+		TinySet<VkImage, 8> stepImages;
+		if (aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) {
+			stepImages.push_back(src->color.image);
+			stepImages.push_back(dst->color.image);
+		}
+		if (aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+			stepImages.push_back(src->depth.image);
+			stepImages.push_back(dst->depth.image);
+		}
+		if (step.stepType == VKRStepType::COPY && src->sampleCount != VK_SAMPLE_COUNT_1_BIT && dst->sampleCount != VK_SAMPLE_COUNT_1_BIT) {
+			if (aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) {
+				stepImages.push_back(src->msaaColor.image);
+				stepImages.push_back(dst->msaaColor.image);
+			}
+			if (aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+				stepImages.push_back(src->msaaDepth.image);
+				stepImages.push_back(dst->msaaDepth.image);
+			}
+		}
+
+		if (i != first && groupImages.contains(stepImages))
+			break;
+
+		if (step.stepType == VKRStepType::COPY) {
+			QueueCopyBarriers(step);
+		} else {
+			QueueBlitBarriers(step);
+		}
+		for (size_t j = 0; j < stepImages.size(); j++) {
+			groupImages.insert(stepImages[j]);
+		}
+	}
+	return i;
+}
+
+void VulkanQueueRunner::PerformBlit(const VKRStep &step, VkCommandBuffer cmd) {
+	// The barrier code doesn't handle this case. We'd need to transition to GENERAL to do an intra-image copy.
+	_dbg_assert_(step.blit.src != step.blit.dst);
+
+	int layerCount = std::min(step.blit.src->numLayers, step.blit.dst->numLayers);
+	_dbg_assert_(step.blit.src->numLayers >= step.blit.dst->numLayers);
+
+	VKRFramebuffer *src = step.blit.src;
+	VKRFramebuffer *dst = step.blit.dst;
 
+	// The layout transitions were queued by QueueTransferBarriers - a no-op here if an
+	// earlier step in the same barrier group already flushed them.
 	recordBarrier_.Flush(cmd);
 
 	// If any validation needs to be performed here, it should probably have been done
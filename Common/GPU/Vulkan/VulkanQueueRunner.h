@@ -267,14 +267,23 @@ public:
 		hacksEnabled_ = hacks;
 	}
 
+	// Stats from the last PreprocessSteps, for the profiler display.
+	int GetNumPassesMerged() const { return numPassesMerged_; }
+	int GetNumStoresDemoted() const { return numStoresDemoted_; }
+	int GetNumPipelineSwitchesAvoided() const { return numPipelineSwitchesAvoided_; }
+
 private:
 	bool InitBackbufferFramebuffers(int width, int height);
 	bool InitDepthStencilBuffer(VkCommandBuffer cmd, VulkanBarrierBatch *barriers);  // Used for non-buffered rendering.
 
-	VKRRenderPass *PerformBindFramebufferAsRenderTarget(const VKRStep &pass, VkCommandBuffer cmd);
-	void PerformRenderPass(const VKRStep &pass, VkCommandBuffer cmd, int curFrame, QueueProfileContext &profile);
+	VKRRenderPass *PerformBindFramebufferAsRenderTarget(const VKRStep &pass, VkCommandBuffer cmd, VkSubpassContents contents);
+	void PerformRenderPass(const VKRStep &pass, VkCommandBuffer cmd, int curFrame, FrameData &frameData, FrameDataShared &frameDataShared);
+	void RecordRenderPassCommands(const VKRStep &step, VkCommandBuffer cmd, int curFrame, VKRRenderPass *renderPass, int first, int last, QueueProfileContext *profile);
 	void PerformCopy(const VKRStep &pass, VkCommandBuffer cmd);
 	void PerformBlit(const VKRStep &pass, VkCommandBuffer cmd);
+	void QueueCopyBarriers(const VKRStep &step);
+	void QueueBlitBarriers(const VKRStep &step);
+	size_t QueueTransferBarriers(const std::vector<VKRStep *> &steps, size_t first);
 	void PerformReadback(const VKRStep &pass, VkCommandBuffer cmd, FrameData &frameData);
 	void PerformReadbackImage(const VKRStep &pass, VkCommandBuffer cmd);
 
@@ -289,6 +298,8 @@ private:
 	static void ApplyMGSHack(std::vector<VKRStep *> &steps);
 	static void ApplySonicHack(std::vector<VKRStep *> &steps);
 	static void ApplyRenderPassMerge(std::vector<VKRStep *> &steps);
+	static int ApplyStoreDemotion(std::vector<VKRStep *> &steps);
+	static int ApplyDrawReorder(std::vector<VKRStep *> &steps);
 
 	static void SetupTransferDstWriteAfterWrite(VKRImage &img, VkImageAspectFlags aspect, VulkanBarrierBatch *recordBarrier);
 
@@ -311,6 +322,11 @@ private:
 	// TODO: Enable based on compat.ini.
 	uint32_t hacksEnabled_ = 0;
 
+	// Counters from the last PreprocessSteps, displayed in the profiler.
+	int numPassesMerged_ = 0;
+	int numStoresDemoted_ = 0;
+	int numPipelineSwitchesAvoided_ = 0;
+
 	// Image barrier helper used during command buffer record (PerformRenderPass etc).
 	// Stored here to help reuse the allocation.
 
@@ -2,6 +2,7 @@
 #include <cstdint>
 
 #include <map>
+#include <set>
 #include <sstream>
 
 #include "Common/Log.h"
@@ -248,7 +249,7 @@ struct SinglePipelineTask {
 
 class CreateMultiPipelinesTask : public Task {
 public:
-	CreateMultiPipelinesTask(VulkanContext *vulkan, std::vector<SinglePipelineTask> tasks) : vulkan_(vulkan), tasks_(std::move(tasks)) {
+	CreateMultiPipelinesTask(VulkanContext *vulkan, std::vector<SinglePipelineTask> tasks, TaskPriority priority) : vulkan_(vulkan), tasks_(std::move(tasks)), priority_(priority) {
 		tasksInFlight_.fetch_add(1);
 	}
 	~CreateMultiPipelinesTask() = default;
@@ -258,7 +259,7 @@ public:
 	}
 
 	TaskPriority Priority() const override {
-		return TaskPriority::HIGH;
+		return priority_;
 	}
 
 	void Run() override {
@@ -270,6 +271,7 @@ public:
 
 	VulkanContext *vulkan_;
 	std::vector<SinglePipelineTask> tasks_;
+	TaskPriority priority_;
 
 	// Use during shutdown to make sure there aren't any leftover tasks sitting queued.
 	// Could probably be done more elegantly. Like waiting for all tasks of a type, or saving pointers to them, or something...
@@ -472,6 +474,7 @@ void VulkanRenderManager::CompileThreadFunc() {
 			}
 			toCompile = std::move(compileQueue_);
 			compileQueue_.clear();
+			compileQueueDepth_.store(0, std::memory_order_relaxed);
 			if (!runCompileThread_) {
 				exitAfterCompile = true;
 			}
@@ -481,6 +484,8 @@ void VulkanRenderManager::CompileThreadFunc() {
 
 		// Here we sort the pending pipelines by vertex and fragment shaders,
 		std::map<std::pair<Promise<VkShaderModule> *, Promise<VkShaderModule> *>, std::vector<SinglePipelineTask>> map;
+		// Shader pairs where at least one pipeline has a draw waiting on it.
+		std::set<std::pair<Promise<VkShaderModule> *, Promise<VkShaderModule> *>> neededPairs;
 
 		double scheduleTime = time_now_d();
 
@@ -492,7 +497,8 @@ void VulkanRenderManager::CompileThreadFunc() {
 			switch (entry.type) {
 			case CompileQueueEntry::Type::GRAPHICS:
 			{
-				map[std::make_pair(entry.graphics->desc->vertexShader, entry.graphics->desc->fragmentShader)].push_back(
+				auto key = std::make_pair(entry.graphics->desc->vertexShader, entry.graphics->desc->fragmentShader);
+				map[key].push_back(
 					SinglePipelineTask{
 						entry.graphics,
 						entry.compatibleRenderPass,
@@ -502,6 +508,8 @@ void VulkanRenderManager::CompileThreadFunc() {
 						countToCompile,
 					}
 				);
+				if (entry.needed)
+					neededPairs.insert(key);
 				break;
 			}
 			}
@@ -513,7 +521,10 @@ void VulkanRenderManager::CompileThreadFunc() {
 
 			// NOTICE_LOG(Log::G3D, "For this shader pair, we have %d pipelines to create", (int)entries.size());
 
-			Task *task = new CreateMultiPipelinesTask(vulkan_, entries);
+			// Pipelines a pending draw is waiting for preempt speculative compiles
+			// (shader cache preloads) on the task queue.
+			TaskPriority priority = neededPairs.count(shaders) != 0 ? TaskPriority::HIGH : TaskPriority::LOW;
+			Task *task = new CreateMultiPipelinesTask(vulkan_, entries, priority);
 			g_threadManager.EnqueueTask(task);
 		}
 
@@ -616,8 +627,35 @@ void VulkanRenderManager::PollPresentTiming() {
 	}
 }
 
+// Auto-tune the inflight frame count from the time BeginFrame spends blocked on the frame
+// fence. Long waits mean the GPU is far behind and deeper buffering will hide hitches,
+// while consistently instant fences mean we can shrink the queue and cut input latency.
+void VulkanRenderManager::TuneInflightFrames(double fenceWaitSeconds) {
+	fenceWaitEwma_ += (fenceWaitSeconds - fenceWaitEwma_) * (1.0 / 16.0);
+	if (++inflightTuneFrameCount_ < 120) {
+		return;
+	}
+	inflightTuneFrameCount_ = 0;
+
+	const int current = vulkan_->GetInflightFrames();
+	int target = current;
+	// The thresholds are far apart on purpose (hysteresis), so a workload that sits near
+	// one of them doesn't make us oscillate between depths.
+	if (fenceWaitEwma_ > 0.004 && current < inflightFramesAtStart_) {
+		target = current + 1;
+	} else if (fenceWaitEwma_ < 0.0005 && current > 1) {
+		target = current - 1;
+	}
+	if (target != current) {
+		INFO_LOG(Log::G3D, "Auto-tuning inflight frames %d -> %d (avg fence wait %0.2f ms)", current, target, fenceWaitEwma_ * 1000.0);
+		newInflightFrames_ = target;
+		// Re-converge at the new depth before judging again.
+		fenceWaitEwma_ = 0.0;
+	}
+}
+
 void VulkanRenderManager::BeginFrame(bool enableProfiling, bool enableLogProfiler) {
-	double frameBeginTime = time_now_d()
+	double frameBeginTime = time_now_d();
 	VLOG("BeginFrame");
 	VkDevice device = vulkan_->GetDevice();
 
@@ -642,6 +680,30 @@ void VulkanRenderManager::BeginFrame(bool enableProfiling, bool enableLogProfile
 	}
 	vkResetFences(device, 1, &frameData.fence);
 
+	if (autoInflightFrames_) {
+		TuneInflightFrames(time_now_d() - frameBeginTime);
+
+		// Apply a pending auto-tune step here, where we know frame 0's fence has signaled.
+		// Draining the remaining frames makes it safe to change the cycle length.
+		if (newInflightFrames_ != -1 && curFrame == 0) {
+			for (int i = 1; i < vulkan_->GetInflightFrames(); i++) {
+				FrameData &fd = frameData_[i];
+				if (useRenderThread_) {
+					std::unique_lock<std::mutex> lock(fd.fenceMutex);
+					while (!fd.readyForFence) {
+						fd.fenceCondVar.wait(lock);
+					}
+					// Don't consume readyForFence - the next BeginFrame for this frame
+					// still needs to see it.
+				}
+				vkWaitForFences(device, 1, &fd.fence, true, UINT64_MAX);
+			}
+			INFO_LOG(Log::G3D, "Updating inflight frames to %d", newInflightFrames_);
+			vulkan_->UpdateInflightFrames(newInflightFrames_);
+			newInflightFrames_ = -1;
+		}
+	}
+
 	uint64_t frameId = frameIdGen_++;
 
 	PollPresentTiming();
@@ -689,6 +751,8 @@ void VulkanRenderManager::BeginFrame(bool enableProfiling, bool enableLogProfile
 				str << line;
 				snprintf(line, sizeof(line), "Resource deletions: %d\n", vulkan_->GetLastDeleteCount());
 				str << line;
+				snprintf(line, sizeof(line), "Passes merged: %d, stores demoted: %d, switches avoided: %d\n", queueRunner_.GetNumPassesMerged(), queueRunner_.GetNumStoresDemoted(), queueRunner_.GetNumPipelineSwitchesAvoided());
+				str << line;
 				for (int i = 0; i < numQueries - 1; i++) {
 					uint64_t diff = (queryResults[i + 1] - queryResults[i]) & timestampDiffMask;
 					double milliseconds = (double)diff * timestampConversionFactor;
@@ -719,6 +783,8 @@ void VulkanRenderManager::BeginFrame(bool enableProfiling, bool enableLogProfile
 			str << line;
 			snprintf(line, sizeof(line), "Descriptors written: %d\n", frameData.profile.descriptorsWritten);
 			str << line;
+			snprintf(line, sizeof(line), "Passes merged: %d, stores demoted: %d, switches avoided: %d\n", queueRunner_.GetNumPassesMerged(), queueRunner_.GetNumStoresDemoted(), queueRunner_.GetNumPipelineSwitchesAvoided());
+			str << line;
 			frameData.profile.profileSummary = str.str();
 		}
 
@@ -824,6 +890,7 @@ VKRGraphicsPipeline *VulkanRenderManager::CreateGraphicsPipeline(VKRGraphicsPipe
 			compileQueue_.emplace_back(pipeline, compatibleRenderPass->Get(vulkan_, rpType, sampleCount), rpType, sampleCount);
 			needsCompile = true;
 		}
+		compileQueueDepth_.store((int)compileQueue_.size(), std::memory_order_relaxed);
 		if (needsCompile)
 			compileCond_.notify_one();
 	}
@@ -880,10 +947,11 @@ void VulkanRenderManager::EndCurRenderStep() {
 		if (!pipeline->pipeline[(size_t)rpType]) {
 			pipeline->pipeline[(size_t)rpType] = Promise<VkPipeline>::CreateEmpty();
 			_assert_(renderPass);
-			compileQueue_.push_back(CompileQueueEntry(pipeline, renderPass->Get(vulkan_, rpType, sampleCount), rpType, sampleCount));
+			compileQueue_.push_back(CompileQueueEntry(pipeline, renderPass->Get(vulkan_, rpType, sampleCount), rpType, sampleCount, true));
 			needsCompile = true;
 		}
 	}
+	compileQueueDepth_.store((int)compileQueue_.size(), std::memory_order_relaxed);
 	if (needsCompile)
 		compileCond_.notify_one();
 	compileQueueMutex_.unlock();
@@ -1520,6 +1588,7 @@ void VulkanRenderManager::Run(VKRRenderThreadTask &task) {
 		// Effectively resets both main and present command buffers, since they both live in this pool.
 		// We always record main commands first, so we don't need to reset the present command buffer separately.
 		vkResetCommandPool(vulkan_->GetDevice(), frameData.cmdPoolMain, 0);
+		frameData.ResetSecondaryCmdPools(vulkan_);
 
 		VkCommandBufferBeginInfo begin{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
 		begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -1744,8 +1813,11 @@ void VKRPipelineLayout::FlushDescSets(VulkanContext *vulkan, int frame, QueuePro
 	VulkanDescSetPool &pool = data.pool;
 	FastVec<PackedDescriptor> &descData = data.descData_;
 	FastVec<PendingDescSet> &descSets = data.descSets_;
+	auto &descCache = data.descCache_;
 
 	pool.Reset();
+	// The cached sets were allocated from the pool we just reset.
+	descCache.Clear();
 
 	VkDescriptorSet setCache[8];
 	VkDescriptorSetLayout layoutsForAlloc[ARRAY_SIZE(setCache)];
@@ -1791,6 +1863,17 @@ void VKRPipelineLayout::FlushDescSets(VulkanContext *vulkan, int frame, QueuePro
 			}
 		}
 
+		// Then check the hash cache - games tend to bind the same few texture/sampler/buffer
+		// combinations over and over again across render passes, not just back to back.
+		// We don't handle hash collisions, they're astronomically unlikely with a 64-bit hash.
+		const uint64_t descHash = XXH3_64bits(descData.data() + d.offset, d.count * sizeof(PackedDescriptor));
+		VkDescriptorSet cachedSet;
+		if (descCache.Get(descHash, &cachedSet)) {
+			d.set = cachedSet;
+			dedupCount++;
+			continue;
+		}
+
 		if (setsUsed < ARRAY_SIZE(setCache)) {
 			d.set = setCache[setsUsed++];
 		} else {
@@ -1862,6 +1945,7 @@ void VKRPipelineLayout::FlushDescSets(VulkanContext *vulkan, int frame, QueuePro
 
 		vkUpdateDescriptorSets(vulkan->GetDevice(), numWrites, writes, 0, nullptr);
 
+		descCache.Insert(descHash, d.set);
 		writeCount++;
 	}
 
@@ -151,8 +151,8 @@ private:
 };
 
 struct CompileQueueEntry {
-	CompileQueueEntry(VKRGraphicsPipeline *p, VkRenderPass _compatibleRenderPass, RenderPassType _renderPassType, VkSampleCountFlagBits _sampleCount)
-		: type(Type::GRAPHICS), graphics(p), compatibleRenderPass(_compatibleRenderPass), renderPassType(_renderPassType), sampleCount(_sampleCount) {}
+	CompileQueueEntry(VKRGraphicsPipeline *p, VkRenderPass _compatibleRenderPass, RenderPassType _renderPassType, VkSampleCountFlagBits _sampleCount, bool _needed = false)
+		: type(Type::GRAPHICS), graphics(p), compatibleRenderPass(_compatibleRenderPass), renderPassType(_renderPassType), sampleCount(_sampleCount), needed(_needed) {}
 	enum class Type {
 		GRAPHICS,
 	};
@@ -161,6 +161,9 @@ struct CompileQueueEntry {
 	RenderPassType renderPassType;
 	VKRGraphicsPipeline* graphics = nullptr;
 	VkSampleCountFlagBits sampleCount;
+	// True if a pending draw is waiting on this pipeline - these are dispatched at
+	// high priority, ahead of speculative compiles from the shader cache.
+	bool needed;
 };
 
 // Pending descriptor sets.
@@ -206,7 +209,7 @@ struct VKRPipelineLayout {
 	const char *tag = nullptr;
 
 	struct FrameData {
-		FrameData() : pool("N/A", true) {}
+		FrameData() : pool("N/A", true), descCache_(512) {}
 
 		VulkanDescSetPool pool;
 		FastVec<PackedDescriptor> descData_;
@@ -214,6 +217,10 @@ struct VKRPipelineLayout {
 		// TODO: We should be able to get away with a single descData_/descSets_ and then send it along,
 		// but it's easier to just segregate by frame id.
 		int flushedDescriptors_ = 0;
+
+		// Dedup cache for descriptor writes: hash of the packed descriptor data -> written set.
+		// Cleared whenever the pool is reset, since the cached sets don't outlive it.
+		DenseHashMap<uint64_t, VkDescriptorSet> descCache_;
 	};
 
 	FrameData frameData[VulkanContext::MAX_INFLIGHT_FRAMES];
@@ -508,6 +515,11 @@ public:
 	}
 
 	void SetInflightFrames(int f) {
+		// 0 means auto: step between 1 and the max at runtime based on measured
+		// fence waits. See TuneInflightFrames.
+		autoInflightFrames_ = f == 0;
+		if (autoInflightFrames_)
+			return;
 		newInflightFrames_ = f < 1 || f > VulkanContext::MAX_INFLIGHT_FRAMES ? VulkanContext::MAX_INFLIGHT_FRAMES : f;
 	}
 
@@ -542,6 +554,11 @@ public:
 		return steps_.size();
 	}
 
+	// For the debug overlay - how many pipelines are waiting for the compile thread.
+	int GetCompileQueueDepth() const {
+		return compileQueueDepth_.load(std::memory_order_relaxed);
+	}
+
 private:
 	void EndCurRenderStep();
 
@@ -563,9 +580,14 @@ private:
 
 	FrameDataShared frameDataShared_;
 
+	void TuneInflightFrames(double fenceWaitSeconds);
+
 	FrameData frameData_[VulkanContext::MAX_INFLIGHT_FRAMES];
 	int newInflightFrames_ = -1;
 	int inflightFramesAtStart_ = 0;
+	bool autoInflightFrames_ = false;
+	double fenceWaitEwma_ = 0.0;
+	int inflightTuneFrameCount_ = 0;
 
 	int outOfDateFrames_ = 0;
 
@@ -617,6 +639,7 @@ private:
 	std::condition_variable compileCond_;
 	std::mutex compileQueueMutex_;
 	std::vector<CompileQueueEntry> compileQueue_;
+	std::atomic<int> compileQueueDepth_{};
 
 	// Thread for measuring presentation delay.
 	std::thread presentWaitThread_;
@@ -965,6 +965,13 @@ VKContext::VKContext(VulkanContext *vulkan, bool useRenderThread)
 		caps_.verySlowShaderCompiler = true;
 	}
 
+	const VkPhysicalDeviceMemoryProperties &memoryProps = vulkan->GetMemoryProperties();
+	for (uint32_t i = 0; i < memoryProps.memoryHeapCount; i++) {
+		if (memoryProps.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+			caps_.deviceLocalMemoryBytes += memoryProps.memoryHeaps[i].size;
+		}
+	}
+
 	// Hide D3D9 when we know it likely won't work well.
 #if PPSSPP_PLATFORM(WINDOWS)
 	caps_.supportsD3D9 = true;
@@ -629,6 +629,11 @@ struct DeviceCaps {
 	PresentMode presentModesSupported;
 
 	u32 multiSampleLevelsMask;  // Bit n is set if (1 << n) is a valid multisample level. Bit 0 is always set.
+
+	// Total device-local memory, summed over heaps. 0 when the backend can't tell.
+	// Used for budgeting caches that live in VRAM.
+	u64 deviceLocalMemoryBytes;
+
 	std::string deviceName;  // The device name to use when creating the thin3d context, to get the same one.
 };
 
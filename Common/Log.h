@@ -82,7 +82,23 @@ void GenericLog(LogLevel level, Log type, const char *file, int line, const char
 		;
 bool GenericLogEnabled(LogLevel level, Log type);
 
+struct LogChannel {
+	char m_shortName[32]{};
+	// Defaults are fully open so that logging works before LogManager::Init() -
+	// the real defaults get applied there.
+	LogLevel level = LogLevel::LVERBOSE;
+	bool enabled = true;
+};
+
+// Owned and configured by LogManager, but global so the macros below can check
+// the channel level inline - a disabled-level log in a hot path (like the syscall
+// dispatcher) is then just a table load and compare, no call.
+extern LogChannel g_logChannels[(size_t)Log::NUMBER_OF_LOGS];
+
 // Exception for Windows - enable more log levels in release mode than on other platforms.
+// Hot translation units can pre-define MAX_LOGLEVEL before their first include of this
+// header to strip their debug-level logging at compile time.
+#ifndef MAX_LOGLEVEL
 #if defined(_DEBUG) || defined(_WIN32)
 
 // Needs to be an int (and not use the enum) because it's used by the preprocessor!
@@ -90,16 +106,14 @@ bool GenericLogEnabled(LogLevel level, Log type);
 
 #else
 
-#ifndef MAX_LOGLEVEL
 #define MAX_LOGLEVEL INFO_LEVEL
-#endif // loglevel
 
 #endif // logging
+#endif // loglevel
 
-// Let the compiler optimize this out.
-// TODO: Compute a dynamic max level as well that can be checked here.
+// Let the compiler optimize the level check out, and the channel check stays branch-predictable.
 #define GENERIC_LOG(t, v, ...) { \
-	if ((int)v <= MAX_LOGLEVEL) \
+	if ((int)v <= MAX_LOGLEVEL && (int)v <= (int)g_logChannels[(size_t)(t)].level && g_logChannels[(size_t)(t)].enabled) \
 		GenericLog(v, t, __FILE__, __LINE__, __VA_ARGS__); \
 	}
 
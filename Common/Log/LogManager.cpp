@@ -44,6 +44,9 @@ const char *hleCurrentThreadName = nullptr;
 
 bool *g_bLogEnabledSetting = nullptr;
 
+// The log macros check this directly, see Log.h. LogManager owns the configuration.
+LogChannel g_logChannels[(size_t)Log::NUMBER_OF_LOGS];
+
 static const char level_to_char[8] = "-NEWIDV";
 
 #if PPSSPP_PLATFORM(UWP) && defined(_DEBUG)
@@ -126,12 +129,12 @@ LogManager::LogManager(bool *enabledSetting) {
 	_dbg_assert_(ARRAY_SIZE(g_logTypeNames) == (size_t)Log::NUMBER_OF_LOGS);
 
 	for (size_t i = 0; i < ARRAY_SIZE(g_logTypeNames); i++) {
-		truncate_cpy(log_[i].m_shortName, g_logTypeNames[i]);
-		log_[i].enabled = true;
+		truncate_cpy(g_logChannels[i].m_shortName, g_logTypeNames[i]);
+		g_logChannels[i].enabled = true;
 #if defined(_DEBUG)
-		log_[i].level = LogLevel::LDEBUG;
+		g_logChannels[i].level = LogLevel::LDEBUG;
 #else
-		log_[i].level = LogLevel::LINFO;
+		g_logChannels[i].level = LogLevel::LINFO;
 #endif
 	}
 
@@ -215,8 +218,8 @@ void LogManager::ChangeFileLog(const char *filename) {
 
 void LogManager::SaveConfig(Section *section) {
 	for (int i = 0; i < (int)Log::NUMBER_OF_LOGS; i++) {
-		section->Set((std::string(log_[i].m_shortName) + "Enabled"), log_[i].enabled);
-		section->Set((std::string(log_[i].m_shortName) + "Level"), (int)log_[i].level);
+		section->Set((std::string(g_logChannels[i].m_shortName) + "Enabled"), g_logChannels[i].enabled);
+		section->Set((std::string(g_logChannels[i].m_shortName) + "Level"), (int)g_logChannels[i].level);
 	}
 }
 
@@ -224,15 +227,15 @@ void LogManager::LoadConfig(const Section *section, bool debugDefaults) {
 	for (int i = 0; i < (int)Log::NUMBER_OF_LOGS; i++) {
 		bool enabled = false;
 		int level = 0;
-		section->Get((std::string(log_[i].m_shortName) + "Enabled"), &enabled, true);
-		section->Get((std::string(log_[i].m_shortName) + "Level"), &level, (int)(debugDefaults ? LogLevel::LDEBUG : LogLevel::LERROR));
-		log_[i].enabled = enabled;
-		log_[i].level = (LogLevel)level;
+		section->Get((std::string(g_logChannels[i].m_shortName) + "Enabled"), &enabled, true);
+		section->Get((std::string(g_logChannels[i].m_shortName) + "Level"), &level, (int)(debugDefaults ? LogLevel::LDEBUG : LogLevel::LERROR));
+		g_logChannels[i].enabled = enabled;
+		g_logChannels[i].level = (LogLevel)level;
 	}
 }
 
 void LogManager::LogLine(LogLevel level, Log type, const char *file, int line, const char *format, va_list args) {
-	const LogChannel &log = log_[(size_t)type];
+	const LogChannel &log = g_logChannels[(size_t)type];
 	if (level > log.level || !log.enabled)
 		return;
 
@@ -289,7 +292,7 @@ void LogManager::LogLine(LogLevel level, Log type, const char *file, int line, c
 }
 
 bool LogManager::IsEnabled(LogLevel level, Log type) {
-	LogChannel &log = log_[(size_t)type];
+	LogChannel &log = g_logChannels[(size_t)type];
 	if (level > log.level || !log.enabled)
 		return false;
 	return true;
@@ -97,12 +97,6 @@ private:
 // on Android etc.
 // class BufferedLogListener { ... }
 
-struct LogChannel {
-	char m_shortName[32]{};
-	LogLevel level;
-	bool enabled;
-};
-
 class ConsoleListener;
 class StdioListener;
 
@@ -115,7 +109,6 @@ private:
 	LogManager(const LogManager &) = delete;
 	void operator=(const LogManager &) = delete;
 
-	LogChannel log_[(size_t)Log::NUMBER_OF_LOGS];
 	FileLogListener *fileLog_ = nullptr;
 #if PPSSPP_PLATFORM(WINDOWS)
 	ConsoleListener *consoleLog_ = nullptr;
@@ -140,25 +133,25 @@ public:
 	bool IsEnabled(LogLevel level, Log type);
 
 	LogChannel *GetLogChannel(Log type) {
-		return &log_[(size_t)type];
+		return &g_logChannels[(size_t)type];
 	}
 
 	void SetLogLevel(Log type, LogLevel level) {
-		log_[(size_t)type].level = level;
+		g_logChannels[(size_t)type].level = level;
 	}
 
 	void SetAllLogLevels(LogLevel level) {
 		for (int i = 0; i < (int)Log::NUMBER_OF_LOGS; ++i) {
-			log_[i].level = level;
+			g_logChannels[i].level = level;
 		}
 	}
 
 	void SetEnabled(Log type, bool enable) {
-		log_[(size_t)type].enabled = enable;
+		g_logChannels[(size_t)type].enabled = enable;
 	}
 
 	LogLevel GetLogLevel(Log type) {
-		return log_[(size_t)type].level;
+		return g_logChannels[(size_t)type].level;
 	}
 
 #if PPSSPP_PLATFORM(WINDOWS)
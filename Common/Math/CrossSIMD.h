@@ -17,6 +17,25 @@
 #define DO_NOT_VECTORIZE_LOOP
 #endif
 
+// Read-prefetch hint for streaming loops. Just a hint - never faults, so it's fine
+// to issue past the end of a buffer.
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH_READ(ptr) __builtin_prefetch((const void *)(ptr), 0, 3)
+#elif PPSSPP_ARCH(SSE2)
+#define PREFETCH_READ(ptr) _mm_prefetch((const char *)(ptr), _MM_HINT_T0)
+#else
+#define PREFETCH_READ(ptr) ((void)0)
+#endif
+
+// How far ahead of the current read position streaming loops should prefetch, in
+// bytes. Mobile SoCs have small L2s, so a short lead avoids evicting lines before
+// they're consumed; desktop parts can run further ahead.
+#if PPSSPP_ARCH(ARM) || PPSSPP_ARCH(ARM64)
+#define PREFETCH_DISTANCE 128
+#else
+#define PREFETCH_DISTANCE 256
+#endif
+
 #if PPSSPP_ARCH(SSE2)
 #include <emmintrin.h>
 #endif
@@ -1,6 +1,8 @@
 // Ultra-lightweight category profiler with history.
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <mutex>
 #include <vector>
 #include <cstring>
@@ -9,6 +11,8 @@
 
 #include "Common/Render/DrawBuffer.h"
 
+#include "Common/StringUtils.h"
+#include "Common/Thread/ThreadUtil.h"
 #include "Common/TimeUtil.h"
 #include "Common/Profiler/Profiler.h"
 #include "Common/Log.h"
@@ -46,9 +50,30 @@ struct Profiler {
 	int depth[MAX_THREADS];
 	int parentCategory[MAX_THREADS][MAX_DEPTH];
 	double eventStart[MAX_THREADS][MAX_CATEGORIES];
+	// Real scope entry times for trace capture - unlike eventStart, these aren't
+	// reset by the suspend/resume bookkeeping, so they span the whole scope.
+	double spanStart[MAX_THREADS][MAX_DEPTH];
 	double curFrameStart;
 };
 
+// Trace capture. The overlay aggregates per category and frame - for handing a
+// trace to someone, we instead record every individual scope while capturing
+// and write them out in Chrome's Trace Event Format (readable by Perfetto).
+struct TraceEvent {
+	const char *name;  // Points into categories[], so guaranteed alive.
+	int threadId;
+	double start;
+	double end;
+};
+
+static const size_t MAX_TRACE_EVENTS = 1000000;
+
+static std::vector<TraceEvent> traceEvents;
+static std::mutex traceLock;
+static std::atomic<bool> traceCapturing{ false };
+static double traceStartTime;
+static char traceThreadNames[MAX_THREADS][64];
+
 static Profiler profiler;
 static Category categories[MAX_CATEGORIES];
 static std::mutex categoriesLock;
@@ -149,6 +174,10 @@ int internal_profiler_enter(const char *category_name, int *out_thread_id) {
 		DEBUG_LOG(Log::System, "profiler: recursive enter (%i - %s)", category, category_name);
 	}
 
+	if (traceCapturing.load(std::memory_order_relaxed) && depth < MAX_DEPTH) {
+		profiler.spanStart[thread_id][depth] = time_now_d();
+	}
+
 	depth++;
 	profiler.parentCategory[thread_id][depth] = category;
 
@@ -184,6 +213,25 @@ void internal_profiler_leave(int thread_id, int category) {
 			internal_profiler_resume(thread_id, parent, now);
 		}
 	}
+
+	if (traceCapturing.load(std::memory_order_relaxed) && depth < MAX_DEPTH) {
+		std::lock_guard<std::mutex> guard(traceLock);
+		if (traceEvents.size() < MAX_TRACE_EVENTS) {
+			if (!traceThreadNames[thread_id][0]) {
+				const char *threadName = GetCurrentThreadName();
+				truncate_cpy(traceThreadNames[thread_id], threadName ? threadName : "unknown");
+			}
+			double start = profiler.spanStart[thread_id][depth];
+			// Scopes already open when capture started have a stale start time, skip those.
+			if (start >= traceStartTime) {
+				traceEvents.push_back(TraceEvent{ categories[category].name, thread_id, start, now });
+			}
+		} else {
+			// Out of space - stop capturing rather than drop events silently.
+			traceCapturing = false;
+			WARN_LOG(Log::System, "Trace capture buffer full (%d events), capture stopped", (int)MAX_TRACE_EVENTS);
+		}
+	}
 }
 
 void internal_profiler_end_frame() {
@@ -195,6 +243,53 @@ void internal_profiler_end_frame() {
 	memset(&history[MAX_THREADS * profiler.historyPos], 0, sizeof(CategoryFrame) * MAX_THREADS);
 }
 
+void internal_profiler_start_capture() {
+	std::lock_guard<std::mutex> guard(traceLock);
+	traceEvents.clear();
+	traceEvents.reserve(65536);
+	memset(traceThreadNames, 0, sizeof(traceThreadNames));
+	traceStartTime = time_now_d();
+	traceCapturing = true;
+	INFO_LOG(Log::System, "Trace capture started");
+}
+
+bool internal_profiler_is_capturing() {
+	return traceCapturing;
+}
+
+bool internal_profiler_stop_capture_and_write(const char *filename) {
+	traceCapturing = false;
+	std::lock_guard<std::mutex> guard(traceLock);
+
+	FILE *f = fopen(filename, "w");
+	if (!f) {
+		WARN_LOG(Log::System, "Failed to open '%s' for trace write", filename);
+		traceEvents.clear();
+		return false;
+	}
+
+	// Trace Event Format, JSON array flavor. Times are microseconds relative to the
+	// start of the capture. Category names are plain identifiers, no JSON escaping needed.
+	fprintf(f, "[\n");
+	for (int i = 0; i < MAX_THREADS; i++) {
+		if (traceThreadNames[i][0]) {
+			fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n", i, traceThreadNames[i]);
+		}
+	}
+	for (size_t i = 0; i < traceEvents.size(); i++) {
+		const TraceEvent &ev = traceEvents[i];
+		fprintf(f, "{\"name\":\"%s\",\"cat\":\"profile\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}%s\n",
+			ev.name, (ev.start - traceStartTime) * 1000000.0, (ev.end - ev.start) * 1000000.0, ev.threadId,
+			i + 1 < traceEvents.size() ? "," : "");
+	}
+	fprintf(f, "]\n");
+	fclose(f);
+
+	INFO_LOG(Log::System, "Wrote %d trace events to '%s'", (int)traceEvents.size(), filename);
+	traceEvents.clear();
+	return true;
+}
+
 const char *Profiler_GetCategoryName(int i) {
 	return i >= 0 ? categories[i].name : "N/A";
 }
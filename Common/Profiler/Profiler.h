@@ -14,6 +14,14 @@ void internal_profiler_end_frame();
 int internal_profiler_enter(const char *category_name, int *thread_id);  // Returns the category number.
 void internal_profiler_leave(int thread_id, int category);
 
+// Chrome trace capture. While capturing, every scope on every profiled thread is
+// recorded as a complete event; stopping writes Trace Event Format JSON, which loads
+// in ui.perfetto.dev and chrome://tracing. Capture stops by itself if the event
+// buffer fills up.
+void internal_profiler_start_capture();
+bool internal_profiler_stop_capture_and_write(const char *filename);
+bool internal_profiler_is_capturing();
+
 const char *Profiler_GetCategoryName(int i);
 int Profiler_GetNumCategories();
 int Profiler_GetHistoryLength();
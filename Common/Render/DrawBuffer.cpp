@@ -3,6 +3,8 @@
 #include <vector>
 #include <stddef.h>
 
+#include "ext/xxhash.h"
+
 #include "Common/System/Display.h"
 #include "Common/Math/math_util.h"
 #include "Common/Render/TextureAtlas.h"
@@ -80,6 +82,9 @@ void DrawBuffer::Flush(bool set_blend_state) {
 	ub.tint = tint_;
 	ub.saturation = saturation_;
 	draw_->UpdateDynamicUniformBuffer(&ub, sizeof(ub));
+	// Fold this batch into the frame's content hash, so the frame loop can tell
+	// static frames from changing ones. Cheap compared to the vertex generation.
+	frameDataHash_ = XXH3_64bits_withSeed(verts_, count_ * sizeof(Vertex), frameDataHash_);
 	draw_->DrawUP((const void *)verts_, count_);
 	count_ = 0;
 }
@@ -65,6 +65,14 @@ public:
 
 	int Count() const { return count_; }
 
+	// Accumulated hash of all vertex data flushed since the last pull. The native
+	// frame loop uses it to detect completely static UI frames and throttle.
+	uint64_t PullFrameDataHash() {
+		uint64_t hash = frameDataHash_;
+		frameDataHash_ = 0;
+		return hash;
+	}
+
 	void Rect(float x, float y, float w, float h, uint32_t color, int align = ALIGN_TOPLEFT);
 	void hLine(float x1, float y, float x2, uint32_t color);
 	void vLine(float x, float y1, float y2, uint32_t color);
@@ -207,4 +215,5 @@ private:
 	float tint_ = 0.0f;
 	float saturation_ = 1.0f;
 	float curZ_ = 0.0f;
+	uint64_t frameDataHash_ = 0;
 };
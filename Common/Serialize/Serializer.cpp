@@ -15,8 +15,11 @@
 // Official SVN repository and contact information can be found at
 // http://code.google.com/p/dolphin-emu/
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 #include <snappy-c.h>
 #include <zstd.h>
 
@@ -24,6 +27,7 @@
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Common/File/FileUtil.h"
 #include "Common/StringUtils.h"
+#include "Common/Thread/ParallelLoop.h"
 
 enum class SerializeCompressType {
 	NONE = 0,
@@ -33,6 +37,11 @@ enum class SerializeCompressType {
 
 static constexpr SerializeCompressType SAVE_TYPE = SerializeCompressType::ZSTD;
 
+// States above this size get compressed as independent zstd frames on worker
+// threads. Concatenated frames decompress transparently through ZSTD_decompress,
+// so the file format stays the same and old builds can still read new saves.
+static constexpr size_t SAVE_CHUNK_SIZE = 2 * 1024 * 1024;
+
 void PointerWrap::RewindForWrite(u8 *writePtr) {
 	_assert_(mode == MODE_MEASURE);
 	// Switch to writing mode, save the size for later checking and start again.
@@ -435,7 +444,12 @@ CChunkFileReader::Error CChunkFileReader::SaveFile(const Path &filename, const s
 		write_len = snappy_max_compressed_length(sz);
 		break;
 	case SerializeCompressType::ZSTD:
-		write_len = ZSTD_compressBound(sz);
+		if (sz > SAVE_CHUNK_SIZE) {
+			// Per-chunk bounds - each frame carries its own header overhead.
+			write_len = ((sz + SAVE_CHUNK_SIZE - 1) / SAVE_CHUNK_SIZE) * ZSTD_compressBound(SAVE_CHUNK_SIZE);
+		} else {
+			write_len = ZSTD_compressBound(sz);
+		}
 		break;
 	}
 	u8 *compressed_buffer = write_len == 0 ? nullptr : (u8 *)malloc(write_len);
@@ -456,7 +470,46 @@ CChunkFileReader::Error CChunkFileReader::SaveFile(const Path &filename, const s
 			success = snappy_compress((const char *)buffer, sz, (char *)compressed_buffer, &write_len) == SNAPPY_OK;
 			break;
 		case SerializeCompressType::ZSTD:
-			{
+			if (sz > SAVE_CHUNK_SIZE) {
+				// Compress SAVE_CHUNK_SIZE pieces as independent frames across the
+				// worker threads - with HD remaster sized states this scales nearly
+				// linearly with core count.
+				const int numChunks = (int)((sz + SAVE_CHUNK_SIZE - 1) / SAVE_CHUNK_SIZE);
+				const size_t chunkBound = ZSTD_compressBound(SAVE_CHUNK_SIZE);
+				std::vector<size_t> chunkLens(numChunks);
+				std::atomic<bool> allOk(true);
+				ParallelRangeLoop(&g_threadManager, [&](int l, int h) {
+					for (int i = l; i < h; i++) {
+						const size_t srcOffset = (size_t)i * SAVE_CHUNK_SIZE;
+						const size_t srcLen = std::min(SAVE_CHUNK_SIZE, sz - srcOffset);
+						auto ctx = ZSTD_createCCtx();
+						if (!ctx) {
+							allOk = false;
+							continue;
+						}
+						ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT);
+						ZSTD_CCtx_setParameter(ctx, ZSTD_c_checksumFlag, 1);
+						ZSTD_CCtx_setPledgedSrcSize(ctx, srcLen);
+						size_t res = ZSTD_compress2(ctx, compressed_buffer + (size_t)i * chunkBound, chunkBound, buffer + srcOffset, srcLen);
+						ZSTD_freeCCtx(ctx);
+						if (ZSTD_isError(res)) {
+							allOk = false;
+						} else {
+							chunkLens[i] = res;
+						}
+					}
+				}, 0, numChunks, 1);
+				success = allOk;
+				if (success) {
+					// Compact the frames so the write below sees one contiguous blob.
+					size_t total = chunkLens[0];
+					for (int i = 1; i < numChunks; i++) {
+						memmove(compressed_buffer + total, compressed_buffer + (size_t)i * chunkBound, chunkLens[i]);
+						total += chunkLens[i];
+					}
+					write_len = total;
+				}
+			} else {
 				auto ctx = ZSTD_createCCtx();
 				if (!ctx) {
 					success = false;
@@ -111,11 +111,22 @@ public:
 		ERROR_FAILURE = 2,
 	};
 
+	// Which subset of the machine state to serialize. Minimal states skip subsystems
+	// that rebuild lazily after load anyway (jit state, achievement runtime progress),
+	// making them much faster to round-trip - meant for rapid in-memory snapshots like
+	// rewind or rollback. A state saved with one profile can only be loaded with the
+	// same profile, so never write minimal states to disk.
+	enum Profile {
+		PROFILE_FULL = 0,
+		PROFILE_MINIMAL,
+	};
+
 	u8 **ptr;
 	Mode mode;
+	Profile profile;
 	Error error = ERROR_NONE;
 
-	PointerWrap(u8 **ptr_, Mode mode_) : ptr(ptr_), ptrStart_(*ptr), mode(mode_) {
+	PointerWrap(u8 **ptr_, Mode mode_, Profile profile_ = PROFILE_FULL) : ptr(ptr_), ptrStart_(*ptr), mode(mode_), profile(profile_) {
 		if (mode == MODE_MEASURE) {
 			checkpoints_.reserve(750);
 		}
@@ -179,9 +190,9 @@ public:
 
 	// May fail badly if ptr doesn't point to valid data.
 	template<class T>
-	static Error LoadPtr(u8 *ptr, T &_class, std::string *errorString)
+	static Error LoadPtr(u8 *ptr, T &_class, std::string *errorString, PointerWrap::Profile profile = PointerWrap::PROFILE_FULL)
 	{
-		PointerWrap p(&ptr, PointerWrap::MODE_READ);
+		PointerWrap p(&ptr, PointerWrap::MODE_READ, profile);
 		_class.DoState(p);
 
 		if (p.error != p.ERROR_FAILURE) {
@@ -205,10 +216,10 @@ public:
 	// If *saved is null, will allocate storage using malloc.
 	// If it's not null, it will be used, but only hope can save you from overruns at the end. For libretro.
 	template<class T>
-	static Error MeasureAndSavePtr(T &_class, u8 **saved, size_t *savedSize)
+	static Error MeasureAndSavePtr(T &_class, u8 **saved, size_t *savedSize, PointerWrap::Profile profile = PointerWrap::PROFILE_FULL)
 	{
 		u8 *ptr = nullptr;
-		PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+		PointerWrap p(&ptr, PointerWrap::MODE_MEASURE, profile);
 		_class.DoState(p);
 		_assert_(p.error == PointerWrap::ERROR_NONE);
 
@@ -240,10 +251,10 @@ public:
 	// Duplicate of the above but takes and modifies a vector. Less invasive
 	// than modifying the rewind manager to keep things in something else than vectors.
 	template<class T>
-	static Error MeasureAndSavePtr(T &_class, std::vector<u8> *saved)
+	static Error MeasureAndSavePtr(T &_class, std::vector<u8> *saved, PointerWrap::Profile profile = PointerWrap::PROFILE_FULL)
 	{
 		u8 *ptr = nullptr;
-		PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+		PointerWrap p(&ptr, PointerWrap::MODE_MEASURE, profile);
 		_class.DoState(p);
 		_assert_(p.error == PointerWrap::ERROR_NONE);
 
@@ -189,6 +189,10 @@ enum SystemProperty {
 
 	SYSPROP_SUPPORTS_PERMISSIONS,
 	SYSPROP_SUPPORTS_SUSTAINED_PERF_MODE,
+	// Thermal headroom: -1 = unknown/unsupported, 0 = nominal, 1 = warm,
+	// 2 = throttling imminent or active, 3 = critical. Matches the coarse levels of
+	// Android's PowerManager thermal status and Apple's thermalState.
+	SYSPROP_THERMAL_STATUS,
 	SYSPROP_SUPPORTS_OPEN_FILE_IN_EDITOR,  // See FileUtil.cpp: OpenFileInEditor
 
 	// Android-specific.
@@ -293,6 +297,12 @@ void System_PostUIMessage(UIMessage message, const std::string &param = "");
 // no need to implement separately.
 void System_AudioGetDebugStats(char *buf, size_t bufSize);
 void System_AudioClear();
+// Total audio buffer underruns since the game started. Cheap enough to poll per frame.
+int System_AudioGetUnderrunCountTotal();
+// Pull-side audio stats: the device period in frames as observed from the host
+// callbacks, plus running totals of frames delivered and frames padded due to
+// underrun. Diffing the totals over an interval gives the missed audio budget.
+void System_AudioGetPullStats(int *devicePeriodFrames, int64_t *framesOutput, int64_t *framesPadded);
 
 // These samples really have 16 bits of value, but can be a little out of range.
 // This is for pushing rate-controlled 44khz audio from emulation.
@@ -10,6 +10,7 @@
 #include "Common/Log.h"
 #include "Common/Thread/ThreadUtil.h"
 #include "Common/Thread/ThreadManager.h"
+#include "Common/TimeUtil.h"
 
 // Threads and task scheduling
 //
@@ -37,7 +38,12 @@ struct GlobalThreadContext {
 
 struct TaskThreadContext {
 	std::atomic<int> queue_size;
+	// Tasks pinned to this thread with EnqueueTaskOnThread. Never stolen - callers
+	// like BinManager rely on these running in order on the thread they chose.
 	std::deque<Task *> private_queue[TASK_PRIORITY_COUNT];
+	// Tasks from EnqueueTask. The owner pops from the front, idle workers of the
+	// same type steal from the back. Both ends are guarded by this thread's mutex.
+	std::deque<Task *> steal_queue[TASK_PRIORITY_COUNT];
 	std::thread thread; // the worker thread
 	std::condition_variable cond; // used to signal new work
 	std::mutex mutex; // protects the local queue.
@@ -45,6 +51,10 @@ struct TaskThreadContext {
 	TaskType type;
 	std::atomic<bool> cancelled;
 	char name[16];
+
+	// Utilization stats. Each is only written by the worker thread itself.
+	std::atomic<int> tasksRun;
+	std::atomic<double> secondsBusy;
 };
 
 ThreadManager::ThreadManager() : global_(new GlobalThreadContext()) {
@@ -93,6 +103,9 @@ void ThreadManager::Teardown() {
 			for (Task *task : threadCtx->private_queue[i]) {
 				TeardownTask(task, true);
 			}
+			for (Task *task : threadCtx->steal_queue[i]) {
+				TeardownTask(task, true);
+			}
 		}
 		delete threadCtx;
 	}
@@ -137,6 +150,13 @@ static void WorkerThreadFunc(GlobalThreadContext *global, TaskThreadContext *thr
 	}
 	SetCurrentThreadName(thread->name);
 
+	// On big.LITTLE-style CPUs, keep the compute workers on the fast cores and let
+	// the background I/O workers take the efficiency cores, so things like softgpu
+	// binning and texture scaling don't end up crawling along on a little core.
+	// No-op on symmetric CPUs.
+	SetCurrentThreadAffinityClass(thread->type == TaskType::CPU_COMPUTE
+		? ThreadAffinityClass::PERFORMANCE : ThreadAffinityClass::EFFICIENCY);
+
 	if (thread->type == TaskType::IO_BLOCKING) {
 		AttachThreadToJNI();
 	}
@@ -146,12 +166,37 @@ static void WorkerThreadFunc(GlobalThreadContext *global, TaskThreadContext *thr
 		return isCompute ? global->compute_queue_size.load() : global->io_queue_size.load();
 	};
 
+	// Pops the best task from our own queues. Assumes thread->mutex is held.
+	// Pinned tasks win over stealable ones of the same priority - they can't run
+	// anywhere else, while the stealable ones still might.
+	const auto grabLocalTask = [thread]() -> Task * {
+		for (size_t p = 0; p < TASK_PRIORITY_COUNT; ++p) {
+			if (!thread->private_queue[p].empty()) {
+				Task *task = thread->private_queue[p].front();
+				thread->private_queue[p].pop_front();
+				return task;
+			}
+			if (!thread->steal_queue[p].empty()) {
+				Task *task = thread->steal_queue[p].front();
+				thread->steal_queue[p].pop_front();
+				return task;
+			}
+		}
+		return nullptr;
+	};
+
 	while (!thread->cancelled) {
 		Task *task = nullptr;
 
-		// Check the global queue first, then check the private queue and wait if there's nothing to do.
-		if (global_queue_size() > 0) {
-			// Grab one from the global queue if there is any.
+		// Check our own queues first.
+		{
+			std::unique_lock<std::mutex> lock(thread->mutex);
+			task = grabLocalTask();
+		}
+
+		// Check the global overflow queue. Normally empty - EnqueueTask goes
+		// straight to the per-worker queues, this only sees teardown leftovers.
+		if (!task && global_queue_size() > 0) {
 			std::unique_lock<std::mutex> lock(global->mutex);
 			auto queue = isCompute ? global->compute_queue : global->io_queue;
 			auto &queue_size = isCompute ? global->compute_queue_size : global->io_queue_size;
@@ -165,31 +210,39 @@ static void WorkerThreadFunc(GlobalThreadContext *global, TaskThreadContext *thr
 					// We are processing one now, so mark that.
 					thread->queue_size++;
 					break;
-				} else if (thread->queue_size != 0) {
-					// Check the thread, as we prefer a HIGH thread task to a global NORMAL task.
-					std::unique_lock<std::mutex> lock(thread->mutex);
-					if (!thread->private_queue[p].empty()) {
-						task = thread->private_queue[p].front();
-						thread->private_queue[p].pop_front();
+				}
+			}
+		}
+
+		// Nothing of our own - steal the oldest stealable task from a busy
+		// sibling of the same type. Pinned tasks are never taken.
+		if (!task) {
+			for (TaskThreadContext *victim : global->threads_) {
+				if (victim == thread || victim->type != thread->type || victim->queue_size.load() == 0)
+					continue;
+				std::unique_lock<std::mutex> lock(victim->mutex);
+				for (size_t p = 0; p < TASK_PRIORITY_COUNT; ++p) {
+					if (!victim->steal_queue[p].empty()) {
+						task = victim->steal_queue[p].back();
+						victim->steal_queue[p].pop_back();
+						// The task moves over to our accounting.
+						victim->queue_size--;
+						thread->queue_size++;
 						break;
 					}
 				}
+				if (task)
+					break;
 			}
 		}
 
 		if (!task) {
-			// We didn't have any global, do we have anything on the thread?
+			// Recheck our own queues while locked, then wait. We don't re-scan the
+			// siblings here - whoever owns a stealable task will get to it when
+			// their current task completes.
 			std::unique_lock<std::mutex> lock(thread->mutex);
-			for (size_t p = 0; p < TASK_PRIORITY_COUNT; ++p) {
-				if (thread->private_queue[p].empty())
-					continue;
-
-				task = thread->private_queue[p].front();
-				thread->private_queue[p].pop_front();
-				break;
-			}
+			task = grabLocalTask();
 
-			// We must check both queue and single again, while locked.
 			bool wait = !thread->cancelled && !task && global_queue_size() == 0;
 
 			if (wait)
@@ -198,8 +251,12 @@ static void WorkerThreadFunc(GlobalThreadContext *global, TaskThreadContext *thr
 		// The task itself takes care of notifying anyone waiting on it. Not the
 		// responsibility of the ThreadManager (although it could be!).
 		if (task) {
+			double startTime = time_now_d();
 			task->Run();
 			task->Release();
+			thread->tasksRun++;
+			// Only this thread writes secondsBusy, so a load/store pair is fine.
+			thread->secondsBusy.store(thread->secondsBusy.load(std::memory_order_relaxed) + time_now_d() - startTime, std::memory_order_relaxed);
 			// Reduce the queue size once complete.
 			thread->queue_size--;
 			// _dbg_assert_(thread->queue_size == thread->private_queue[0].size() + thread->private_queue[1].size() + thread->private_queue[2].size());
@@ -227,6 +284,8 @@ void ThreadManager::Init(int numRealCores, int numLogicalCoresPerCpu) {
 	for (int i = 0; i < numThreads; i++) {
 		TaskThreadContext *thread = new TaskThreadContext();
 		thread->cancelled.store(false);
+		thread->tasksRun.store(0);
+		thread->secondsBusy.store(0.0);
 		thread->type = i < numComputeThreads_ ? TaskType::CPU_COMPUTE : TaskType::IO_BLOCKING;
 		thread->index = i;
 		thread->thread = std::thread(&WorkerThreadFunc, global_, thread);
@@ -266,7 +325,7 @@ void ThreadManager::EnqueueTask(Task *task) {
 		TaskThreadContext *thread = global_->threads_[threadNum];
 		if (thread->queue_size.load() == 0) {
 			std::unique_lock<std::mutex> lock(thread->mutex);
-			thread->private_queue[queueIndex].push_back(task);
+			thread->steal_queue[queueIndex].push_back(task);
 			thread->queue_size++;
 			thread->cond.notify_one();
 			// Found it - done.
@@ -274,27 +333,18 @@ void ThreadManager::EnqueueTask(Task *task) {
 		}
 	}
 
-	// Still not scheduled? Put it on the global queue and notify a thread chosen by round-robin.
-	// Not particularly scientific, but hopefully we should not run into this too much.
-	{
-		std::unique_lock<std::mutex> lock(global_->mutex);
-		if (task->Type() == TaskType::CPU_COMPUTE) {
-			global_->compute_queue[queueIndex].push_back(task);
-			global_->compute_queue_size++;
-		} else if (task->Type() == TaskType::IO_BLOCKING) {
-			global_->io_queue[queueIndex].push_back(task);
-			global_->io_queue_size++;
-		} else {
-			_assert_(false);
-		}
-	}
-
+	// Everyone is busy. Pick a thread by round-robin and put the task on its
+	// stealable queue - either the owner gets to it when its current task
+	// completes, or whichever sibling finishes first steals it. This used to go
+	// through a single global queue, which serialized fine-grained fan-out
+	// (softgpu bins, texture scaling) on one lock.
 	int chosenIndex = global_->roundRobin++;
 	chosenIndex = minThread + (chosenIndex % (maxThread - minThread));
-	TaskThreadContext *&chosenThread = global_->threads_[chosenIndex];
+	TaskThreadContext *chosenThread = global_->threads_[chosenIndex];
 
-	// Lock the thread to ensure it gets the message.
 	std::unique_lock<std::mutex> lock(chosenThread->mutex);
+	chosenThread->steal_queue[queueIndex].push_back(task);
+	chosenThread->queue_size++;
 	chosenThread->cond.notify_one();
 }
 
@@ -316,6 +366,18 @@ int ThreadManager::GetNumLooperThreads() const {
 	return numComputeThreads_;
 }
 
+int ThreadManager::GetWorkerStats(ThreadWorkerStats *stats, int maxCount) const {
+	int count = std::min((int)global_->threads_.size(), maxCount);
+	for (int i = 0; i < count; i++) {
+		const TaskThreadContext *thread = global_->threads_[i];
+		stats[i].index = thread->index;
+		stats[i].type = thread->type;
+		stats[i].tasksRun = thread->tasksRun.load(std::memory_order_relaxed);
+		stats[i].secondsBusy = thread->secondsBusy.load(std::memory_order_relaxed);
+	}
+	return count;
+}
+
 void ThreadManager::TryCancelTask(uint64_t taskID) {
 	// Do nothing for now, just let it finish.
 }
@@ -48,6 +48,14 @@ public:
 struct TaskThreadContext;
 struct GlobalThreadContext;
 
+// Per-worker utilization, for debug display.
+struct ThreadWorkerStats {
+	int index;
+	TaskType type;
+	int tasksRun;
+	double secondsBusy;
+};
+
 class ThreadManager {
 public:
 	ThreadManager();
@@ -73,6 +81,9 @@ public:
 	// for I/O bounds tasks, that can be run concurrently with those.
 	int GetNumLooperThreads() const;
 
+	// Fills in one entry per worker thread, up to maxCount. Returns the number written.
+	int GetWorkerStats(ThreadWorkerStats *stats, int maxCount) const;
+
 private:
 	bool TeardownTask(Task *task, bool enqueue);
 
@@ -21,8 +21,11 @@
 // TODO: Many other platforms also support TLS, in fact probably nearly all that we support
 // these days.
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <cstdint>
+#include <vector>
 
 #include "Common/Log.h"
 #include "Common/Thread/ThreadUtil.h"
@@ -215,6 +218,94 @@ void SetCurrentThreadNameThroughException(const char *threadName) {
 }
 #endif
 
+#if PPSSPP_PLATFORM(ANDROID) || PPSSPP_PLATFORM(LINUX)
+
+#include <sched.h>
+
+// Tells the core types apart by their max frequency. On tri-cluster SoCs
+// (prime/big/little), anything above the midpoint counts as a fast core.
+struct CoreTopology {
+	cpu_set_t performanceSet;
+	cpu_set_t efficiencySet;
+	bool asymmetric = false;
+};
+
+static CoreTopology g_coreTopology;
+static std::once_flag g_coreTopologyOnce;
+
+static void DetectCoreTopology() {
+	CPU_ZERO(&g_coreTopology.performanceSet);
+	CPU_ZERO(&g_coreTopology.efficiencySet);
+
+	int numCores = (int)sysconf(_SC_NPROCESSORS_CONF);
+	if (numCores <= 1 || numCores > CPU_SETSIZE)
+		return;
+
+	std::vector<int> freqKHz(numCores, 0);
+	int minFreq = 0, maxFreq = 0;
+	for (int i = 0; i < numCores; i++) {
+		char path[256];
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", i);
+		FILE *f = fopen(path, "r");
+		if (!f) {
+			// Can't classify the cores, stay symmetric.
+			return;
+		}
+		if (fscanf(f, "%d", &freqKHz[i]) != 1) {
+			fclose(f);
+			return;
+		}
+		fclose(f);
+		if (i == 0) {
+			minFreq = maxFreq = freqKHz[i];
+		} else {
+			minFreq = std::min(minFreq, freqKHz[i]);
+			maxFreq = std::max(maxFreq, freqKHz[i]);
+		}
+	}
+
+	if (maxFreq <= minFreq) {
+		// All cores the same - nothing to gain from affinity.
+		return;
+	}
+
+	int threshold = (minFreq + maxFreq) / 2;
+	for (int i = 0; i < numCores; i++) {
+		if (freqKHz[i] >= threshold) {
+			CPU_SET(i, &g_coreTopology.performanceSet);
+		} else {
+			CPU_SET(i, &g_coreTopology.efficiencySet);
+		}
+	}
+	g_coreTopology.asymmetric = true;
+	INFO_LOG(Log::System, "Asymmetric CPU detected: %d fast / %d slow cores (max freq %d / %d kHz)",
+		CPU_COUNT(&g_coreTopology.performanceSet), CPU_COUNT(&g_coreTopology.efficiencySet), maxFreq, minFreq);
+}
+
+void SetCurrentThreadAffinityClass(ThreadAffinityClass affinityClass) {
+	if (affinityClass == ThreadAffinityClass::DEFAULT)
+		return;
+	std::call_once(g_coreTopologyOnce, &DetectCoreTopology);
+	if (!g_coreTopology.asymmetric)
+		return;
+
+	const cpu_set_t &set = affinityClass == ThreadAffinityClass::PERFORMANCE
+		? g_coreTopology.performanceSet : g_coreTopology.efficiencySet;
+	// 0 means the calling thread.
+	if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+		WARN_LOG(Log::System, "sched_setaffinity failed: %s", strerror(errno));
+	}
+}
+
+#else
+
+void SetCurrentThreadAffinityClass(ThreadAffinityClass affinityClass) {
+	// The OS schedulers on the other platforms already steer threads to the right
+	// core types, and explicit affinity masks tend to fight them. Do nothing.
+}
+
+#endif
+
 void AssertCurrentThreadName(const char *threadName) {
 #ifdef TLS_SUPPORTED
 	if (strcmp(curThreadName, threadName) != 0) {
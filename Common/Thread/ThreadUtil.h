@@ -2,6 +2,18 @@
 
 #include <mutex>
 
+// Hint about what kind of core the current thread should run on.
+// On big.LITTLE-style CPUs (common on Android), PERFORMANCE restricts the thread
+// to the fast cores and EFFICIENCY to the slow ones. On symmetric CPUs, and on
+// platforms where we don't control affinity, this is a no-op.
+enum class ThreadAffinityClass {
+	DEFAULT,
+	PERFORMANCE,
+	EFFICIENCY,
+};
+
+void SetCurrentThreadAffinityClass(ThreadAffinityClass affinityClass);
+
 // Note that the string pointed to must have a lifetime until the end of the thread,
 // for AssertCurrentThreadName to work.
 void SetCurrentThreadName(const char *threadName);
@@ -8,9 +8,13 @@
 #define __STDC_CONSTANT_MACROS 1
 #endif
 
-#include <string>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <thread>
 
 #ifdef USE_FFMPEG
 
@@ -26,6 +30,7 @@ extern "C" {
 #include "Common/Data/Convert/ColorConv.h"
 #include "Common/File/FileUtil.h"
 #include "Common/File/Path.h"
+#include "Common/Thread/ThreadUtil.h"
 
 #include "Core/Config.h"
 #include "Core/AVIDump.h"
@@ -63,7 +68,24 @@ static bool s_start_dumping = false;
 static int s_current_width;
 static int s_current_height;
 static int s_file_index = 0;
-static GPUDebugBuffer buf;
+
+// Captured frames are handed to a dedicated encode thread, so the color
+// conversion, scaling and encoding don't stall the emu thread - only the
+// framebuffer readback remains on it. A few frames of queue absorbs encoder
+// hiccups; if the encoder can't keep up at all we block rather than drop
+// frames, since the video has to stay in sync with the audio dump.
+struct PendingFrame {
+	GPUDebugBuffer buf;
+	u32 w;
+	u32 h;
+};
+static constexpr size_t FRAME_QUEUE_SIZE = 3;
+static std::deque<PendingFrame> s_frame_queue;
+static std::mutex s_frame_lock;
+static std::condition_variable s_frame_cond;
+static std::thread s_encode_thread;
+static bool s_stop_encoding = false;
+static bool s_recording = false;
 
 static void InitAVCodec() {
 	static bool first_run = true;
@@ -77,6 +99,8 @@ static void InitAVCodec() {
 	}
 }
 
+static void EncodeThreadFunc();
+
 bool AVIDump::Start(int w, int h)
 {
 	s_width = w;
@@ -86,8 +110,13 @@ bool AVIDump::Start(int w, int h)
 
 	InitAVCodec();
 	bool success = CreateAVI();
-	if (!success)
+	if (!success) {
 		CloseFile();
+	} else {
+		s_stop_encoding = false;
+		s_recording = true;
+		s_encode_thread = std::thread(&EncodeThreadFunc);
+	}
 	return success;
 }
 
@@ -191,20 +220,34 @@ static void PreparePacket(AVPacket* pkt) {
 #endif
 
 void AVIDump::AddFrame() {
-	u32 w = 0;
-	u32 h = 0;
+	if (!s_recording)
+		return;
+
+	// Only the readback happens on the emu thread - the conversion, scaling and
+	// encode all run on the encode thread.
+	PendingFrame frame;
 	if (g_Config.bDumpVideoOutput) {
-		gpuDebug->GetOutputFramebuffer(buf);
-		w = buf.GetStride();
-		h = buf.GetHeight();
+		gpuDebug->GetOutputFramebuffer(frame.buf);
+		frame.w = frame.buf.GetStride();
+		frame.h = frame.buf.GetHeight();
 	} else {
-		gpuDebug->GetCurrentFramebuffer(buf, GPU_DBG_FRAMEBUF_RENDER);
-		w = PSP_CoreParameter().renderWidth;
-		h = PSP_CoreParameter().renderHeight;
+		gpuDebug->GetCurrentFramebuffer(frame.buf, GPU_DBG_FRAMEBUF_RENDER);
+		frame.w = PSP_CoreParameter().renderWidth;
+		frame.h = PSP_CoreParameter().renderHeight;
 	}
-	CheckResolution(w, h);
+	CheckResolution(frame.w, frame.h);
+
+	std::unique_lock<std::mutex> lock(s_frame_lock);
+	s_frame_cond.wait(lock, [] { return s_frame_queue.size() < FRAME_QUEUE_SIZE; });
+	s_frame_queue.push_back(std::move(frame));
+	s_frame_cond.notify_all();
+}
+
+static void EncodeFrame(const PendingFrame &frame) {
+	u32 w = frame.w;
+	u32 h = frame.h;
 	u8 *flipbuffer = nullptr;
-	const u8 *buffer = ConvertBufferToScreenshot(buf, false, flipbuffer, w, h);
+	const u8 *buffer = ConvertBufferToScreenshot(frame.buf, false, flipbuffer, w, h);
 
 #ifdef USE_FFMPEG
 
@@ -273,7 +316,37 @@ void AVIDump::AddFrame() {
 	delete[] flipbuffer;
 }
 
+static void EncodeThreadFunc() {
+	SetCurrentThreadName("AVIDumpEncode");
+	std::unique_lock<std::mutex> lock(s_frame_lock);
+	while (true) {
+		s_frame_cond.wait(lock, [] { return !s_frame_queue.empty() || s_stop_encoding; });
+		if (s_frame_queue.empty()) {
+			if (s_stop_encoding)
+				break;
+			continue;
+		}
+		PendingFrame frame = std::move(s_frame_queue.front());
+		s_frame_queue.pop_front();
+		// Wake up AddFrame if it's blocked on a full queue.
+		s_frame_cond.notify_all();
+		lock.unlock();
+		EncodeFrame(frame);
+		lock.lock();
+	}
+}
+
 void AVIDump::Stop() {
+	// Drain and stop the encode thread before finishing the file.
+	if (s_recording) {
+		{
+			std::lock_guard<std::mutex> guard(s_frame_lock);
+			s_stop_encoding = true;
+			s_frame_cond.notify_all();
+		}
+		s_encode_thread.join();
+		s_recording = false;
+	}
 #ifdef USE_FFMPEG
 
 	av_write_trailer(s_format_context);
@@ -69,11 +69,30 @@ void Compatibility::Load(const std::string &gameID) {
 			CheckVRSettings(compat2, gameID);
 		}
 	}
+
+	{
+		IniFile hints;
+		// This loads from assets.
+		if (hints.LoadFromVFS(g_VFS, "perfhints.ini")) {
+			CheckPerfHints(hints, gameID);
+		}
+	}
+
+	{
+		IniFile hints2;
+		// This one is user-editable. Need to load it after the system one.
+		Path path = GetSysDirectory(DIRECTORY_SYSTEM) / "perfhints.ini";
+		if (hints2.Load(path)) {
+			CheckPerfHints(hints2, gameID);
+		}
+	}
 }
 
 void Compatibility::Clear() {
 	memset(&flags_, 0, sizeof(flags_));
 	memset(&vrCompat_, 0, sizeof(vrCompat_));
+	hints_ = PerfHints{};
+	hints_.SplineQuality = -1;
 }
 
 void Compatibility::CheckSettings(IniFile &iniFile, const std::string &gameID) {
@@ -142,6 +161,8 @@ void Compatibility::CheckSettings(IniFile &iniFile, const std::string &gameID) {
 	CheckSetting(iniFile, gameID, "DisableMemcpySlicing", &flags_.DisableMemcpySlicing);
 	CheckSetting(iniFile, gameID, "ForceEnableGPUReadback", &flags_.ForceEnableGPUReadback);
 	CheckSetting(iniFile, gameID, "UseFFMPEGFindStreamInfo", &flags_.UseFFMPEGFindStreamInfo);
+	CheckSetting(iniFile, gameID, "SkipUnsampledRenderTargets", &flags_.SkipUnsampledRenderTargets);
+	CheckSetting(iniFile, gameID, "DedupIndexedVertices", &flags_.DedupIndexedVertices);
 }
 
 void Compatibility::CheckVRSettings(IniFile &iniFile, const std::string &gameID) {
@@ -156,6 +177,23 @@ void Compatibility::CheckVRSettings(IniFile &iniFile, const std::string &gameID)
 	NOTICE_LOG(Log::G3D, "UnitsPerMeter for %s: %f", gameID.c_str(), vrCompat_.UnitsPerMeter);
 }
 
+void Compatibility::CheckPerfHints(IniFile &iniFile, const std::string &gameID) {
+	CheckHintSetting(iniFile, gameID, "SplineQuality", &hints_.SplineQuality);
+	CheckHintSetting(iniFile, gameID, "ReadbackLatencyFrames", &hints_.ReadbackLatencyFrames);
+	CheckSetting(iniFile, gameID, "AggressiveBlockLink", &hints_.AggressiveBlockLink);
+	CheckHintSetting(iniFile, gameID, "TextureHashBackoffMax", &hints_.TextureHashBackoffMax);
+	CheckHintSetting(iniFile, gameID, "TextureHashReliableAfter", &hints_.TextureHashReliableAfter);
+	CheckSetting(iniFile, gameID, "CacheDecodedVertices", &hints_.CacheDecodedVertices);
+}
+
+// Unlike the int CheckSetting above, this keeps the previous value when the option is
+// absent, so the user override file only changes what it mentions.
+void Compatibility::CheckHintSetting(IniFile &iniFile, const std::string &gameID, const char *option, int *value) {
+	if (ignored_.find(option) == ignored_.end()) {
+		iniFile.Get(option, gameID.c_str(), value, *value);
+	}
+}
+
 void Compatibility::CheckSetting(IniFile &iniFile, const std::string &gameID, const char *option, bool *flag) {
 	if (ignored_.find(option) == ignored_.end()) {
 		iniFile.Get(option, gameID.c_str(), flag, *flag);
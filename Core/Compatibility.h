@@ -112,6 +112,21 @@ struct CompatFlags {
 	bool DisableMemcpySlicing;
 	bool ForceEnableGPUReadback;
 	bool UseFFMPEGFindStreamInfo;
+	bool SkipUnsampledRenderTargets;
+	bool DedupIndexedVertices;
+};
+
+// Per-title performance hints, from assets/perfhints.ini (same format and override
+// mechanism as compat.ini). Unlike compat flags these never affect correctness - they
+// ship known-good tuning that we'd otherwise ask users to hand-enter in per-game ini
+// files on every device.
+struct PerfHints {
+	int SplineQuality;             // -1 = no hint, else overrides the spline/bezier quality setting (0-2)
+	int ReadbackLatencyFrames;     // > 0: title tolerates readbacks returning data this many frames stale
+	bool AggressiveBlockLink;      // title known safe with continueBranches/continueJumps in the jit
+	int TextureHashBackoffMax;     // 0 = default; max frames between full rehashes of stable textures
+	int TextureHashReliableAfter;  // 0 = default; consecutive clean rehashes before hashing stops, < 0 = never stop
+	bool CacheDecodedVertices;     // memoize decoded vertex data, keyed on a hash of the source bytes
 };
 
 struct VRCompat {
@@ -137,17 +152,22 @@ public:
 
 	const VRCompat &vrCompat() const { return vrCompat_; }
 
+	const PerfHints &hints() const { return hints_; }
+
 	void Load(const std::string &gameID);
 
 private:
 	void Clear();
 	void CheckSettings(IniFile &iniFile, const std::string &gameID);
 	void CheckVRSettings(IniFile &iniFile, const std::string &gameID);
+	void CheckPerfHints(IniFile &iniFile, const std::string &gameID);
 	void CheckSetting(IniFile &iniFile, const std::string &gameID, const char *option, bool *flag);
 	void CheckSetting(IniFile &iniFile, const std::string &gameID, const char *option, float *value);
 	void CheckSetting(IniFile &iniFile, const std::string &gameID, const char *option, int *value);
+	void CheckHintSetting(IniFile &iniFile, const std::string &gameID, const char *option, int *value);
 
 	CompatFlags flags_{};
 	VRCompat vrCompat_{};
+	PerfHints hints_{};
 	std::set<std::string> ignored_;
 };
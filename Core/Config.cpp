@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <mutex>
 #include <set>
@@ -37,6 +38,7 @@
 #include "Common/Data/Text/I18n.h"
 #include "Common/Data/Text/Parsers.h"
 #include "Common/CPUDetect.h"
+#include "Common/File/DirListing.h"
 #include "Common/File/FileUtil.h"
 #include "Common/File/VFS/VFS.h"
 #include "Common/Log/LogManager.h"
@@ -234,6 +236,7 @@ static const ConfigSetting generalSettings[] = {
 	ConfigSetting("StateUndoLastSaveGame", &g_Config.sStateUndoLastSaveGame, "NA", CfgFlag::DEFAULT),
 	ConfigSetting("StateUndoLastSaveSlot", &g_Config.iStateUndoLastSaveSlot, -5, CfgFlag::DEFAULT), // Start with an "invalid" value
 	ConfigSetting("RewindSnapshotInterval", &g_Config.iRewindSnapshotInterval, 0, CfgFlag::PER_GAME),
+	ConfigSetting("RewindMemoryBudgetMB", &g_Config.iRewindMemoryBudgetMB, 64, CfgFlag::PER_GAME),
 
 	ConfigSetting("ShowOnScreenMessage", &g_Config.bShowOnScreenMessages, true, CfgFlag::DEFAULT),
 	ConfigSetting("ShowRegionOnGameIcon", &g_Config.bShowRegionOnGameIcon, false, CfgFlag::DEFAULT),
@@ -262,6 +265,7 @@ static const ConfigSetting generalSettings[] = {
 	ConfigSetting("ReportingHost", &g_Config.sReportHost, "default", CfgFlag::DEFAULT),
 	ConfigSetting("AutoSaveSymbolMap", &g_Config.bAutoSaveSymbolMap, false, CfgFlag::PER_GAME),
 	ConfigSetting("CacheFullIsoInRam", &g_Config.bCacheFullIsoInRam, false, CfgFlag::PER_GAME),
+	ConfigSetting("VerifyDiscCRC", &g_Config.bVerifyDiscCRC, false, CfgFlag::PER_GAME),
 	ConfigSetting("RemoteISOPort", &g_Config.iRemoteISOPort, 0, CfgFlag::DEFAULT),
 	ConfigSetting("LastRemoteISOServer", &g_Config.sLastRemoteISOServer, "", CfgFlag::DEFAULT),
 	ConfigSetting("LastRemoteISOPort", &g_Config.iLastRemoteISOPort, 0, CfgFlag::DEFAULT),
@@ -691,11 +695,13 @@ static const ConfigSetting graphicsSettings[] = {
 
 	ConfigSetting("InflightFrames", &g_Config.iInflightFrames, 3, CfgFlag::DEFAULT),
 	ConfigSetting("RenderDuplicateFrames", &g_Config.bRenderDuplicateFrames, false, CfgFlag::PER_GAME),
+	ConfigSetting("ThermalGovernor", &g_Config.bThermalGovernor, true, CfgFlag::DEFAULT),
 
 	ConfigSetting("MultiThreading", &g_Config.bRenderMultiThreading, true, CfgFlag::DEFAULT),
 
 	ConfigSetting("ShaderCache", &g_Config.bShaderCache, true, CfgFlag::DONT_SAVE),  // Doesn't save. Ini-only.
 	ConfigSetting("GpuLogProfiler", &g_Config.bGpuLogProfiler, false, CfgFlag::DEFAULT),
+	ConfigSetting("GpuStatsProfile", &g_Config.bGpuStatsProfile, false, CfgFlag::DEFAULT),
 
 	ConfigSetting("UberShaderVertex", &g_Config.bUberShaderVertex, true, CfgFlag::DEFAULT),
 	ConfigSetting("UberShaderFragment", &g_Config.bUberShaderFragment, true, CfgFlag::DEFAULT),
@@ -818,6 +824,7 @@ static const ConfigSetting controlSettings[] = {
 
 	ConfigSetting("DisableDpadDiagonals", &g_Config.bDisableDpadDiagonals, false, CfgFlag::PER_GAME),
 	ConfigSetting("GamepadOnlyFocused", &g_Config.bGamepadOnlyFocused, false, CfgFlag::PER_GAME),
+	ConfigSetting("InputLatePoll", &g_Config.bInputLatePoll, false, CfgFlag::PER_GAME),
 	ConfigSetting("TouchButtonStyle", &g_Config.iTouchButtonStyle, 1, CfgFlag::PER_GAME),
 	ConfigSetting("TouchButtonOpacity", &g_Config.iTouchButtonOpacity, 65, CfgFlag::PER_GAME),
 	ConfigSetting("TouchButtonHideSeconds", &g_Config.iTouchButtonHideSeconds, 20, CfgFlag::PER_GAME),
@@ -879,6 +886,7 @@ static const ConfigSetting networkSettings[] = {
 	ConfigSetting("proAdhocServer", &g_Config.proAdhocServer, "socom.cc", CfgFlag::PER_GAME),
 	ConfigSetting("PortOffset", &g_Config.iPortOffset, 10000, CfgFlag::PER_GAME),
 	ConfigSetting("MinTimeout", &g_Config.iMinTimeout, 0, CfgFlag::PER_GAME),
+	ConfigSetting("AdhocLatency", &g_Config.iAdhocLatency, 0, CfgFlag::PER_GAME),
 	ConfigSetting("ForcedFirstConnect", &g_Config.bForcedFirstConnect, false, CfgFlag::PER_GAME),
 	ConfigSetting("EnableUPnP", &g_Config.bEnableUPnP, false, CfgFlag::PER_GAME),
 	ConfigSetting("UPnPUseOriginalPort", &g_Config.bUPnPUseOriginalPort, false, CfgFlag::PER_GAME),
@@ -1118,6 +1126,125 @@ void Config::SetAppendedConfigIni(const Path &path) {
 	appendedConfigFileName_ = path;
 }
 
+// Binary snapshot of the parsed ini, written next to it after each save. Lets us skip
+// the text parse on the boot fast path - on slow Android storage that's a visible chunk
+// of startup. The snapshot records the ini's mtime and size; if they don't match anymore
+// (user edited the ini by hand, or another install touched it), we just fall back to the
+// normal text parse and the snapshot gets rewritten on the next save.
+static const uint32_t CONFIG_SNAPSHOT_MAGIC = 0x50434647;  // 'PCFG'
+static const uint32_t CONFIG_SNAPSHOT_VERSION = 1;
+
+static Path ConfigSnapshotPath(const Path &iniPath) {
+	return iniPath.WithExtraExtension(".cache");
+}
+
+static void SnapshotWriteString(std::string *out, std::string_view str) {
+	uint32_t len = (uint32_t)str.size();
+	out->append((const char *)&len, sizeof(len));
+	out->append(str.data(), str.size());
+}
+
+static bool SnapshotReadString(const std::string &in, size_t *offset, std::string *str) {
+	uint32_t len;
+	if (*offset + sizeof(len) > in.size())
+		return false;
+	memcpy(&len, in.data() + *offset, sizeof(len));
+	*offset += sizeof(len);
+	if (*offset + len > in.size())
+		return false;
+	str->assign(in.data() + *offset, len);
+	*offset += len;
+	return true;
+}
+
+static void SaveConfigSnapshot(const Path &iniPath, IniFile &iniFile) {
+	File::FileInfo info;
+	if (!File::GetFileInfo(iniPath, &info)) {
+		return;
+	}
+
+	std::string out;
+	out.reserve(16384);
+	out.append((const char *)&CONFIG_SNAPSHOT_MAGIC, sizeof(CONFIG_SNAPSHOT_MAGIC));
+	out.append((const char *)&CONFIG_SNAPSHOT_VERSION, sizeof(CONFIG_SNAPSHOT_VERSION));
+	out.append((const char *)&info.mtime, sizeof(info.mtime));
+	out.append((const char *)&info.size, sizeof(info.size));
+
+	uint32_t sectionCount = (uint32_t)iniFile.Sections().size();
+	out.append((const char *)&sectionCount, sizeof(sectionCount));
+	for (const auto &section : iniFile.Sections()) {
+		SnapshotWriteString(&out, section->name());
+		// Comments are dropped - the snapshot is only ever read from, the text ini
+		// stays the authority for saves.
+		auto map = section->ToMap();
+		uint32_t keyCount = (uint32_t)map.size();
+		out.append((const char *)&keyCount, sizeof(keyCount));
+		for (const auto &[key, value] : map) {
+			SnapshotWriteString(&out, key);
+			SnapshotWriteString(&out, value);
+		}
+	}
+
+	Path snapshotPath = ConfigSnapshotPath(iniPath);
+	if (!File::WriteDataToFile(false, out.data(), out.size(), snapshotPath)) {
+		WARN_LOG(Log::Loader, "Failed to write config snapshot '%s'", snapshotPath.c_str());
+	}
+}
+
+static bool LoadConfigSnapshot(const Path &iniPath, IniFile *iniFile) {
+	Path snapshotPath = ConfigSnapshotPath(iniPath);
+	std::string in;
+	if (!File::ReadBinaryFileToString(snapshotPath, &in)) {
+		return false;
+	}
+
+	size_t offset = 0;
+	uint32_t magic, version;
+	uint64_t mtime, size;
+	if (in.size() < sizeof(magic) + sizeof(version) + sizeof(mtime) + sizeof(size)) {
+		return false;
+	}
+	memcpy(&magic, in.data() + offset, sizeof(magic)); offset += sizeof(magic);
+	memcpy(&version, in.data() + offset, sizeof(version)); offset += sizeof(version);
+	memcpy(&mtime, in.data() + offset, sizeof(mtime)); offset += sizeof(mtime);
+	memcpy(&size, in.data() + offset, sizeof(size)); offset += sizeof(size);
+	if (magic != CONFIG_SNAPSHOT_MAGIC || version != CONFIG_SNAPSHOT_VERSION) {
+		return false;
+	}
+
+	File::FileInfo info;
+	if (!File::GetFileInfo(iniPath, &info) || info.mtime != mtime || info.size != size) {
+		// The ini changed behind our back - full parse.
+		return false;
+	}
+
+	// Parse into a scratch IniFile so a truncated snapshot can't leave the caller
+	// with half the sections.
+	IniFile parsed;
+	uint32_t sectionCount;
+	if (offset + sizeof(sectionCount) > in.size())
+		return false;
+	memcpy(&sectionCount, in.data() + offset, sizeof(sectionCount)); offset += sizeof(sectionCount);
+	for (uint32_t i = 0; i < sectionCount; i++) {
+		std::string sectionName;
+		if (!SnapshotReadString(in, &offset, &sectionName))
+			return false;
+		Section *section = parsed.GetOrCreateSection(sectionName.c_str());
+		uint32_t keyCount;
+		if (offset + sizeof(keyCount) > in.size())
+			return false;
+		memcpy(&keyCount, in.data() + offset, sizeof(keyCount)); offset += sizeof(keyCount);
+		std::string key, value;
+		for (uint32_t j = 0; j < keyCount; j++) {
+			if (!SnapshotReadString(in, &offset, &key) || !SnapshotReadString(in, &offset, &value))
+				return false;
+			section->Set(key, value);
+		}
+	}
+	*iniFile = std::move(parsed);
+	return true;
+}
+
 void Config::UpdateAfterSettingAutoFrameSkip() {
 	if (bAutoFrameSkip && iFrameSkip == 0) {
 		iFrameSkip = 1;
@@ -1144,7 +1271,9 @@ void Config::Load(const char *iniFileName, const char *controllerIniFilename) {
 	bSaveSettings = true;
 
 	IniFile iniFile;
-	if (!iniFile.Load(iniFilename_)) {
+	if (LoadConfigSnapshot(iniFilename_, &iniFile)) {
+		VERBOSE_LOG(Log::Loader, "Loaded config from snapshot, skipping ini parse");
+	} else if (!iniFile.Load(iniFilename_)) {
 		ERROR_LOG(Log::Loader, "Failed to read '%s'. Setting config to default.", iniFilename_.c_str());
 		// Continue anyway to initialize the config.
 	}
@@ -1381,6 +1510,8 @@ bool Config::Save(const char *saveReason) {
 			ERROR_LOG(Log::Loader, "Error saving config (%s) - can't write ini '%s'", saveReason, iniFilename_.c_str());
 			return false;
 		}
+		// Refresh the binary snapshot so the next boot can skip the text parse.
+		SaveConfigSnapshot(iniFilename_, iniFile);
 		INFO_LOG(Log::Loader, "Config saved (%s): '%s' (%0.1f ms)", saveReason, iniFilename_.c_str(), (time_now_d() - startTime) * 1000.0);
 
 		if (!bGameSpecific) //otherwise we already did this in saveGameConfig()
@@ -122,6 +122,7 @@ public:
 	int iLockedCPUSpeed;
 	bool bAutoSaveSymbolMap;
 	bool bCacheFullIsoInRam;
+	bool bVerifyDiscCRC;
 	int iRemoteISOPort;
 	std::string sLastRemoteISOServer;
 	int iLastRemoteISOPort;
@@ -234,6 +235,7 @@ public:
 	int iMaxRecent;
 	int iCurrentStateSlot;
 	int iRewindSnapshotInterval;
+	int iRewindMemoryBudgetMB;
 	bool bUISound;
 	bool bEnableStateUndo;
 	std::string sStateLoadUndoGame;
@@ -267,6 +269,9 @@ public:
 	bool bGfxDebugOutput;
 	int iInflightFrames;
 	bool bRenderDuplicateFrames;
+	// Step down rendering quality when the device reports thermal throttling is close.
+	// No-op on platforms that don't report SYSPROP_THERMAL_STATUS.
+	bool bThermalGovernor;
 	bool bRenderMultiThreading;
 
 	// HW debug
@@ -349,6 +354,8 @@ public:
 	// Disable diagonals
 	bool bDisableDpadDiagonals;
 	bool bGamepadOnlyFocused;
+	// Poll controllers right before the ctrl sample is latched, instead of only on the host's own schedule.
+	bool bInputLatePoll;
 	// Control Style
 	int iTouchButtonStyle;
 	int iTouchButtonOpacity;
@@ -461,6 +468,7 @@ public:
 	bool bForcedFirstConnect;
 	int iPortOffset;
 	int iMinTimeout;
+	int iAdhocLatency;  // Minimum delivery latency for blocking adhoc recv, in ms (0 = off). Evens out asymmetric connections between peers.
 	int iWlanAdhocChannel;
 	bool bWlanPowerSave;
 	bool bEnableNetworkChat;
@@ -530,6 +538,7 @@ public:
 	int iDebugOverlay;
 
 	bool bGpuLogProfiler; // Controls the Vulkan logging profiler (profiles textures uploads etc).
+	bool bGpuStatsProfile; // Records per-title gpuStats distributions, see GPU/Debugger/StatsProfile.h. Ini-only.
 
 	// Retro Achievement settings
 	// Copied from Duckstation, we might want to remove some.
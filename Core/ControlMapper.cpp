@@ -11,6 +11,7 @@
 #include "Core/ControlMapper.h"
 #include "Core/Config.h"
 #include "Core/CoreParameter.h"
+#include "Core/FrameTiming.h"
 #include "Core/System.h"
 
 using KeyMap::MultiInputMapping;
@@ -345,14 +346,8 @@ void ControlMapper::SwapMappingIfEnabled(uint32_t *vkey) {
 	}
 }
 
-// Can only be called from Key or Axis.
 // mutex_ should be locked, and also KeyMap::LockMappings().
-// TODO: We should probably make a batched version of this.
-bool ControlMapper::UpdatePSPState(const InputMapping &changedMapping, double now) {
-	// Instead of taking an input key and finding what it outputs, we loop through the OUTPUTS and
-	// see if the input that corresponds to it has a value. That way we can easily implement all sorts
-	// of crazy input combos if needed.
-
+void ControlMapper::RefreshCompiledMappings() {
 	int rotations = 0;
 	switch (g_Config.iInternalScreenRotation) {
 	case ROTATION_LOCKED_HORIZONTAL180: rotations = 2; break;
@@ -360,28 +355,54 @@ bool ControlMapper::UpdatePSPState(const InputMapping &changedMapping, double no
 	case ROTATION_LOCKED_VERTICAL180:   rotations = 3; break;
 	}
 
-	// For the PSP's digital button inputs, we just go through and put the flags together.
-	uint32_t buttonMask = 0;
-	uint32_t changedButtonMask = 0;
-	std::vector<MultiInputMapping> inputMappings;
 	for (int i = 0; i < 32; i++) {
+		compiled_.buttons[i].clear();
 		uint32_t mask = 1 << i;
 		if (!(mask & CTRL_MASK_USER)) {
 			// Not a mappable button bit
 			continue;
 		}
-
 		uint32_t mappingBit = mask;
-		for (int i = 0; i < rotations; i++) {
+		for (int r = 0; r < rotations; r++) {
 			mappingBit = RotatePSPKeyCode(mappingBit);
 		}
-
 		SwapMappingIfEnabled(&mappingBit);
-		if (!KeyMap::InputMappingsFromPspButtonNoLock(mappingBit, &inputMappings, false))
-			continue;
+		KeyMap::InputMappingsFromPspButtonNoLock(mappingBit, &compiled_.buttons[i], false);
+	}
+
+	for (int i = 0; i < VIRTKEY_COUNT; i++) {
+		compiled_.vkeys[i].clear();
+		uint32_t idForMapping = VIRTKEY_FIRST + i;
+		SwapMappingIfEnabled(&idForMapping);
+		compiled_.vkeyMappingId[i] = idForMapping;
+		KeyMap::InputMappingsFromPspButtonNoLock(idForMapping, &compiled_.vkeys[i], false);
+	}
+
+	compiledRotation_ = g_Config.iInternalScreenRotation;
+	compiledSwapAxes_ = swapAxes_;
+}
+
+// Can only be called from Key or Axis.
+// mutex_ should be locked, and also KeyMap::LockMappings().
+// TODO: We should probably make a batched version of this.
+bool ControlMapper::UpdatePSPState(const InputMapping &changedMapping, double now) {
+	// Instead of taking an input key and finding what it outputs, we loop through the OUTPUTS and
+	// see if the input that corresponds to it has a value. That way we can easily implement all sorts
+	// of crazy input combos if needed.
+
+	// Rebuild the compiled table if the controller map (or anything we bake into it) changed.
+	if (KeyMap::HasChanged(mapGeneration_) || compiledRotation_ != g_Config.iInternalScreenRotation || compiledSwapAxes_ != swapAxes_) {
+		RefreshCompiledMappings();
+	}
+
+	// For the PSP's digital button inputs, we just go through and put the flags together.
+	uint32_t buttonMask = 0;
+	uint32_t changedButtonMask = 0;
+	for (int i = 0; i < 32; i++) {
+		const uint32_t mask = 1 << i;
 
 		// If a mapping could consist of a combo, we could trivially check it here.
-		for (auto &multiMapping : inputMappings) {
+		for (auto &multiMapping : compiled_.buttons[i]) {
 			// Check if the changed mapping was involved in this PSP key.
 			if (multiMapping.mappings.contains(changedMapping)) {
 				changedButtonMask |= mask;
@@ -423,10 +444,9 @@ bool ControlMapper::UpdatePSPState(const InputMapping &changedMapping, double no
 	for (int i = 0; i < VIRTKEY_COUNT; i++) {
 		int vkId = i + VIRTKEY_FIRST;
 
-		uint32_t idForMapping = vkId;
-		SwapMappingIfEnabled(&idForMapping);
-
-		if (!KeyMap::InputMappingsFromPspButtonNoLock(idForMapping, &inputMappings, false))
+		const uint32_t idForMapping = compiled_.vkeyMappingId[i];
+		const std::vector<MultiInputMapping> &inputMappings = compiled_.vkeys[i];
+		if (inputMappings.empty())
 			continue;
 
 		// If a mapping could consist of a combo, we could trivially check it here.
@@ -435,7 +455,7 @@ bool ControlMapper::UpdatePSPState(const InputMapping &changedMapping, double no
 		float threshold = 1.0f;
 		bool touchedByMapping = false;
 		float value = 0.0f;
-		for (auto &multiMapping : inputMappings) {
+		for (const auto &multiMapping : inputMappings) {
 			if (multiMapping.mappings.contains(changedMapping)) {
 				touchedByMapping = true;
 			}
@@ -482,8 +502,8 @@ bool ControlMapper::UpdatePSPState(const InputMapping &changedMapping, double no
 		// that still works, though a bit weaker. We could also zero here, but you never know who relies on such strange tricks..
 		// Note: This is an old problem, it didn't appear with the refactoring.
 		if (!changedMapping.IsAxis()) {
-			for (auto &multiMapping : inputMappings) {
-				for (auto &mapping : multiMapping.mappings) {
+			for (const auto &multiMapping : inputMappings) {
+				for (const auto &mapping : multiMapping.mappings) {
 					if (mapping != changedMapping && curInput_[mapping].value > 0.0f) {
 						// Note that this takes the time into account now - values will
 						// decay after a while, not immediately.
@@ -648,6 +668,9 @@ void ControlMapper::Axis(const AxisInput *axes, size_t count) {
 }
 
 void ControlMapper::Update(double now) {
+	// Stamp the poll time for the frame latency instrumentation.
+	g_frameTiming.NotifyInputPoll(now);
+
 	if (autoRotatingAnalogCW_) {
 		// Clamp to a square
 		float x = std::min(1.0f, std::max(-1.0f, 1.42f * (float)cos(now * -g_Config.fAnalogAutoRotSpeed)));
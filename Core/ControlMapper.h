@@ -52,6 +52,7 @@ public:
 
 private:
 	bool UpdatePSPState(const InputMapping &changedMapping, double now);
+	void RefreshCompiledMappings();
 	float MapAxisValue(float value, int vkId, const InputMapping &mapping, const InputMapping &changedMapping, bool *oppositeTouched);
 	void SwapMappingIfEnabled(uint32_t *vkey);
 
@@ -85,6 +86,20 @@ private:
 
 	bool swapAxes_ = false;
 
+	// Compiled mapping table. UpdatePSPState runs on every input event, so rather than querying
+	// KeyMap per output (a map lookup and a vector copy each), we flatten the per-output mappings
+	// into arrays indexed the same way as the loops, with rotation and axis swap pre-applied.
+	// Rebuilt lazily when the controller map generation, screen rotation or axis swap changes.
+	struct CompiledMappings {
+		std::vector<KeyMap::MultiInputMapping> buttons[32];  // indexed by PSP button bit
+		std::vector<KeyMap::MultiInputMapping> vkeys[VIRTKEY_COUNT];
+		uint32_t vkeyMappingId[VIRTKEY_COUNT]{};  // vkey after axis swap, what we actually looked up
+	};
+	CompiledMappings compiled_;
+	int mapGeneration_ = -1;
+	int compiledRotation_ = -1;
+	bool compiledSwapAxes_ = false;
+
 	// Protects basically all the state.
 	// TODO: Maybe we should piggyback on the screenmanager mutex - it's always locked
 	// when events come in here.
@@ -15,6 +15,7 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include <algorithm>
 #include <atomic>
 #include <climits>
 #include <cstdio>
@@ -60,10 +61,26 @@ struct BaseEvent {
 	int type;
 };
 
-typedef LinkedListItem<BaseEvent> Event;
+struct Event : public BaseEvent {
+	u64 seq;  // Tie-breaker so same-time events keep FIFO order, like the old sorted list.
+};
 
-Event *first;
-Event *eventPool = 0;
+// Binary min-heap ordered by (time, seq), stored contiguously. Scheduling and
+// popping are O(log n) and allocation-free in the steady state, unlike the old
+// sorted linked list which was O(n) per insert and chased pointers all over the
+// heap. The freelist event pool went away with it - the vector is the pool.
+static std::vector<Event> events;
+static u64 eventSeq;
+
+// Cumulative count of scheduled events per type, for the debugger's scheduler view.
+static std::vector<u64> scheduledTypeCounts;
+
+// "Later" comparison, which makes std heap operations produce a min-heap.
+static bool EventAfter(const Event &a, const Event &b) {
+	if (a.time != b.time)
+		return a.time > b.time;
+	return a.seq > b.seq;
+}
 
 // Downcount has been moved to currentMIPS, to save a couple of clocks in every ARM JIT block
 // as we can already reach that structure through a register.
@@ -120,22 +137,6 @@ u64 GetGlobalTimeUs() {
 	return lastGlobalTimeUs + usSinceLast;
 }
 
-Event* GetNewEvent()
-{
-	if(!eventPool)
-		return new Event;
-
-	Event* ev = eventPool;
-	eventPool = ev->next;
-	return ev;
-}
-
-void FreeEvent(Event* ev)
-{
-	ev->next = eventPool;
-	eventPool = ev;
-}
-
 int RegisterEvent(const char *name, TimedCallback callback) {
 	for (const auto &ty : event_types) {
 		if (!strcmp(ty.name, name)) {
@@ -179,7 +180,7 @@ void RestoreRegisterEvent(int &event_type, const char *name, TimedCallback callb
 }
 
 void UnregisterAllEvents() {
-	_dbg_assert_msg_(first == nullptr, "Unregistering events with events pending - this isn't good.");
+	_dbg_assert_msg_(events.empty(), "Unregistering events with events pending - this isn't good.");
 	event_types.clear();
 	usedEventTypes.clear();
 	restoredEventTypes.clear();
@@ -193,6 +194,9 @@ void Init()
 	idledCycles = 0;
 	lastGlobalTimeTicks = 0;
 	lastGlobalTimeUs = 0;
+	events.clear();
+	eventSeq = 0;
+	scheduledTypeCounts.clear();
 	mhzChangeCallbacks.clear();
 	CPU_HZ = initialHz;
 }
@@ -201,14 +205,9 @@ void Shutdown()
 {
 	ClearPendingEvents();
 	UnregisterAllEvents();
-
-	while (eventPool) {
-		Event *ev = eventPool;
-		eventPool = ev->next;
-		delete ev;
-	}
+	events.shrink_to_fit();
 }
- 
+
 u64 GetTicks()
 {
 	if (currentMIPS) {
@@ -226,30 +225,7 @@ u64 GetIdleTicks()
 
 void ClearPendingEvents()
 {
-	while (first)
-	{
-		Event *e = first->next;
-		FreeEvent(first);
-		first = e;
-	}
-}
-
-void AddEventToQueue(Event* ne)
-{
-	Event* prev = NULL;
-	Event** pNext = &first;
-	for(;;)
-	{
-		Event*& next = *pNext;
-		if(!next || ne->time < next->time)
-		{
-			ne->next = next;
-			next = ne;
-			break;
-		}
-		prev = next;
-		pNext = &prev->next;
-	}
+	events.clear();
 }
 
 // This must be run ONLY from within the cpu thread
@@ -257,54 +233,45 @@ void AddEventToQueue(Event* ne)
 // than Advance
 void ScheduleEvent(s64 cyclesIntoFuture, int event_type, u64 userdata)
 {
-	Event *ne = GetNewEvent();
-	ne->userdata = userdata;
-	ne->type = event_type;
-	ne->time = GetTicks() + cyclesIntoFuture;
-	AddEventToQueue(ne);
+	Event ne;
+	ne.userdata = userdata;
+	ne.type = event_type;
+	ne.time = GetTicks() + cyclesIntoFuture;
+	ne.seq = eventSeq++;
+	events.push_back(ne);
+	std::push_heap(events.begin(), events.end(), EventAfter);
+
+	if (event_type >= 0) {
+		if (event_type >= (int)scheduledTypeCounts.size())
+			scheduledTypeCounts.resize(std::max(event_types.size(), (size_t)event_type + 1), 0);
+		scheduledTypeCounts[event_type]++;
+	}
 }
 
 // Returns cycles left in timer.
 s64 UnscheduleEvent(int event_type, u64 userdata)
 {
 	s64 result = 0;
-	if (!first)
-		return result;
-	while(first)
-	{
-		if (first->type == event_type && first->userdata == userdata)
-		{
-			result = first->time - GetTicks();
-
-			Event *next = first->next;
-			FreeEvent(first);
-			first = next;
-		}
-		else
-		{
-			break;
-		}
-	}
-	if (!first)
-		return result;
-	Event *prev = first;
-	Event *ptr = prev->next;
-	while (ptr)
+	bool removed = false;
+	for (size_t i = 0; i < events.size(); )
 	{
-		if (ptr->type == event_type && ptr->userdata == userdata)
+		if (events[i].type == event_type && events[i].userdata == userdata)
 		{
-			result = ptr->time - GetTicks();
-
-			prev->next = ptr->next;
-			FreeEvent(ptr);
-			ptr = prev->next;
+			// The old sorted list reported the last match in time order, so keep the largest.
+			s64 remaining = events[i].time - GetTicks();
+			if (!removed || remaining > result)
+				result = remaining;
+			events[i] = events.back();
+			events.pop_back();
+			removed = true;
 		}
 		else
 		{
-			prev = ptr;
-			ptr = ptr->next;
+			i++;
 		}
 	}
+	if (removed)
+		std::make_heap(events.begin(), events.end(), EventAfter);
 
 	return result;
 }
@@ -315,66 +282,45 @@ void RegisterMHzChangeCallback(MHzChangeCallback callback) {
 
 bool IsScheduled(int event_type)
 {
-	if (!first)
-		return false;
-	Event *e = first;
-	while (e) {
-		if (e->type == event_type)
+	for (const Event &ev : events) {
+		if (ev.type == event_type)
 			return true;
-		e = e->next;
 	}
 	return false;
 }
 
 void RemoveEvent(int event_type)
 {
-	if (!first)
-		return;
-	while(first)
-	{
-		if (first->type == event_type)
-		{
-			Event *next = first->next;
-			FreeEvent(first);
-			first = next;
-		}
-		else
-		{
-			break;
-		}
-	}
-	if (!first)
-		return;
-	Event *prev = first;
-	Event *ptr = prev->next;
-	while (ptr)
+	bool removed = false;
+	for (size_t i = 0; i < events.size(); )
 	{
-		if (ptr->type == event_type)
+		if (events[i].type == event_type)
 		{
-			prev->next = ptr->next;
-			FreeEvent(ptr);
-			ptr = prev->next;
+			events[i] = events.back();
+			events.pop_back();
+			removed = true;
 		}
 		else
 		{
-			prev = ptr;
-			ptr = ptr->next;
+			i++;
 		}
 	}
+	if (removed)
+		std::make_heap(events.begin(), events.end(), EventAfter);
 }
 
 void ProcessEvents() {
-	while (first) {
-		if (first->time <= (s64)GetTicks()) {
+	while (!events.empty()) {
+		if (events.front().time <= (s64)GetTicks()) {
 			// INFO_LOG(Log::CPU, "%s (%lld, %lld) ", first->name ? first->name : "?", (u64)GetTicks(), (u64)first->time);
-			Event *evt = first;
-			first = first->next;
-			if (evt->type >= 0 && evt->type < event_types.size()) {
-				event_types[evt->type].callback(evt->userdata, (int)(GetTicks() - evt->time));
+			Event evt = events.front();
+			std::pop_heap(events.begin(), events.end(), EventAfter);
+			events.pop_back();
+			if (evt.type >= 0 && evt.type < (int)event_types.size()) {
+				event_types[evt.type].callback(evt.userdata, (int)(GetTicks() - evt.time));
 			} else {
-				_dbg_assert_msg_(false, "Bad event type %d", evt->type);
+				_dbg_assert_msg_(false, "Bad event type %d", evt.type);
 			}
-			FreeEvent(evt);
 		} else {
 			// Caught up to the current time.
 			break;
@@ -404,7 +350,7 @@ void Advance() {
 
 	ProcessEvents();
 
-	if (!first) {
+	if (events.empty()) {
 		// This should never happen in PPSSPP.
 		if (slicelength < 10000) {
 			slicelength += 10000;
@@ -412,7 +358,7 @@ void Advance() {
 		}
 	} else {
 		// Note that events can eat cycles as well.
-		int target = (int)(first->time - globalTimer);
+		int target = (int)(events.front().time - globalTimer);
 		if (target > MAX_SLICE_LENGTH)
 			target = MAX_SLICE_LENGTH;
 
@@ -423,10 +369,9 @@ void Advance() {
 }
 
 void LogPendingEvents() {
-	Event *ptr = first;
-	while (ptr) {
-		//INFO_LOG(Log::CPU, "PENDING: Now: %lld Pending: %lld Type: %d", globalTimer, ptr->time, ptr->type);
-		ptr = ptr->next;
+	for (const Event &ev : events) {
+		//INFO_LOG(Log::CPU, "PENDING: Now: %lld Pending: %lld Type: %d", globalTimer, ev.time, ev.type);
+		(void)ev;
 	}
 }
 
@@ -435,9 +380,9 @@ void Idle(int maxIdle) {
 	if (maxIdle != 0 && cyclesDown > maxIdle)
 		cyclesDown = maxIdle;
 
-	if (first && cyclesDown > 0) {
+	if (!events.empty() && cyclesDown > 0) {
 		int cyclesExecuted = slicelength - currentMIPS->downcount;
-		int cyclesNextEvent = (int) (first->time - globalTimer);
+		int cyclesNextEvent = (int)(events.front().time - globalTimer);
 
 		if (cyclesNextEvent < cyclesExecuted + cyclesDown)
 			cyclesDown = cyclesNextEvent - cyclesExecuted;
@@ -455,28 +400,50 @@ void Idle(int maxIdle) {
 		currentMIPS->downcount = -1;
 }
 
+// Sorted copy of the heap, for displaying and serializing in the order the old
+// linked list used.
+static std::vector<Event> SortedEvents() {
+	std::vector<Event> sorted = events;
+	std::sort(sorted.begin(), sorted.end(), [](const Event &a, const Event &b) {
+		if (a.time != b.time)
+			return a.time < b.time;
+		return a.seq < b.seq;
+	});
+	return sorted;
+}
+
 std::string GetScheduledEventsSummary() {
-	Event *ptr = first;
 	std::string text = "Scheduled events\n";
 	text.reserve(1000);
-	while (ptr) {
-		unsigned int t = ptr->type;
+	for (const Event &ev : SortedEvents()) {
+		unsigned int t = ev.type;
 		if (t >= event_types.size()) {
 			_dbg_assert_msg_(false, "Invalid event type %d", t);
-			ptr = ptr->next;
 			continue;
 		}
 		const char *name = event_types[t].name;
 		if (!name)
 			name = "[unknown]";
 		char temp[512];
-		snprintf(temp, sizeof(temp), "%s : %i %08x%08x\n", name, (int)ptr->time, (u32)(ptr->userdata >> 32), (u32)(ptr->userdata));
+		snprintf(temp, sizeof(temp), "%s : %i %08x%08x\n", name, (int)ev.time, (u32)(ev.userdata >> 32), (u32)(ev.userdata));
 		text += temp;
-		ptr = ptr->next;
 	}
 	return text;
 }
 
+void GetEventTypeStats(std::vector<EventTypeStats> *stats) {
+	stats->resize(event_types.size());
+	for (size_t i = 0; i < event_types.size(); i++) {
+		(*stats)[i].name = event_types[i].name ? event_types[i].name : "[unknown]";
+		(*stats)[i].scheduledCount = i < scheduledTypeCounts.size() ? scheduledTypeCounts[i] : 0;
+		(*stats)[i].pendingCount = 0;
+	}
+	for (const Event &ev : events) {
+		if (ev.type >= 0 && ev.type < (int)stats->size())
+			(*stats)[ev.type].pendingCount++;
+	}
+}
+
 void Event_DoState(PointerWrap &p, BaseEvent *ev) {
 	// There may be padding, so do each one individually.
 	Do(p, ev->time);
@@ -490,6 +457,42 @@ void Event_DoStateOld(PointerWrap &p, BaseEvent *ev) {
 	usedEventTypes.insert(ev->type);
 }
 
+// Keeps the wire format of the old DoLinkedList serialization (a marker byte of 1
+// before each event, 0 terminates), so the heap change needs no section version
+// bump and old states keep loading.
+static void DoEventQueue(PointerWrap &p, void (*eventDoState)(PointerWrap &, BaseEvent *)) {
+	if (p.mode == PointerWrap::MODE_READ) {
+		events.clear();
+		while (true) {
+			u8 marker = 0;
+			Do(p, marker);
+			if (marker == 0)
+				break;
+			if (marker != 1) {
+				WARN_LOG(Log::SaveState, "Savestate failure: incorrect event marker %d", marker);
+				p.SetError(p.ERROR_FAILURE);
+				return;
+			}
+			Event ev{};
+			eventDoState(p, &ev);
+			ev.seq = eventSeq++;
+			events.push_back(ev);
+		}
+		// The old list was stored in time order, which already forms a valid
+		// min-heap, but don't rely on states being well-formed.
+		std::make_heap(events.begin(), events.end(), EventAfter);
+	} else {
+		std::vector<Event> sorted = SortedEvents();
+		for (Event &ev : sorted) {
+			u8 marker = 1;
+			Do(p, marker);
+			eventDoState(p, &ev);
+		}
+		u8 marker = 0;
+		Do(p, marker);
+	}
+}
+
 void DoState(PointerWrap &p) {
 	auto s = p.Section("CoreTiming", 1, 3);
 	if (!s)
@@ -514,11 +517,11 @@ void DoState(PointerWrap &p) {
 	restoredEventTypes.clear();
 
 	if (s >= 3) {
-		DoLinkedList<BaseEvent, GetNewEvent, FreeEvent, Event_DoState>(p, first, (Event **)nullptr);
+		DoEventQueue(p, Event_DoState);
 		// This is here because we previously stored a second queue of "threadsafe" events. Gone now. Remove in the next section version upgrade.
 		DoIgnoreUnusedLinkedList(p);
 	} else {
-		DoLinkedList<BaseEvent, GetNewEvent, FreeEvent, Event_DoStateOld>(p, first, (Event **)nullptr);
+		DoEventQueue(p, Event_DoStateOld);
 		DoIgnoreUnusedLinkedList(p);
 	}
 
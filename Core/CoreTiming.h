@@ -18,6 +18,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "Common/CommonTypes.h"
 
 // This is a system to schedule events into the emulated machine's future. Time is measured
@@ -112,6 +113,14 @@ namespace CoreTiming
 
 	std::string GetScheduledEventsSummary();
 
+	// For the debugger's scheduler stats view.
+	struct EventTypeStats {
+		const char *name;
+		u64 scheduledCount;  // cumulative since boot
+		int pendingCount;
+	};
+	void GetEventTypeStats(std::vector<EventTypeStats> *stats);
+
 	void DoState(PointerWrap &p);
 
 	void SetClockFrequencyHz(int cpuHz);
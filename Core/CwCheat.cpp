@@ -397,6 +397,27 @@ void CWCheatEngine::ParseCheats() {
 	// TODO: Report errors.
 
 	cheats_ = parser.GetCheats();
+	CompileCheats();
+}
+
+// Decodes every cheat once, up front. The decode is pure (no memory or pad
+// reads), so the result can be replayed every frame without re-walking lines.
+void CWCheatEngine::CompileCheats() {
+	compiled_.clear();
+	compiled_.reserve(cheats_.size());
+	for (const CheatCode &cheat : cheats_) {
+		CompiledCheatCode compiled;
+		compiled.opAtLine.assign(cheat.lines.size(), -1);
+		size_t i = 0;
+		while (i < cheat.lines.size()) {
+			size_t start = i;
+			CheatOperation op = InterpretNextOp(cheat, i);
+			compiled.opAtLine[start] = (int)compiled.ops.size();
+			compiled.ops.push_back(op);
+			compiled.opNextLine.push_back((uint32_t)i);
+		}
+		compiled_.push_back(std::move(compiled));
+	}
 }
 
 u32 CWCheatEngine::GetAddress(u32 value) {
@@ -419,89 +440,6 @@ void CWCheatEngine::InvalidateICache(u32 addr, int size) {
 	currentMIPS->InvalidateICache(aligned, alignedSize);
 }
 
-enum class CheatOp {
-	Invalid,
-	Noop,
-
-	Write,
-	Add,
-	Subtract,
-	Or,
-	And,
-	Xor,
-
-	MultiWrite,
-
-	CopyBytesFrom,
-	Vibration,
-	VibrationFromMemory,
-	PostShader,
-	PostShaderFromMemory,
-	Delay,
-
-	Assert,
-
-	IfEqual,
-	IfNotEqual,
-	IfLess,
-	IfGreater,
-
-	IfAddrEqual,
-	IfAddrNotEqual,
-	IfAddrLess,
-	IfAddrGreater,
-
-	IfPressed,
-	IfNotPressed,
-
-	CwCheatPointerCommands,
-};
-
-struct CheatOperation {
-	CheatOp op;
-	uint32_t addr;
-	int sz;
-	uint32_t val;
-
-	union {
-		struct {
-			uint32_t count;
-			uint32_t step;
-			uint32_t add;
-		} multiWrite;
-		struct {
-			uint32_t destAddr;
-		} copyBytesFrom;
-		struct {
-			uint32_t skip;
-		} ifTypes;
-		struct {
-			uint32_t skip;
-			uint32_t compareAddr;
-		} ifAddrTypes;
-		struct {
-			int offset;
-			int baseOffset;
-			int count;
-			int type;
-		} pointerCommands;
-		struct {
-			uint16_t vibrL;
-			uint16_t vibrR;
-			uint8_t vibrLTime;
-			uint8_t vibrRTime;
-		} vibrationValues;
-		struct {
-			union {
-				float f;
-				uint32_t u;
-			} value;
-			uint8_t shader;
-			uint8_t uniform;
-			uint8_t format;
-		} PostShaderUniform;
-	};
-};
 
 CheatOperation CWCheatEngine::InterpretNextCwCheat(const CheatCode &cheat, size_t &i) {
 	const CheatLine &line1 = cheat.lines[i++];
@@ -1200,11 +1138,22 @@ void CWCheatEngine::Run() {
 		return;
 	}
 
-	for (CheatCode cheat : cheats_) {
-		// InterpretNextOp and ExecuteOp move i.
-		for (size_t i = 0; i < cheat.lines.size(); ) {
-			CheatOperation op = InterpretNextOp(cheat, i);
-			ExecuteOp(op, cheat, i);
+	for (size_t c = 0; c < cheats_.size(); c++) {
+		const CheatCode &cheat = cheats_[c];
+		const CompiledCheatCode &compiled = compiled_[c];
+		// i counts lines, like the cheat format's skips do. ExecuteOp moves it.
+		size_t i = 0;
+		while (i < cheat.lines.size()) {
+			int opIndex = compiled.opAtLine[i];
+			if (opIndex < 0) {
+				// A conditional skip landed in the middle of a multi-line op.
+				// Decode from this line, exactly like the interpreter used to.
+				CheatOperation op = InterpretNextOp(cheat, i);
+				ExecuteOp(op, cheat, i);
+				continue;
+			}
+			i = compiled.opNextLine[opIndex];
+			ExecuteOp(compiled.ops[opIndex], cheat, i);
 		}
 	}
 }
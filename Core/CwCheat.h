@@ -41,7 +41,98 @@ struct CheatFileInfo {
 	bool enabled;
 };
 
-struct CheatOperation;
+enum class CheatOp {
+	Invalid,
+	Noop,
+
+	Write,
+	Add,
+	Subtract,
+	Or,
+	And,
+	Xor,
+
+	MultiWrite,
+
+	CopyBytesFrom,
+	Vibration,
+	VibrationFromMemory,
+	PostShader,
+	PostShaderFromMemory,
+	Delay,
+
+	Assert,
+
+	IfEqual,
+	IfNotEqual,
+	IfLess,
+	IfGreater,
+
+	IfAddrEqual,
+	IfAddrNotEqual,
+	IfAddrLess,
+	IfAddrGreater,
+
+	IfPressed,
+	IfNotPressed,
+
+	CwCheatPointerCommands,
+};
+
+struct CheatOperation {
+	CheatOp op;
+	uint32_t addr;
+	int sz;
+	uint32_t val;
+
+	union {
+		struct {
+			uint32_t count;
+			uint32_t step;
+			uint32_t add;
+		} multiWrite;
+		struct {
+			uint32_t destAddr;
+		} copyBytesFrom;
+		struct {
+			uint32_t skip;
+		} ifTypes;
+		struct {
+			uint32_t skip;
+			uint32_t compareAddr;
+		} ifAddrTypes;
+		struct {
+			int offset;
+			int baseOffset;
+			int count;
+			int type;
+		} pointerCommands;
+		struct {
+			uint16_t vibrL;
+			uint16_t vibrR;
+			uint8_t vibrLTime;
+			uint8_t vibrRTime;
+		} vibrationValues;
+		struct {
+			union {
+				float f;
+				uint32_t u;
+			} value;
+			uint8_t shader;
+			uint8_t uniform;
+			uint8_t format;
+		} PostShaderUniform;
+	};
+};
+
+// A cheat decoded once into operations, so the per-frame loop doesn't have to
+// re-walk the raw lines. Skips are still counted in lines (that's what the
+// cheat format encodes), so each op records the line it starts at.
+struct CompiledCheatCode {
+	std::vector<CheatOperation> ops;
+	std::vector<uint32_t> opNextLine;  // line index following each op
+	std::vector<int> opAtLine;         // op starting at each line, or -1 mid-op
+};
 
 class CWCheatEngine {
 public:
@@ -56,6 +147,8 @@ public:
 private:
 	u32 GetAddress(u32 value);
 
+	void CompileCheats();
+
 	CheatOperation InterpretNextOp(const CheatCode &cheat, size_t &i);
 	CheatOperation InterpretNextCwCheat(const CheatCode &cheat, size_t &i);
 	CheatOperation InterpretNextTempAR(const CheatCode &cheat, size_t &i);
@@ -66,6 +159,7 @@ private:
 	bool TestIfAddr(const CheatOperation &op, bool(*oper)(int a, int b));
 
 	std::vector<CheatCode> cheats_;
+	std::vector<CompiledCheatCode> compiled_;  // parallel to cheats_
 	std::string gameID_;
 	Path filename_;
 };
@@ -198,7 +198,10 @@ class DisassemblyManager
 public:
 	~DisassemblyManager();
 
-	void clear();
+	// Drops the analyzed entries. They're shared between views (and survive a view
+	// closing - analyze() rechecks them by hash), so only call when they're truly
+	// stale: symbols changed under us, or the game shut down.
+	static void clear();
 
 	void setCpu(DebugInterface* _cpu) { cpu = _cpu; };
 	void setMaxParamChars(int num) { maxParamChars = num; clear(); };
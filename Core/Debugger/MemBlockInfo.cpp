@@ -21,6 +21,7 @@
 #include <cstring>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 
 #include "Common/Log.h"
 #include "Common/Serialize/Serializer.h"
@@ -87,6 +88,7 @@ struct PendingNotifyMem {
 	uint32_t copySrc;
 	uint64_t ticks;
 	uint32_t pc;
+	uint64_t seq;
 	char tag[128];
 };
 
@@ -97,22 +99,65 @@ static MemSlabMap allocMap;
 static MemSlabMap suballocMap;
 static MemSlabMap writeMap;
 static MemSlabMap textureMap;
-static std::vector<PendingNotifyMem> pendingNotifies;
+
+// The pending queue is sharded by address so the CPU and GPU threads don't fight over a
+// single lock on every tracked memcpy. Atomic locks are used on the shards, the critical
+// sections are tiny. Order across shards is restored on flush using the sequence number.
+static constexpr size_t PENDING_SHARDS = 8;
+struct PendingShard {
+	std::atomic_flag lock = ATOMIC_FLAG_INIT;
+	std::vector<PendingNotifyMem> notifies;
+};
+static PendingShard pendingShards[PENDING_SHARDS];
+static std::atomic<uint64_t> pendingSeq;
 static std::atomic<uint32_t> pendingNotifyMinAddr1;
 static std::atomic<uint32_t> pendingNotifyMaxAddr1;
 static std::atomic<uint32_t> pendingNotifyMinAddr2;
 static std::atomic<uint32_t> pendingNotifyMaxAddr2;
-// To prevent deadlocks, acquire Read before Write if you're going to acquire both.
-static std::mutex pendingWriteMutex;
 static std::mutex pendingReadMutex;
 static int detailedOverride;
 
+static inline PendingShard &PendingShardForAddr(uint32_t addr) {
+	return pendingShards[(addr >> 16) % PENDING_SHARDS];
+}
+
+static inline void LockPendingShard(PendingShard &shard) {
+	while (shard.lock.test_and_set(std::memory_order_acquire)) {
+		// Spin. Shards are only held for a merge check and a push.
+	}
+}
+
+static inline void UnlockPendingShard(PendingShard &shard) {
+	shard.lock.clear(std::memory_order_release);
+}
+
+static inline void AtomicMin(std::atomic<uint32_t> &v, uint32_t value) {
+	uint32_t prev = v.load();
+	while (value < prev && !v.compare_exchange_weak(prev, value)) {
+	}
+}
+
+static inline void AtomicMax(std::atomic<uint32_t> &v, uint32_t value) {
+	uint32_t prev = v.load();
+	while (value > prev && !v.compare_exchange_weak(prev, value)) {
+	}
+}
+
 static std::thread flushThread;
 static std::atomic<bool> flushThreadRunning;
 static std::atomic<bool> flushThreadPending;
 static std::mutex flushLock;
 static std::condition_variable flushCond;
 
+// Allocation history: per-tag live/peak accounting plus a ring of the most
+// recent alloc/free events. Only alloc-type events feed this (no writes), so
+// the cost stays constant however long the session runs. Has its own lock
+// since readers arrive from the debugger websocket thread.
+static std::mutex allocHistoryLock;
+static MemAllocEvent allocEventRing[MEM_ALLOC_EVENT_RING];
+static uint64_t allocEventCount;
+static std::unordered_map<std::string, MemAllocTagStats> allocTagStats;
+
 MemSlabMap::MemSlabMap() {
 	Reset();
 }
@@ -397,23 +442,108 @@ void MemSlabMap::FillHeads(Slab *slab) {
 }
 
 size_t FormatMemWriteTagAtNoFlush(char *buf, size_t sz, const char *prefix, uint32_t start, uint32_t size);
+void FlushPendingMemInfo();
+
+static void RecordAllocHistory(const PendingNotifyMem &info) {
+	const bool isAlloc = (info.flags & (MemBlockFlags::ALLOC | MemBlockFlags::SUB_ALLOC)) != 0;
+	const bool isFree = (info.flags & (MemBlockFlags::FREE | MemBlockFlags::SUB_FREE)) != 0;
+	if (!isAlloc && !isFree)
+		return;
+
+	// Free notifies are tagged by whoever called the free, not by what was
+	// allocated there - look up the allocation's tag so the accounting and the
+	// event both name the leaker. The maps haven't been marked free yet.
+	const char *tag = info.tag;
+	if (isFree) {
+		MemSlabMap &map = (info.flags & MemBlockFlags::FREE) ? allocMap : suballocMap;
+		const char *allocTag = map.FastFindWriteTag(info.flags, info.start, info.size);
+		if (allocTag && allocTag[0] != '\0')
+			tag = allocTag;
+	}
+
+	std::lock_guard<std::mutex> guard(allocHistoryLock);
+	MemAllocTagStats &stats = allocTagStats[tag];
+	if (isAlloc) {
+		stats.liveBytes += info.size;
+		stats.liveCount++;
+		stats.totalAllocs++;
+		if (stats.liveBytes > stats.peakBytes)
+			stats.peakBytes = stats.liveBytes;
+	} else {
+		// Partial frees and missed attributions can drift - clamp at zero so a
+		// real leak still reads as monotonic growth.
+		stats.liveBytes -= std::min(stats.liveBytes, (uint64_t)info.size);
+		if (stats.liveCount > 0)
+			stats.liveCount--;
+	}
+
+	MemAllocEvent &event = allocEventRing[allocEventCount % MEM_ALLOC_EVENT_RING];
+	event.seq = allocEventCount++;
+	event.ticks = info.ticks;
+	event.pc = info.pc;
+	event.addr = info.start;
+	event.size = info.size;
+	if (info.flags & MemBlockFlags::ALLOC)
+		event.flags = MemBlockFlags::ALLOC;
+	else if (info.flags & MemBlockFlags::SUB_ALLOC)
+		event.flags = MemBlockFlags::SUB_ALLOC;
+	else if (info.flags & MemBlockFlags::FREE)
+		event.flags = MemBlockFlags::FREE;
+	else
+		event.flags = MemBlockFlags::SUB_FREE;
+	truncate_cpy(event.tag, tag);
+}
+
+std::vector<MemAllocTagStats> GetMemAllocTagStats() {
+	FlushPendingMemInfo();
+
+	std::lock_guard<std::mutex> guard(allocHistoryLock);
+	std::vector<MemAllocTagStats> results;
+	results.reserve(allocTagStats.size());
+	for (const auto &pair : allocTagStats) {
+		MemAllocTagStats stats = pair.second;
+		stats.tag = pair.first;
+		results.push_back(std::move(stats));
+	}
+	return results;
+}
+
+uint64_t GetMemAllocEvents(uint64_t afterSeq, std::vector<MemAllocEvent> &events) {
+	FlushPendingMemInfo();
+
+	std::lock_guard<std::mutex> guard(allocHistoryLock);
+	uint64_t first = allocEventCount > MEM_ALLOC_EVENT_RING ? allocEventCount - MEM_ALLOC_EVENT_RING : 0;
+	if (afterSeq > first)
+		first = afterSeq;
+	for (uint64_t i = first; i < allocEventCount; ++i)
+		events.push_back(allocEventRing[i % MEM_ALLOC_EVENT_RING]);
+	return allocEventCount;
+}
 
 void FlushPendingMemInfo() {
 	// This lock prevents us from another thread reading while we're busy flushing.
 	std::lock_guard<std::mutex> guard(pendingReadMutex);
-	std::vector<PendingNotifyMem> thisBatch;
-	{
-		std::lock_guard<std::mutex> guard(pendingWriteMutex);
-		thisBatch = std::move(pendingNotifies);
-		pendingNotifies.clear();
-		pendingNotifies.reserve(MAX_PENDING_NOTIFIES);
 
-		pendingNotifyMinAddr1 = 0xFFFFFFFF;
-		pendingNotifyMaxAddr1 = 0;
-		pendingNotifyMinAddr2 = 0xFFFFFFFF;
-		pendingNotifyMaxAddr2 = 0;
+	// Reset the hints before draining - anything pushed after this point sets them again,
+	// anything pushed before is picked up by the drain below.
+	pendingNotifyMinAddr1 = 0xFFFFFFFF;
+	pendingNotifyMaxAddr1 = 0;
+	pendingNotifyMinAddr2 = 0xFFFFFFFF;
+	pendingNotifyMaxAddr2 = 0;
+
+	std::vector<PendingNotifyMem> thisBatch;
+	for (PendingShard &shard : pendingShards) {
+		LockPendingShard(shard);
+		thisBatch.insert(thisBatch.end(), shard.notifies.begin(), shard.notifies.end());
+		shard.notifies.clear();
+		UnlockPendingShard(shard);
 	}
 
+	// Restore the original notify order across the shards.
+	std::sort(thisBatch.begin(), thisBatch.end(), [](const PendingNotifyMem &a, const PendingNotifyMem &b) {
+		return a.seq < b.seq;
+	});
+
 	for (const auto &info : thisBatch) {
 		if (info.copySrc != 0) {
 			char tagData[128];
@@ -422,6 +552,9 @@ void FlushPendingMemInfo() {
 			continue;
 		}
 
+		// Before the maps update, so frees can still look up the alloc tag.
+		RecordAllocHistory(info);
+
 		if (info.flags & MemBlockFlags::ALLOC) {
 			allocMap.Mark(info.start, info.size, info.ticks, info.pc, true, info.tag);
 		} else if (info.flags & MemBlockFlags::FREE) {
@@ -450,12 +583,12 @@ static inline uint32_t NormalizeAddress(uint32_t addr) {
 	return addr & 0x3FFFFFFF;
 }
 
-static inline bool MergeRecentMemInfo(const PendingNotifyMem &info, size_t copyLength) {
-	if (pendingNotifies.size() < 4)
+static inline bool MergeRecentMemInfo(std::vector<PendingNotifyMem> &notifies, const PendingNotifyMem &info, size_t copyLength) {
+	if (notifies.size() < 4)
 		return false;
 
 	for (size_t i = 1; i <= 4; ++i) {
-		auto &prev = pendingNotifies[pendingNotifies.size() - i];
+		auto &prev = notifies[notifies.size() - i];
 		if (prev.copySrc != 0)
 			return false;
 
@@ -500,19 +633,22 @@ void NotifyMemInfoPC(MemBlockFlags flags, uint32_t start, uint32_t size, uint32_
 		memcpy(info.tag, tagStr, copyLength);
 		info.tag[copyLength] = 0;
 
-		std::lock_guard<std::mutex> guard(pendingWriteMutex);
+		PendingShard &shard = PendingShardForAddr(start);
+		LockPendingShard(shard);
 		// Sometimes we get duplicates, quickly check.
-		if (!MergeRecentMemInfo(info, copyLength)) {
+		if (!MergeRecentMemInfo(shard.notifies, info, copyLength)) {
 			if (start < 0x08000000) {
-				pendingNotifyMinAddr1 = std::min(pendingNotifyMinAddr1.load(), start);
-				pendingNotifyMaxAddr1 = std::max(pendingNotifyMaxAddr1.load(), start + size);
+				AtomicMin(pendingNotifyMinAddr1, start);
+				AtomicMax(pendingNotifyMaxAddr1, start + size);
 			} else {
-				pendingNotifyMinAddr2 = std::min(pendingNotifyMinAddr2.load(), start);
-				pendingNotifyMaxAddr2 = std::max(pendingNotifyMaxAddr2.load(), start + size);
+				AtomicMin(pendingNotifyMinAddr2, start);
+				AtomicMax(pendingNotifyMaxAddr2, start + size);
 			}
-			pendingNotifies.push_back(info);
+			info.seq = pendingSeq.fetch_add(1, std::memory_order_relaxed);
+			shard.notifies.push_back(info);
 		}
-		needFlush = pendingNotifies.size() > MAX_PENDING_NOTIFIES_THREAD;
+		needFlush = shard.notifies.size() > MAX_PENDING_NOTIFIES_THREAD / PENDING_SHARDS;
+		UnlockPendingShard(shard);
 	}
 
 	if (needFlush) {
@@ -559,16 +695,19 @@ void NotifyMemInfoCopy(uint32_t destPtr, uint32_t srcPtr, uint32_t size, const c
 		// Store the prefix for now.  The correct tag will be calculated on flush.
 		truncate_cpy(info.tag, prefix);
 
-		std::lock_guard<std::mutex> guard(pendingWriteMutex);
 		if (destPtr < 0x08000000) {
-			pendingNotifyMinAddr1 = std::min(pendingNotifyMinAddr1.load(), destPtr);
-			pendingNotifyMaxAddr1 = std::max(pendingNotifyMaxAddr1.load(), destPtr + size);
+			AtomicMin(pendingNotifyMinAddr1, destPtr);
+			AtomicMax(pendingNotifyMaxAddr1, destPtr + size);
 		} else {
-			pendingNotifyMinAddr2 = std::min(pendingNotifyMinAddr2.load(), destPtr);
-			pendingNotifyMaxAddr2 = std::max(pendingNotifyMaxAddr2.load(), destPtr + size);
+			AtomicMin(pendingNotifyMinAddr2, destPtr);
+			AtomicMax(pendingNotifyMaxAddr2, destPtr + size);
 		}
-		pendingNotifies.push_back(info);
-		needsFlush = pendingNotifies.size() > MAX_PENDING_NOTIFIES_THREAD;
+		PendingShard &shard = PendingShardForAddr(destPtr);
+		LockPendingShard(shard);
+		info.seq = pendingSeq.fetch_add(1, std::memory_order_relaxed);
+		shard.notifies.push_back(info);
+		needsFlush = shard.notifies.size() > MAX_PENDING_NOTIFIES_THREAD / PENDING_SHARDS;
+		UnlockPendingShard(shard);
 	}
 
 	if (needsFlush) {
@@ -691,8 +830,17 @@ static void FlushMemInfoThread() {
 
 void MemBlockInfoInit() {
 	std::lock_guard<std::mutex> guard(pendingReadMutex);
-	std::lock_guard<std::mutex> guardW(pendingWriteMutex);
-	pendingNotifies.reserve(MAX_PENDING_NOTIFIES);
+	for (PendingShard &shard : pendingShards) {
+		LockPendingShard(shard);
+		shard.notifies.reserve(MAX_PENDING_NOTIFIES / PENDING_SHARDS);
+		UnlockPendingShard(shard);
+	}
+	{
+		std::lock_guard<std::mutex> history(allocHistoryLock);
+		allocEventCount = 0;
+		allocTagStats.clear();
+	}
+	pendingSeq = 0;
 	pendingNotifyMinAddr1 = 0xFFFFFFFF;
 	pendingNotifyMaxAddr1 = 0;
 	pendingNotifyMinAddr2 = 0xFFFFFFFF;
@@ -706,12 +854,18 @@ void MemBlockInfoInit() {
 void MemBlockInfoShutdown() {
 	{
 		std::lock_guard<std::mutex> guard(pendingReadMutex);
-		std::lock_guard<std::mutex> guardW(pendingWriteMutex);
 		allocMap.Reset();
 		suballocMap.Reset();
 		writeMap.Reset();
 		textureMap.Reset();
-		pendingNotifies.clear();
+		for (PendingShard &shard : pendingShards) {
+			LockPendingShard(shard);
+			shard.notifies.clear();
+			UnlockPendingShard(shard);
+		}
+		std::lock_guard<std::mutex> history(allocHistoryLock);
+		allocEventCount = 0;
+		allocTagStats.clear();
 	}
 
 	if (flushThreadRunning.load()) {
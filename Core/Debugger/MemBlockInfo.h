@@ -69,6 +69,35 @@ inline void NotifyMemInfo(MemBlockFlags flags, uint32_t start, uint32_t size, co
 std::vector<MemBlockInfo> FindMemInfo(uint32_t start, uint32_t size);
 std::vector<MemBlockInfo> FindMemInfoByFlag(MemBlockFlags flags, uint32_t start, uint32_t size);
 
+// Live/peak accounting per allocation tag, for chasing kernel heap leaks over
+// long sessions without attaching anything heavier.
+struct MemAllocTagStats {
+	std::string tag;
+	uint64_t liveBytes = 0;
+	uint64_t peakBytes = 0;
+	uint32_t liveCount = 0;
+	uint32_t totalAllocs = 0;
+};
+
+// One alloc/free event. The last MEM_ALLOC_EVENT_RING of these are kept so a
+// debugger can stream them; older events only survive in the tag stats.
+struct MemAllocEvent {
+	uint64_t seq;
+	uint64_t ticks;
+	uint32_t pc;
+	uint32_t addr;
+	uint32_t size;
+	MemBlockFlags flags;  // ALLOC, SUB_ALLOC, FREE or SUB_FREE.
+	char tag[128];        // Frees carry the tag of the allocation they released.
+};
+
+static constexpr size_t MEM_ALLOC_EVENT_RING = 1024;
+
+std::vector<MemAllocTagStats> GetMemAllocTagStats();
+// Appends events with seq >= afterSeq (bounded by the ring size) and returns
+// the total recorded so far - pass that back in as afterSeq to resume.
+uint64_t GetMemAllocEvents(uint64_t afterSeq, std::vector<MemAllocEvent> &events);
+
 size_t FormatMemWriteTagAt(char *buf, size_t sz, const char *prefix, uint32_t start, uint32_t size);
 
 void MemBlockInfoInit();
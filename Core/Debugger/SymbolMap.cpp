@@ -462,11 +462,19 @@ void SymbolMap::AddModule(const char *name, u32 address, u32 size) {
 
 	for (auto it = modules.begin(), end = modules.end(); it != end; ++it) {
 		if (!strcmp(it->name, name)) {
+			// If it's somehow still active at another address, drop those entries first.
+			auto old = activeModuleEnds.find(it->start + it->size);
+			if (old != activeModuleEnds.end() && old->second.index == it->index) {
+				ModuleEntry oldMod = old->second;
+				activeModuleEnds.erase(old);
+				DeactivateModuleSymbols(oldMod);
+			}
+
 			// Just reactivate that one.
 			it->start = address;
 			it->size = size;
 			activeModuleEnds.emplace(it->start + it->size, *it);
-			activeNeedUpdate_ = true;
+			ActivateModuleSymbols(*it);
 			return;
 		}
 	}
@@ -479,13 +487,17 @@ void SymbolMap::AddModule(const char *name, u32 address, u32 size) {
 
 	modules.push_back(mod);
 	activeModuleEnds.emplace(mod.start + mod.size, mod);
-	activeNeedUpdate_ = true;
+	ActivateModuleSymbols(mod);
 }
 
 void SymbolMap::UnloadModule(u32 address, u32 size) {
 	std::lock_guard<std::recursive_mutex> guard(lock_);
-	activeModuleEnds.erase(address + size);
-	activeNeedUpdate_ = true;
+	auto iter = activeModuleEnds.find(address + size);
+	if (iter == activeModuleEnds.end())
+		return;
+	ModuleEntry mod = iter->second;
+	activeModuleEnds.erase(iter);
+	DeactivateModuleSymbols(mod);
 }
 
 u32 SymbolMap::GetModuleRelativeAddr(u32 address, int moduleIndex) const {
@@ -721,6 +733,50 @@ void SymbolMap::AssignFunctionIndices() {
 	}
 }
 
+void SymbolMap::ActivateModuleSymbols(const ModuleEntry &mod) {
+	std::lock_guard<std::recursive_mutex> guard(lock_);
+
+	const auto fbegin = functions.lower_bound(std::make_pair(mod.index, 0));
+	const auto fend = functions.upper_bound(std::make_pair(mod.index, 0xFFFFFFFF));
+	for (auto it = fbegin; it != fend; ++it)
+		activeFunctions.emplace(mod.start + it->second.start, it->second);
+
+	const auto lbegin = labels.lower_bound(std::make_pair(mod.index, 0));
+	const auto lend = labels.upper_bound(std::make_pair(mod.index, 0xFFFFFFFF));
+	for (auto it = lbegin; it != lend; ++it)
+		activeLabels.emplace(mod.start + it->second.addr, it->second);
+
+	const auto dbegin = data.lower_bound(std::make_pair(mod.index, 0));
+	const auto dend = data.upper_bound(std::make_pair(mod.index, 0xFFFFFFFF));
+	for (auto it = dbegin; it != dend; ++it)
+		activeData.emplace(mod.start + it->second.start, it->second);
+
+	AssignFunctionIndices();
+}
+
+void SymbolMap::DeactivateModuleSymbols(const ModuleEntry &mod) {
+	std::lock_guard<std::recursive_mutex> guard(lock_);
+
+	const u32 start = mod.start;
+	const u32 end = mod.start + mod.size;
+	// Only remove entries that actually belong to the module - "module 0" symbols
+	// are always active and may share the address range.
+	auto eraseRange = [&](auto &activeMap) {
+		auto it = activeMap.lower_bound(start);
+		while (it != activeMap.end() && (it->first < end || end < start)) {
+			if (it->second.module == mod.index)
+				it = activeMap.erase(it);
+			else
+				++it;
+		}
+	};
+	eraseRange(activeFunctions);
+	eraseRange(activeLabels);
+	eraseRange(activeData);
+
+	AssignFunctionIndices();
+}
+
 void SymbolMap::UpdateActiveSymbols() {
 	// return;   (slow in debug mode)
 	std::lock_guard<std::recursive_mutex> guard(lock_);
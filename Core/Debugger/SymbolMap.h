@@ -125,6 +125,12 @@ private:
 	const char *GetLabelName(u32 address);
 	const char *GetLabelNameRel(u32 relAddress, int moduleIndex) const;
 
+	struct ModuleEntry;
+	// Incremental alternatives to UpdateActiveSymbols() - touch only one module's symbols,
+	// so loading/unloading a module doesn't rebuild the whole active set.
+	void ActivateModuleSymbols(const ModuleEntry &mod);
+	void DeactivateModuleSymbols(const ModuleEntry &mod);
+
 	struct FunctionEntry {
 		u32 start;
 		u32 size;
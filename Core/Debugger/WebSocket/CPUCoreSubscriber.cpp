@@ -15,19 +15,39 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include <algorithm>
+#include <vector>
+
 #include "Common/StringUtils.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/Debugger/Breakpoints.h"
+#include "Core/Debugger/SymbolMap.h"
 #include "Core/Debugger/WebSocket/CPUCoreSubscriber.h"
 #include "Core/Debugger/WebSocket/WebSocketUtils.h"
 #include "Core/HLE/sceKernelThread.h"
 #include "Core/MIPS/MIPS.h"
 #include "Core/MIPS/MIPSDebugInterface.h"
+#include "Core/MIPS/JitCommon/JitBlockCache.h"
+#include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/Reporting.h"
 
+struct WebSocketCPURegDeltaState : public DebuggerSubscriber {
+	void Subscribe(DebuggerRequest &req);
+	void Unsubscribe(DebuggerRequest &req);
+
+	void Broadcast(net::WebSocketServer *ws) override;
+
+protected:
+	void Snapshot(std::vector<uint32_t> &values);
+
+	bool subscribed_ = false;
+	int lastCounter_ = -1;
+	std::vector<uint32_t> lastValues_;
+};
+
 DebuggerSubscriber *WebSocketCPUCoreInit(DebuggerEventHandlerMap &map) {
-	// No need to bind or alloc state, these are all global.
+	// Most of these are global, only the delta subscription carries state.
 	map["cpu.stepping"] = &WebSocketCPUStepping;
 	map["cpu.resume"] = &WebSocketCPUResume;
 	map["cpu.status"] = &WebSocketCPUStatus;
@@ -35,8 +55,13 @@ DebuggerSubscriber *WebSocketCPUCoreInit(DebuggerEventHandlerMap &map) {
 	map["cpu.getReg"] = &WebSocketCPUGetReg;
 	map["cpu.setReg"] = &WebSocketCPUSetReg;
 	map["cpu.evaluate"] = &WebSocketCPUEvaluate;
+	map["cpu.blockProfile"] = &WebSocketCPUBlockProfile;
 
-	return nullptr;
+	auto p = new WebSocketCPURegDeltaState();
+	map["cpu.regDeltas.subscribe"] = std::bind(&WebSocketCPURegDeltaState::Subscribe, p, std::placeholders::_1);
+	map["cpu.regDeltas.unsubscribe"] = std::bind(&WebSocketCPURegDeltaState::Unsubscribe, p, std::placeholders::_1);
+
+	return p;
 }
 
 static std::string RegValueAsFloat(uint32_t u) {
@@ -178,6 +203,101 @@ void WebSocketCPUGetAllRegs(DebuggerRequest &req) {
 	json.pop();
 }
 
+// Subscribe to register deltas (cpu.regDeltas.subscribe)
+//
+// No parameters.
+//
+// Response (same event name) with no extra data. After this, a "cpu.regDeltas" event is
+// pushed each time the CPU stops stepping, containing only the registers that changed
+// since the last push - much less traffic than polling cpu.getAllRegs per step.
+void WebSocketCPURegDeltaState::Subscribe(DebuggerRequest &req) {
+	subscribed_ = true;
+	// Forget the old baseline so the next push is a full set.
+	lastValues_.clear();
+	lastCounter_ = -1;
+	req.Respond();
+}
+
+// Unsubscribe from register deltas (cpu.regDeltas.unsubscribe)
+//
+// No parameters.
+//
+// Response (same event name) with no extra data.
+void WebSocketCPURegDeltaState::Unsubscribe(DebuggerRequest &req) {
+	subscribed_ = false;
+	lastValues_.clear();
+	req.Respond();
+}
+
+void WebSocketCPURegDeltaState::Snapshot(std::vector<uint32_t> &values) {
+	for (int c = 0; c < currentDebugMIPS->GetNumCategories(); ++c) {
+		int total = currentDebugMIPS->GetNumRegsInCategory(c);
+		for (int r = 0; r < total; ++r)
+			values.push_back(currentDebugMIPS->GetRegValue(c, r));
+		if (c == 0) {
+			// Same faked GPR indices (32-34) as cpu.getReg/cpu.setReg.
+			values.push_back(currentDebugMIPS->GetPC());
+			values.push_back(currentDebugMIPS->GetHi());
+			values.push_back(currentDebugMIPS->GetLo());
+		}
+	}
+}
+
+// Registers changed while stepping (cpu.regDeltas)
+//
+// Sent unexpectedly to subscribers with these properties:
+//  - full: boolean, true when all registers are listed (first push after subscribing.)
+//  - deltas: array of objects:
+//     - category: id for use in cpu.getReg/cpu.setReg.
+//     - register: index within the category (GPR 32-34 are pc/hi/lo.)
+//     - uintValue: unsigned integer value for the register.
+//     - floatValue: string showing float representation.  May be "nan", "inf", or "-inf".
+void WebSocketCPURegDeltaState::Broadcast(net::WebSocketServer *ws) {
+	if (!subscribed_)
+		return;
+	if (!PSP_IsInited() || !currentDebugMIPS->isAlive()) {
+		lastValues_.clear();
+		lastCounter_ = -1;
+		return;
+	}
+
+	int steppingCounter = Core_GetSteppingCounter();
+	if (coreState != CORE_STEPPING || steppingCounter == lastCounter_)
+		return;
+	lastCounter_ = steppingCounter;
+
+	std::vector<uint32_t> values;
+	Snapshot(values);
+	const bool full = values.size() != lastValues_.size();
+
+	JsonWriter j;
+	j.begin();
+	j.writeString("event", "cpu.regDeltas");
+	j.writeBool("full", full);
+	j.pushArray("deltas");
+	size_t index = 0;
+	for (int c = 0; c < currentDebugMIPS->GetNumCategories(); ++c) {
+		int total = currentDebugMIPS->GetNumRegsInCategory(c);
+		if (c == 0)
+			total += 3;
+		for (int r = 0; r < total; ++r, ++index) {
+			if (!full && values[index] == lastValues_[index])
+				continue;
+			j.pushDict();
+			j.writeInt("category", c);
+			j.writeInt("register", r);
+			j.writeUint("uintValue", values[index]);
+			j.writeString("floatValue", RegValueAsFloat(values[index]));
+			j.pop();
+		}
+	}
+	j.pop();
+	j.end();
+	ws->Send(j.str());
+
+	lastValues_ = std::move(values);
+}
+
 enum class DebuggerRegType {
 	INVALID,
 	NORMAL,
@@ -413,3 +533,66 @@ void WebSocketCPUEvaluate(DebuggerRequest &req) {
 	json.writeUint("uintValue", val);
 	json.writeString("floatValue", RegValueAsFloat(val));
 }
+
+// Get ranked per-block execution statistics (cpu.blockProfile)
+//
+// Parameters:
+//  - count: optional number of top blocks to return (default 100.)
+//
+// Response (same event name):
+//  - blocks: array of objects, sorted by total time descending, each with:
+//     - address: unsigned integer address of the block's first MIPS instruction.
+//     - symbol: string name of the containing function, if known.
+//     - executions: number of times the block has run.
+//     - totalNanos: total time spent executing the block.
+//
+// Only available when the CPU core collects block profiling stats (IR_PROFILING.)
+void WebSocketCPUBlockProfile(DebuggerRequest &req) {
+	if (!currentDebugMIPS->isAlive()) {
+		return req.Fail("CPU not started");
+	}
+
+	std::lock_guard<std::recursive_mutex> guard(MIPSComp::jitLock);
+	JitBlockCacheDebugInterface *blockCache = MIPSComp::jit ? MIPSComp::jit->GetBlockCacheDebugInterface() : nullptr;
+	if (!blockCache || !blockCache->SupportsProfiling()) {
+		return req.Fail("Block profiling not supported by the current CPU core");
+	}
+
+	u32 count = 100;
+	if (req.HasParam("count") && !req.ParamU32("count", &count)) {
+		// Already sent error.
+		return;
+	}
+
+	struct BlockEntry {
+		u32 addr;
+		JitBlockProfileStats stats;
+	};
+	std::vector<BlockEntry> entries;
+	const int numBlocks = blockCache->GetNumBlocks();
+	for (int i = 0; i < numBlocks; i++) {
+		if (!blockCache->IsValidBlock(i))
+			continue;
+		JitBlockProfileStats stats = blockCache->GetBlockProfileStats(i);
+		if (stats.executions == 0)
+			continue;
+		entries.push_back(BlockEntry{ blockCache->GetBlockMeta(i).addr, stats });
+	}
+	std::sort(entries.begin(), entries.end(), [](const BlockEntry &a, const BlockEntry &b) {
+		return a.stats.totalNanos > b.stats.totalNanos;
+	});
+	if (entries.size() > count)
+		entries.resize(count);
+
+	JsonWriter &json = req.Respond();
+	json.pushArray("blocks");
+	for (const auto &entry : entries) {
+		json.pushDict();
+		json.writeUint("address", entry.addr);
+		json.writeString("symbol", g_symbolMap ? g_symbolMap->GetDescription(entry.addr) : "");
+		json.writeUint("executions", (uint64_t)entry.stats.executions);
+		json.writeUint("totalNanos", (uint64_t)entry.stats.totalNanos);
+		json.pop();
+	}
+	json.pop();
+}
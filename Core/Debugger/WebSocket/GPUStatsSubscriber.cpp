@@ -15,11 +15,15 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include <algorithm>
 #include <mutex>
 #include <vector>
+#include "Common/GPU/thin3d.h"
 #include "Core/Debugger/WebSocket/GPUStatsSubscriber.h"
+#include "Core/FrameTiming.h"
 #include "Core/HW/Display.h"
 #include "Core/System.h"
+#include "GPU/GPUInterface.h"
 
 struct CollectedStats {
 	float vps;
@@ -29,6 +33,8 @@ struct CollectedStats {
 	std::vector<double> frameTimes;
 	std::vector<double> sleepTimes;
 	int frameTimePos;
+	double inputPollTime;
+	std::vector<FrameTimeData> latencyFrames;
 };
 
 struct DebuggerGPUStatsEvent {
@@ -61,6 +67,25 @@ struct DebuggerGPUStatsEvent {
 		j.pop();
 		j.writeInt("pos", s.frameTimePos);
 		j.pop();
+		j.pushDict("latency");
+		j.writeFloat("inputPoll", s.inputPollTime);
+		j.pushArray("frames");
+		for (const FrameTimeData &f : s.latencyFrames) {
+			j.pushDict();
+			j.writeFloat("frameId", (double)f.frameId);
+			j.writeInt("waitCount", f.waitCount);
+			j.writeFloat("frameBegin", f.frameBegin);
+			j.writeFloat("afterFenceWait", f.afterFenceWait);
+			j.writeFloat("firstSubmit", f.firstSubmit);
+			j.writeFloat("queuePresent", f.queuePresent);
+			j.writeFloat("actualPresent", f.actualPresent);
+			j.writeFloat("desiredPresentTime", f.desiredPresentTime);
+			j.writeFloat("earliestPresentTime", f.earliestPresentTime);
+			j.writeFloat("presentMargin", f.presentMargin);
+			j.pop();
+		}
+		j.pop();
+		j.pop();
 		j.end();
 		return j.str();
 	}
@@ -131,6 +156,18 @@ void WebSocketGPUStatsState::FlipListener() {
 	memcpy(&stats.frameTimes[0], history, sizeof(double) * valid);
 	memcpy(&stats.sleepTimes[0], sleepHistory, sizeof(double) * valid);
 
+	// Per-frame latency records, from the backend's frame timestamp ring. Together with the
+	// input poll time this lets external tooling compute input-to-present latency.
+	stats.inputPollTime = g_frameTiming.lastInputPollTime;
+	if (gpu && gpu->GetDrawContext()) {
+		const auto &frameHistory = gpu->GetDrawContext()->FrameTimeHistory();
+		size_t count = std::min(frameHistory.MaxIndex(), FRAME_TIME_HISTORY_LENGTH);
+		for (size_t i = count; i > 0; i--) {
+			// Oldest first, so consumers can append to a log/CSV directly.
+			stats.latencyFrames.push_back(frameHistory.Back(i - 1));
+		}
+	}
+
 	sendNext_ = false;
 }
 
@@ -146,6 +183,12 @@ void WebSocketGPUStatsState::FlipListener() {
 //     - frames: array of numbers, each representing the time taken for a frame.
 //     - sleep: array of numbers, each representing the delay time waiting for next frame.
 //     - pos: number, index of the current frame (not always last.)
+//  - latency: object with properties:
+//     - inputPoll: number, timestamp when input was last polled.
+//     - frames: array of objects (oldest first), each with timestamps for one frame:
+//       frameBegin, afterFenceWait, firstSubmit, queuePresent, actualPresent,
+//       desiredPresentTime, earliestPresentTime, presentMargin, plus frameId and waitCount.
+//       Timestamps are in seconds on the same clock as inputPoll; 0 if not available.
 //
 // Note: stats are returned after the next flip completes (paused if CPU or GPU in break.)
 // Note: info and timing may not be accurate if certain settings are disabled.
@@ -36,6 +36,8 @@ public:
 	void Set(DebuggerRequest &req);
 	void List(DebuggerRequest &req);
 	void Search(DebuggerRequest &req);
+	void AllocStats(DebuggerRequest &req);
+	void AllocEvents(DebuggerRequest &req);
 
 protected:
 	void UpdateOverride(bool flag);
@@ -50,6 +52,8 @@ DebuggerSubscriber *WebSocketMemoryInfoInit(DebuggerEventHandlerMap &map) {
 	map["memory.info.set"] = std::bind(&WebSocketMemoryInfoState::Set, p, std::placeholders::_1);
 	map["memory.info.list"] = std::bind(&WebSocketMemoryInfoState::List, p, std::placeholders::_1);
 	map["memory.info.search"] = std::bind(&WebSocketMemoryInfoState::Search, p, std::placeholders::_1);
+	map["memory.alloc.stats"] = std::bind(&WebSocketMemoryInfoState::AllocStats, p, std::placeholders::_1);
+	map["memory.alloc.events"] = std::bind(&WebSocketMemoryInfoState::AllocEvents, p, std::placeholders::_1);
 
 	return p;
 }
@@ -298,6 +302,92 @@ void WebSocketMemoryInfoState::List(DebuggerRequest &req) {
 	json.pop();
 }
 
+// List per-tag allocation accounting (memory.alloc.stats)
+//
+// No parameters.
+//
+// Response (same event name):
+//  - tags: array of objects, sorted by live bytes descending:
+//     - tag: string allocation tag.
+//     - liveBytes: number, bytes currently allocated under this tag.
+//     - peakBytes: number, highest liveBytes seen this session.
+//     - liveCount: number of live allocations.
+//     - totalAllocs: number of allocations since the game started.
+//
+// A tag whose liveBytes keeps growing while liveCount doesn't return to its
+// baseline is the usual leak signature.
+void WebSocketMemoryInfoState::AllocStats(DebuggerRequest &req) {
+	if (!currentDebugMIPS->isAlive() || !Memory::IsActive())
+		return req.Fail("CPU not started");
+
+	std::vector<MemAllocTagStats> stats = GetMemAllocTagStats();
+	std::sort(stats.begin(), stats.end(), [](const MemAllocTagStats &a, const MemAllocTagStats &b) {
+		return a.liveBytes > b.liveBytes;
+	});
+
+	JsonWriter &json = req.Respond();
+	json.pushArray("tags");
+	for (const auto &entry : stats) {
+		json.pushDict();
+		json.writeString("tag", entry.tag);
+		json.writeUint("liveBytes", (uint32_t)entry.liveBytes);
+		json.writeUint("peakBytes", (uint32_t)entry.peakBytes);
+		json.writeUint("liveCount", entry.liveCount);
+		json.writeUint("totalAllocs", entry.totalAllocs);
+		json.pop();
+	}
+	json.pop();
+}
+
+// Stream recent allocation events (memory.alloc.events)
+//
+// Parameters:
+//  - after: optional number, the "next" value from the previous response.
+//    Only events recorded after that point are returned, so polling this is a
+//    constant-overhead stream. Events are kept in a ring of 1024, anything a
+//    slow poller misses is dropped (but still reflected in memory.alloc.stats.)
+//
+// Response (same event name):
+//  - next: number to pass as after on the next call.
+//  - events: array of objects, in order:
+//     - type: "alloc", "suballoc", "free", or "subfree".
+//     - address: number.
+//     - size: number, in bytes.
+//     - pc: number, PC of the requesting code.
+//     - ticks: number indicating tick counter at the event.
+//     - tag: string allocation tag (frees carry the allocating tag.)
+void WebSocketMemoryInfoState::AllocEvents(DebuggerRequest &req) {
+	if (!currentDebugMIPS->isAlive() || !Memory::IsActive())
+		return req.Fail("CPU not started");
+
+	uint32_t after = 0;
+	if (!req.ParamU32("after", &after, false, DebuggerParamType::OPTIONAL))
+		return;
+
+	std::vector<MemAllocEvent> events;
+	uint64_t next = GetMemAllocEvents(after, events);
+
+	JsonWriter &json = req.Respond();
+	json.writeFloat("next", (double)next);
+	json.pushArray("events");
+	for (const auto &event : events) {
+		json.pushDict();
+		if (event.flags & MemBlockFlags::FREE)
+			json.writeString("type", "free");
+		else if (event.flags & MemBlockFlags::SUB_FREE)
+			json.writeString("type", "subfree");
+		else
+			json.writeString("type", TypeFromFlag(event.flags));
+		json.writeUint("address", event.addr);
+		json.writeUint("size", event.size);
+		json.writeUint("pc", event.pc);
+		json.writeFloat("ticks", (double)event.ticks);
+		json.writeString("tag", event.tag);
+		json.pop();
+	}
+	json.pop();
+}
+
 // Search memory info tags for a string (memory.info.search)
 //
 // Parameters:
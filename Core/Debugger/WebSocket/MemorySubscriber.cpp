@@ -187,9 +187,17 @@ void WebSocketMemoryReadU32(DebuggerRequest &req) {
 //  - address: unsigned integer address for the start of the memory range.
 //  - size: unsigned integer specifying size of memory range.
 //  - replacements: optional, false to ignore PPSSPP replacements in MIPS code.
+//  - format: optional, 'base64' (default) or 'binary'.
 //
-// Response (same event name):
+// Response (same event name) for 'base64':
 //  - base64: base64 encode of binary data.
+//
+// Response (same event name) for 'binary':
+//  - address: the address that was read.
+//  - size: number of bytes read.
+// Followed immediately by a single binary frame: an 8 byte header with the address
+// and size as little-endian u32s, then the raw bytes. This skips the base64
+// overhead entirely, which matters for multi-megabyte dumps.
 void WebSocketMemoryRead(DebuggerRequest &req) {
 	uint32_t addr;
 	if (!req.ParamU32("address", &addr))
@@ -200,6 +208,11 @@ void WebSocketMemoryRead(DebuggerRequest &req) {
 	bool replacements = true;
 	if (!req.ParamBool("replacements", &replacements, DebuggerParamType::OPTIONAL))
 		return;
+	std::string format = "base64";
+	if (!req.ParamString("format", &format, DebuggerParamType::OPTIONAL))
+		return;
+	if (format != "base64" && format != "binary")
+		return req.Fail("Invalid format, must be either base64 or binary");
 
 	auto memLock = LockMemoryAndCPU(addr, replacements);
 	if (!currentDebugMIPS->isAlive() || !Memory::IsActive())
@@ -210,6 +223,22 @@ void WebSocketMemoryRead(DebuggerRequest &req) {
 	else if (!Memory::IsValidRange(addr, size))
 		return req.Fail("Invalid size");
 
+	if (format == "binary") {
+		JsonWriter &json = req.Respond();
+		json.writeUint("address", addr);
+		json.writeUint("size", size);
+		// Send the JSON response now so the binary frame follows it.
+		req.Finish();
+
+		std::vector<uint8_t> frame;
+		frame.resize(8 + size);
+		const uint32_t header[2] = { addr, size };
+		memcpy(&frame[0], header, sizeof(header));
+		memcpy(&frame[8], Memory::GetPointerUnchecked(addr), size);
+		req.ws->Send(frame);
+		return;
+	}
+
 	JsonWriter &json = req.Respond();
 	// Start a value without any actual data yet...
 	json.writeRaw("base64", "");
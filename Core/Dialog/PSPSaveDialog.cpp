@@ -114,7 +114,6 @@ int PSPSaveDialog::Init(int paramAddr)
 	Memory::Memcpy(&originalRequest, requestAddr, size);
 
 	param.SetIgnoreTextures(IsNotVisibleAction((SceUtilitySavedataType)(u32)request.mode));
-	param.ClearSFOCache();
 	int retval = param.SetPspParam(&request);
 
 	const u32 mode = (u32)param.GetPspParam()->mode;
@@ -269,7 +268,6 @@ int PSPSaveDialog::Init(int paramAddr)
 		ChangeStatusInit(SAVEDATA_INIT_DELAY_US);
 	}
 
-	param.ClearSFOCache();
 	InitCommon();
 	UpdateButtons();
 	StartFade(true);
@@ -651,7 +649,6 @@ int PSPSaveDialog::Update(int animSpeed)
 		param.SetPspParam(&request);
 	}
 
-	param.ClearSFOCache();
 	UpdateButtons();
 	UpdateFade(animSpeed);
 
@@ -1060,13 +1057,11 @@ int PSPSaveDialog::Update(int animSpeed)
 
 	if (ReadStatus() == SCE_UTILITY_STATUS_FINISHED || pendingStatus == SCE_UTILITY_STATUS_FINISHED)
 		Memory::Memcpy(requestAddr, &request, request.common.size, "SaveDialogParam");
-	param.ClearSFOCache();
 	
 	return 0;
 }
 
 void PSPSaveDialog::ExecuteIOAction() {
-	param.ClearSFOCache();
 	auto &result = param.GetPspParam()->common.result;
 	std::lock_guard<std::mutex> guard(paramLock);
 	switch (display) {
@@ -1105,11 +1100,9 @@ void PSPSaveDialog::ExecuteIOAction() {
 	}
 
 	ioThreadStatus = SAVEIO_DONE;
-	param.ClearSFOCache();
 }
 
 void PSPSaveDialog::ExecuteNotVisibleIOAction() {
-	param.ClearSFOCache();
 	auto &result = param.GetPspParam()->common.result;
 
 	SceUtilitySavedataType utilityMode = (SceUtilitySavedataType)(u32)param.GetPspParam()->mode;
@@ -1191,8 +1184,6 @@ void PSPSaveDialog::ExecuteNotVisibleIOAction() {
 	default:
 		break;
 	}
-
-	param.ClearSFOCache();
 }
 
 void PSPSaveDialog::JoinIOThread() {
@@ -1232,7 +1223,6 @@ int PSPSaveDialog::Shutdown(bool force) {
 		ChangeStatusShutdown(SAVEDATA_SHUTDOWN_DELAY_US);
 	}
 	param.SetPspParam(0);
-	param.ClearSFOCache();
 
 	return 0;
 }
@@ -1944,26 +1944,41 @@ void SavedataParam::ClearSFOCache() {
 }
 
 std::shared_ptr<ParamSFOData> SavedataParam::LoadCachedSFO(const std::string &path, bool orCreate) {
+	PSPFileInfo info = pspFileSystem.GetFileInfo(path);
+	tm mtimeTm = info.mtime;
+	const s64 mtime = info.exists ? (s64)mktime(&mtimeTm) : 0;
+
 	std::lock_guard<std::mutex> guard(cacheLock_);
-	if (sfoCache_.find(path) == sfoCache_.end()) {
-		std::vector<u8> data;
-		if (pspFileSystem.ReadEntireFile(path, data, true) < 0) {
-			// Mark as not existing for later.
-			sfoCache_[path].reset();
-		} else {
-			sfoCache_.emplace(path, new ParamSFOData());
-			// If it fails to load, also keep it to indicate failed.
-			if (!sfoCache_.at(path)->ReadSFO(data))
-				sfoCache_.at(path).reset();
+	auto it = sfoCache_.find(path);
+	if (it != sfoCache_.end()) {
+		// Re-read if the file changed (or appeared/disappeared) since we cached it.
+		if (it->second.exists != info.exists || it->second.size != (u64)info.size || it->second.mtime != mtime) {
+			sfoCache_.erase(it);
+			it = sfoCache_.end();
+		}
+	}
+
+	if (it == sfoCache_.end()) {
+		CachedSFO entry;
+		entry.exists = info.exists;
+		entry.size = (u64)info.size;
+		entry.mtime = mtime;
+		if (info.exists) {
+			std::vector<u8> data;
+			if (pspFileSystem.ReadEntireFile(path, data, true) >= 0) {
+				entry.sfo.reset(new ParamSFOData());
+				// If it fails to load, keep a null entry to indicate failed.
+				if (!entry.sfo->ReadSFO(data))
+					entry.sfo.reset();
+			}
 		}
+		it = sfoCache_.emplace(path, entry).first;
 	}
 
-	if (!sfoCache_.at(path)) {
-		if (!orCreate)
-			return nullptr;
-		sfoCache_.at(path).reset(new ParamSFOData());
+	if (!it->second.sfo && orCreate) {
+		it->second.sfo.reset(new ParamSFOData());
 	}
-	return sfoCache_.at(path);
+	return it->second.sfo;
 }
 
 int SavedataParam::GetSaveCryptMode(const SceUtilitySavedataParam *param, const std::string &saveDirName) {
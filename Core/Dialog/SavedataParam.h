@@ -396,7 +396,14 @@ private:
 	int saveNameListDataCount = 0;
 	bool ignoreTextures_ = false;
 
-	// Cleared before returning to PSP, no need to save state.
+	// Parsed PARAM.SFO headers, validated against the file's size/mtime on each lookup so
+	// stale entries get re-read. Survives between dialog visits; not saved in states.
+	struct CachedSFO {
+		u64 size = 0;
+		s64 mtime = 0;
+		bool exists = false;
+		std::shared_ptr<ParamSFOData> sfo;
+	};
 	std::mutex cacheLock_;
-	std::unordered_map<std::string, std::shared_ptr<ParamSFOData>> sfoCache_;
+	std::unordered_map<std::string, CachedSFO> sfoCache_;
 };
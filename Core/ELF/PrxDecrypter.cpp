@@ -1,15 +1,19 @@
 #include <algorithm>
 #include <array>
+#include <memory>
 #include <string.h>
 
 extern "C"
 {
 #include "ext/libkirk/kirk_engine.h"
+#include "ext/libkirk/AES.h"
 #include "ext/libkirk/SHA1.h"
 }
 #include "Common/Common.h"
 #include "Common/Log.h"
 #include "Common/Swap.h"
+#include "Common/Thread/ParallelLoop.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Core/ELF/PrxDecrypter.h"
 
 #define ROUNDUP16(x)  (((x)+15)&~15)
@@ -1015,8 +1019,35 @@ static int pspDecryptType6(const u8 *inbuf, u8 *outbuf, u32 size)
 	return decryptSize;
 }
 
+// Drives the bulk CBC decrypt of big buffers (whole EBOOT images) across the
+// thread pool. Each output block only needs its own and the previous ciphertext
+// block, so the stream splits cleanly into ranges.
+static void ParallelCBCDecrypt(AES_ctx *ctx, const u8 *src, u8 *dst, int size) {
+	// The kirk code rounds reads/writes up to whole blocks.
+	const int numBlocks = (size + 15) / 16;
+
+	// The serial path decrypts forward in place (dst below src), backing up each
+	// ciphertext block before overwriting it. With workers running out of order,
+	// an earlier range's output would clobber a later range's ciphertext input,
+	// so for overlapping buffers we decrypt from a copy of the ciphertext.
+	const u8 *cipher = src;
+	std::unique_ptr<u8[]> cipherCopy;
+	if (dst + (size_t)numBlocks * 16 > src && src + (size_t)numBlocks * 16 > dst) {
+		cipherCopy.reset(new u8[numBlocks * 16]);
+		memcpy(cipherCopy.get(), src, numBlocks * 16);
+		cipher = cipherCopy.get();
+	}
+
+	ParallelRangeLoop(&g_threadManager, [&](int l, int h) {
+		const u8 *prevBlock = l == 0 ? nullptr : cipher + (l - 1) * 16;
+		const int bytes = std::min(size, h * 16) - l * 16;
+		AES_cbc_decrypt_range(ctx, prevBlock, cipher + l * 16, dst + l * 16, bytes);
+	}, 0, numBlocks, 1024);
+}
+
 int pspDecryptPRX(const u8 *inbuf, u8 *outbuf, u32 size, const u8 *seed)
 {
+	AES_cbc_decrypt_parallel = &ParallelCBCDecrypt;
 	kirk_init();
 
 	// this would be significantly better if we had a log of the tags
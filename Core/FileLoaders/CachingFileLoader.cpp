@@ -19,9 +19,32 @@
 #include <thread>
 #include <algorithm>
 
+#include "Common/File/FileUtil.h"
+#include "Common/Log.h"
 #include "Common/Thread/ThreadUtil.h"
 #include "Common/TimeUtil.h"
 #include "Core/FileLoaders/CachingFileLoader.h"
+#include "Core/System.h"
+
+static const char * const TRACEFILE_MAGIC = "ppssppRT";
+
+// Same mangling scheme as the disk cache, different extension.
+static Path AccessTracePath(const Path &path) {
+	static const char *const invalidChars = "?*:/\\^|<>\"'";
+	std::string filename = path.ToString();
+	for (size_t i = 0; i < filename.size(); ++i) {
+		int c = filename[i];
+		if (strchr(invalidChars, c) != nullptr) {
+			filename[i] = '_';
+		}
+	}
+
+	Path dir = GetSysDirectory(DIRECTORY_CACHE);
+	if (!File::Exists(dir)) {
+		File::CreateFullPath(dir);
+	}
+	return dir / (filename + ".pprt");
+}
 
 // Takes ownership of backend.
 CachingFileLoader::CachingFileLoader(FileLoader *backend)
@@ -33,6 +56,10 @@ void CachingFileLoader::Prepare() {
 		filesize_ = ProxiedFileLoader::FileSize();
 		if (filesize_ > 0) {
 			InitCache();
+			LoadAccessTrace();
+			if (traceLoaded_) {
+				StartTracePrefetch();
+			}
 		}
 	});
 }
@@ -109,12 +136,15 @@ void CachingFileLoader::ShutdownCache() {
 	// TODO: Maybe add some hint that deletion is coming soon?
 	// We can't delete while the thread is running, so have to wait.
 	// This should only happen from the menu.
+	aheadCancel_ = true;
 	while (aheadThreadRunning_) {
 		sleep_ms(1);
 	}
 	if (aheadThread_.joinable())
 		aheadThread_.join();
 
+	SaveAccessTrace();
+
 	std::lock_guard<std::recursive_mutex> guard(blocksMutex_);
 	for (auto block : blocks_) {
 		delete [] block.second.ptr;
@@ -160,6 +190,10 @@ void CachingFileLoader::SaveIntoCache(s64 pos, size_t bytes, Flags flags, bool r
 		if (block != blocks_.end()) {
 			break;
 		}
+		// Until we have a trace for this file, record each demand miss in order.
+		if (!readingAhead && !traceLoaded_ && traceBlocks_.size() < TRACE_MAX_BLOCKS && traceSeen_.insert(i).second) {
+			traceBlocks_.push_back((u32)i);
+		}
 		++blocksToRead;
 		if (blocksToRead >= MAX_BLOCKS_PER_READ) {
 			break;
@@ -287,3 +321,91 @@ void CachingFileLoader::StartReadAhead(s64 pos) {
 		aheadThreadRunning_ = false;
 	});
 }
+
+void CachingFileLoader::LoadAccessTrace() {
+	FILE *f = File::OpenCFile(AccessTracePath(GetPath()), "rb");
+	if (!f) {
+		return;
+	}
+
+	char magic[8];
+	u32 count = 0;
+	bool valid = fread(magic, sizeof(magic), 1, f) == 1 && memcmp(magic, TRACEFILE_MAGIC, sizeof(magic)) == 0;
+	valid = valid && fread(&count, sizeof(count), 1, f) == 1 && count <= TRACE_MAX_BLOCKS;
+	if (valid && count != 0) {
+		traceBlocks_.resize(count);
+		if (fread(&traceBlocks_[0], sizeof(u32), count, f) != count) {
+			traceBlocks_.clear();
+		}
+	}
+	fclose(f);
+
+	traceLoaded_ = !traceBlocks_.empty();
+	if (traceLoaded_) {
+		INFO_LOG(Log::Loader, "Loaded access trace (%d blocks) for %s", (int)traceBlocks_.size(), GetPath().c_str());
+	}
+}
+
+void CachingFileLoader::SaveAccessTrace() {
+	// Only the first run writes a trace - it covers boot and initial streaming, which is
+	// the part worth warming up. Later runs just replay it.
+	if (traceLoaded_ || traceBlocks_.empty()) {
+		return;
+	}
+
+	const Path path = AccessTracePath(GetPath());
+	FILE *f = File::OpenCFile(path, "wb");
+	if (!f) {
+		return;
+	}
+
+	u32 count = (u32)traceBlocks_.size();
+	bool failed = fwrite(TRACEFILE_MAGIC, 8, 1, f) != 1;
+	failed = failed || fwrite(&count, sizeof(count), 1, f) != 1;
+	failed = failed || fwrite(traceBlocks_.data(), sizeof(u32), count, f) != count;
+	fclose(f);
+	if (failed) {
+		File::Delete(path);
+	} else {
+		INFO_LOG(Log::Loader, "Saved access trace (%d blocks) for %s", (int)count, GetPath().c_str());
+	}
+}
+
+void CachingFileLoader::StartTracePrefetch() {
+	std::lock_guard<std::recursive_mutex> guard(blocksMutex_);
+	if (aheadThreadRunning_) {
+		return;
+	}
+
+	aheadThreadRunning_ = true;
+	if (aheadThread_.joinable())
+		aheadThread_.join();
+	aheadThread_ = std::thread([this] {
+		SetCurrentThreadName("FileLoaderTracePrefetch");
+
+		AndroidJNIThreadContext jniContext;
+
+		// Walk the trace in recorded order, batching contiguous blocks into single reads.
+		// Over high-latency links the batching matters as much as the ordering.
+		for (size_t i = 0; i < traceBlocks_.size() && !aheadCancel_; ) {
+			const s64 start = (s64)traceBlocks_[i];
+			size_t run = 1;
+			while (i + run < traceBlocks_.size() && run < MAX_BLOCKS_PER_READ && (s64)traceBlocks_[i + run] == start + (s64)run) {
+				++run;
+			}
+
+			{
+				std::lock_guard<std::recursive_mutex> guard(blocksMutex_);
+				if (cacheSize_ + run + BLOCK_READAHEAD > MAX_BLOCKS_CACHED) {
+					// Leave the rest of the cache to demand reads.
+					break;
+				}
+			}
+
+			SaveIntoCache(start << BLOCK_SHIFT, run << BLOCK_SHIFT, Flags::NONE, true);
+			i += run;
+		}
+
+		aheadThreadRunning_ = false;
+	});
+}
@@ -19,7 +19,9 @@
 
 #include <map>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/Loaders.h"
@@ -48,6 +50,9 @@ private:
 	void SaveIntoCache(s64 pos, size_t bytes, Flags flags, bool readingAhead = false);
 	bool MakeCacheSpaceFor(size_t blocks, bool readingAhead);
 	void StartReadAhead(s64 pos);
+	void LoadAccessTrace();
+	void SaveAccessTrace();
+	void StartTracePrefetch();
 
 	enum {
 		BLOCK_SIZE = 65536,
@@ -55,6 +60,7 @@ private:
 		MAX_BLOCKS_PER_READ = 16,
 		MAX_BLOCKS_CACHED = 4096, // 256 MB
 		BLOCK_READAHEAD = 4,
+		TRACE_MAX_BLOCKS = 8192,
 	};
 
 	s64 filesize_ = 0;
@@ -77,6 +83,13 @@ private:
 	std::map<s64, BlockInfo> blocks_;
 	std::recursive_mutex blocksMutex_;
 	bool aheadThreadRunning_ = false;
+	bool aheadCancel_ = false;
 	std::thread aheadThread_;
 	std::once_flag preparedFlag_;
+
+	// Block indices in first-touch order. Recorded on the first run, saved next to the
+	// disk cache, and replayed on later runs to prefetch in the order the game will ask.
+	std::vector<u32> traceBlocks_;
+	std::set<s64> traceSeen_;
+	bool traceLoaded_ = false;
 };
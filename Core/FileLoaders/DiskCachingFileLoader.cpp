@@ -49,6 +49,9 @@ static const u32 CACHE_SPACE_FLEX = 4;
 
 Path DiskCachingFileLoaderCache::cacheDir_;
 
+std::atomic<u64> DiskCachingFileLoaderCache::hitBytes_(0);
+std::atomic<u64> DiskCachingFileLoaderCache::missBytes_(0);
+
 std::map<Path, DiskCachingFileLoaderCache *> DiskCachingFileLoader::caches_;
 std::mutex DiskCachingFileLoader::cachesMutex_;
 
@@ -136,6 +139,16 @@ std::vector<Path> DiskCachingFileLoader::GetCachedPathsInUse() {
 	return files;
 }
 
+DiskCacheStats DiskCachingFileLoader::GetStats() {
+	std::lock_guard<std::mutex> guard(cachesMutex_);
+
+	DiskCacheStats stats;
+	stats.hitBytes = DiskCachingFileLoaderCache::hitBytes_;
+	stats.missBytes = DiskCachingFileLoaderCache::missBytes_;
+	stats.cachedFileCount = (u32)caches_.size();
+	return stats;
+}
+
 void DiskCachingFileLoader::InitCache() {
 	std::lock_guard<std::mutex> guard(cachesMutex_);
 
@@ -256,6 +269,7 @@ size_t DiskCachingFileLoaderCache::ReadFromCache(s64 pos, size_t bytes, void *da
 		// Don't need an offset after the first read.
 		offset = 0;
 	}
+	hitBytes_ += readSize;
 	return readSize;
 }
 
@@ -264,7 +278,9 @@ size_t DiskCachingFileLoaderCache::SaveIntoCache(FileLoader *backend, s64 pos, s
 
 	if (!f_) {
 		// Just to keep things working.
-		return backend->ReadAt(pos, bytes, data, flags);
+		size_t result = backend->ReadAt(pos, bytes, data, flags);
+		missBytes_ += result;
+		return result;
 	}
 
 	size_t cacheStartPos = (size_t)(pos / blockSize_);
@@ -330,6 +346,7 @@ size_t DiskCachingFileLoaderCache::SaveIntoCache(FileLoader *backend, s64 pos, s
 
 	cacheSize_ += blocksToRead;
 	++generation_;
+	missBytes_ += readSize;
 
 	if (generation_ == std::numeric_limits<u16>::max()) {
 		RebalanceGenerations();
@@ -819,8 +836,13 @@ void DiskCachingFileLoaderCache::GarbageCollectCacheFiles(u64 goalBytes) {
 	std::vector<File::FileInfo> files;
 	File::GetFilesInDir(dir, &files, "ppdc:");
 
+	// Drop the least recently touched caches first. Block writes update mtime, so this
+	// approximates LRU well enough without tracking anything extra.
+	std::sort(files.begin(), files.end(), [](const File::FileInfo &a, const File::FileInfo &b) {
+		return a.mtime < b.mtime;
+	});
+
 	u64 remaining = goalBytes;
-	// TODO: Could order by LRU or etc.
 	for (File::FileInfo &file : files) {
 		if (file.isDirectory) {
 			continue;
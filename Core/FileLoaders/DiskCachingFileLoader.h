@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <map>
 #include <mutex>
@@ -28,6 +29,13 @@
 
 class DiskCachingFileLoaderCache;
 
+// Aggregate stats over all open disk caches, shown on the system info screen.
+struct DiskCacheStats {
+	u64 hitBytes = 0;
+	u64 missBytes = 0;
+	u32 cachedFileCount = 0;
+};
+
 class DiskCachingFileLoader : public ProxiedFileLoader {
 public:
 	DiskCachingFileLoader(FileLoader *backend);
@@ -43,6 +51,7 @@ public:
 	size_t ReadAt(s64 absolutePos, size_t bytes, void *data, Flags flags = Flags::NONE) override;
 
 	static std::vector<Path> GetCachedPathsInUse();
+	static DiskCacheStats GetStats();
 
 private:
 	void Prepare();
@@ -178,4 +187,10 @@ private:
 	int fd_ = 0;
 
 	static Path cacheDir_;
+
+	// Global counters across all caches (see DiskCachingFileLoader::GetStats().)
+	static std::atomic<u64> hitBytes_;
+	static std::atomic<u64> missBytes_;
+
+	friend DiskCacheStats DiskCachingFileLoader::GetStats();
 };
@@ -19,6 +19,7 @@
 
 #include "Common/Log.h"
 #include "Common/StringUtils.h"
+#include "Common/TimeUtil.h"
 #include "Core/Config.h"
 #include "Core/FileLoaders/HTTPFileLoader.h"
 
@@ -153,6 +154,67 @@ int HTTPFileLoader::SendHEAD(const Url &url, std::vector<std::string> &responseH
 
 HTTPFileLoader::~HTTPFileLoader() {
 	Disconnect();
+
+	std::lock_guard<std::mutex> lock(poolMutex_);
+	for (size_t i = 0; i < pool_.size(); i++) {
+		Connection *conn = pool_[i].get();
+		if (conn->connected) {
+			conn->client.Disconnect();
+		}
+		if (conn->bytesRead > 0 && conn->busySeconds > 0.0) {
+			double mb = conn->bytesRead / (1024.0 * 1024.0);
+			INFO_LOG(Log::Loader, "HTTP connection %d: %0.2f MB in %0.2f s (%0.2f MB/s)",
+				(int)i, mb, conn->busySeconds, mb / conn->busySeconds);
+		}
+	}
+}
+
+HTTPFileLoader::Connection *HTTPFileLoader::AcquireConnection() {
+	Connection *conn;
+	{
+		std::unique_lock<std::mutex> lock(poolMutex_);
+		while (idle_.empty() && (int)pool_.size() >= MAX_CONNECTIONS) {
+			poolCond_.wait(lock);
+		}
+		if (!idle_.empty()) {
+			conn = idle_.back();
+			idle_.pop_back();
+		} else {
+			pool_.push_back(std::unique_ptr<Connection>(new Connection(&cancel_)));
+			conn = pool_.back().get();
+			conn->client.SetUserAgent(StringFromFormat("PPSSPP/%s", PPSSPP_GIT_VERSION));
+			conn->client.SetDataTimeout(20.0);
+		}
+	}
+
+	if (!conn->connected) {
+		// Note that url_ is the final URL after Prepare() chased any redirects.
+		if (!conn->client.Resolve(url_.Host().c_str(), url_.Port())) {
+			latestError_ = "Could not connect (name not resolved)";
+			ReleaseConnection(conn);
+			return nullptr;
+		}
+		cancel_ = false;
+		conn->connected = conn->client.Connect(3, 10.0, &cancel_);
+		if (!conn->connected) {
+			latestError_ = "Could not connect (refused to connect)";
+			ReleaseConnection(conn);
+			return nullptr;
+		}
+	}
+	return conn;
+}
+
+void HTTPFileLoader::ReleaseConnection(Connection *conn) {
+	// TODO: Keepalive instead.
+	if (conn->connected) {
+		conn->client.Disconnect();
+		conn->connected = false;
+	}
+
+	std::lock_guard<std::mutex> lock(poolMutex_);
+	idle_.push_back(conn);
+	poolCond_.notify_one();
 }
 
 bool HTTPFileLoader::Exists() {
@@ -180,7 +242,6 @@ Path HTTPFileLoader::GetPath() const {
 
 size_t HTTPFileLoader::ReadAt(s64 absolutePos, size_t bytes, void *data, Flags flags) {
 	Prepare();
-	std::lock_guard<std::mutex> guard(readAtMutex_);
 
 	s64 absoluteEnd = std::min(absolutePos + (s64)bytes, filesize_);
 	if (absolutePos >= filesize_ || bytes == 0) {
@@ -188,10 +249,11 @@ size_t HTTPFileLoader::ReadAt(s64 absolutePos, size_t bytes, void *data, Flags f
 		return 0;
 	}
 
-	Connect(10.0);
-	if (!connected_) {
+	Connection *conn = AcquireConnection();
+	if (!conn) {
 		return 0;
 	}
+	const double start = time_now_d();
 
 	char requestHeaders[4096];
 	// Note that the Range header is *inclusive*.
@@ -199,20 +261,20 @@ size_t HTTPFileLoader::ReadAt(s64 absolutePos, size_t bytes, void *data, Flags f
 		"Range: bytes=%lld-%lld\r\n", absolutePos, absoluteEnd - 1);
 
 	http::RequestParams req(url_.Resource(), "*/*");
-	int err = client_.SendRequest("GET", req, requestHeaders, &progress_);
+	int err = conn->client.SendRequest("GET", req, requestHeaders, &conn->progress);
 	if (err < 0) {
 		latestError_ = "Invalid response reading data";
-		Disconnect();
+		ReleaseConnection(conn);
 		return 0;
 	}
 
 	net::Buffer readbuf;
 	std::vector<std::string> responseHeaders;
-	int code = client_.ReadResponseHeaders(&readbuf, responseHeaders, &progress_);
+	int code = conn->client.ReadResponseHeaders(&readbuf, responseHeaders, &conn->progress);
 	if (code != 206) {
 		ERROR_LOG(Log::Loader, "HTTP server did not respond with range, received code=%03d", code);
 		latestError_ = "Invalid response reading data";
-		Disconnect();
+		ReleaseConnection(conn);
 		return 0;
 	}
 
@@ -239,24 +301,25 @@ size_t HTTPFileLoader::ReadAt(s64 absolutePos, size_t bytes, void *data, Flags f
 
 	// TODO: Would be nice to read directly.
 	net::Buffer output;
-	int res = client_.ReadResponseEntity(&readbuf, responseHeaders, &output, &progress_);
+	int res = conn->client.ReadResponseEntity(&readbuf, responseHeaders, &output, &conn->progress);
 	if (res != 0) {
 		ERROR_LOG(Log::Loader, "Unable to read HTTP response entity: %d", res);
 		// Let's take anything we got anyway.  Not worse than returning nothing?
 	}
 
-	// TODO: Keepalive instead.
-	Disconnect();
-
 	if (!supportedResponse) {
 		ERROR_LOG(Log::Loader, "HTTP server did not respond with the range we wanted.");
 		latestError_ = "Invalid response reading data";
+		ReleaseConnection(conn);
 		return 0;
 	}
 
 	size_t readBytes = output.size();
 	output.Take(readBytes, (char *)data);
-	filepos_ = absolutePos + readBytes;
+
+	conn->bytesRead += (s64)readBytes;
+	conn->busySeconds += time_now_d() - start;
+	ReleaseConnection(conn);
 	return readBytes;
 }
 
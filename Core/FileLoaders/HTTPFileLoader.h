@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -55,6 +57,20 @@ public:
 	}
 
 private:
+	// One socket plus its stats. Range requests from the emu thread and the
+	// readahead thread(s) each grab their own connection, so they overlap on the wire.
+	struct Connection {
+		explicit Connection(bool *cancel) : progress(cancel) {}
+
+		http::Client client;
+		net::RequestProgress progress;
+		bool connected = false;
+
+		// Throughput stats, logged when the loader shuts down.
+		s64 bytesRead = 0;
+		double busySeconds = 0.0;
+	};
+
 	void Prepare();
 	int SendHEAD(const Url &url, std::vector<std::string> &responseHeaders);
 
@@ -67,9 +83,17 @@ private:
 		connected_ = false;
 	}
 
+	// Blocks until a connection is free if the pool is maxed out. Returns nullptr on connect failure.
+	Connection *AcquireConnection();
+	void ReleaseConnection(Connection *conn);
+
+	enum {
+		MAX_CONNECTIONS = 4,
+	};
+
 	s64 filesize_ = 0;
-	s64 filepos_ = 0;
 	Url url_;
+	// Used for the initial HEAD probing only - data reads go through the pool.
 	http::Client client_;
 	net::RequestProgress progress_;
 	::Path filename_;
@@ -78,5 +102,9 @@ private:
 	const char *latestError_ = "";
 
 	std::once_flag preparedFlag_;
-	std::mutex readAtMutex_;
+
+	std::vector<std::unique_ptr<Connection>> pool_;
+	std::vector<Connection *> idle_;
+	std::mutex poolMutex_;
+	std::condition_variable poolCond_;
 };
@@ -16,6 +16,7 @@
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
 #include <cstdio>
+#include <cstring>
 
 #include "ppsspp_config.h"
 
@@ -36,6 +37,9 @@
 #endif
 #else
 #include <fcntl.h>
+#if !PPSSPP_PLATFORM(SWITCH)
+#include <sys/mman.h>
+#endif
 #endif
 
 #ifdef HAVE_LIBRETRO_VFS
@@ -84,6 +88,7 @@ LocalFileLoader::LocalFileLoader(const Path &filename)
 		fd_ = fd;
 		isOpenedByFd_ = true;
 		DetectSizeFd();
+		MapFileIfSupported();
 		return;
 	}
 #endif
@@ -98,6 +103,7 @@ LocalFileLoader::LocalFileLoader(const Path &filename)
 	}
 
 	DetectSizeFd();
+	MapFileIfSupported();
 
 #else // _WIN32
 
@@ -120,17 +126,55 @@ LocalFileLoader::LocalFileLoader(const Path &filename)
 	}
 	filesize_ = end_offset.QuadPart;
 	SetFilePointerEx(handle_, zero, nullptr, FILE_BEGIN);
+	MapFileIfSupported();
 #endif // _WIN32
 }
 
+void LocalFileLoader::MapFileIfSupported() {
+	// Only bother on 64-bit - full ISOs don't reliably fit in a 32-bit address space.
+#if PPSSPP_ARCH(64BIT) && !defined(HAVE_LIBRETRO_VFS) && !PPSSPP_PLATFORM(SWITCH)
+	if (filesize_ == 0)
+		return;
+#if !defined(_WIN32)
+	void *map = mmap(nullptr, filesize_, PROT_READ, MAP_SHARED, fd_, 0);
+	if (map == MAP_FAILED) {
+		// Content URIs and weird filesystems can fail here, pread still works.
+		return;
+	}
+	// Sector reads bounce around the disc image, so the kernel's sequential
+	// readahead mostly just evicts useful pages. Ask for random-access behavior.
+	madvise(map, filesize_, MADV_RANDOM);
+	mapped_ = map;
+#elif !PPSSPP_PLATFORM(UWP)
+	mapping_ = CreateFileMapping(handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping_)
+		return;
+	mapped_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+	if (!mapped_) {
+		CloseHandle(mapping_);
+		mapping_ = 0;
+	}
+#endif
+#endif
+}
+
 LocalFileLoader::~LocalFileLoader() {
 #if defined(HAVE_LIBRETRO_VFS)
     filestream_close(handle_);
 #elif !defined(_WIN32)
+#if !PPSSPP_PLATFORM(SWITCH)
+	if (mapped_) {
+		munmap(mapped_, filesize_);
+	}
+#endif
 	if (fd_ != -1) {
 		close(fd_);
 	}
 #else
+	if (mapped_) {
+		UnmapViewOfFile(mapped_);
+		CloseHandle(mapping_);
+	}
 	if (handle_ != INVALID_HANDLE_VALUE) {
 		CloseHandle(handle_);
 	}
@@ -184,6 +228,17 @@ size_t LocalFileLoader::ReadAt(s64 absolutePos, size_t bytes, size_t count, void
 		return 0;
 	}
 
+	if (mapped_) {
+		// Plain copy from the page cache, no syscall. Clamp to the file size like a read would.
+		if ((u64)absolutePos >= filesize_)
+			return 0;
+		size_t wanted = bytes * count;
+		if (wanted > filesize_ - absolutePos)
+			wanted = (size_t)(filesize_ - absolutePos);
+		memcpy(data, (const u8 *)mapped_ + absolutePos, wanted);
+		return wanted / bytes;
+	}
+
 #if defined(HAVE_LIBRETRO_VFS)
     std::lock_guard<std::mutex> guard(readLock_);
 	filestream_seek(handle_, absolutePos, RETRO_VFS_SEEK_POSITION_START);
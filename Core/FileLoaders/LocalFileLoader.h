@@ -46,12 +46,20 @@ public:
 	size_t ReadAt(s64 absolutePos, size_t bytes, size_t count, void *data, Flags flags = Flags::NONE) override;
 
 private:
+	// Tries to memory-map the file so ReadAt becomes a memcpy from the page cache,
+	// with no syscall per read. On failure we just keep using pread/ReadFile.
+	void MapFileIfSupported();
+
 #if !defined(_WIN32) && !defined(HAVE_LIBRETRO_VFS)
 	void DetectSizeFd();
 	int fd_ = -1;
 #else
 	HANDLE handle_ = 0;
 #endif
+#if defined(_WIN32) && !defined(HAVE_LIBRETRO_VFS)
+	HANDLE mapping_ = 0;
+#endif
+	void *mapped_ = nullptr;
 	u64 filesize_ = 0;
 	Path filename_;
 	std::mutex readLock_;
@@ -97,22 +97,30 @@ void RamCachingFileLoader::InitCache() {
 		return;
 	}
 	aheadRemaining_ = blockCount;
-	blocks_.resize(blockCount);
+	blockCount_ = blockCount;
+	blocks_.reset(new std::atomic<u8>[blockCount]);
+	for (u32 i = 0; i < blockCount; ++i) {
+		blocks_[i].store(0, std::memory_order_relaxed);
+	}
 }
 
 void RamCachingFileLoader::ShutdownCache() {
 	Cancel();
 
-	// We can't delete while the thread is running, so have to wait.
+	// We can't delete while the threads are running, so have to wait.
 	// This should only happen from the menu.
-	while (aheadThreadRunning_) {
+	while (aheadThreadsRunning_ != 0) {
 		sleep_ms(1);
 	}
-	if (aheadThread_.joinable())
-		aheadThread_.join();
+	for (auto &thread : aheadThreads_) {
+		if (thread.joinable())
+			thread.join();
+	}
+	aheadThreads_.clear();
 
 	std::lock_guard<std::mutex> guard(blocksMutex_);
-	blocks_.clear();
+	blocks_.reset();
+	blockCount_ = 0;
 	if (cache_ != nullptr) {
 		free(cache_);
 		cache_ = nullptr;
@@ -120,7 +128,7 @@ void RamCachingFileLoader::ShutdownCache() {
 }
 
 void RamCachingFileLoader::Cancel() {
-	if (aheadThreadRunning_) {
+	if (aheadThreadsRunning_ != 0) {
 		std::lock_guard<std::mutex> guard(blocksMutex_);
 		aheadCancel_ = true;
 	}
@@ -131,8 +139,8 @@ void RamCachingFileLoader::Cancel() {
 size_t RamCachingFileLoader::ReadFromCache(s64 pos, size_t bytes, void *data) {
 	s64 cacheStartPos = pos >> BLOCK_SHIFT;
 	s64 cacheEndPos = (pos + bytes - 1) >> BLOCK_SHIFT;
-	if ((size_t)cacheEndPos >= blocks_.size()) {
-		cacheEndPos = blocks_.size() - 1;
+	if ((size_t)cacheEndPos >= blockCount_) {
+		cacheEndPos = blockCount_ - 1;
 	}
 
 	size_t readSize = 0;
@@ -148,9 +156,10 @@ size_t RamCachingFileLoader::ReadFromCache(s64 pos, size_t bytes, void *data) {
 		bytes = (size_t)(filesize_ - pos);
 	}
 
-	std::lock_guard<std::mutex> guard(blocksMutex_);
+	// No lock needed - the acquire pairs with the release store in SaveIntoCache,
+	// so a block observed as resident has its data fully in place.
 	for (s64 i = cacheStartPos; i <= cacheEndPos; ++i) {
-		if (blocks_[(size_t)i] == 0) {
+		if (blocks_[(size_t)i].load(std::memory_order_acquire) == 0) {
 			return readSize;
 		}
 
@@ -168,15 +177,15 @@ size_t RamCachingFileLoader::ReadFromCache(s64 pos, size_t bytes, void *data) {
 void RamCachingFileLoader::SaveIntoCache(s64 pos, size_t bytes, Flags flags) {
 	s64 cacheStartPos = pos >> BLOCK_SHIFT;
 	s64 cacheEndPos = (pos + bytes - 1) >> BLOCK_SHIFT;
-	if ((size_t)cacheEndPos >= blocks_.size()) {
-		cacheEndPos = blocks_.size() - 1;
+	if ((size_t)cacheEndPos >= blockCount_) {
+		cacheEndPos = blockCount_ - 1;
 	}
 
 	size_t blocksToRead = 0;
 	{
 		std::lock_guard<std::mutex> guard(blocksMutex_);
 		for (s64 i = cacheStartPos; i <= cacheEndPos; ++i) {
-			if (blocks_[(size_t)i] == 0) {
+			if (blocks_[(size_t)i].load(std::memory_order_relaxed) == 0) {
 				++blocksToRead;
 				if (blocksToRead >= MAX_BLOCKS_PER_READ) {
 					break;
@@ -193,11 +202,12 @@ void RamCachingFileLoader::SaveIntoCache(s64 pos, size_t bytes, Flags flags) {
 	{
 		std::lock_guard<std::mutex> guard(blocksMutex_);
 
-		// In case they were simultaneously read.
+		// In case they were simultaneously read. The release store publishes the
+		// block data written above to lock-free readers.
 		u32 blocksRead = 0;
 		for (size_t i = 0; i < blocksActuallyRead; ++i) {
-			if (blocks_[(size_t)cacheStartPos + i] == 0) {
-				blocks_[(size_t)cacheStartPos + i] = 1;
+			if (blocks_[(size_t)cacheStartPos + i].load(std::memory_order_relaxed) == 0) {
+				blocks_[(size_t)cacheStartPos + i].store(1, std::memory_order_release);
 				++blocksRead;
 			}
 		}
@@ -215,42 +225,52 @@ void RamCachingFileLoader::StartReadAhead(s64 pos) {
 
 	std::lock_guard<std::mutex> guard(blocksMutex_);
 	aheadPos_ = pos;
-	if (aheadThreadRunning_) {
+	if (aheadThreadsRunning_ != 0) {
 		// Already going.
 		return;
 	}
 
-	aheadThreadRunning_ = true;
-	aheadCancel_ = false;
-	if (aheadThread_.joinable())
-		aheadThread_.join();
-	aheadThread_ = std::thread([this] {
-		SetCurrentThreadName("FileLoaderReadAhead");
-
-		AndroidJNIThreadContext jniContext;
-
-		while (aheadRemaining_ != 0 && !aheadCancel_) {
-			// Where should we look?
-			const u32 cacheStartPos = NextAheadBlock();
-			if (cacheStartPos == 0xFFFFFFFF) {
-				// Must be full.
-				break;
-			}
-			u32 cacheEndPos = cacheStartPos + BLOCK_READAHEAD - 1;
-			if (cacheEndPos >= blocks_.size()) {
-				cacheEndPos = (u32)blocks_.size() - 1;
-			}
+	// A remote backend can serve overlapping range requests in parallel, so throw
+	// more threads at it. Locally, one is plenty.
+	const int threadCount = backend_->IsRemote() ? REMOTE_AHEAD_THREADS : 1;
 
-			for (u32 i = cacheStartPos; i <= cacheEndPos; ++i) {
-				if (blocks_[i] == 0) {
-					SaveIntoCache((u64)i << BLOCK_SHIFT, BLOCK_SIZE * BLOCK_READAHEAD, Flags::NONE);
+	aheadThreadsRunning_ = threadCount;
+	aheadCancel_ = false;
+	for (auto &thread : aheadThreads_) {
+		if (thread.joinable())
+			thread.join();
+	}
+	aheadThreads_.clear();
+	for (int t = 0; t < threadCount; ++t) {
+		aheadThreads_.push_back(std::thread([this] {
+			SetCurrentThreadName("FileLoaderReadAhead");
+
+			AndroidJNIThreadContext jniContext;
+
+			while (aheadRemaining_ != 0 && !aheadCancel_) {
+				// Where should we look?
+				const u32 cacheStartPos = NextAheadBlock();
+				if (cacheStartPos == 0xFFFFFFFF) {
+					// Must be full.
 					break;
 				}
+				u32 cacheEndPos = cacheStartPos + BLOCK_READAHEAD - 1;
+				if (cacheEndPos >= blockCount_) {
+					cacheEndPos = blockCount_ - 1;
+				}
+
+				for (u32 i = cacheStartPos; i <= cacheEndPos; ++i) {
+					if (blocks_[i].load(std::memory_order_relaxed) == 0) {
+						SaveIntoCache((u64)i << BLOCK_SHIFT, BLOCK_SIZE * BLOCK_READAHEAD, Flags::NONE);
+						break;
+					}
+				}
 			}
-		}
 
-		aheadThreadRunning_ = false;
-	});
+			std::lock_guard<std::mutex> guard(blocksMutex_);
+			aheadThreadsRunning_--;
+		}));
+	}
 }
 
 u32 RamCachingFileLoader::NextAheadBlock() {
@@ -258,11 +278,20 @@ u32 RamCachingFileLoader::NextAheadBlock() {
 
 	// If we had an aheadPos_ set, start reading from there and go forward.
 	u32 startFrom = (u32)(aheadPos_ >> BLOCK_SHIFT);
-	// But next time, start from the beginning again.
-	aheadPos_ = 0;
 
-	for (u32 i = startFrom; i < blocks_.size(); ++i) {
-		if (blocks_[i] == 0) {
+	for (u32 i = startFrom; i < blockCount_; ++i) {
+		if (blocks_[i].load(std::memory_order_relaxed) == 0) {
+			// Advance the cursor past this chunk so concurrent ahead threads
+			// stripe forward instead of all grabbing the same blocks.
+			aheadPos_ = (s64)(i + BLOCK_READAHEAD) << BLOCK_SHIFT;
+			return i;
+		}
+	}
+
+	// Wrap around - there may still be holes before the cursor.
+	for (u32 i = 0; i < startFrom && i < blockCount_; ++i) {
+		if (blocks_[i].load(std::memory_order_relaxed) == 0) {
+			aheadPos_ = (s64)(i + BLOCK_READAHEAD) << BLOCK_SHIFT;
 			return i;
 		}
 	}
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <mutex>
 #include <thread>
@@ -55,6 +57,9 @@ private:
 		BLOCK_SHIFT = 16,
 		MAX_BLOCKS_PER_READ = 16,
 		BLOCK_READAHEAD = 4,
+		// Remote backends (HTTP) benefit from overlapping range requests - the
+		// backend's connection pool lets these actually run in parallel.
+		REMOTE_AHEAD_THREADS = 3,
 	};
 
 	s64 filesize_ = 0;
@@ -62,11 +67,15 @@ private:
 	int exists_ = -1;
 	int isDirectory_ = -1;
 
-	std::vector<u8> blocks_;
+	// Written with release order once a block's data is in place, read with
+	// acquire - so fully-cached reads never take the mutex. blocksMutex_ only
+	// guards fill bookkeeping and the ahead thread state.
+	std::unique_ptr<std::atomic<u8>[]> blocks_;
+	u32 blockCount_ = 0;
 	std::mutex blocksMutex_;
 	u32 aheadRemaining_;
 	s64 aheadPos_;
-	std::thread aheadThread_;
-	bool aheadThreadRunning_ = false;
+	std::vector<std::thread> aheadThreads_;
+	int aheadThreadsRunning_ = 0;
 	bool aheadCancel_ = false;
 };
@@ -18,12 +18,15 @@
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <vector>
 
 #include "Common/Data/Text/I18n.h"
 #include "Common/File/FileUtil.h"
 #include "Common/System/OSD.h"
 #include "Common/Log.h"
 #include "Common/Swap.h"
+#include "Common/Thread/ParallelLoop.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Common/File/FileUtil.h"
 #include "Common/File/DirListing.h"
 #include "Core/Loaders.h"
@@ -134,6 +137,11 @@ typedef struct ciso_header
 // TODO: Need much better error handling.
 
 static const u32 CSO_READ_BUFFER_SIZE = 256 * 1024;
+// Fan decompression out to workers once a read spans at least this many frames.
+static const u32 CSO_PARALLEL_MIN_FRAMES = 8;
+// Above this compressed span we fall back to the chunked serial loop instead of
+// buffering the whole range.
+static const u64 CSO_PARALLEL_MAX_SPAN = 8 * 1024 * 1024;
 
 CISOFileBlockDevice::CISOFileBlockDevice(FileLoader *fileLoader)
 	: BlockDevice(fileLoader)
@@ -171,8 +179,8 @@ CISOFileBlockDevice::CISOFileBlockDevice(FileLoader *fileLoader)
 		readBuffer = new u8[CSO_READ_BUFFER_SIZE];
 	else
 		readBuffer = new u8[frameSize + (1 << indexShift)];
-	zlibBuffer = new u8[frameSize + (1 << indexShift)];
-	zlibBufferFrame = numFrames;
+	// Frame cache buffers are allocated on demand.
+	memset(frameCacheFrame_, 0xFF, sizeof(frameCacheFrame_));
 
 	const u32 indexSize = numFrames + 1;
 	const size_t headerEnd = hdr.ver > 1 ? (size_t)hdr.header_size : sizeof(hdr);
@@ -215,7 +223,56 @@ CISOFileBlockDevice::~CISOFileBlockDevice()
 {
 	delete [] index;
 	delete [] readBuffer;
-	delete [] zlibBuffer;
+	for (int i = 0; i < FRAME_CACHE_SIZE; ++i)
+		delete [] frameCache_[i];
+}
+
+u8 *CISOFileBlockDevice::FindCachedFrame(u32 frame) {
+	for (int i = 0; i < FRAME_CACHE_SIZE; ++i) {
+		if (frameCacheFrame_[i] == frame) {
+			frameCacheAge_[i] = ++frameCacheCounter_;
+			return frameCache_[i];
+		}
+	}
+	return nullptr;
+}
+
+u8 *CISOFileBlockDevice::InflateFrameCached(u32 frame, const u8 *compressed, u32 compressedSize) {
+	// Evict the least recently used slot.
+	int lru = 0;
+	for (int i = 0; i < FRAME_CACHE_SIZE; ++i) {
+		if (!frameCache_[i]) {
+			lru = i;
+			break;
+		}
+		if (frameCacheAge_[i] < frameCacheAge_[lru])
+			lru = i;
+	}
+	if (!frameCache_[lru])
+		frameCache_[lru] = new u8[frameSize];
+	frameCacheFrame_[lru] = frame;
+	frameCacheAge_[lru] = ++frameCacheCounter_;
+
+	z_stream z{};
+	if (inflateInit2(&z, -15) != Z_OK) {
+		ERROR_LOG(Log::Loader, "Unable to initialize inflate: %s\n", (z.msg) ? z.msg : "?");
+		frameCacheFrame_[lru] = 0xFFFFFFFF;
+		return nullptr;
+	}
+	z.avail_in = compressedSize;
+	z.next_in = (Bytef *)compressed;
+	z.avail_out = frameSize;
+	z.next_out = frameCache_[lru];
+
+	int status = inflate(&z, Z_FINISH);
+	bool success = status == Z_STREAM_END && z.total_out == frameSize;
+	if (!success) {
+		ERROR_LOG(Log::Loader, "Inflate frame %d: failed - %s[%d]\n", frame, (z.msg) ? z.msg : "error", status);
+		NotifyReadError();
+		frameCacheFrame_[lru] = 0xFFFFFFFF;
+	}
+	inflateEnd(&z);
+	return success ? frameCache_[lru] : nullptr;
 }
 
 bool CISOFileBlockDevice::ReadBlock(int blockNumber, u8 *outPtr, bool uncached)
@@ -230,7 +287,6 @@ bool CISOFileBlockDevice::ReadBlock(int blockNumber, u8 *outPtr, bool uncached)
 	const u32 idx = index[frameNumber];
 	const u32 indexPos = idx & 0x7FFFFFFF;
 	const u32 nextIndexPos = index[frameNumber + 1] & 0x7FFFFFFF;
-	z_stream z{};
 
 	const u64 compressedReadPos = (u64)indexPos << indexShift;
 	const u64 compressedReadEnd = (u64)nextIndexPos << indexShift;
@@ -246,46 +302,18 @@ bool CISOFileBlockDevice::ReadBlock(int blockNumber, u8 *outPtr, bool uncached)
 		int readSize = (u32)fileLoader_->ReadAt(compressedReadPos + compressedOffset, 1, GetBlockSize(), outPtr, flags);
 		if (readSize < GetBlockSize())
 			memset(outPtr + readSize, 0, GetBlockSize() - readSize);
-	} else if (zlibBufferFrame == frameNumber) {
-		// We already have it.  Just apply the offset and copy.
-		memcpy(outPtr, zlibBuffer + compressedOffset, GetBlockSize());
 	} else {
-		const u32 readSize = (u32)fileLoader_->ReadAt(compressedReadPos, 1, compressedReadSize, readBuffer, flags);
-
-		z.zalloc = Z_NULL;
-		z.zfree = Z_NULL;
-		z.opaque = Z_NULL;
-		if (inflateInit2(&z, -15) != Z_OK) {
-			ERROR_LOG(Log::Loader, "GetBlockSize() ERROR: %s\n", (z.msg) ? z.msg : "?");
-			NotifyReadError();
-			return false;
-		}
-		z.avail_in = readSize;
-		z.next_out = frameSize == (u32)GetBlockSize() ? outPtr : zlibBuffer;
-		z.avail_out = frameSize;
-		z.next_in = readBuffer;
-
-		int status = inflate(&z, Z_FINISH);
-		if (status != Z_STREAM_END) {
-			ERROR_LOG(Log::Loader, "block %d: inflate : %s[%d]\n", blockNumber, (z.msg) ? z.msg : "error", status);
-			NotifyReadError();
-			inflateEnd(&z);
-			memset(outPtr, 0, GetBlockSize());
-			return false;
-		}
-		if (z.total_out != frameSize) {
-			ERROR_LOG(Log::Loader, "block %d: block size error %d != %d\n", blockNumber, (u32)z.total_out, frameSize);
-			NotifyReadError();
-			inflateEnd(&z);
-			memset(outPtr, 0, GetBlockSize());
-			return false;
-		}
-		inflateEnd(&z);
-
-		if (frameSize != (u32)GetBlockSize()) {
-			zlibBufferFrame = frameNumber;
-			memcpy(outPtr, zlibBuffer + compressedOffset, GetBlockSize());
+		std::lock_guard<std::mutex> guard(frameCacheLock_);
+		const u8 *frameData = FindCachedFrame(frameNumber);
+		if (!frameData) {
+			const u32 readSize = (u32)fileLoader_->ReadAt(compressedReadPos, 1, compressedReadSize, readBuffer, flags);
+			frameData = InflateFrameCached(frameNumber, readBuffer, readSize);
+			if (!frameData) {
+				memset(outPtr, 0, GetBlockSize());
+				return false;
+			}
 		}
+		memcpy(outPtr, frameData + compressedOffset, GetBlockSize());
 	}
 	return true;
 }
@@ -310,6 +338,14 @@ bool CISOFileBlockDevice::ReadBlocks(u32 minBlock, int count, u8 *outPtr) {
 	const u32 afterLastIndexPos = index[lastFrameNumber + 1] & 0x7FFFFFFF;
 	const u64 totalReadEnd = (u64)afterLastIndexPos << indexShift;
 
+	// Long frame runs (video streaming does dozens at a time) inflate independently,
+	// so fan them out across the worker threads instead of grinding through serially.
+	const u32 framesSpanned = lastFrameNumber - minFrameNumber + 1;
+	const u64 spanReadPos = (u64)(index[minFrameNumber] & 0x7FFFFFFF) << indexShift;
+	if (framesSpanned >= CSO_PARALLEL_MIN_FRAMES && totalReadEnd - spanReadPos <= CSO_PARALLEL_MAX_SPAN) {
+		return ReadFramesParallel(minBlock, lastBlock, outPtr);
+	}
+
 	z_stream z{};
 	if (inflateInit2(&z, -15) != Z_OK) {
 		ERROR_LOG(Log::Loader, "Unable to initialize inflate: %s\n", (z.msg) ? z.msg : "?");
@@ -348,9 +384,9 @@ bool CISOFileBlockDevice::ReadBlocks(u32 minBlock, int count, u8 *outPtr) {
 		const int plain = idx & 0x80000000;
 		if (plain) {
 			memcpy(outPtr, rawBuffer + frameBlockOffset * GetBlockSize(), frameBlocks * GetBlockSize());
-		} else {
+		} else if (frameBlocks == blocksPerFrame) {
 			z.avail_in = frameReadSize;
-			z.next_out = frameBlocks == blocksPerFrame ? outPtr : zlibBuffer;
+			z.next_out = outPtr;
 			z.avail_out = frameSize;
 			z.next_in = rawBuffer;
 
@@ -363,13 +399,20 @@ bool CISOFileBlockDevice::ReadBlocks(u32 minBlock, int count, u8 *outPtr) {
 				ERROR_LOG(Log::Loader, "Inflate frame %d: block size error %d != %d\n", frame, (u32)z.total_out, frameSize);
 				NotifyReadError();
 				memset(outPtr, 0, frameBlocks * GetBlockSize());
-			} else if (frameBlocks != blocksPerFrame) {
-				memcpy(outPtr, zlibBuffer + frameBlockOffset * GetBlockSize(), frameBlocks * GetBlockSize());
-				// In case we end up reusing it in a single read later.
-				zlibBufferFrame = frame;
 			}
 
 			inflateReset(&z);
+		} else {
+			// Partially covered frame - go through the shared cache, since the adjoining
+			// read will typically want the rest of it.
+			std::lock_guard<std::mutex> guard(frameCacheLock_);
+			const u8 *frameData = FindCachedFrame(frame);
+			if (!frameData)
+				frameData = InflateFrameCached(frame, rawBuffer, frameReadSize);
+			if (frameData)
+				memcpy(outPtr, frameData + frameBlockOffset * GetBlockSize(), frameBlocks * GetBlockSize());
+			else
+				memset(outPtr, 0, frameBlocks * GetBlockSize());
 		}
 
 		block += frameBlocks;
@@ -380,6 +423,80 @@ bool CISOFileBlockDevice::ReadBlocks(u32 minBlock, int count, u8 *outPtr) {
 	return true;
 }
 
+bool CISOFileBlockDevice::ReadFramesParallel(u32 minBlock, u32 lastBlock, u8 *outPtr) {
+	const u32 minFrameNumber = minBlock >> blockShift;
+	const u32 lastFrameNumber = lastBlock >> blockShift;
+	const u32 blocksPerFrame = 1 << blockShift;
+	const u64 spanReadPos = (u64)(index[minFrameNumber] & 0x7FFFFFFF) << indexShift;
+	const u64 spanReadEnd = (u64)(index[lastFrameNumber + 1] & 0x7FFFFFFF) << indexShift;
+	const size_t spanSize = (size_t)(spanReadEnd - spanReadPos);
+
+	// One serial read of the whole compressed span (which is what the storage wants
+	// anyway), then the frames inflate independently on worker threads.
+	std::vector<u8> compressed(spanSize);
+	const size_t readSize = fileLoader_->ReadAt(spanReadPos, 1, spanSize, compressed.data());
+	if (readSize < spanSize) {
+		memset(compressed.data() + readSize, 0, spanSize - readSize);
+	}
+
+	ParallelRangeLoop(&g_threadManager, [&](int low, int high) {
+		for (int frame = low; frame < high; ++frame) {
+			const u32 idx = index[frame];
+			const u64 frameReadPos = (u64)(idx & 0x7FFFFFFF) << indexShift;
+			const u64 frameReadEnd = (u64)(index[frame + 1] & 0x7FFFFFFF) << indexShift;
+			const u32 frameReadSize = (u32)(frameReadEnd - frameReadPos);
+			const u8 *rawBuffer = &compressed[frameReadPos - spanReadPos];
+
+			// The part of this frame covered by the read.
+			const u32 frameFirstBlock = std::max((u32)frame << blockShift, minBlock);
+			const u32 frameLastBlock = std::min((((u32)frame + 1) << blockShift) - 1, lastBlock);
+			const u32 frameBlockOffset = frameFirstBlock & (blocksPerFrame - 1);
+			const u32 frameBlocks = frameLastBlock - frameFirstBlock + 1;
+			u8 *dest = outPtr + (u64)(frameFirstBlock - minBlock) * GetBlockSize();
+
+			bool plain = (idx & 0x80000000) != 0;
+			if (ver_ >= 2) {
+				plain = frameReadSize >= frameSize;
+			}
+			if (plain) {
+				memcpy(dest, rawBuffer + frameBlockOffset * GetBlockSize(), frameBlocks * GetBlockSize());
+			} else if (frameBlocks == blocksPerFrame) {
+				z_stream z{};
+				if (inflateInit2(&z, -15) != Z_OK) {
+					ERROR_LOG(Log::Loader, "Unable to initialize inflate: %s\n", (z.msg) ? z.msg : "?");
+					memset(dest, 0, frameBlocks * GetBlockSize());
+					continue;
+				}
+				z.avail_in = frameReadSize;
+				z.next_in = (Bytef *)rawBuffer;
+				z.avail_out = frameSize;
+				z.next_out = dest;
+
+				int status = inflate(&z, Z_FINISH);
+				if (status != Z_STREAM_END || z.total_out != frameSize) {
+					ERROR_LOG(Log::Loader, "Inflate frame %d: failed - %s[%d]\n", frame, (z.msg) ? z.msg : "error", status);
+					NotifyReadError();
+					memset(dest, 0, frameBlocks * GetBlockSize());
+				}
+				inflateEnd(&z);
+			} else {
+				// Partially covered edge frame - go through the shared cache, since the
+				// adjoining read will typically want the rest of it.
+				std::lock_guard<std::mutex> guard(frameCacheLock_);
+				const u8 *frameData = FindCachedFrame(frame);
+				if (!frameData)
+					frameData = InflateFrameCached(frame, rawBuffer, frameReadSize);
+				if (frameData)
+					memcpy(dest, frameData + frameBlockOffset * GetBlockSize(), frameBlocks * GetBlockSize());
+				else
+					memset(dest, 0, frameBlocks * GetBlockSize());
+			}
+		}
+	}, minFrameNumber, lastFrameNumber + 1, 1);
+
+	return true;
+}
+
 NPDRMDemoBlockDevice::NPDRMDemoBlockDevice(FileLoader *fileLoader)
 	: BlockDevice(fileLoader)
 {
@@ -68,16 +68,31 @@ public:
 	bool IsDisc() const override { return true; }
 
 private:
+	// These expect frameCacheLock_ to be held.
+	u8 *FindCachedFrame(u32 frame);
+	u8 *InflateFrameCached(u32 frame, const u8 *compressed, u32 compressedSize);
+	bool ReadFramesParallel(u32 minBlock, u32 lastBlock, u8 *outPtr);
+
+	enum {
+		FRAME_CACHE_SIZE = 16,
+	};
+
 	u32 *index = nullptr;
 	u8 *readBuffer = nullptr;
-	u8 *zlibBuffer = nullptr;
-	u32 zlibBufferFrame = 0;
 	u8 indexShift = 0;
 	u8 blockShift = 0;
 	u32 frameSize = 0;
 	u32 numBlocks = 0;
 	u32 numFrames = 0;
 	int ver_ = 0;
+
+	// Small cache of decompressed frames, shared between the sync read path and the
+	// async io thread so the same frame doesn't get inflated twice in short order.
+	u8 *frameCache_[FRAME_CACHE_SIZE]{};
+	u32 frameCacheFrame_[FRAME_CACHE_SIZE];
+	u64 frameCacheAge_[FRAME_CACHE_SIZE]{};
+	u64 frameCacheCounter_ = 0;
+	std::mutex frameCacheLock_;
 };
 
 
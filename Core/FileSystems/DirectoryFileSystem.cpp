@@ -459,6 +459,7 @@ bool DirectoryFileSystem::MkDir(const std::string &dirname) {
 #else
 	result = File::CreateFullPath(GetLocalPath(dirname));
 #endif
+	InvalidateListingCache();
 	MemoryStick_NotifyWrite();
 	return ReplayApplyDisk(ReplayAction::MKDIR, result, CoreTiming::GetGlobalTimeUs()) != 0;
 }
@@ -469,6 +470,7 @@ bool DirectoryFileSystem::RmDir(const std::string &dirname) {
 #if HOST_IS_CASE_SENSITIVE
 	// Maybe we're lucky?
 	if (File::DeleteDirRecursively(fullName)) {
+		InvalidateListingCache();
 		MemoryStick_NotifyWrite();
 		return (bool)ReplayApplyDisk(ReplayAction::RMDIR, true, CoreTiming::GetGlobalTimeUs());
 	}
@@ -482,6 +484,7 @@ bool DirectoryFileSystem::RmDir(const std::string &dirname) {
 #endif
 
 	bool result = File::DeleteDirRecursively(fullName);
+	InvalidateListingCache();
 	MemoryStick_NotifyWrite();
 	return ReplayApplyDisk(ReplayAction::RMDIR, result, CoreTiming::GetGlobalTimeUs()) != 0;
 }
@@ -530,6 +533,7 @@ int DirectoryFileSystem::RenameFile(const std::string &from, const std::string &
 
 	// TODO: Better error codes.
 	int result = retValue ? 0 : (int)SCE_KERNEL_ERROR_ERRNO_FILE_ALREADY_EXISTS;
+	InvalidateListingCache();
 	MemoryStick_NotifyWrite();
 	return ReplayApplyDisk(ReplayAction::FILE_RENAME, result, CoreTiming::GetGlobalTimeUs());
 }
@@ -552,6 +556,7 @@ bool DirectoryFileSystem::RemoveFile(const std::string &filename) {
 	}
 #endif
 
+	InvalidateListingCache();
 	MemoryStick_NotifyWrite();
 	return ReplayApplyDisk(ReplayAction::FILE_REMOVE, retValue, CoreTiming::GetGlobalTimeUs()) != 0;
 }
@@ -592,6 +597,11 @@ int DirectoryFileSystem::OpenFile(std::string filename, FileAccess access, const
 		entry.guestFilename = filename;
 		entry.access = (FileAccess)(access & FILEACCESS_PSP_FLAGS);
 
+		if (access & (FILEACCESS_APPEND | FILEACCESS_CREATE | FILEACCESS_WRITE)) {
+			// May have created the file, or will change its size/mtime.
+			InvalidateListingCache();
+		}
+
 		entries[newHandle] = entry;
 
 		return newHandle;
@@ -602,6 +612,10 @@ void DirectoryFileSystem::CloseFile(u32 handle) {
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter != entries.end()) {
 		hAlloc->FreeHandle(handle);
+		if (iter->second.access & (FILEACCESS_APPEND | FILEACCESS_CREATE | FILEACCESS_WRITE)) {
+			// Any pending truncation is applied on close.
+			InvalidateListingCache();
+		}
 		iter->second.hFile.Close();
 		entries.erase(iter);
 	} else {
@@ -654,6 +668,8 @@ size_t DirectoryFileSystem::WriteFile(u32 handle, const u8 *pointer, s64 size, i
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter != entries.end()) {
 		size_t bytesWritten = iter->second.hFile.Write(pointer,size);
+		// Sizes and mtimes in any cached listing are stale now.
+		InvalidateListingCache();
 		return bytesWritten;
 	} else {
 		//This shouldn't happen...
@@ -784,9 +800,20 @@ static std::string SimulateVFATBug(std::string filename) {
 }
 
 bool DirectoryFileSystem::ComputeRecursiveDirSizeIfFast(const std::string &path, int64_t *size) {
+	// Same deal as the listing cache - recursive walks over savedata are slow on some hosts
+	// and games re-query sizes constantly. Invalidated together with the listings on writes.
+	auto cached = dirSizeCache_.find(path);
+	if (cached != dirSizeCache_.end()) {
+		if (cached->second < 0)
+			return false;
+		*size = cached->second;
+		return true;
+	}
+
 	Path localPath = GetLocalPath(path);
 
 	int64_t sizeTemp = File::ComputeRecursiveDirectorySize(localPath);
+	dirSizeCache_[path] = sizeTemp;
 	if (sizeTemp >= 0) {
 		*size = sizeTemp;
 		return true;
@@ -798,22 +825,30 @@ bool DirectoryFileSystem::ComputeRecursiveDirSizeIfFast(const std::string &path,
 std::vector<PSPFileInfo> DirectoryFileSystem::GetDirListing(const std::string &path, bool *exists) {
 	std::vector<PSPFileInfo> myVector;
 
-	std::vector<File::FileInfo> files;
-	Path localPath = GetLocalPath(path);
-	const int flags = File::GETFILES_GETHIDDEN | File::GETFILES_GET_NAVIGATION_ENTRIES;
-	bool success = File::GetFilesInDir(localPath, &files, nullptr, flags);
+	auto cached = listingCache_.find(path);
+	if (cached == listingCache_.end()) {
+		CachedListing listing;
+		Path localPath = GetLocalPath(path);
+		const int flags = File::GETFILES_GETHIDDEN | File::GETFILES_GET_NAVIGATION_ENTRIES;
+		listing.success = File::GetFilesInDir(localPath, &listing.files, nullptr, flags);
 #if HOST_IS_CASE_SENSITIVE
-	if (!success) {
-		// TODO: Case sensitivity should be checked on a file system basis, right?
-		std::string fixedPath = path;
-		if (FixPathCase(basePath, fixedPath, FPC_FILE_MUST_EXIST)) {
-			// May have failed due to case sensitivity, try again
-			localPath = GetLocalPath(fixedPath);
-			success = File::GetFilesInDir(localPath, &files, nullptr, flags);
+		if (!listing.success) {
+			// TODO: Case sensitivity should be checked on a file system basis, right?
+			std::string fixedPath = path;
+			if (FixPathCase(basePath, fixedPath, FPC_FILE_MUST_EXIST)) {
+				// May have failed due to case sensitivity, try again
+				localPath = GetLocalPath(fixedPath);
+				listing.success = File::GetFilesInDir(localPath, &listing.files, nullptr, flags);
+			}
 		}
-	}
 #endif
-	if (!success) {
+		cached = listingCache_.emplace(path, std::move(listing)).first;
+	}
+
+	// The PSP-specific transforms below depend on per-game state (compat flags, disc ID),
+	// so we cache the raw host listing and reapply them on every call.
+	const std::vector<File::FileInfo> &files = cached->second.files;
+	if (!cached->second.success) {
 		if (exists)
 			*exists = false;
 		return ReplayApplyDiskListing(myVector, CoreTiming::GetGlobalTimeUs());
@@ -910,6 +945,8 @@ void DirectoryFileSystem::DoState(PointerWrap &p) {
 
 	if (p.mode == p.MODE_READ) {
 		CloseAll();
+		// The state we're loading may have changed files on disk since we listed them.
+		InvalidateListingCache();
 		u32 key;
 		OpenFileEntry entry;
 		entry.hFile.fileSystemFlags_ = flags;
@@ -21,6 +21,7 @@
 
 #include <map>
 
+#include "Common/File/DirListing.h"
 #include "Common/File/Path.h"
 #include "Core/FileSystems/FileSystem.h"
 
@@ -100,6 +101,25 @@ private:
 	IHandleAllocator *hAlloc;
 	FileSystemFlags flags;
 
+	// Host directory listings are expensive (hundreds of ms through Android's storage
+	// access framework), and save dialogs list the same directory over and over. We cache
+	// the raw host listing per guest path, and drop the whole cache whenever we mutate the
+	// directory contents ourselves - outside writers aren't tracked.
+	struct CachedListing {
+		bool success;
+		std::vector<File::FileInfo> files;
+	};
+	std::map<std::string, CachedListing> listingCache_;
+
+	// Recursive directory sizes, same lifetime as the listing cache. -1 means the
+	// walk failed (cached too, so we don't retry a missing dir every query).
+	std::map<std::string, int64_t> dirSizeCache_;
+
+	void InvalidateListingCache() {
+		listingCache_.clear();
+		dirSizeCache_.clear();
+	}
+
 	Path GetLocalPath(std::string internalPath) const;
 };
 
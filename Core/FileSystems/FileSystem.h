@@ -70,6 +70,9 @@ enum class FileSystemFlags {
 	CARD = 4,
 	FLASH = 8,
 	STRIP_PSP = 16,
+	// I/O on open handles is internally synchronized, so MetaFileSystem can drop its
+	// global lock while reading/writing. See MetaFileSystem::ReadFile.
+	CONCURRENT_IO = 32,
 };
 ENUM_CLASS_BITOPS(FileSystemFlags);
 
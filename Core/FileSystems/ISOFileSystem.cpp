@@ -321,6 +321,7 @@ ISOFileSystem::TreeEntry *ISOFileSystem::GetFromPath(const std::string &path, bo
 }
 
 int ISOFileSystem::OpenFile(std::string filename, FileAccess access, const char *devicename) {
+	std::lock_guard<std::mutex> guard(lock_);
 	OpenFileEntry entry;
 	entry.isRawSector = false;
 	entry.isBlockSectorMode = false;
@@ -376,6 +377,7 @@ int ISOFileSystem::OpenFile(std::string filename, FileAccess access, const char
 }
 
 void ISOFileSystem::CloseFile(u32 handle) {
+	std::lock_guard<std::mutex> guard(lock_);
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter != entries.end()) {
 		//CloseHandle((*iter).second.hFile);
@@ -388,11 +390,13 @@ void ISOFileSystem::CloseFile(u32 handle) {
 }
 
 bool ISOFileSystem::OwnsHandle(u32 handle) {
+	std::lock_guard<std::mutex> guard(lock_);
 	EntryMap::iterator iter = entries.find(handle);
 	return (iter != entries.end());
 }
 
 int ISOFileSystem::Ioctl(u32 handle, u32 cmd, u32 indataPtr, u32 inlen, u32 outdataPtr, u32 outlen, int &usec) {
+	std::lock_guard<std::mutex> guard(lock_);
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter == entries.end()) {
 		ERROR_LOG(Log::FileSystem, "Ioctl on a bad file handle");
@@ -452,6 +456,7 @@ int ISOFileSystem::Ioctl(u32 handle, u32 cmd, u32 indataPtr, u32 inlen, u32 outd
 }
 
 PSPDevType ISOFileSystem::DevType(u32 handle) {
+	std::lock_guard<std::mutex> guard(lock_);
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter == entries.end())
 		return PSPDevType::FILE;
@@ -464,7 +469,7 @@ PSPDevType ISOFileSystem::DevType(u32 handle) {
 FileSystemFlags ISOFileSystem::Flags() {
 	// TODO: Here may be a good place to force things, in case users recompress games
 	// as PBP or CSO when they were originally the other type.
-	return blockDevice->IsDisc() ? FileSystemFlags::UMD : FileSystemFlags::CARD;
+	return (blockDevice->IsDisc() ? FileSystemFlags::UMD : FileSystemFlags::CARD) | FileSystemFlags::CONCURRENT_IO;
 }
 
 size_t ISOFileSystem::ReadFile(u32 handle, u8 *pointer, s64 size)
@@ -474,6 +479,7 @@ size_t ISOFileSystem::ReadFile(u32 handle, u8 *pointer, s64 size)
 }
 
 size_t ISOFileSystem::ReadFile(u32 handle, u8 *pointer, s64 size, int &usec) {
+	std::lock_guard<std::mutex> guard(lock_);
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter != entries.end()) {
 		OpenFileEntry &e = iter->second;
@@ -581,6 +587,7 @@ size_t ISOFileSystem::WriteFile(u32 handle, const u8 *pointer, s64 size, int &us
 }
 
 size_t ISOFileSystem::SeekFile(u32 handle, s32 position, FileMove type) {
+	std::lock_guard<std::mutex> guard(lock_);
 	EntryMap::iterator iter = entries.find(handle);
 	if (iter != entries.end()) {
 		OpenFileEntry &e = iter->second;
@@ -608,6 +615,7 @@ size_t ISOFileSystem::SeekFile(u32 handle, s32 position, FileMove type) {
 }
 
 PSPFileInfo ISOFileSystem::GetFileInfo(std::string filename) {
+	std::lock_guard<std::mutex> guard(lock_);
 	if (filename.compare(0,8,"/sce_lbn") == 0) {
 		u32 sectorStart = 0xFFFFFFFF, readSize = 0xFFFFFFFF;
 		parseLBN(filename, &sectorStart, &readSize);
@@ -640,6 +648,7 @@ PSPFileInfo ISOFileSystem::GetFileInfo(std::string filename) {
 }
 
 std::vector<PSPFileInfo> ISOFileSystem::GetDirListing(const std::string &path, bool *exists) {
+	std::lock_guard<std::mutex> guard(lock_);
 	std::vector<PSPFileInfo> myVector;
 	TreeEntry *entry = GetFromPath(path);
 	if (!entry) {
@@ -712,6 +721,7 @@ ISOFileSystem::TreeEntry::~TreeEntry() {
 }
 
 void ISOFileSystem::DoState(PointerWrap &p) {
+	std::lock_guard<std::mutex> guard(lock_);
 	auto s = p.Section("ISOFileSystem", 1, 2);
 	if (!s)
 		return;
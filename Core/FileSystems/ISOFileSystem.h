@@ -20,6 +20,7 @@
 #include <map>
 #include <list>
 #include <memory>
+#include <mutex>
 
 #include "FileSystem.h"
 
@@ -88,6 +89,11 @@ private:
 	};
 
 	typedef std::map<u32, OpenFileEntry> EntryMap;
+
+	// Guards entries, the lazily-read directory tree and the block device. ReadFile may be
+	// called from the async io thread without the MetaFileSystem lock held (see
+	// FileSystemFlags::CONCURRENT_IO), concurrently with other calls from the emu thread.
+	std::mutex lock_;
 	EntryMap entries;
 	IHandleAllocator *hAlloc;
 	TreeEntry *treeroot;
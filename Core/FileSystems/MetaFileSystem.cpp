@@ -178,6 +178,19 @@ IFileSystem *MetaFileSystem::GetHandleOwner(u32 handle)
 	return nullptr;
 }
 
+std::shared_ptr<IFileSystem> MetaFileSystem::GetHandleOwnerRef(u32 handle)
+{
+	std::lock_guard<std::recursive_mutex> guard(lock);
+	for (size_t i = 0; i < fileSystems.size(); i++)
+	{
+		if (fileSystems[i].system->OwnsHandle(handle))
+			return fileSystems[i].system;
+	}
+
+	// Not found
+	return nullptr;
+}
+
 int MetaFileSystem::MapFilePath(const std::string &_inpath, std::string &outpath, MountPoint **system)
 {
 	int error = SCE_KERNEL_ERROR_ERRNO_FILE_NOT_FOUND;
@@ -228,6 +241,20 @@ int MetaFileSystem::MapFilePath(const std::string &_inpath, std::string &outpath
 		currentDirectory = &(it->second);
 	}
 
+	std::string cacheKey;
+	if (error != SCE_KERNEL_ERROR_NOCWD) {
+		cacheKey.reserve(inpath.size() + currentDirectory->size() + 1);
+		cacheKey += inpath;
+		cacheKey += '\n';
+		cacheKey += *currentDirectory;
+		auto cached = mapCache_.find(cacheKey);
+		if (cached != mapCache_.end()) {
+			outpath = cached->second.outpath;
+			*system = &fileSystems[cached->second.systemIndex];
+			return 0;
+		}
+	}
+
 	if (RealPath(*currentDirectory, inpath, realpath))
 	{
 		std::string prefix = realpath;
@@ -245,7 +272,14 @@ int MetaFileSystem::MapFilePath(const std::string &_inpath, std::string &outpath
 
 				VERBOSE_LOG(Log::FileSystem, "MapFilePath: mapped \"%s\" to prefix: \"%s\", path: \"%s\"", inpath.c_str(), fileSystems[i].prefix.c_str(), outpath.c_str());
 
-				return error == SCE_KERNEL_ERROR_NOCWD ? error : 0;
+				if (error != SCE_KERNEL_ERROR_NOCWD) {
+					// Crude bound, but a game would have to touch a lot of distinct paths to hit it.
+					if (mapCache_.size() >= 512)
+						mapCache_.clear();
+					mapCache_.emplace(std::move(cacheKey), MapCacheEntry{ outpath, i });
+					return 0;
+				}
+				return error;
 			}
 		}
 
@@ -277,6 +311,8 @@ std::string MetaFileSystem::NormalizePrefix(std::string prefix) const {
 void MetaFileSystem::Mount(const std::string &prefix, std::shared_ptr<IFileSystem> system) {
 	std::lock_guard<std::recursive_mutex> guard(lock);
 
+	mapCache_.clear();
+
 	MountPoint x;
 	x.prefix = prefix;
 	x.system = system;
@@ -296,10 +332,12 @@ void MetaFileSystem::Mount(const std::string &prefix, std::shared_ptr<IFileSyste
 void MetaFileSystem::UnmountAll() {
 	fileSystems.clear();
 	currentDir.clear();
+	mapCache_.clear();
 }
 
 void MetaFileSystem::Unmount(const std::string &prefix) {
 	std::lock_guard<std::recursive_mutex> guard(lock);
+	mapCache_.clear();
 	for (auto iter = fileSystems.begin(); iter != fileSystems.end(); iter++) {
 		if (iter->prefix == prefix) {
 			fileSystems.erase(iter);
@@ -310,6 +348,7 @@ void MetaFileSystem::Unmount(const std::string &prefix) {
 
 bool MetaFileSystem::Remount(const std::string &prefix, std::shared_ptr<IFileSystem> system) {
 	std::lock_guard<std::recursive_mutex> guard(lock);
+	mapCache_.clear();
 	for (auto &it : fileSystems) {
 		if (it.prefix == prefix) {
 			it.system = system;
@@ -535,42 +574,50 @@ void MetaFileSystem::CloseFile(u32 handle)
 
 size_t MetaFileSystem::ReadFile(u32 handle, u8 *pointer, s64 size)
 {
-	std::lock_guard<std::recursive_mutex> guard(lock);
-	IFileSystem *sys = GetHandleOwner(handle);
-	if (sys)
-		return sys->ReadFile(handle, pointer, size);
-	else
+	std::unique_lock<std::recursive_mutex> guard(lock);
+	std::shared_ptr<IFileSystem> sys = GetHandleOwnerRef(handle);
+	if (!sys)
 		return 0;
+	// Filesystems that synchronize internally (FileSystemFlags::CONCURRENT_IO) don't need
+	// the global lock held across the read. That way a long async UMD streaming read on the
+	// io thread overlaps with the emu thread's other I/O instead of stalling all of it.
+	if (sys->Flags() & FileSystemFlags::CONCURRENT_IO)
+		guard.unlock();
+	return sys->ReadFile(handle, pointer, size);
 }
 
 size_t MetaFileSystem::WriteFile(u32 handle, const u8 *pointer, s64 size)
 {
-	std::lock_guard<std::recursive_mutex> guard(lock);
-	IFileSystem *sys = GetHandleOwner(handle);
-	if (sys)
-		return sys->WriteFile(handle, pointer, size);
-	else
+	std::unique_lock<std::recursive_mutex> guard(lock);
+	std::shared_ptr<IFileSystem> sys = GetHandleOwnerRef(handle);
+	if (!sys)
 		return 0;
+	if (sys->Flags() & FileSystemFlags::CONCURRENT_IO)
+		guard.unlock();
+	return sys->WriteFile(handle, pointer, size);
 }
 
 size_t MetaFileSystem::ReadFile(u32 handle, u8 *pointer, s64 size, int &usec)
 {
-	std::lock_guard<std::recursive_mutex> guard(lock);
-	IFileSystem *sys = GetHandleOwner(handle);
-	if (sys)
-		return sys->ReadFile(handle, pointer, size, usec);
-	else
+	std::unique_lock<std::recursive_mutex> guard(lock);
+	std::shared_ptr<IFileSystem> sys = GetHandleOwnerRef(handle);
+	if (!sys)
 		return 0;
+	// See the comment in the variant above.
+	if (sys->Flags() & FileSystemFlags::CONCURRENT_IO)
+		guard.unlock();
+	return sys->ReadFile(handle, pointer, size, usec);
 }
 
 size_t MetaFileSystem::WriteFile(u32 handle, const u8 *pointer, s64 size, int &usec)
 {
-	std::lock_guard<std::recursive_mutex> guard(lock);
-	IFileSystem *sys = GetHandleOwner(handle);
-	if (sys)
-		return sys->WriteFile(handle, pointer, size, usec);
-	else
+	std::unique_lock<std::recursive_mutex> guard(lock);
+	std::shared_ptr<IFileSystem> sys = GetHandleOwnerRef(handle);
+	if (!sys)
 		return 0;
+	if (sys->Flags() & FileSystemFlags::CONCURRENT_IO)
+		guard.unlock();
+	return sys->WriteFile(handle, pointer, size, usec);
 }
 
 size_t MetaFileSystem::SeekFile(u32 handle, s32 position, FileMove type)
@@ -626,6 +673,9 @@ void MetaFileSystem::DoState(PointerWrap &p) {
 
 	Do(p, current);
 
+	// The mount table may be about to change under us.
+	mapCache_.clear();
+
 	// Save/load per-thread current directory map
 	Do(p, currentDir);
 
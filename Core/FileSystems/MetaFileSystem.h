@@ -18,6 +18,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <mutex>
 #include <memory>
@@ -45,6 +46,16 @@ private:
 	std::string startingDirectory;
 	std::recursive_mutex lock;  // must be recursive. TODO: fix that
 
+	// Memoizes MapFilePath results - games poll the same files every frame, and the
+	// RealPath normalization does a lot of string slicing. Keyed on the input path
+	// plus the current directory it was resolved against (so ChDir needs no flush);
+	// cleared whenever the mount table changes. Only successful mappings are cached.
+	struct MapCacheEntry {
+		std::string outpath;
+		size_t systemIndex;
+	};
+	std::unordered_map<std::string, MapCacheEntry> mapCache_;
+
 	// Assumes the lock is held
 	void Reset() {
 		// This used to be 6, probably an attempt to replicate PSP handles.
@@ -69,6 +80,8 @@ public:
 	IFileSystem *GetSystem(const std::string &prefix);
 	IFileSystem *GetSystemFromFilename(const std::string &filename);
 	IFileSystem *GetHandleOwner(u32 handle);
+	// For use when calling into the filesystem without the lock held - keeps it alive.
+	std::shared_ptr<IFileSystem> GetHandleOwnerRef(u32 handle);
 	FileSystemFlags FlagsFromFilename(const std::string &filename) {
 		IFileSystem *sys = GetSystemFromFilename(filename);
 		return sys ? sys->Flags() : FileSystemFlags::NONE;
@@ -155,6 +155,8 @@ void VirtualDiscFileSystem::LoadFileListIndex() {
 		}
 
 		fileList.push_back(entry);
+		// First match wins on duplicate names, same as the old linear search.
+		fileListLookup_.emplace(entry.fileName, (int)fileList.size() - 1);
 	}
 
 	fclose(f);
@@ -185,6 +187,11 @@ void VirtualDiscFileSystem::DoState(PointerWrap &p)
 
 	if (p.mode == p.MODE_READ)
 	{
+		fileListLookup_.clear();
+		for (int i = 0; i < fileListSize; i++) {
+			fileListLookup_.emplace(fileList[i].fileName, i);
+		}
+
 		entries.clear();
 
 		for (int i = 0; i < entryCount; i++)
@@ -268,11 +275,9 @@ int VirtualDiscFileSystem::getFileListIndex(std::string &fileName)
 		normalized = fileName;
 	}
 
-	for (size_t i = 0; i < fileList.size(); i++)
-	{
-		if (fileList[i].fileName == normalized)
-			return (int)i;
-	}
+	auto lookup = fileListLookup_.find(normalized);
+	if (lookup != fileListLookup_.end())
+		return lookup->second;
 
 	// unknown file - add it
 	Path fullName = GetLocalPath(fileName);
@@ -299,6 +304,7 @@ int VirtualDiscFileSystem::getFileListIndex(std::string &fileName)
 	currentBlockIndex += (entry.totalSize+2047)/2048;
 
 	fileList.push_back(entry);
+	fileListLookup_.emplace(entry.fileName, (int)fileList.size() - 1);
 
 	return (int)fileList.size()-1;
 }
@@ -20,6 +20,7 @@
 // TODO: Remove the Windows-specific code, FILE is fine there too.
 
 #include <map>
+#include <unordered_map>
 
 #include "Common/File/Path.h"
 #include "Core/FileSystems/FileSystem.h"
@@ -192,6 +193,9 @@ private:
 	};
 
 	std::vector<FileListEntry> fileList;
+	// Name -> fileList index, so per-access resolution doesn't linear-scan and
+	// re-stat the host filesystem. Kept in sync as entries get added lazily.
+	std::unordered_map<std::string, int> fileListLookup_;
 	u32 currentBlockIndex;
 	u32 lastReadBlock_;
 
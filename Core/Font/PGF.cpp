@@ -137,6 +137,7 @@ void PGF::DoState(PointerWrap &p) {
 	Do(p, fontDataSizeTemp);
 	fontDataSize = (size_t)fontDataSizeTemp;
 	if (p.mode == p.MODE_READ) {
+		glyphPixelCache_.clear();
 		delete [] fontData;
 		if (fontDataSize) {
 			fontData = new u8[fontDataSize];
@@ -178,6 +179,8 @@ void PGF::DoState(PointerWrap &p) {
 bool PGF::ReadPtr(const u8 *ptr, size_t dataSize) {
 	const u8 *const startPtr = ptr;
 
+	glyphPixelCache_.clear();
+
 	if (dataSize < sizeof(header)) {
 		return false;
 	}
@@ -576,9 +579,7 @@ void PGF::DrawCharacter(const GlyphImage *image, int clipX, int clipY, int clipW
 		return;
 	}
 
-	size_t bitPtr = glyph.ptr * 8;
 	int numberPixels = glyph.w * glyph.h;
-	int pixelIndex = 0;
 
 	int x = image->xPos64 >> 6;
 	int y = image->yPos64 >> 6;
@@ -595,32 +596,46 @@ void PGF::DrawCharacter(const GlyphImage *image, int clipX, int clipY, int clipW
 	if (clipHeight < 0)
 		clipHeight = 8192;
 
-	// Use a buffer so we can apply subpixel rendering.
-	// TODO: Cache this buffer per glyph?  Maybe even transpose it first?
-	std::vector<u8> decodedPixels;
-	decodedPixels.resize(numberPixels);
-
-	while (pixelIndex < numberPixels && bitPtr + 8 < fontDataSize * 8) {
-		// This is some kind of nibble based RLE compression.
-		int nibble = consumeBits(4, fontData, bitPtr);
-
-		int count;
-		int value = 0;
-		if (nibble < 8) {
-			value = consumeBits(4, fontData, bitPtr);
-			count = nibble + 1;
-		} else {
-			count = 16 - nibble;
-		}
-
-		for (int i = 0; i < count && pixelIndex < numberPixels; i++) {
-			if (nibble >= 8) {
+	// Use a buffer so we can apply subpixel rendering. Decoded glyphs are cached
+	// by their data offset - the expansion is all serial bit fetches, and games
+	// draw the same characters every frame.
+	auto cachedGlyph = glyphPixelCache_.find(glyph.ptr);
+	if (cachedGlyph == glyphPixelCache_.end()) {
+		// Real fonts have a few thousand glyphs at most, but don't let a
+		// malformed one grow the cache without bound.
+		if (glyphPixelCache_.size() >= 8192)
+			glyphPixelCache_.clear();
+
+		std::vector<u8> pixels;
+		pixels.resize(numberPixels);
+
+		size_t bitPtr = glyph.ptr * 8;
+		int pixelIndex = 0;
+		while (pixelIndex < numberPixels && bitPtr + 8 < fontDataSize * 8) {
+			// This is some kind of nibble based RLE compression.
+			int nibble = consumeBits(4, fontData, bitPtr);
+
+			int count;
+			int value = 0;
+			if (nibble < 8) {
 				value = consumeBits(4, fontData, bitPtr);
+				count = nibble + 1;
+			} else {
+				count = 16 - nibble;
 			}
 
-			decodedPixels[pixelIndex++] = value | (value << 4);
+			for (int i = 0; i < count && pixelIndex < numberPixels; i++) {
+				if (nibble >= 8) {
+					value = consumeBits(4, fontData, bitPtr);
+				}
+
+				pixels[pixelIndex++] = value | (value << 4);
+			}
 		}
+
+		cachedGlyph = glyphPixelCache_.emplace(glyph.ptr, std::move(pixels)).first;
 	}
+	const std::vector<u8> &decodedPixels = cachedGlyph->second;
 
 	auto samplePixel = [&](int xx, int yy) -> u8 {
 		if (xx < 0 || yy < 0 || xx >= glyph.w || yy >= glyph.h) {
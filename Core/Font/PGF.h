@@ -20,6 +20,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -305,4 +306,11 @@ private:
 	std::vector<Glyph> glyphs;
 	std::vector<Glyph> shadowGlyphs;
 	int firstGlyph;
+
+	// Decoded glyph bitmaps, keyed by the glyph's data offset (which uniquely
+	// identifies the bitmap within fontData.) Text-heavy games draw the same
+	// characters over and over, and the RLE expansion is all serial bit fetches,
+	// so memoizing it makes repeat draws a straight copy. Not saved in states -
+	// rebuilt lazily. Mutable since DrawCharacter is const.
+	mutable std::unordered_map<u32, std::vector<u8>> glyphPixelCache_;
 };
@@ -19,8 +19,11 @@
 // * Frame skipping. This gets complicated.
 // * The game not actually asking for flips, like in static loading screens
 
+#include <cmath>
+
 #include "Common/Profiler/Profiler.h"
 #include "Common/Log.h"
+#include "Common/System/System.h"
 #include "Common/TimeUtil.h"
 
 #include "Core/RetroAchievements.h"
@@ -63,6 +66,34 @@ void FrameTiming::Reset(Draw::DrawContext *draw) {
 	}
 }
 
+double FrameTiming::GetVsyncAlignedTimestep(double timestep) {
+	if (presentMode != Draw::PresentMode::FIFO) {
+		// Not vsync-locked, so there's no grid to align to.
+		return timestep;
+	}
+	const float refreshRate = System_GetPropertyFloat(SYSPROP_DISPLAY_REFRESH_RATE);
+	if (refreshRate < 20.0f) {
+		// Unknown or bogus. Some backends report 0 before the first frame.
+		return timestep;
+	}
+	const double period = 1.0 / refreshRate;
+	if (fabs(period - timestep) < 0.001) {
+		// Content rate matches the display, every vsync is a frame. Nothing to do.
+		return timestep;
+	}
+	// Quantize to a whole number of refresh periods, carrying the remainder so we
+	// still average the requested rate.
+	double want = timestep + vsyncGridError_;
+	double snapped = floor(want / period + 0.5) * period;
+	if (snapped < period)
+		snapped = period;
+	vsyncGridError_ = want - snapped;
+	// A hitch shouldn't turn into a persistent phase offset.
+	if (fabs(vsyncGridError_) > period)
+		vsyncGridError_ = 0.0;
+	return snapped;
+}
+
 void FrameTiming::DeferWaitUntil(double until, double *curTimePtr) {
 	_dbg_assert_(until > 0.0);
 	waitUntil_ = until;
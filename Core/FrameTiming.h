@@ -14,13 +14,26 @@ public:
 	void PostSubmit();
 	void Reset(Draw::DrawContext *draw);
 
+	// Compositor-aware pacing: when presenting with vsync on a display whose refresh
+	// doesn't match the content rate (90/120Hz phones running 60Hz games), quantize
+	// the frame timestep to whole refresh periods, carrying the remainder. The
+	// cadence then settles into a stable repeating pattern (2-1-2-1 vsyncs at 90Hz)
+	// instead of drifting across vsync slots, which is what reads as micro-stutter.
+	double GetVsyncAlignedTimestep(double timestep);
+
 	// Some backends won't allow changing this willy nilly.
 	Draw::PresentMode presentMode;
 	int presentInterval;
 
+	// Latency instrumentation: when input was last polled, stamped by ControlMapper::Update
+	// and exported with the per-frame timestamps through gpu.stats.get in the debugger.
+	void NotifyInputPoll(double now) { lastInputPollTime = now; }
+	double lastInputPollTime = 0.0;
+
 private:
 	double waitUntil_;
 	double *curTimePtr_;
+	double vsyncGridError_ = 0.0;
 };
 
 extern FrameTiming g_frameTiming;
@@ -18,6 +18,8 @@
 #include "Common/Serialize/Serializer.h"
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Common/Log.h"
+#include "Common/Thread/ThreadManager.h"
+#include "Common/Thread/Waitable.h"
 #include "Core/Reporting.h"
 #include "Core/MemMapHelpers.h"
 #include "Core/System.h"
@@ -37,11 +39,46 @@ const int DATA_CHUNK_MAGIC = 0x61746164;
 const int SMPL_CHUNK_MAGIC = 0x6C706D73;
 const int FACT_CHUNK_MAGIC = 0x74636166;
 
+// Decodes one frame ahead of time on a worker thread, see Atrac::StartPrefetch().
+class AtracPrefetchTask : public Task {
+public:
+	AtracPrefetchTask(AudioDecoder *decoder, const u8 *src, u32 srcBytes, int channels, int16_t *pcmOut, int *outSamples, bool *ok, LimitedWaitable *waitable)
+		: decoder_(decoder), src_(src), srcBytes_(srcBytes), channels_(channels), pcmOut_(pcmOut), outSamples_(outSamples), ok_(ok), waitable_(waitable) {}
+
+	TaskType Type() const override {
+		return TaskType::CPU_COMPUTE;
+	}
+	TaskPriority Priority() const override {
+		return TaskPriority::NORMAL;
+	}
+
+	void Run() override {
+		int bytesConsumed = 0;
+		*ok_ = decoder_->Decode(src_, srcBytes_, &bytesConsumed, channels_, pcmOut_, outSamples_);
+		waitable_->Notify();
+	}
+
+private:
+	AudioDecoder *decoder_;
+	const u8 *src_;
+	u32 srcBytes_;
+	int channels_;
+	int16_t *pcmOut_;
+	int *outSamples_;
+	bool *ok_;
+	LimitedWaitable *waitable_;
+};
+
 void Atrac::DoState(PointerWrap &p) {
 	auto s = p.Section("Atrac", 1, 9);
 	if (!s)
 		return;
 
+	// Loading recreates the buffers and decoder out from under any in-flight
+	// lookahead decode. (Saving is fine - both just read the buffers.)
+	if (p.mode == p.MODE_READ)
+		JoinPrefetch();
+
 	Do(p, track_.channels);
 	Do(p, outputChannels_);
 	if (s >= 5) {
@@ -152,6 +189,9 @@ void Atrac::DoState(PointerWrap &p) {
 }
 
 void Atrac::ResetData() {
+	// The task reads the buffers and uses the decoder, so let it finish first.
+	JoinPrefetch();
+
 	delete decoder_;
 	decoder_ = nullptr;
 
@@ -830,12 +870,31 @@ u32 Atrac::GetNextSamples() {
 }
 
 void Atrac::ForceSeekToSample(int sample) {
+	JoinPrefetch();
 	if (decoder_) {
 		decoder_->FlushBuffers();
 	}
 	currentSample_ = sample;
 }
 
+void Atrac::ReseekDecoder(int sample) {
+	// Prefill the decode buffer with packets before the first sample offset.
+	decoder_->FlushBuffers();
+
+	int adjust = 0;
+	if (sample == 0) {
+		int offsetSamples = track_.FirstSampleOffsetFull();
+		adjust = -(int)(offsetSamples % track_.SamplesPerFrame());
+	}
+	const u32 off = track_.FileOffsetBySample(sample + adjust);
+	const u32 backfill = track_.bytesPerFrame * 2;
+	const u32 start = off - track_.dataByteOffset < backfill ? track_.dataByteOffset : off - backfill;
+
+	for (u32 pos = start; pos < off; pos += track_.bytesPerFrame) {
+		decoder_->Decode(BufferStart() + pos, track_.bytesPerFrame, nullptr, 2, nullptr, nullptr);
+	}
+}
+
 void Atrac::SeekToSample(int sample) {
 	// It seems like the PSP aligns the sample position to 0x800...?
 	const u32 offsetSamples = track_.FirstSampleOffsetFull();
@@ -843,21 +902,8 @@ void Atrac::SeekToSample(int sample) {
 	int seekFrame = sample + offsetSamples - unalignedSamples;
 
 	if ((sample != currentSample_ || sample == 0) && decoder_ != nullptr) {
-		// Prefill the decode buffer with packets before the first sample offset.
-		decoder_->FlushBuffers();
-
-		int adjust = 0;
-		if (sample == 0) {
-			int offsetSamples = track_.FirstSampleOffsetFull();
-			adjust = -(int)(offsetSamples % track_.SamplesPerFrame());
-		}
-		const u32 off = track_.FileOffsetBySample(sample + adjust);
-		const u32 backfill = track_.bytesPerFrame * 2;
-		const u32 start = off - track_.dataByteOffset < backfill ? track_.dataByteOffset : off - backfill;
-
-		for (u32 pos = start; pos < off; pos += track_.bytesPerFrame) {
-			decoder_->Decode(BufferStart() + pos, track_.bytesPerFrame, nullptr, 2, nullptr, nullptr);
-		}
+		JoinPrefetch();
+		ReseekDecoder(sample);
 	}
 
 	currentSample_ = sample;
@@ -973,7 +1019,14 @@ u32 Atrac::DecodeData(u8 *outbuf, u32 outbufPtr, u32 *SamplesNum, u32 *finish, i
 		numSamples = std::min(maxSamples, numSamples);
 
 		outSamples = numSamples;
-		if (!decoder_->Decode(indata, track_.bytesPerFrame, &bytesConsumed, outputChannels_, (int16_t *)outbuf, &outSamples)) {
+		bool decodeOk;
+		if (TakePrefetchedFrame(off, currentSample_ - skipSamples, (int16_t *)outbuf, numSamples)) {
+			// The frame was already decoded on a worker task - just copied out.
+			decodeOk = true;
+		} else {
+			decodeOk = decoder_->Decode(indata, track_.bytesPerFrame, &bytesConsumed, outputChannels_, (int16_t *)outbuf, &outSamples);
+		}
+		if (!decodeOk) {
 			// Decode failed.
 			*SamplesNum = 0;
 			*finish = 1;
@@ -1038,6 +1091,9 @@ u32 Atrac::DecodeData(u8 *outbuf, u32 outbufPtr, u32 *SamplesNum, u32 *finish, i
 		currentSample_ += track_.SamplesPerFrame() - numSamples;
 	}
 
+	// Queue up a lookahead decode of the next frame while the game does other work.
+	StartPrefetch();
+
 	*finish = finishFlag;
 	*remains = RemainingFrames();
 	// refresh context_
@@ -1045,6 +1101,59 @@ u32 Atrac::DecodeData(u8 *outbuf, u32 outbufPtr, u32 *SamplesNum, u32 *finish, i
 	return 0;
 }
 
+void Atrac::StartPrefetch() {
+	if (prefetchWaitable_ || !decoder_)
+		return;
+	// Streaming buffers get rewritten by the game between calls, so only read
+	// ahead when the whole file is in place and can't change.
+	if (bufferState_ != ATRAC_STATUS_ALL_DATA_LOADED)
+		return;
+	if (currentSample_ >= track_.endSample)
+		return;
+	// Off-alignment positions take the skip path in DecodeData, don't bother.
+	if ((track_.FirstSampleOffsetFull() + currentSample_) % track_.SamplesPerFrame() != 0)
+		return;
+	const u32 off = track_.FileOffsetBySample(currentSample_);
+	if (off + track_.bytesPerFrame > first_.size)
+		return;
+
+	prefetchOff_ = off;
+	prefetchChannels_ = outputChannels_;
+	prefetchOutSamples_ = (int)track_.SamplesPerFrame();
+	prefetchOk_ = false;
+	prefetchWaitable_ = new LimitedWaitable();
+	g_threadManager.EnqueueTask(new AtracPrefetchTask(decoder_, BufferStart() + off, track_.bytesPerFrame, outputChannels_, prefetchPcm_, &prefetchOutSamples_, &prefetchOk_, prefetchWaitable_));
+}
+
+void Atrac::JoinPrefetch() {
+	if (prefetchWaitable_) {
+		prefetchWaitable_->WaitAndRelease();
+		prefetchWaitable_ = nullptr;
+	}
+}
+
+bool Atrac::TakePrefetchedFrame(u32 off, int sample, int16_t *outbuf, u32 numSamples) {
+	if (!prefetchWaitable_)
+		return false;
+	prefetchWaitable_->WaitAndRelease();
+	prefetchWaitable_ = nullptr;
+
+	if (off != prefetchOff_ || outputChannels_ != prefetchChannels_ || !prefetchOk_) {
+		// A seek, loop or channel change invalidated the lookahead, but the worker
+		// already ran the decoder past its frame - rewind before decoding normally.
+		ReseekDecoder(sample);
+		return false;
+	}
+
+	if (outbuf) {
+		u32 validSamples = std::min(numSamples, (u32)prefetchOutSamples_);
+		memcpy(outbuf, prefetchPcm_, validSamples * outputChannels_ * sizeof(int16_t));
+		if (validSamples < numSamples)
+			memset(outbuf + validSamples * outputChannels_, 0, (numSamples - validSamples) * outputChannels_ * sizeof(int16_t));
+	}
+	return true;
+}
+
 void AtracBase::SetLoopNum(int loopNum) {
 	// Spammed in MHU
 	loopNum_ = loopNum;
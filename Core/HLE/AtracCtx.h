@@ -25,6 +25,8 @@
 #include "Core/MemMap.h"
 #include "Core/HLE/sceAtrac.h"
 
+class LimitedWaitable;
+
 struct AtracSingleResetBufferInfo {
 	u32_le writePosPtr;
 	u32_le writableBytes;
@@ -333,6 +335,15 @@ private:
 	void ConsumeFrame();
 	void CalculateStreamInfo(u32 *readOffset);
 
+	// Lookahead decode: right after handing out a frame, the next one is decoded
+	// on a worker task so the following sceAtracDecodeData is mostly a copy.
+	// Only done for all-data-loaded contexts, where the source can't change
+	// between calls. See StartPrefetch() for the conditions.
+	void StartPrefetch();
+	void JoinPrefetch();
+	bool TakePrefetchedFrame(u32 off, int sample, int16_t *outbuf, u32 numSamples);
+	void ReseekDecoder(int sample);
+
 	InputBuffer first_{};
 	InputBuffer second_{};  // only addr, size, fileoffset are used (incomplete)
 
@@ -348,4 +359,13 @@ private:
 	u32 bufferPos_ = 0;
 	u32 bufferValidBytes_ = 0;
 	u32 bufferHeaderSize_ = 0;
+
+	// Lookahead decode state. The waitable is non-null while a result is in
+	// flight or waiting to be picked up; the rest is written by the worker task.
+	LimitedWaitable *prefetchWaitable_ = nullptr;
+	u32 prefetchOff_ = 0;
+	int prefetchChannels_ = 0;
+	int prefetchOutSamples_ = 0;
+	bool prefetchOk_ = false;
+	int16_t prefetchPcm_[ATRAC3PLUS_MAX_SAMPLES * 2]{};
 };
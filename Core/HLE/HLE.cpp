@@ -34,6 +34,7 @@
 #include "Core/MIPS/MIPS.h"
 #include "Core/MIPS/MIPSCodeUtils.h"
 #include "Core/HLE/HLETables.h"
+#include "Core/HLE/FunctionWrappers.h"
 #include "Core/HLE/sceIo.h"
 #include "Core/HLE/sceAudio.h"
 #include "Core/HLE/sceKernelMemory.h"
@@ -664,6 +665,58 @@ inline void CallSyscallWithoutFlags(const HLEFunction *info)
 		SetDeadbeefRegs();
 }
 
+// Variant of CallSyscallWithFlags with the flags baked in at compile time, so the checks
+// that don't apply fold away. Used by the jits for the common flag combinations.
+template <u32 flags>
+void CallSyscallWithFlagsSpec(const HLEFunction *info)
+{
+	latestSyscall = info;
+	latestSyscallPC = currentMIPS->pc;
+
+	if (flags & HLE_CLEAR_STACK_BYTES) {
+		u32 stackStart = __KernelGetCurThreadStackStart();
+		if (currentMIPS->r[MIPS_REG_SP] - info->stackBytesToClear >= stackStart) {
+			Memory::Memset(currentMIPS->r[MIPS_REG_SP] - info->stackBytesToClear, 0, info->stackBytesToClear, "HLEStackClear");
+		}
+	}
+
+	if ((flags & HLE_NOT_DISPATCH_SUSPENDED) && !__KernelIsDispatchEnabled()) {
+		RETURN(hleLogDebug(Log::HLE, SCE_KERNEL_ERROR_CAN_NOT_WAIT, "dispatch suspended"));
+	} else if ((flags & HLE_NOT_IN_INTERRUPT) && __IsInInterrupt()) {
+		RETURN(hleLogDebug(Log::HLE, SCE_KERNEL_ERROR_ILLEGAL_CONTEXT, "in interrupt"));
+	} else {
+		info->func();
+	}
+
+	if (hleAfterSyscall != HLE_AFTER_NOTHING)
+		hleFinishSyscall(*info);
+	else
+		SetDeadbeefRegs();
+}
+
+// Fully specialized thunk - both the wrapper and the flags are compile-time, so the call
+// into the HLE function is direct. Only possible where the function is visible from this
+// file; most HLE functions are static to their module.
+template <void (*func)(), u32 flags>
+void CallSyscallDirect(const HLEFunction *info)
+{
+	latestSyscall = info;
+	latestSyscallPC = currentMIPS->pc;
+
+	if ((flags & HLE_NOT_DISPATCH_SUSPENDED) && !__KernelIsDispatchEnabled()) {
+		RETURN(hleLogDebug(Log::HLE, SCE_KERNEL_ERROR_CAN_NOT_WAIT, "dispatch suspended"));
+	} else if ((flags & HLE_NOT_IN_INTERRUPT) && __IsInInterrupt()) {
+		RETURN(hleLogDebug(Log::HLE, SCE_KERNEL_ERROR_ILLEGAL_CONTEXT, "in interrupt"));
+	} else {
+		func();
+	}
+
+	if (hleAfterSyscall != HLE_AFTER_NOTHING)
+		hleFinishSyscall(*info);
+	else
+		SetDeadbeefRegs();
+}
+
 const HLEFunction *GetSyscallFuncPointer(MIPSOpcode op)
 {
 	u32 callno = (op >> 6) & 0xFFFFF; //20 bits
@@ -696,8 +749,23 @@ void *GetQuickSyscallFunc(MIPSOpcode op) {
 	// TODO: Do this with a flag?
 	if (op == idleOp)
 		return (void *)info->func;
-	if (info->flags != 0)
+
+	// Only these flags affect the call itself - the rest matter at link time.
+	constexpr u32 callFlagsMask = HLE_CLEAR_STACK_BYTES | HLE_NOT_DISPATCH_SUSPENDED | HLE_NOT_IN_INTERRUPT;
+	constexpr u32 waitFlags = HLE_NOT_DISPATCH_SUSPENDED | HLE_NOT_IN_INTERRUPT;
+	const u32 callFlags = info->flags & callFlagsMask;
+
+	// sceKernelDelayThread is hot enough (games idle through it) to deserve a direct thunk.
+	if (info->func == &WrapI_U<sceKernelDelayThread> && callFlags == waitFlags)
+		return (void *)&CallSyscallDirect<&WrapI_U<sceKernelDelayThread>, waitFlags>;
+
+	if (info->flags != 0) {
+		// The wait-style syscalls (vblank waits, delays, sync waits) share this
+		// combination, so bake the checks in for them.
+		if (callFlags == waitFlags)
+			return (void *)&CallSyscallWithFlagsSpec<waitFlags>;
 		return (void *)&CallSyscallWithFlags;
+	}
 	return (void *)&CallSyscallWithoutFlags;
 }
 
@@ -494,6 +494,130 @@ static int Replace_strncmp() {
 	return 10 + bytes / 4;  // approximation
 }
 
+static int Replace_memcmp() {
+	u32 bytes = PARAM(2);
+	const u8 *a = Memory::GetPointerRange(PARAM(0), bytes);
+	const u8 *b = Memory::GetPointerRange(PARAM(1), bytes);
+	if (a && b && bytes != 0) {
+		RETURN(memcmp(a, b, bytes));
+	} else {
+		RETURN(0);
+	}
+	return 10 + bytes / 4;  // approximation
+}
+
+static int Replace_memchr() {
+	u32 ptr = PARAM(0);
+	u32 c = PARAM(1) & 0xFF;
+	u32 bytes = PARAM(2);
+	const u8 *p = Memory::GetPointerRange(ptr, bytes);
+	if (p && bytes != 0) {
+		const u8 *result = (const u8 *)memchr(p, c, bytes);
+		RETURN(result ? ptr + (u32)(result - p) : 0);
+	} else {
+		RETURN(0);
+	}
+	return 10 + bytes / 4;  // approximation
+}
+
+static int Replace_strcat() {
+	u32 destPtr = PARAM(0);
+	u32 srcPtr = PARAM(1);
+	u32 destLen = SafeStringLen(destPtr);
+	u32 srcLen = SafeStringLen(srcPtr);
+	char *dst = (char *)Memory::GetPointerWriteRange(destPtr, destLen + srcLen + 1);
+	const char *src = (const char *)Memory::GetPointerRange(srcPtr, srcLen + 1);
+	if (dst && src && srcLen != 0) {
+		memcpy(dst + destLen, src, srcLen + 1);
+	}
+	RETURN(destPtr);
+	return 10 + (destLen + srcLen) / 4;  // approximation
+}
+
+static int Replace_strchr() {
+	u32 srcPtr = PARAM(0);
+	u32 c = PARAM(1) & 0xFF;
+	u32 len = SafeStringLen(srcPtr);
+	// Search one past the length so searching for the terminator works too.
+	const char *src = (const char *)Memory::GetPointerRange(srcPtr, len + 1);
+	if (src) {
+		const char *result = (const char *)memchr(src, c, len + 1);
+		RETURN(result ? srcPtr + (u32)(result - src) : 0);
+	} else {
+		RETURN(0);
+	}
+	return 10 + len / 4;  // approximation
+}
+
+static int Replace_strrchr() {
+	u32 srcPtr = PARAM(0);
+	u32 c = PARAM(1) & 0xFF;
+	u32 len = SafeStringLen(srcPtr);
+	const char *src = (const char *)Memory::GetPointerRange(srcPtr, len + 1);
+	u32 result = 0;
+	if (src) {
+		for (int i = (int)len; i >= 0; --i) {
+			if ((u8)src[i] == c) {
+				result = srcPtr + i;
+				break;
+			}
+		}
+	}
+	RETURN(result);
+	return 10 + len / 4;  // approximation
+}
+
+static int Replace_strstr() {
+	u32 haystackPtr = PARAM(0);
+	u32 needlePtr = PARAM(1);
+	u32 haystackLen = SafeStringLen(haystackPtr);
+	u32 needleLen = SafeStringLen(needlePtr);
+	const char *haystack = (const char *)Memory::GetPointerRange(haystackPtr, haystackLen);
+	const char *needle = (const char *)Memory::GetPointerRange(needlePtr, needleLen);
+	if (needleLen == 0) {
+		// An empty needle always matches at the start.
+		RETURN(haystackPtr);
+	} else if (haystack && needle) {
+		const char *result = std::search(haystack, haystack + haystackLen, needle, needle + needleLen);
+		RETURN(result != haystack + haystackLen ? haystackPtr + (u32)(result - haystack) : 0);
+	} else {
+		RETURN(0);
+	}
+	return 10 + haystackLen / 4;  // approximation
+}
+
+static int Replace_strcspn() {
+	u32 srcPtr = PARAM(0);
+	u32 rejectPtr = PARAM(1);
+	u32 srcLen = SafeStringLen(srcPtr);
+	u32 rejectLen = SafeStringLen(rejectPtr);
+	const char *src = (const char *)Memory::GetPointerRange(srcPtr, srcLen);
+	const char *reject = (const char *)Memory::GetPointerRange(rejectPtr, rejectLen);
+	if (src && srcLen != 0) {
+		// Stay within the validated ranges instead of calling the libc version.
+		const char *end = src + srcLen;
+		const char *result = reject && rejectLen != 0 ? std::find_first_of(src, end, reject, reject + rejectLen) : end;
+		RETURN((u32)(result - src));
+	} else {
+		RETURN(0);
+	}
+	return 10 + srcLen / 4;  // approximation
+}
+
+static int Replace_strncasecmp() {
+	u32 bytes = PARAM(2);
+	u32 aLen = SafeStringLen(PARAM(0), bytes);
+	const char *a = (const char *)Memory::GetPointerRange(PARAM(0), aLen == 0 ? bytes : aLen);
+	u32 bLen = SafeStringLen(PARAM(1), bytes);
+	const char *b = (const char *)Memory::GetPointerRange(PARAM(1), bLen == 0 ? bytes : bLen);
+	if (a && b && bytes != 0) {
+		RETURN(strncasecmp(a, b, bytes));
+	} else {
+		RETURN(0);
+	}
+	return 10 + bytes / 4;  // approximation
+}
+
 static int Replace_fabsf() {
 	RETURNF(fabsf(PARAMF(0)));
 	return 4;
@@ -1512,6 +1636,17 @@ static const ReplacementTableEntry entries[] = {
 	{ "strncpy", &Replace_strncpy, 0, REPFLAG_DISABLED },
 	{ "strcmp", &Replace_strcmp, 0, REPFLAG_DISABLED },
 	{ "strncmp", &Replace_strncmp, 0, REPFLAG_DISABLED },
+	// Disabled by default like the rest of the string routines - hash matches
+	// occasionally hit SDK variants with subtly different behavior. The coverage
+	// report (LogReplacementCoverage) still counts them so we know what a game would use.
+	{ "memcmp", &Replace_memcmp, 0, REPFLAG_DISABLED },
+	{ "memchr", &Replace_memchr, 0, REPFLAG_DISABLED },
+	{ "strcat", &Replace_strcat, 0, REPFLAG_DISABLED },
+	{ "strchr", &Replace_strchr, 0, REPFLAG_DISABLED },
+	{ "strrchr", &Replace_strrchr, 0, REPFLAG_DISABLED },
+	{ "strstr", &Replace_strstr, 0, REPFLAG_DISABLED },
+	{ "strcspn", &Replace_strcspn, 0, REPFLAG_DISABLED },
+	{ "strncasecmp", &Replace_strncasecmp, 0, REPFLAG_DISABLED },
 	{ "fabsf", &Replace_fabsf, JITFUNC(Replace_fabsf), REPFLAG_ALLOWINLINE | REPFLAG_DISABLED },
 	{ "dl_write_matrix", &Replace_dl_write_matrix, 0, REPFLAG_DISABLED }, // &MIPSComp::Jit::Replace_dl_write_matrix, REPFLAG_DISABLED },
 	{ "dl_write_matrix_2", &Replace_dl_write_matrix, 0, REPFLAG_DISABLED },
@@ -1606,21 +1741,53 @@ static const ReplacementTableEntry entries[] = {
 
 static std::map<u32, u32> replacedInstructions;
 static std::unordered_map<std::string, std::vector<int> > replacementNameLookup;
+static std::unordered_map<std::string, std::vector<int> > disabledNameLookup;
+
+// Per-game coverage stats: how many addresses each entry replaced, and how many
+// times a hash matched an entry that's disabled.
+static int replacementHits[ARRAY_SIZE(entries)];
+static int replacementDisabledHits[ARRAY_SIZE(entries)];
 
 void Replacement_Init() {
 	for (int i = 0; i < (int)ARRAY_SIZE(entries); i++) {
 		const auto entry = &entries[i];
-		if (!entry->name || (entry->flags & REPFLAG_DISABLED) != 0)
+		if (!entry->name)
 			continue;
+		if ((entry->flags & REPFLAG_DISABLED) != 0) {
+			disabledNameLookup[entry->name].push_back(i);
+			continue;
+		}
 		replacementNameLookup[entry->name].push_back(i);
 	}
 
+	memset(replacementHits, 0, sizeof(replacementHits));
+	memset(replacementDisabledHits, 0, sizeof(replacementDisabledHits));
 	skipGPUReplacements = 0;
 }
 
+void LogReplacementCoverage() {
+	int found = 0;
+	for (int i = 0; i < (int)ARRAY_SIZE(entries); i++) {
+		if (replacementHits[i] != 0) {
+			INFO_LOG(Log::HLE, "Func replacement: %s replaced at %d address(es)", entries[i].name, replacementHits[i]);
+			++found;
+		}
+		if (replacementDisabledHits[i] != 0) {
+			INFO_LOG(Log::HLE, "Func replacement: %s recognized %d time(s) but disabled", entries[i].name, replacementDisabledHits[i]);
+			++found;
+		}
+	}
+	if (found == 0) {
+		INFO_LOG(Log::HLE, "Func replacement: no recognized functions in this game");
+	}
+}
+
 void Replacement_Shutdown() {
+	LogReplacementCoverage();
+
 	replacedInstructions.clear();
 	replacementNameLookup.clear();
+	disabledNameLookup.clear();
 }
 
 int GetNumReplacementFuncs() {
@@ -1638,6 +1805,13 @@ std::vector<int> GetReplacementFuncIndexes(u64 hash, int funcSize) {
 	if (index != replacementNameLookup.end()) {
 		return index->second;
 	}
+	// Keep score of recognized-but-disabled funcs too, for the coverage report.
+	auto disabled = disabledNameLookup.find(name);
+	if (disabled != disabledNameLookup.end()) {
+		for (int i : disabled->second) {
+			replacementDisabledHits[i]++;
+		}
+	}
 	return emptyResult;
 }
 
@@ -1694,6 +1868,7 @@ void WriteReplaceInstructions(u32 address, u64 hash, int size) {
 		}
 
 		if (didReplace) {
+			replacementHits[index]++;
 			INFO_LOG(Log::HLE, "Replaced %s at %08x with hash %016llx", entries[index].name, address, hash);
 		}
 	}
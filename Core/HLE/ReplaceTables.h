@@ -64,6 +64,9 @@ struct ReplacementTableEntry {
 void Replacement_Init();
 void Replacement_Shutdown();
 
+// Logs which recognized funcs this game hit (also called on shutdown.)
+void LogReplacementCoverage();
+
 int GetNumReplacementFuncs();
 std::vector<int> GetReplacementFuncIndexes(u64 hash, int funcSize);
 const ReplacementTableEntry *GetReplacementFunc(size_t index);
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "Common/BitScan.h"
 #include "Core/HLE/sceKernel.h"
 #include "Common/Serialize/Serializer.h"
 
@@ -51,6 +52,7 @@ struct ThreadQueueList {
 
 	ThreadQueueList() {
 		memset(queues, 0, sizeof(queues));
+		memset(readyBits, 0, sizeof(readyBits));
 		first = invalid();
 	}
 
@@ -75,36 +77,41 @@ struct ThreadQueueList {
 	}
 
 	inline SceUID pop_first() {
-		Queue *cur = first;
-		while (cur != invalid()) {
-			if (cur->size() > 0)
-				return cur->data[cur->first++];
-			cur = cur->next;
-		}
+		// The bitmap jumps straight to the best ready priority - no need to walk
+		// long-dead queues during wakeup storms.
+		if (readyBits[0] != 0)
+			return pop_ready(ctz64_nonzero(readyBits[0]));
+		if (readyBits[1] != 0)
+			return pop_ready(64 + ctz64_nonzero(readyBits[1]));
 
 		_dbg_assert_msg_(false, "ThreadQueueList should not be empty.");
 		return 0;
 	}
 
 	inline SceUID pop_first_better(u32 priority) {
-		Queue *cur = first;
 		// Don't bother looking past (worse than) this priority.
-		Queue *stop = &queues[priority];
-		while (cur < stop) {
-			if (cur->size() > 0)
-				return cur->data[cur->first++];
-			cur = cur->next;
+		u64 bits = readyBits[0];
+		if (priority < 64)
+			bits &= ((u64)1 << priority) - 1;
+		if (bits != 0)
+			return pop_ready(ctz64_nonzero(bits));
+		if (priority > 64) {
+			bits = readyBits[1] & (((u64)1 << (priority - 64)) - 1);
+			if (bits != 0)
+				return pop_ready(64 + ctz64_nonzero(bits));
 		}
 
 		return 0;
 	}
 
 	inline SceUID peek_first() {
-		Queue *cur = first;
-		while (cur != invalid()) {
-			if (cur->size() > 0)
-				return cur->data[cur->first];
-			cur = cur->next;
+		if (readyBits[0] != 0) {
+			const Queue &cur = queues[ctz64_nonzero(readyBits[0])];
+			return cur.data[cur.first];
+		}
+		if (readyBits[1] != 0) {
+			const Queue &cur = queues[64 + ctz64_nonzero(readyBits[1])];
+			return cur.data[cur.first];
 		}
 
 		return 0;
@@ -113,6 +120,7 @@ struct ThreadQueueList {
 	inline void push_front(u32 priority, const SceUID threadID) {
 		Queue *cur = &queues[priority];
 		cur->data[--cur->first] = threadID;
+		mark_ready(priority);
 		// If we ran out of room toward the front, add more room for next time.
 		if (cur->first == 0)
 			rebalance(priority);
@@ -121,6 +129,7 @@ struct ThreadQueueList {
 	inline void push_back(u32 priority, const SceUID threadID) {
 		Queue *cur = &queues[priority];
 		cur->data[cur->end++] = threadID;
+		mark_ready(priority);
 		if (cur->full())
 			rebalance(priority);
 	}
@@ -139,6 +148,8 @@ struct ThreadQueueList {
 
 				// Now we're one shorter.
 				--cur->end;
+				if (cur->empty())
+					mark_empty(priority);
 				return;
 			}
 		}
@@ -163,6 +174,7 @@ struct ThreadQueueList {
 			free(queues[i].data);
 		}
 		memset(queues, 0, sizeof(queues));
+		memset(readyBits, 0, sizeof(readyBits));
 		first = invalid();
 	}
 
@@ -207,6 +219,8 @@ struct ThreadQueueList {
 				link(i, capacity);
 				cur->first = (cur->capacity - size) / 2;
 				cur->end = cur->first + size;
+				if (size != 0)
+					mark_ready(i);
 			}
 
 			if (size != 0)
@@ -219,6 +233,23 @@ private:
 		return (Queue *)-1;
 	}
 
+	inline void mark_ready(u32 priority) {
+		readyBits[priority >> 6] |= (u64)1 << (priority & 63);
+	}
+
+	inline void mark_empty(u32 priority) {
+		readyBits[priority >> 6] &= ~((u64)1 << (priority & 63));
+	}
+
+	// Pop the front thread of a queue known to be non-empty.
+	inline SceUID pop_ready(u32 priority) {
+		Queue *cur = &queues[priority];
+		SceUID threadID = cur->data[cur->first++];
+		if (cur->empty())
+			mark_empty(priority);
+		return threadID;
+	}
+
 	// Initialize a priority level and link to other queues.
 	void link(u32 priority, int size) {
 		_dbg_assert_msg_(queues[priority].data == nullptr, "ThreadQueueList::Queue should only be initialized once.");
@@ -283,6 +314,8 @@ private:
 
 	// The first queue that's ever been used.
 	Queue *first;
+	// One ready bit per priority level, so the best non-empty queue is a ctz away.
+	u64 readyBits[NUM_QUEUES / 64];
 	// The priority level queues of thread ids.
 	Queue queues[NUM_QUEUES];
 };
@@ -29,6 +29,14 @@
 #include <emmintrin.h>
 #endif
 
+#if PPSSPP_ARCH(ARM_NEON)
+#if defined(_MSC_VER) && PPSSPP_ARCH(ARM64)
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif // PPSSPP_ARCH(ARM_NEON)
+
 #include "Core/Config.h"
 #include "Core/CoreTiming.h"
 #include "Core/MemMapHelpers.h"
@@ -54,6 +62,9 @@ std::atomic_flag atomicLock_;
 // Might try something more efficient later.
 FixedSizeQueue<s16, 32768 * 8> chanSampleQueues[PSP_AUDIO_CHANNEL_MAX + 1];
 
+// Per-channel underrun counters for the audio debug overlay. Not savestated, debug only.
+static int chanUnderrunCount[PSP_AUDIO_CHANNEL_MAX + 1];
+
 int eventAudioUpdate = -1;
 
 // TODO: This is now useless and should be removed. Just scared of breaking states.
@@ -116,6 +127,7 @@ void __AudioInit() {
 	for (u32 i = 0; i < PSP_AUDIO_CHANNEL_MAX + 1; i++) {
 		chans[i].index = i;
 		chans[i].clear();
+		chanUnderrunCount[i] = 0;
 	}
 
 	mixBuffer = new s32[hwBlockSize * 2];
@@ -326,6 +338,65 @@ void __AudioSetSRCFrequency(int freq) {
 	srcFrequency = freq;
 }
 
+// dst = src, widening to s32. The SSE2 sign extension uses the srai/unpack trick.
+static void MixDownCopy(s32 *dst, const s16 *src, size_t count) {
+	size_t s = 0;
+#ifdef _M_SSE
+	for (; s + 8 <= count; s += 8) {
+		__m128i in = _mm_loadu_si128((const __m128i *)&src[s]);
+		__m128i sign = _mm_srai_epi16(in, 15);
+		_mm_storeu_si128((__m128i *)&dst[s], _mm_unpacklo_epi16(in, sign));
+		_mm_storeu_si128((__m128i *)&dst[s + 4], _mm_unpackhi_epi16(in, sign));
+	}
+#elif PPSSPP_ARCH(ARM_NEON)
+	for (; s + 8 <= count; s += 8) {
+		int16x8_t in = vld1q_s16(&src[s]);
+		vst1q_s32(&dst[s], vmovl_s16(vget_low_s16(in)));
+		vst1q_s32(&dst[s + 4], vmovl_s16(vget_high_s16(in)));
+	}
+#endif
+	for (; s < count; s++)
+		dst[s] = src[s];
+}
+
+// dst += src, widening to s32.
+static void MixDownAdd(s32 *dst, const s16 *src, size_t count) {
+	size_t s = 0;
+#ifdef _M_SSE
+	for (; s + 8 <= count; s += 8) {
+		__m128i in = _mm_loadu_si128((const __m128i *)&src[s]);
+		__m128i sign = _mm_srai_epi16(in, 15);
+		__m128i lo = _mm_add_epi32(_mm_loadu_si128((const __m128i *)&dst[s]), _mm_unpacklo_epi16(in, sign));
+		__m128i hi = _mm_add_epi32(_mm_loadu_si128((const __m128i *)&dst[s + 4]), _mm_unpackhi_epi16(in, sign));
+		_mm_storeu_si128((__m128i *)&dst[s], lo);
+		_mm_storeu_si128((__m128i *)&dst[s + 4], hi);
+	}
+#elif PPSSPP_ARCH(ARM_NEON)
+	for (; s + 8 <= count; s += 8) {
+		int16x8_t in = vld1q_s16(&src[s]);
+		vst1q_s32(&dst[s], vaddw_s16(vld1q_s32(&dst[s]), vget_low_s16(in)));
+		vst1q_s32(&dst[s + 4], vaddw_s16(vld1q_s32(&dst[s + 4]), vget_high_s16(in)));
+	}
+#endif
+	for (; s < count; s++)
+		dst[s] += src[s];
+}
+
+void __AudioGetDebugStats(char *buf, size_t bufSize) {
+	char *p = buf;
+	char *end = buf + bufSize;
+	p += snprintf(p, end - p, "\nHLE audio channels:\n");
+	for (u32 i = 0; i < PSP_AUDIO_CHANNEL_MAX + 1 && p < end - 1; i++) {
+		if (!chans[i].reserved)
+			continue;
+		const char *label = (int)i == PSP_AUDIO_CHANNEL_SRC ? " (SRC/output2)" : "";
+		p += snprintf(p, end - p, "%2d%s: %d/%d frames, %d underruns\n",
+			i, label,
+			(int)chanSampleQueues[i].size() / 2, (int)chanSampleQueues[i].capacity() / 2,
+			chanUnderrunCount[i]);
+	}
+}
+
 // Mix samples from the various audio channels into a single sample queue, managed by the backend implementation.
 void __AudioUpdate(bool resetRecording) {
 	// AUDIO throttle doesn't really work on the PSP since the mixing intervals are so closely tied
@@ -348,6 +419,7 @@ void __AudioUpdate(bool resetRecording) {
 		bool needsResample = i == PSP_AUDIO_CHANNEL_SRC && srcFrequency != 0 && srcFrequency != mixFrequency;
 		size_t sz = needsResample ? (srcBufferSize * srcFrequency) / mixFrequency : srcBufferSize;
 		if (sz > chanSampleQueues[i].size()) {
+			chanUnderrunCount[i]++;
 			ERROR_LOG(Log::sceAudio, "Channel %i buffer underrun at %i of %i", i, (int)chanSampleQueues[i].size() / 2, (int)sz / 2);
 		}
 
@@ -393,21 +465,15 @@ void __AudioUpdate(bool resetRecording) {
 		}
 
 		if (firstChannel) {
-			for (size_t s = 0; s < sz1; s++)
-				mixBuffer[s] = buf1[s];
+			MixDownCopy(mixBuffer, buf1, sz1);
 			if (buf2) {
-				for (size_t s = 0; s < sz2; s++)
-					mixBuffer[s + sz1] = buf2[s];
+				MixDownCopy(mixBuffer + sz1, buf2, sz2);
 			}
 			firstChannel = false;
 		} else {
-			// Surprisingly hard to SIMD efficiently on SSE2 due to lack of 16-to-32-bit sign extension. NEON should be straight-forward though, and SSE4.1 can do it nicely.
-			// Actually, the cmple/pack trick should work fine...
-			for (size_t s = 0; s < sz1; s++)
-				mixBuffer[s] += buf1[s];
+			MixDownAdd(mixBuffer, buf1, sz1);
 			if (buf2) {
-				for (size_t s = 0; s < sz2; s++)
-					mixBuffer[s + sz1] += buf2[s];
+				MixDownAdd(mixBuffer + sz1, buf2, sz2);
 			}
 		}
 	}
@@ -41,6 +41,9 @@ void __AudioShutdown();
 void __AudioSetOutputFrequency(int freq);
 void __AudioSetSRCFrequency(int freq);
 
+// Appends per-channel fill levels and underrun counts, for the audio debug overlay.
+void __AudioGetDebugStats(char *buf, size_t bufSize);
+
 // May return SCE_ERROR_AUDIO_CHANNEL_BUSY if buffer too large
 u32 __AudioEnqueue(AudioChannel &chan, int chanNum, bool blocking);
 void __AudioWakeThreads(AudioChannel &chan, int result, int step);
@@ -31,6 +31,7 @@
 #if !defined(_WIN32)
 #include <unistd.h>
 #include <netinet/tcp.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -88,6 +89,7 @@
 
 uint16_t portOffset;
 uint32_t minSocketTimeoutUS;
+uint32_t adhocRecvLatencyUS           = 0;
 uint32_t fakePoolSize                 = 0;
 SceNetAdhocMatchingContext * contexts = NULL;
 char* dummyPeekBuf64k                 = NULL;
@@ -307,36 +309,39 @@ SceNetAdhocctlPeerInfo* findFriendByIP(uint32_t ip) {
 }
 
 int IsSocketReady(int fd, bool readfd, bool writefd, int* errorcode, int timeoutUS) {
-	fd_set readfds, writefds;
-	timeval tval;
-
 	// Avoid getting Fatal signal 6 (SIGABRT) on linux/android
 	if (fd < 0) {
 		if (errorcode != nullptr)
 			*errorcode = EBADF;
 		return SOCKET_ERROR;
 	}
-#if !defined(_WIN32)
-	if (fd >= FD_SETSIZE) {
-		if (errorcode != nullptr)
-			*errorcode = EBADF;
-		return SOCKET_ERROR;
-	}
-#endif
 
-	FD_ZERO(&readfds);
-	writefds = readfds;
-	if (readfd) {	
-		FD_SET(fd, &readfds);
+	// Implemented on poll/WSAPoll rather than select - one syscall covers both
+	// directions, and there's no FD_SETSIZE limit to trip over when the host app
+	// has lots of files open (easy to hit on linux/android where it's 1024).
+#if defined(_WIN32)
+	WSAPOLLFD pfd{};
+#else
+	pollfd pfd{};
+#endif
+	pfd.fd = fd;
+	if (readfd) {
+		pfd.events |= POLLIN;
 	}
-	if (writefd) {	
-		FD_SET(fd, &writefds);
+	if (writefd) {
+		pfd.events |= POLLOUT;
 	}
-	tval.tv_sec = timeoutUS / 1000000;
-	tval.tv_usec = timeoutUS % 1000000;
+	// Round sub-millisecond timeouts up so we don't turn short waits into busy polls.
+	int timeoutMS = timeoutUS > 0 ? (timeoutUS + 999) / 1000 : 0;
 
-	// Note: select will flags an unconnected TCP socket (ie. a freshly created socket without connecting first, or when connect failed with ECONNREFUSED on linux) as writeable/readable, thus can't be used to tell whether the connection has established or not.
-	int ret = select(fd + 1, readfd? &readfds: nullptr, writefd? &writefds: nullptr, nullptr, &tval);
+	// Note: like select, a poll-based readiness check can't reliably tell whether a
+	// non-blocking connect has established yet (failed connects may flag the socket
+	// readable/writeable, and old Windows versions don't report POLLERR for them).
+#if defined(_WIN32)
+	int ret = WSAPoll(&pfd, 1, timeoutMS);
+#else
+	int ret = poll(&pfd, 1, timeoutMS);
+#endif
 	if (errorcode != nullptr)
 		*errorcode = (ret < 0? errno: 0);
 
@@ -1494,6 +1499,20 @@ int friendFinder(){
 					//printf("Received %d Bytes of Data from Server\n", received);
 					INFO_LOG(Log::sceNet, "Received %d Bytes of Data from Adhoc Server", received);
 				}
+				else if (received == 0) {
+					// Server closed the connection gracefully. Without handling this, the socket
+					// stays readable forever and we'd spin until the next ping notices the error.
+					ERROR_LOG(Log::sceNet, "FriendFinder: Adhoc Server closed the connection");
+					networkInited = false;
+					shutdown((int)metasocket, SD_BOTH);
+					closesocket((int)metasocket);
+					metasocket = (int)INVALID_SOCKET;
+					g_OSD.Show(OSDType::MESSAGE_ERROR, std::string(n->T("Disconnected from AdhocServer")));
+					// Mark all friends as timedout since we won't be able to detects disconnected friends anymore without being connected to Adhoc Server
+					peerlock.lock();
+					timeoutFriendsRecursive(friends);
+					peerlock.unlock();
+				}
 			}
 
 			// Calculate EnterGameMode Timeout to prevent waiting forever for disconnected players
@@ -1780,7 +1799,13 @@ int friendFinder(){
 			}
 		}
 		// This delay time should be 100ms when there is an event otherwise 500ms ?
-		sleep_ms(10); // Using 1ms for faster response just like AdhocServer?
+		if (networkInited && metasocket != (int)INVALID_SOCKET) {
+			// Sleep on the socket instead of a plain delay, so incoming server data
+			// gets handled immediately instead of on the next 10ms tick.
+			IsSocketReady((int)metasocket, true, false, nullptr, 10000);
+		} else {
+			sleep_ms(10); // Using 1ms for faster response just like AdhocServer?
+		}
 
 		// Don't do anything if it's paused, otherwise the log will be flooded
 		while (Core_IsStepping() && coreState != CORE_POWERDOWN && friendFinderRunning) sleep_ms(10);
@@ -936,6 +936,7 @@ union SockAddrIN4 {
 
 extern uint16_t portOffset;
 extern uint32_t minSocketTimeoutUS;
+extern uint32_t adhocRecvLatencyUS; // Delivery latency floor for blocking recv, see AdhocLatency in config (0 = off)
 extern bool isOriPort;
 extern bool isLocalServer;
 extern SockAddrIN4 g_adhocServerIP; // Resolved Adhoc Server IP so we don't need to repeatedly resolve the DNS again later
@@ -21,6 +21,8 @@
 #include "Common/Serialize/Serializer.h"
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Common/Math/math_util.h"
+#include "Common/System/System.h"
+#include "Core/Config.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HLE/FunctionWrappers.h"
@@ -305,6 +307,12 @@ static int __CtrlReadBuffer(u32 ctrlDataPtr, u32 nBufs, bool negative, bool peek
 
 static void __CtrlDoSample()
 {
+	// Optional late poll: pump the host's polled controllers right before latching, so the
+	// sampled state is as fresh as possible. Ignored on platforms where input is purely
+	// event-driven - this only helps where controllers are polled on a timer (Windows).
+	if (g_Config.bInputLatePoll)
+		System_Notify(SystemNotification::POLL_CONTROLLERS);
+
 	// This samples the ctrl data into the buffers and updates the latch.
 	__CtrlUpdateLatch();
 
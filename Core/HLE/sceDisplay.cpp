@@ -49,6 +49,7 @@
 #include "Core/HLE/sceKernelThread.h"
 #include "Core/HLE/sceKernelInterrupt.h"
 #include "Core/HW/Display.h"
+#include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/Util/PPGeDraw.h"
 #include "Core/RetroAchievements.h"
 
@@ -58,6 +59,7 @@
 #include "GPU/Common/FramebufferManagerCommon.h"
 #include "GPU/Common/PostShader.h"
 #include "GPU/Debugger/Record.h"
+#include "GPU/Debugger/StatsProfile.h"
 
 struct FrameBufferState {
 	u32 topaddr;
@@ -115,6 +117,9 @@ static double timePerVblank;
 static double curFrameTime;
 static double lastFrameTime;
 static double nextFrameTime;
+// Audio-sync sleep time since the last flip, subtracted from the measured frame cost so the
+// predictive frameskip governor doesn't mistake idling for work.
+static double frameIdleSlept;
 static int numVBlanksSinceFlip;
 
 const int PSP_DISPLAY_MODE_LCD = 0;
@@ -205,6 +210,7 @@ void __DisplayInit() {
 	curFrameTime = 0.0;
 	nextFrameTime = 0.0;
 	lastFrameTime = 0.0;
+	frameIdleSlept = 0.0;
 
 	__KernelRegisterWaitTypeFuncs(WAITTYPE_VBLANK, __DisplayVblankBeginCallback, __DisplayVblankEndCallback);
 }
@@ -294,6 +300,7 @@ void __DisplayDoState(PointerWrap &p) {
 }
 
 void __DisplayShutdown() {
+	GPUStatsProfile::Shutdown();
 	DisplayHWShutdown();
 	vblankWaitingThreads.clear();
 }
@@ -406,14 +413,27 @@ static void DoFrameTiming(bool throttle, bool *skipFrame, float scaledTimestep,
 	if (lastFrameTime == 0.0 || wasPaused) {
 		nextFrameTime = time_now_d() + scaledTimestep;
 	} else {
+		// On displays running at a different rate than the content (high-refresh
+		// phones), snap the deadline to the refresh grid so the present cadence
+		// stays regular.
+		const double pacedTimestep = throttle ? g_frameTiming.GetVsyncAlignedTimestep(scaledTimestep) : scaledTimestep;
+
 		// Advance lastFrameTime by a constant amount each frame,
 		// but don't let it get too far behind as things can get very jumpy.
 		const double maxFallBehindFrames = 5.5;
 
-		nextFrameTime = std::max(lastFrameTime + scaledTimestep, time_now_d() - maxFallBehindFrames * scaledTimestep);
+		nextFrameTime = std::max(lastFrameTime + pacedTimestep, time_now_d() - maxFallBehindFrames * scaledTimestep);
 	}
+	// Before updating it, curFrameTime still holds the time we finished waiting last frame,
+	// so the difference is what the frame we just emulated actually cost us.
+	const double lastFrameWorkStart = curFrameTime;
 	curFrameTime = time_now_d();
 
+	if (lastFrameWorkStart != 0.0 && !wasPaused) {
+		DisplayNotifyFrameCost(curFrameTime - lastFrameWorkStart - frameIdleSlept, numSkippedFrames > 0);
+	}
+	frameIdleSlept = 0.0;
+
 	if (g_Config.bLogFrameDrops) {
 		DoFrameDropLogging(scaledTimestep);
 	}
@@ -425,6 +445,10 @@ static void DoFrameTiming(bool throttle, bool *skipFrame, float scaledTimestep,
 		// Argh, we are falling behind! Let's skip a frame and see if we catch up.
 		if (curFrameTime > nextFrameTime && doFrameSkip) {
 			*skipFrame = true;
+		} else if (doFrameSkip && DisplayPredictFrameOverBudget(scaledTimestep)) {
+			// Not late yet, but the rolling cost estimate says the next rendered frame
+			// won't fit in the budget - skip proactively to keep the cadence even.
+			*skipFrame = true;
 		}
 	} else if (frameSkipNum >= 1) {
 		// fixed frameskip
@@ -492,6 +516,8 @@ static void DoFrameIdleTiming() {
 #endif
 		}
 
+		frameIdleSlept += time_now_d() - before;
+
 		if ((DebugOverlay)g_Config.iDebugOverlay == DebugOverlay::FRAME_GRAPH || coreCollectDebugStats) {
 			DisplayNotifySleep(time_now_d() - before);
 		}
@@ -658,6 +684,8 @@ void __DisplayFlip(int cyclesLate) {
 
 	if (fbDirty) {
 		gpuStats.numFlips++;
+		// Sample the frame counters before Core_UpdateDebugStats resets them.
+		GPUStatsProfile::NotifyFlip();
 	}
 
 	bool throttle = FrameTimingThrottled();
@@ -707,6 +735,9 @@ void hleAfterFlip(u64 userdata, int cyclesLate) {
 
 	PPGeNotifyFrame();
 
+	// Drain a slice of any queued-up function precompilation (see MIPSAnalyst::PrecompileFunctions).
+	MIPSComp::ProcessCompileQueue();
+
 	// This seems like as good a time as any to check if the config changed.
 	if (lagSyncScheduled != UseLagSync()) {
 		ScheduleLagSync();
@@ -89,6 +89,8 @@
 #include "sceOpenPSID.h"
 #include "Core/Util/PPGeDraw.h"
 
+static void KernelObjectFreeListsClear();
+
 /*
 17: [MIPS32 R4K 00000000 ]: Loader: Type: 1 Vaddr: 00000000 Filesz: 2856816 Memsz: 2856816 
 18: [MIPS32 R4K 00000000 ]: Loader: Loadable Segment Copied to 0898dab0, size 002b9770
@@ -178,6 +180,7 @@ void __KernelShutdown()
 	INFO_LOG(Log::sceKernel, "Shutting down kernel - %i kernel objects alive", kernelObjects.GetCount());
 	hleCurrentThreadName = NULL;
 	kernelObjects.Clear();
+	KernelObjectFreeListsClear();
 
 	__OpenPSIDShutdown();
 	__UsbCamShutdown();
@@ -486,8 +489,50 @@ void KernelObject::GetQuickInfo(char *ptr, int size)
 	strcpy(ptr, "-");
 }
 
+// Size-bucketed freelists for kernel objects, to keep malloc/free off the syscall
+// path. Buckets are 64-byte steps, which covers everything up to PSPThread with its
+// register context; anything bigger falls through to the heap. Sized delete gets the
+// dynamic type's size since the destructor is virtual, so blocks always return to the
+// bucket they came from. Savestate loading goes through CreateByIDType and plain
+// delete, so it recycles through these automatically.
+static constexpr size_t kernelObjectBucketStep = 64;
+static constexpr int kernelObjectNumBuckets = 32;
+static std::vector<void *> kernelObjectFreeLists[kernelObjectNumBuckets];
+
+void *KernelObject::operator new(size_t size) {
+	const int bucket = (int)((size + kernelObjectBucketStep - 1) / kernelObjectBucketStep) - 1;
+	if (bucket >= kernelObjectNumBuckets)
+		return ::operator new(size);
+	auto &freeList = kernelObjectFreeLists[bucket];
+	if (!freeList.empty()) {
+		void *ptr = freeList.back();
+		freeList.pop_back();
+		return ptr;
+	}
+	return ::operator new((bucket + 1) * kernelObjectBucketStep);
+}
+
+void KernelObject::operator delete(void *ptr, size_t size) {
+	const int bucket = (int)((size + kernelObjectBucketStep - 1) / kernelObjectBucketStep) - 1;
+	if (bucket >= kernelObjectNumBuckets) {
+		::operator delete(ptr);
+		return;
+	}
+	kernelObjectFreeLists[bucket].push_back(ptr);
+}
+
+static void KernelObjectFreeListsClear() {
+	for (auto &freeList : kernelObjectFreeLists) {
+		for (void *ptr : freeList)
+			::operator delete(ptr);
+		freeList.clear();
+		freeList.shrink_to_fit();
+	}
+}
+
 KernelObjectPool::KernelObjectPool() {
 	memset(occupied, 0, sizeof(bool)*maxCount);
+	memset(typeIds, 0, sizeof(typeIds));
 	nextID = initialNextID;
 }
 
@@ -502,6 +547,7 @@ SceUID KernelObjectPool::Create(KernelObject *obj, int rangeBottom, int rangeTop
 			occupied[i] = true;
 			pool[i] = obj;
 			pool[i]->uid = i + handleOffset;
+			typeIds[i] = obj->GetIDType();
 			return i + handleOffset;
 		}
 	}
@@ -525,6 +571,7 @@ void KernelObjectPool::Clear() {
 			delete pool[i];
 		pool[i] = nullptr;
 		occupied[i] = false;
+		typeIds[i] = 0;
 	}
 	nextID = initialNextID;
 }
@@ -587,6 +634,9 @@ void KernelObjectPool::DoState(PointerWrap &p) {
 				return;
 
 			pool[i]->uid = i + handleOffset;
+			// Note: from the object, not the serialized type - Tlspl_v0 is stored under
+			// its old id but reports the current one.
+			typeIds[i] = pool[i]->GetIDType();
 		} else {
 			type = pool[i]->GetIDType();
 			Do(p, type);
@@ -419,6 +419,12 @@ public:
 	virtual int GetIDType() const = 0;
 	virtual void GetQuickInfo(char *ptr, int size);
 
+	// Kernel objects churn heavily in thread-heavy games (some create and destroy
+	// one per mutex/sema operation), so allocations come from size-bucketed
+	// freelists instead of the heap. Released in __KernelShutdown().
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr, size_t size);
+
 	// Implement the following in all subclasses:
 	// static u32 GetMissingErrorCode()
 	// static int GetStaticIDType()
@@ -446,6 +452,7 @@ public:
 		if (Get<T>(handle, error)) {
 			int index = handle - handleOffset;
 			occupied[index] = false;
+			typeIds[index] = 0;
 			delete pool[index];
 			pool[index] = nullptr;
 		}
@@ -456,26 +463,30 @@ public:
 
 	template <class T>
 	T* Get(SceUID handle, u32 &outError) {
-		if (handle < handleOffset || handle >= handleOffset+maxCount || !occupied[handle-handleOffset]) {
+		const int index = handle - handleOffset;
+		// Fast path: GetStaticIDType() is a per-type constant, so resolving a handle from
+		// an HLE wrapper is a bounds check and one compare against the stored type id -
+		// no need to chase the object's vtable. A free slot stores 0, which no type uses,
+		// so this covers occupancy too.
+		if (index >= 0 && index < maxCount && typeIds[index] == T::GetStaticIDType()) {
+			outError = SCE_KERNEL_ERROR_OK;
+			// Previously we had a dynamic_cast here, but since RTTI was disabled traditionally,
+			// it just acted as a static cast and everything worked. This means that we will never
+			// see the Wrong type object error below, but we'll just have to live with that danger.
+			return static_cast<T *>(pool[index]);
+		}
+		if (index < 0 || index >= maxCount || !occupied[index]) {
 			// Tekken 6 spams 0x80020001 gets wrong with no ill effects, also on the real PSP
 			if (handle != 0 && (u32)handle != 0x80020001) {
 				WARN_LOG(Log::sceKernel, "Kernel: Bad %s handle %d (%08x)", T::GetStaticTypeName(), handle, handle);
 			}
 			outError = T::GetMissingErrorCode();
 			return 0;
-		} else {
-			// Previously we had a dynamic_cast here, but since RTTI was disabled traditionally,
-			// it just acted as a static cast and everything worked. This means that we will never
-			// see the Wrong type object error below, but we'll just have to live with that danger.
-			T* t = static_cast<T*>(pool[handle - handleOffset]);
-			if (t == nullptr || t->GetIDType() != T::GetStaticIDType()) {
-				WARN_LOG(Log::sceKernel, "Kernel: Wrong object type for %d (%08x), was %s, should have been %s", handle, handle, t ? t->GetTypeName() : "null", T::GetStaticTypeName());
-				outError = T::GetMissingErrorCode();
-				return 0;
-			}
-			outError = SCE_KERNEL_ERROR_OK;
-			return t;
 		}
+		KernelObject *t = pool[index];
+		WARN_LOG(Log::sceKernel, "Kernel: Wrong object type for %d (%08x), was %s, should have been %s", handle, handle, t ? t->GetTypeName() : "null", T::GetStaticTypeName());
+		outError = T::GetMissingErrorCode();
+		return 0;
 	}
 
 	// ONLY use this when you KNOW the handle is valid.
@@ -538,6 +549,9 @@ private:
 	};
 	KernelObject *pool[maxCount];
 	bool occupied[maxCount];
+	// GetIDType() of each occupied slot (0 when free), so Get can type-check without
+	// touching the object. Rebuilt from the objects on savestate load.
+	int typeIds[maxCount];
 	int nextID;
 };
 
@@ -540,6 +540,56 @@ static void __KernelModuleInit()
 	actionAfterModule = __KernelRegisterActionType(AfterModuleEntryCall::Create);
 }
 
+// Module loading and unloading poke at guest code one word at a time - every
+// relocation and import stub write used to trigger its own InvalidateICache,
+// each taking the jit lock and walking the block map. Games that hot-swap
+// overlay modules issue thousands of these per load. While a batch is active
+// (ELF load, import resolution on state load, module cleanup), the writes just
+// record pending ranges, which are merged and swept once when the outermost
+// batch ends. Regions that never got compiled cost nothing in the sweep - the
+// block map walk comes up empty for them.
+static int moduleICacheBatchDepth = 0;
+static std::vector<std::pair<u32, u32>> moduleICachePendingRanges;
+
+static void ModuleFlushICacheRanges() {
+	std::sort(moduleICachePendingRanges.begin(), moduleICachePendingRanges.end());
+	u32 start = 0;
+	u32 end = 0;
+	for (const auto &range : moduleICachePendingRanges) {
+		if (range.first > end) {
+			if (end > start)
+				currentMIPS->InvalidateICache(start, end - start);
+			start = range.first;
+			end = range.second;
+		} else if (range.second > end) {
+			end = range.second;
+		}
+	}
+	if (end > start)
+		currentMIPS->InvalidateICache(start, end - start);
+	moduleICachePendingRanges.clear();
+}
+
+static void ModuleInvalidateICache(u32 address, u32 size) {
+	if (moduleICacheBatchDepth > 0) {
+		moduleICachePendingRanges.emplace_back(address, address + size);
+	} else {
+		currentMIPS->InvalidateICache(address, size);
+	}
+}
+
+class ModuleICacheBatch {
+public:
+	ModuleICacheBatch() {
+		++moduleICacheBatchDepth;
+	}
+	~ModuleICacheBatch() {
+		if (--moduleICacheBatchDepth == 0 && !moduleICachePendingRanges.empty()) {
+			ModuleFlushICacheRanges();
+		}
+	}
+};
+
 void __KernelModuleDoState(PointerWrap &p)
 {
 	auto s = p.Section("sceKernelModule", 1, 2);
@@ -555,6 +605,8 @@ void __KernelModuleDoState(PointerWrap &p)
 
 	if (p.mode == p.MODE_READ) {
 		u32 error;
+		// Reimporting rewrites every stub in every module - sweep once at the end.
+		ModuleICacheBatch batch;
 		// We process these late, since they depend on loadedModules for interlinking.
 		for (SceUID moduleId : loadedModules) {
 			PSPModule *module = kernelObjects.Get<PSPModule>(moduleId, error);
@@ -673,7 +725,7 @@ static void WriteVarSymbol(WriteVarSymbolState &state, u32 exportAddress, u32 re
 					// We add 1 in that case so that it ends up the right value.
 					u16 high = (full >> 16) + ((full & 0x8000) ? 1 : 0);
 					Memory::Write_U32((reloc.data & ~0xFFFF) | high, reloc.addr);
-					currentMIPS->InvalidateICache(reloc.addr, 4);
+					ModuleInvalidateICache(reloc.addr, 4);
 				}
 				state.lastHI16Processed = true;
 			}
@@ -688,7 +740,7 @@ static void WriteVarSymbol(WriteVarSymbolState &state, u32 exportAddress, u32 re
 	}
 
 	Memory::Write_U32(relocData, relocAddress);
-	currentMIPS->InvalidateICache(relocAddress, 4);
+	ModuleInvalidateICache(relocAddress, 4);
 }
 
 void ImportVarSymbol(WriteVarSymbolState &state, const VarSymbolImport &var) {
@@ -769,8 +821,11 @@ void ImportFuncSymbol(const FuncSymbolImport &func, bool reimporting, const char
 			WARN_LOG(Log::Loader, "Reimporting updated syscall %s", GetFuncName(func.moduleName, func.nid));
 		}
 		WriteSyscall(func.moduleName, func.nid, func.stubAddr);
-		currentMIPS->InvalidateICache(func.stubAddr, 8);
+		ModuleInvalidateICache(func.stubAddr, 8);
 		if (g_Config.bPreloadFunctions) {
+			// Can't leave the invalidation pending here, or the batch sweep would
+			// destroy the block we're about to precompile.
+			ModuleFlushICacheRanges();
 			MIPSAnalyst::PrecompileFunction(func.stubAddr, 8);
 		}
 		return;
@@ -790,8 +845,9 @@ void ImportFuncSymbol(const FuncSymbolImport &func, bool reimporting, const char
 					WARN_LOG_REPORT(Log::Loader, "Reimporting: func import %s/%08x changed", func.moduleName, func.nid);
 				}
 				WriteFuncStub(func.stubAddr, it->symAddr);
-				currentMIPS->InvalidateICache(func.stubAddr, 8);
+				ModuleInvalidateICache(func.stubAddr, 8);
 				if (g_Config.bPreloadFunctions) {
+					ModuleFlushICacheRanges();
 					MIPSAnalyst::PrecompileFunction(func.stubAddr, 8);
 				}
 				return;
@@ -809,7 +865,7 @@ void ImportFuncSymbol(const FuncSymbolImport &func, bool reimporting, const char
 	}
 	if (isKnownModule || !reimporting) {
 		WriteFuncMissingStub(func.stubAddr, func.nid);
-		currentMIPS->InvalidateICache(func.stubAddr, 8);
+		ModuleInvalidateICache(func.stubAddr, 8);
 	}
 }
 
@@ -832,8 +888,9 @@ void ExportFuncSymbol(const FuncSymbolExport &func) {
 			if (func.Matches(*it)) {
 				INFO_LOG(Log::Loader, "Resolving function %s/%08x", func.moduleName, func.nid);
 				WriteFuncStub(it->stubAddr, func.symAddr);
-				currentMIPS->InvalidateICache(it->stubAddr, 8);
+				ModuleInvalidateICache(it->stubAddr, 8);
 				if (g_Config.bPreloadFunctions) {
+					ModuleFlushICacheRanges();
 					MIPSAnalyst::PrecompileFunction(it->stubAddr, 8);
 				}
 			}
@@ -859,13 +916,15 @@ void UnexportFuncSymbol(const FuncSymbolExport &func) {
 			if (func.Matches(*it)) {
 				INFO_LOG(Log::Loader, "Unresolving function %s/%08x", func.moduleName, func.nid);
 				WriteFuncMissingStub(it->stubAddr, it->nid);
-				currentMIPS->InvalidateICache(it->stubAddr, 8);
+				ModuleInvalidateICache(it->stubAddr, 8);
 			}
 		}
 	}
 }
 
 void PSPModule::Cleanup() {
+	ModuleICacheBatch batch;
+
 	MIPSAnalyst::ForgetFunctions(textStart, textEnd);
 
 	loadedModules.erase(GetUID());
@@ -887,7 +946,7 @@ void PSPModule::Cleanup() {
 		Memory::Memset(nm.text_addr + nm.text_size, -1, nm.data_size + nm.bss_size, "ModuleClear");
 
 		// Let's also invalidate, just to make sure it's cleared out for any future data.
-		currentMIPS->InvalidateICache(memoryBlockAddr, memoryBlockSize);
+		ModuleInvalidateICache(memoryBlockAddr, memoryBlockSize);
 	}
 }
 
@@ -1004,6 +1063,8 @@ static bool IsHLEVersionedModule(const char *name) {
 }
 
 static bool KernelImportModuleFuncs(PSPModule *module, u32 *firstImportStubAddr, bool reimporting) {
+	ModuleICacheBatch batch;
+
 	struct PspLibStubEntry {
 		u32_le name;
 		u16_le version;
@@ -1248,6 +1309,8 @@ static void parsePrxLibInfo(const u8* ptr, u32 headerSize) {
 }
 
 static PSPModule *__KernelLoadELFFromPtr(const u8 *ptr, size_t elfSize, u32 loadAddress, bool fromTop, std::string *error_string, u32 *magic, u32 &error) {
+	ModuleICacheBatch batch;
+
 	PSPModule *module = new PSPModule();
 	kernelObjects.Create(module);
 	loadedModules.insert(module->GetUID());
@@ -198,6 +198,7 @@ void __NetInit() {
 	portOffset = g_Config.iPortOffset;
 	isOriPort = g_Config.bEnableUPnP && g_Config.bUPnPUseOriginalPort;
 	minSocketTimeoutUS = g_Config.iMinTimeout * 1000UL;
+	adhocRecvLatencyUS = g_Config.iAdhocLatency * 1000UL;
 
 	// Init Default AdhocServer struct
 	g_adhocServerIP.in.sin_family = AF_INET;
@@ -976,6 +976,20 @@ int DoBlockingAdhocPollSocket(AdhocSocketRequest& req, s64& result) {
 	return 0;
 }
 
+// Buffer-and-release traffic shaping: when AdhocLatency is configured, hold off
+// completing a blocking recv until the request is at least that old, so every peer
+// observes a consistent delivery latency regardless of how fast their host network
+// happens to be. Returns true while delivery should still be deferred.
+static bool DeferForRecvLatency(const AdhocSocketRequest &req) {
+	if (adhocRecvLatencyUS == 0)
+		return false;
+	u64 now = (u64)(time_now_d() * 1000000.0);
+	// Don't defer past the game's own timeout, let the normal handling report it.
+	if (req.timeout != 0 && now - req.startTime > req.timeout)
+		return false;
+	return now - req.startTime < adhocRecvLatencyUS;
+}
+
 static void __AdhocSocketNotify(u64 userdata, int cyclesLate) {
 	SceUID threadID = userdata >> 32;
 	int uid = (int)(userdata & 0xFFFFFFFF); // fd/socket id
@@ -1015,7 +1029,7 @@ static void __AdhocSocketNotify(u64 userdata, int cyclesLate) {
 		break;
 
 	case PDP_RECV:
-		if (DoBlockingPdpRecv(req, result)) {
+		if (DeferForRecvLatency(req) || DoBlockingPdpRecv(req, result)) {
 			// Try again in another 0.5ms until data available or timedout.
 			CoreTiming::ScheduleEvent(usToCycles(delayUS) - cyclesLate, adhocSocketNotifyEvent, userdata);
 			return;
@@ -1031,7 +1045,7 @@ static void __AdhocSocketNotify(u64 userdata, int cyclesLate) {
 		break;
 
 	case PTP_RECV:
-		if (DoBlockingPtpRecv(req, result)) {
+		if (DeferForRecvLatency(req) || DoBlockingPtpRecv(req, result)) {
 			// Try again in another 0.5ms until data available or timedout.
 			CoreTiming::ScheduleEvent(usToCycles(delayUS) - cyclesLate, adhocSocketNotifyEvent, userdata);
 			return;
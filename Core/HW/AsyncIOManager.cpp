@@ -39,13 +39,16 @@ bool AsyncIOManager::HasOperation(u32 handle) {
 	return false;
 }
 
-void AsyncIOManager::ScheduleOperation(const AsyncIOEvent &ev) {
+void AsyncIOManager::ScheduleOperation(AsyncIOEvent ev) {
 	{
 		std::lock_guard<std::mutex> guard(resultsLock_);
 		if (!resultsPending_.insert(ev.handle).second) {
 			ERROR_LOG_REPORT(Log::sceIo, "Scheduling operation for file %d while one is pending (type %d)", ev.handle, ev.type);
 		}
 	}
+	// Stamp with the current guest time (we're on the emu thread here) so the completion
+	// estimate is deterministic no matter how long the host I/O actually takes.
+	ev.startTicks = CoreTiming::GetTicks();
 	ScheduleEvent(ev);
 }
 
@@ -119,11 +122,11 @@ u64 AsyncIOManager::ResultFinishTicks(u32 handle) {
 void AsyncIOManager::ProcessEvent(AsyncIOEvent ev) {
 	switch (ev.type) {
 	case IO_EVENT_READ:
-		Read(ev.handle, ev.buf, ev.bytes, ev.invalidateAddr);
+		Read(ev.handle, ev.buf, ev.bytes, ev.invalidateAddr, ev.startTicks);
 		break;
 
 	case IO_EVENT_WRITE:
-		Write(ev.handle, ev.buf, ev.bytes);
+		Write(ev.handle, ev.buf, ev.bytes, ev.startTicks);
 		break;
 
 	default:
@@ -131,16 +134,16 @@ void AsyncIOManager::ProcessEvent(AsyncIOEvent ev) {
 	}
 }
 
-void AsyncIOManager::Read(u32 handle, u8 *buf, size_t bytes, u32 invalidateAddr) {
+void AsyncIOManager::Read(u32 handle, u8 *buf, size_t bytes, u32 invalidateAddr, u64 startTicks) {
 	int usec = 0;
 	s64 result = pspFileSystem.ReadFile(handle, buf, bytes, usec);
-	EventResult(handle, AsyncIOResult(result, usec, invalidateAddr));
+	EventResult(handle, AsyncIOResult(result, usec, startTicks, invalidateAddr));
 }
 
-void AsyncIOManager::Write(u32 handle, const u8 *buf, size_t bytes) {
+void AsyncIOManager::Write(u32 handle, const u8 *buf, size_t bytes, u64 startTicks) {
 	int usec = 0;
 	s64 result = pspFileSystem.WriteFile(handle, buf, bytes, usec);
-	EventResult(handle, AsyncIOResult(result, usec));
+	EventResult(handle, AsyncIOResult(result, usec, startTicks));
 }
 
 void AsyncIOManager::EventResult(u32 handle, const AsyncIOResult &result) {
@@ -41,6 +41,8 @@ struct AsyncIOEvent {
 	u8 *buf;
 	size_t bytes;
 	u32 invalidateAddr;
+	// Guest time when the operation was issued, stamped by ScheduleOperation().
+	u64 startTicks = 0;
 
 	operator AsyncIOEventType() const {
 		return type;
@@ -54,8 +56,10 @@ struct AsyncIOResult {
 	explicit AsyncIOResult(s64 r) : result(r), finishTicks(0), invalidateAddr(0) {
 	}
 
-	AsyncIOResult(s64 r, int usec, u32 addr = 0) : result(r), invalidateAddr(addr) {
-		finishTicks = CoreTiming::GetTicks() + usToCycles(usec);
+	AsyncIOResult(s64 r, int usec, u64 startTicks, u32 addr = 0) : result(r), invalidateAddr(addr) {
+		// The estimate counts from when the operation was issued, not from when the host
+		// I/O happened to complete - host storage speed shouldn't leak into guest timing.
+		finishTicks = startTicks + usToCycles(usec);
 	}
 
 	void DoState(PointerWrap &p) {
@@ -83,7 +87,7 @@ public:
 	void DoState(PointerWrap &p);
 
 	bool HasOperation(u32 handle);
-	void ScheduleOperation(const AsyncIOEvent &ev);
+	void ScheduleOperation(AsyncIOEvent ev);
 	void Shutdown();
 
 	bool HasResult(u32 handle);
@@ -99,8 +103,8 @@ protected:
 private:
 	bool PopResult(u32 handle, AsyncIOResult &result);
 	bool ReadResult(u32 handle, AsyncIOResult &result);
-	void Read(u32 handle, u8 *buf, size_t bytes, u32 invalidateAddr);
-	void Write(u32 handle, const u8 *buf, size_t bytes);
+	void Read(u32 handle, u8 *buf, size_t bytes, u32 invalidateAddr, u64 startTicks);
+	void Write(u32 handle, const u8 *buf, size_t bytes, u64 startTicks);
 
 	void EventResult(u32 handle, const AsyncIOResult &result);
 
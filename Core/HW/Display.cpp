@@ -290,6 +290,38 @@ void __DisplayForgetFlip(FlipCallback callback, void *userdata) {
 	}), flipListeners.end());
 }
 
+// Predictive auto-frameskip. We keep a rolling estimate of how long a fully rendered frame
+// costs us, so the skip decision can be made before we're actually late instead of always
+// reacting one frame behind, which tends to oscillate and stutter the audio on slow devices.
+static double frameCostEstimate = 0.0;
+static double frameCostDeviation = 0.0;
+
+void DisplayNotifyFrameCost(double seconds, bool frameWasSkipped) {
+	// Ignore nonsense measurements - pauses, loading hitches and the like.
+	if (seconds <= 0.0 || seconds > 0.5)
+		return;
+	if (frameWasSkipped) {
+		// Skipped frames are much cheaper, and feeding them in directly would make the
+		// estimate oscillate. Only let them pull it down slowly, so we can recover once
+		// the expensive scene is over.
+		if (seconds < frameCostEstimate)
+			frameCostEstimate += (seconds - frameCostEstimate) * (1.0 / 32.0);
+		return;
+	}
+	const double alpha = 1.0 / 8.0;
+	const double delta = seconds - frameCostEstimate;
+	frameCostEstimate += delta * alpha;
+	frameCostDeviation += (fabs(delta) - frameCostDeviation) * alpha;
+}
+
+bool DisplayPredictFrameOverBudget(double budget) {
+	if (frameCostEstimate <= 0.0)
+		return false;
+	// Count some of the recent jitter on top, so games hovering right at the budget don't
+	// flip between skipping and rendering every other frame.
+	return frameCostEstimate + 0.5 * frameCostDeviation > budget;
+}
+
 int DisplayCalculateFrameSkip() {
 	int frameSkipNum;
 	if (g_Config.iFrameSkipType == 1) {
@@ -321,6 +353,9 @@ void DisplayHWInit() {
 	frameTimeHistoryValid = 0;
 	frameTimeHistoryPos = 0;
 	lastFrameTimeHistory = 0.0;
+
+	frameCostEstimate = 0.0;
+	frameCostDeviation = 0.0;
 }
 
 void DisplayHWShutdown() {
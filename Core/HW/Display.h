@@ -53,6 +53,11 @@ void DisplayFireActualFlip();
 
 int DisplayCalculateFrameSkip();
 
+// Predictive auto-frameskip. Feed the measured emulation cost of each frame (with sleeps
+// excluded), then ask whether the next rendered frame is expected to blow the vsync budget.
+void DisplayNotifyFrameCost(double seconds, bool frameWasSkipped);
+bool DisplayPredictFrameOverBudget(double budget);
+
 void DisplayHWInit();
 void DisplayHWShutdown();
 void DisplayHWDoState(PointerWrap &p, int hleCompatV2);
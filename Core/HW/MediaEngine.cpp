@@ -17,6 +17,8 @@
 
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Common/Math/CrossSIMD.h"
+#include "Common/Thread/ThreadManager.h"
+#include "Common/Thread/Waitable.h"
 #include "Core/Config.h"
 #include "Core/Core.h"
 #include "Core/Debugger/MemBlockInfo.h"
@@ -59,6 +61,34 @@ extern "C" {
 
 #include "Core/FFMPEGCompat.h"
 
+// Runs the sws_scale color conversion of a decoded frame on a worker, so it
+// overlaps emulation between sceMpegGetAvcAu and the sceMpegAvcDecode that
+// actually consumes the converted pixels.
+class SwsScaleTask : public Task {
+public:
+	SwsScaleTask(SwsContext *ctx, const AVFrame *src, AVFrame *dst, int srcHeight, LimitedWaitable *waitable)
+		: ctx_(ctx), src_(src), dst_(dst), srcHeight_(srcHeight), waitable_(waitable) {}
+
+	TaskType Type() const override {
+		return TaskType::CPU_COMPUTE;
+	}
+	TaskPriority Priority() const override {
+		return TaskPriority::NORMAL;
+	}
+
+	void Run() override {
+		sws_scale(ctx_, src_->data, src_->linesize, 0, srcHeight_, dst_->data, dst_->linesize);
+		waitable_->Notify();
+	}
+
+private:
+	SwsContext *ctx_;
+	const AVFrame *src_;
+	AVFrame *dst_;
+	int srcHeight_;
+	LimitedWaitable *waitable_;
+};
+
 static AVPixelFormat getSwsFormat(int pspFormat)
 {
 	switch (pspFormat)
@@ -134,6 +164,13 @@ static int getPixelFormatBytes(int pspFormat)
 	}
 }
 
+void MediaEngine::joinColorConversion() {
+	if (m_swsWaitable) {
+		m_swsWaitable->WaitAndRelease();
+		m_swsWaitable = nullptr;
+	}
+}
+
 MediaEngine::MediaEngine() {
 	m_bufSize = 0x2000;
 
@@ -160,6 +197,8 @@ void MediaEngine::DoState(PointerWrap &p) {
 	if (!s)
 		return;
 
+	joinColorConversion();
+
 	Do(p, m_videoStream);
 	Do(p, m_audioStream);
 
@@ -354,6 +393,7 @@ bool MediaEngine::openContext(bool keepReadPos) {
 
 void MediaEngine::closeContext()
 {
+	joinColorConversion();
 #ifdef USE_FFMPEG
 	if (m_buffer)
 		av_free(m_buffer);
@@ -660,6 +700,9 @@ void MediaEngine::updateSwsFormat(int videoPixelMode) {
 
 bool MediaEngine::stepVideo(int videoPixelMode, bool skipFrame) {
 #ifdef USE_FFMPEG
+	// The decoder is about to overwrite m_pFrame, which a pending conversion reads.
+	joinColorConversion();
+
 	auto codecIter = m_pCodecCtxs.find(m_videoStream);
 	AVCodecContext *m_pCodecCtx = codecIter == m_pCodecCtxs.end() ? 0 : codecIter->second;
 
@@ -714,8 +757,10 @@ bool MediaEngine::stepVideo(int videoPixelMode, bool skipFrame) {
 					// Update the linesize for the new format too.  We started with the largest size, so it should fit.
 					m_pFrameRGB->linesize[0] = getPixelFormatBytes(videoPixelMode) * m_desWidth;
 
-					sws_scale(m_sws_ctx, m_pFrame->data, m_pFrame->linesize, 0,
-						m_pCodecCtx->height, m_pFrameRGB->data, m_pFrameRGB->linesize);
+					// Convert on a worker - the game usually does a bunch of work between
+					// sceMpegGetAvcAu and the sceMpegAvcDecode that needs the pixels.
+					m_swsWaitable = new LimitedWaitable();
+					g_threadManager.EnqueueTask(new SwsScaleTask(m_sws_ctx, m_pFrame, m_pFrameRGB, m_pCodecCtx->height, m_swsWaitable));
 				}
 
 #if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(55, 58, 100)
@@ -831,6 +876,8 @@ inline void writeVideoLineABGR4444(void *destp, const void *srcp, int width) {
 }
 
 int MediaEngine::writeVideoImage(u32 bufferPtr, int frameWidth, int videoPixelMode) {
+	joinColorConversion();
+
 	int videoLineSize = 0;
 	switch (videoPixelMode) {
 	case GE_CMODE_32BIT_ABGR8888:
@@ -921,6 +968,8 @@ int MediaEngine::writeVideoImage(u32 bufferPtr, int frameWidth, int videoPixelMo
 
 int MediaEngine::writeVideoImageWithRange(u32 bufferPtr, int frameWidth, int videoPixelMode,
 	                             int xpos, int ypos, int width, int height) {
+	joinColorConversion();
+
 	int videoLineSize = 0;
 	switch (videoPixelMode) {
 	case GE_CMODE_32BIT_ABGR8888:
@@ -1022,6 +1071,7 @@ int MediaEngine::writeVideoImageWithRange(u32 bufferPtr, int frameWidth, int vid
 
 u8 *MediaEngine::getFrameImage() {
 #ifdef USE_FFMPEG
+	joinColorConversion();
 	return m_pFrameRGB->data[0];
 #else
 	return nullptr;
@@ -32,6 +32,7 @@
 
 class PointerWrap;
 class AudioDecoder;
+class LimitedWaitable;
 
 #ifdef USE_FFMPEG
 struct SwsContext;
@@ -97,6 +98,8 @@ private:
 	bool SetupStreams();
 	bool setVideoDim(int width = 0, int height = 0);
 	void updateSwsFormat(int videoPixelMode);
+	// Waits out the worker-side color conversion of the last decoded frame.
+	void joinColorConversion();
 	int getNextAudioFrame(u8 **buf, int *headerCode1, int *headerCode2);
 
 	static int MpegReadbuffer(void *opaque, uint8_t *buf, int buf_size);
@@ -130,6 +133,9 @@ private:
 	SwsContext *m_sws_ctx = nullptr;
 #endif
 
+	// Non-null while a frame conversion is in flight on a worker.
+	LimitedWaitable *m_swsWaitable = nullptr;
+
 	int m_sws_fmt = 0;
 	int m_videoStream = -1;
 	int m_expectedVideoStreams = 0;
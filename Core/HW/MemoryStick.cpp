@@ -38,6 +38,8 @@ static u64 memStickInsertedAt = 0;
 static uint64_t memstickInitialFree = 0;
 static uint64_t memstickCurrentUse = 0;
 static bool memstickCurrentUseValid = false;
+static uint64_t memstickRealFree = 0;
+static bool memstickRealFreeValid = false;
 
 enum FreeCalcStatus {
 	NONE,
@@ -122,12 +124,19 @@ static void MemoryStick_WaitInitialFree() {
 }
 
 u64 MemoryStick_FreeSpace() {
-	NOTICE_LOG(Log::IO, "Calculated free disk space");
-
 	MemoryStick_WaitInitialFree();
 
 	const CompatFlags &flags = PSP_CoreParameter().compat.flags();
-	u64 realFreeSpace = pspFileSystem.FreeDiskSpace("ms0:/");
+
+	// Games can call sceUtilitySavedataGetSizes every frame - both the host free space query
+	// and the savedata directory walk below are cached until the next write through
+	// DirectoryFileSystem, which calls MemoryStick_NotifyWrite().
+	if (!memstickRealFreeValid) {
+		memstickRealFree = pspFileSystem.FreeDiskSpace("ms0:/");
+		memstickRealFreeValid = true;
+		NOTICE_LOG(Log::IO, "Calculated free disk space");
+	}
+	u64 realFreeSpace = memstickRealFree;
 
 	// Cap the memory stick size to avoid math errors when old games get sizes that were
 	// not planned for back then (even though 2GB cards were available.)
@@ -161,6 +170,7 @@ u64 MemoryStick_FreeSpace() {
 
 void MemoryStick_NotifyWrite() {
 	memstickCurrentUseValid = false;
+	memstickRealFreeValid = false;
 }
 
 void MemoryStick_SetFatState(MemStickFatState state) {
@@ -194,6 +204,8 @@ void MemoryStick_Init() {
 	}
 
 	memStickNeedsAssign = false;
+	memstickCurrentUseValid = false;
+	memstickRealFreeValid = false;
 	MemoryStick_CalcInitialFree();
 }
 
@@ -575,35 +575,54 @@ void SasInstance::MixVoice(SasVoice &voice) {
 			voice.envelope.Step();
 		}
 
-		const bool needsInterp = voicePitch != PSP_SAS_PITCH_BASE || (sampleFrac & PSP_SAS_PITCH_MASK) != 0;
-		for (int i = delay; i < grainSize; i++) {
-			const int16_t *s = mixTemp_ + (sampleFrac >> PSP_SAS_PITCH_BASE_SHIFT);
+		// If the voice can't be heard, we still have to advance the envelope and the
+		// read position below, but the resample and mix passes can be skipped entirely.
+		const bool silent = voice.volumeLeft == 0 && voice.volumeRight == 0 && voice.effectLeft == 0 && voice.effectRight == 0;
 
-			// Linear interpolation. Good enough. Need to make resampleHist bigger if we want more.
-			int sample = s[0];
+		// Instead of one loop interleaving everything per sample, we do blocked passes:
+		// resample a block, walk the envelope for a block, then mix the block.
+		// The resample and mix loops are simple and independent enough to vectorize.
+		const bool needsInterp = voicePitch != PSP_SAS_PITCH_BASE || (sampleFrac & PSP_SAS_PITCH_MASK) != 0;
+		if (!silent) {
 			if (needsInterp) {
-				int f = sampleFrac & PSP_SAS_PITCH_MASK;
-				sample = (s[0] * (PSP_SAS_PITCH_MASK - f) + s[1] * f) >> PSP_SAS_PITCH_BASE_SHIFT;
+				u32 frac = sampleFrac;
+				for (int i = delay; i < grainSize; i++) {
+					// Linear interpolation. Good enough. Need to make resampleHist bigger if we want more.
+					const int16_t *s = mixTemp_ + (frac >> PSP_SAS_PITCH_BASE_SHIFT);
+					const int f = frac & PSP_SAS_PITCH_MASK;
+					resampled_[i] = (int16_t)((s[0] * (PSP_SAS_PITCH_MASK - f) + s[1] * f) >> PSP_SAS_PITCH_BASE_SHIFT);
+					frac += voicePitch;
+				}
+			} else {
+				// 1:1 pitch with no fractional phase is just a copy.
+				memcpy(resampled_ + delay, mixTemp_ + (sampleFrac >> PSP_SAS_PITCH_BASE_SHIFT), (grainSize - delay) * sizeof(int16_t));
 			}
-			sampleFrac += voicePitch;
+		}
+		sampleFrac += voicePitch * (grainSize - delay);
 
+		// The envelope is a state machine, so this pass stays per-sample even when silent.
+		for (int i = delay; i < grainSize; i++) {
 			// The maximum envelope height (PSP_SAS_ENVELOPE_HEIGHT_MAX) is (1 << 30) - 1.
 			// Reduce it to 14 bits, by shifting off 15.  Round up by adding (1 << 14) first.
 			int envelopeValue = voice.envelope.GetHeight();
 			voice.envelope.Step();
-			envelopeValue = (envelopeValue + (1 << 14)) >> 15;
-
-			// We just scale by the envelope before we scale by volumes.
-			// Again, we round up by adding (1 << 14) first (*after* multiplying.)
-			sample = ((sample * envelopeValue) + (1 << 14)) >> 15;
-
-			// We mix into this 32-bit temp buffer and clip in a second loop
-			// Ideally, the shift right should be there too but for now I'm concerned about
-			// not overflowing.
-			mixBuffer[i * 2] += (sample * voice.volumeLeft) >> 12;
-			mixBuffer[i * 2 + 1] += (sample * voice.volumeRight) >> 12;
-			sendBuffer[i * 2] += sample * voice.effectLeft >> 12;
-			sendBuffer[i * 2 + 1] += sample * voice.effectRight >> 12;
+			envBlock_[i] = (uint16_t)((envelopeValue + (1 << 14)) >> 15);
+		}
+
+		if (!silent) {
+			for (int i = delay; i < grainSize; i++) {
+				// We just scale by the envelope before we scale by volumes.
+				// Again, we round up by adding (1 << 14) first (*after* multiplying.)
+				const int sample = ((resampled_[i] * envBlock_[i]) + (1 << 14)) >> 15;
+
+				// We mix into this 32-bit temp buffer and clip in a second loop
+				// Ideally, the shift right should be there too but for now I'm concerned about
+				// not overflowing.
+				mixBuffer[i * 2] += (sample * voice.volumeLeft) >> 12;
+				mixBuffer[i * 2 + 1] += (sample * voice.volumeRight) >> 12;
+				sendBuffer[i * 2] += sample * voice.effectLeft >> 12;
+				sendBuffer[i * 2 + 1] += sample * voice.effectRight >> 12;
+			}
 		}
 
 		voice.resampleHist[0] = mixTemp_[tempPos - 2];
@@ -731,6 +750,13 @@ void SasInstance::SetWaveformEffectType(int type) {
 // See http://report.ppsspp.org/logs/kind/772 for a list of games that use different types. Maybe can help us figure out
 // which is which.
 void SasInstance::ApplyWaveformEffect() {
+	// With the effect volume faded out, ProcessReverb would only produce
+	// silence anyway - skip the downsampling too.
+	if (waveformEffect.leftVol == 0 && waveformEffect.rightVol == 0) {
+		memset(sendBufferProcessed, 0, grainSize * 2 * sizeof(int16_t));
+		return;
+	}
+
 	// First, downsample the send buffer to 22khz. We do this naively for now.
 	for (int i = 0; i < grainSize / 2; i++) {
 		sendBufferDownsampled[i * 2] = clamp_s16(sendBuffer[i * 4]);
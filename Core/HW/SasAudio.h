@@ -333,6 +333,9 @@ private:
 	SasReverb reverb_;
 	int grainSize = 0;
 	int16_t mixTemp_[PSP_SAS_MAX_GRAIN * 4 + 2 + 16];  // some extra margin for very high pitches.
+	// Per-block scratch for MixVoice's resample/envelope/mix passes.
+	int16_t resampled_[PSP_SAS_MAX_GRAIN];
+	uint16_t envBlock_[PSP_SAS_MAX_GRAIN];
 };
 
 const char *ADSRCurveModeAsString(SasADSRCurveMode mode);
@@ -208,6 +208,13 @@ private:
 };
 
 void SasReverb::ProcessReverb(int16_t *output, const int16_t *input, size_t inputSize, uint16_t volLeft, uint16_t volRight) {
+	// Games commonly leave reverb enabled but faded all the way out. Like the
+	// zero-volume override below, just output silence and skip the whole chain.
+	if (volLeft == 0 && volRight == 0) {
+		memset(output, 0, inputSize * 4 * sizeof(int16_t));
+		return;
+	}
+
 	// This means replicate the input signal in the processed buffer.
 	// Can also be used to verify that the error is in here...
 	if (preset_ == -1) {
@@ -226,7 +233,7 @@ void SasReverb::ProcessReverb(int16_t *output, const int16_t *input, size_t inpu
 	const uint8_t finalShift = 25 - reverbVolume;
 	if (reverbVolume == 0) {
 		// Force to zero output, which is not the same as "Off."
-		memset(output, 0, inputSize * 4);
+		memset(output, 0, inputSize * 4 * sizeof(int16_t));
 		return;
 	}
 
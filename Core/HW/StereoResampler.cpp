@@ -99,6 +99,20 @@ void StereoResampler::UpdateBufferSize() {
 			if (m_targetBufsize * 2 > MAX_BUFSIZE_DEFAULT)
 				m_maxBufsize = MAX_BUFSIZE_EXTRA;
 		}
+
+		// Once we've seen actual callbacks, align the target to whole device periods
+		// (at least two) so the host pulls don't beat against the 64-sample mix grain
+		// and force an extra period of slack. Most platforms never report
+		// SYSPROP_AUDIO_FRAMES_PER_BUFFER, this covers them too.
+		int period = devicePeriod_;
+		if (period > 0 && period <= 2048) {
+			int aligned = ((m_targetBufsize + period - 1) / period) * period;
+			if (aligned < period * 2)
+				aligned = period * 2;
+			m_targetBufsize = std::min(4096, aligned);
+			if (m_targetBufsize * 2 > MAX_BUFSIZE_DEFAULT)
+				m_maxBufsize = MAX_BUFSIZE_EXTRA;
+		}
 	}
 }
 
@@ -188,14 +202,19 @@ unsigned int StereoResampler::Mix(short* samples, unsigned int numSamples, bool
 	// so we will just ignore new written data while interpolating (until it wraps...).
 	// Without this cache, the compiler wouldn't be allowed to optimize the
 	// interpolation loop.
-	u32 indexR = m_indexR.load();
-	u32 indexW = m_indexW.load();
+	u32 indexR = m_indexR.load(std::memory_order_relaxed);
+	// Acquire so we see the sample data written before the index bump on the pushing side.
+	u32 indexW = m_indexW.load(std::memory_order_acquire);
 
 	const int INDEX_MASK = (m_maxBufsize * 2 - 1);
 
 	// This is only for debug visualization, not used for anything.
 	lastBufSize_ = ((indexW - indexR) & INDEX_MASK) / 2;
 
+	// The callback size is the host's device period - remember it so the buffer
+	// targeting on the push side can align to it instead of guessing.
+	devicePeriod_ = (int)numSamples;
+
 	// Drift prevention mechanism.
 	float numLeft = (float)(((indexW - indexR) & INDEX_MASK) / 2);
 	// If we had to discard samples the last frame due to underrun,
@@ -246,6 +265,11 @@ unsigned int StereoResampler::Mix(short* samples, unsigned int numSamples, bool
 	// Let's not count the underrun padding here.
 	outputSampleCount_ += currentSample / 2;
 
+	// Remember how much we're about to pad, so the drift controller above
+	// doesn't mistake the padding for samples it still has to deliver.
+	droppedSamples_ = (numSamples * 2 - currentSample) / 2;
+	paddedFrameCount_ += droppedSamples_;
+
 	// Padding with the last value to reduce clicking
 	short s[2];
 	s[0] = clamp_s16(m_buffer[(indexR - 1) & INDEX_MASK]);
@@ -255,13 +279,59 @@ unsigned int StereoResampler::Mix(short* samples, unsigned int numSamples, bool
 		samples[currentSample + 1] = s[1];
 	}
 
-	// Flush cached variable
-	m_indexR.store(indexR);
+	// Flush cached variable. Release isn't needed for correctness (we only read
+	// the buffer), but store it explicitly to keep the intent clear.
+	m_indexR.store(indexR, std::memory_order_release);
 
 	// TODO: What should we actually return here?
 	return currentSample / 2;
 }
 
+// Overrun handling during fast-forward: overwrite the tail of the queue with the
+// incoming block, crossfading across the seam so there's no click. Older audio is
+// what gets discarded, the newest always survives. A proper WSOLA correlation search
+// isn't worth it here - at these speeds the output is audibly sped up regardless,
+// the seams just have to be clean.
+//
+// Note that the mixer may race us over this region since it's already published;
+// worst case it picks up a partially blended sample during fast-forward, which is
+// inaudible next to the stretching itself.
+void StereoResampler::OverlapFadeTail(const s32 *samples, unsigned int numSamples, u32 indexW, int indexMask) {
+	const u32 buffered = (indexW - m_indexR.load(std::memory_order_acquire)) & indexMask;
+	if (buffered < numSamples * 2 + 2) {
+		// Only called with a full buffer, so this shouldn't happen - bail rather than
+		// stomp past the read position.
+		return;
+	}
+
+	static const int MAX_FADE_FRAMES = 256;
+	const int fadeFrames = std::min((int)numSamples, MAX_FADE_FRAMES);
+	const u32 tail = indexW - numSamples * 2;
+
+	// Save the audio we're about to overwrite in the fade region.
+	s16 old[MAX_FADE_FRAMES * 2];
+	for (int i = 0; i < fadeFrames * 2; i++)
+		old[i] = m_buffer[(tail + i) & indexMask];
+
+	// Drop the new block in over the tail, same split logic as the regular push.
+	unsigned int tailLeft = m_maxBufsize * 2 - (tail & indexMask);
+	if (numSamples * 2 > tailLeft) {
+		ClampBufferToS16WithVolume(&m_buffer[tail & indexMask], samples, tailLeft);
+		ClampBufferToS16WithVolume(&m_buffer[0], samples + tailLeft, numSamples * 2 - tailLeft);
+	} else {
+		ClampBufferToS16WithVolume(&m_buffer[tail & indexMask], samples, numSamples * 2);
+	}
+
+	// Linear ramp from the old content into the new block across the seam.
+	for (int i = 0; i < fadeFrames; i++) {
+		const int w = (i * 256) / fadeFrames;
+		for (int c = 0; c < 2; c++) {
+			const u32 idx = (tail + i * 2 + c) & indexMask;
+			m_buffer[idx] = (s16)((old[i * 2 + c] * (256 - w) + m_buffer[idx] * w) >> 8);
+		}
+	}
+}
+
 // Executes on the emulator thread, pushing sound into the buffer.
 void StereoResampler::PushSamples(const s32 *samples, unsigned int numSamples) {
 	inputSampleCount_ += numSamples;
@@ -271,7 +341,7 @@ void StereoResampler::PushSamples(const s32 *samples, unsigned int numSamples) {
 	// Cache access in non-volatile variable
 	// indexR isn't allowed to cache in the audio throttling loop as it
 	// needs to get updates to not deadlock.
-	u32 indexW = m_indexW.load();
+	u32 indexW = m_indexW.load(std::memory_order_relaxed);
 
 	u32 cap = m_maxBufsize * 2;
 	// If fast-forwarding, no need to fill up the entire buffer, just screws up timing after releasing the fast-forward button.
@@ -281,11 +351,15 @@ void StereoResampler::PushSamples(const s32 *samples, unsigned int numSamples) {
 
 	// Check if we have enough free space
 	// indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW
-	if (numSamples * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >= cap) {
-		if (!PSP_CoreParameter().fastForward) {
+	if (numSamples * 2 + ((indexW - m_indexR.load(std::memory_order_acquire)) & INDEX_MASK) >= cap) {
+		if (PSP_CoreParameter().fastForward) {
+			// Fold the new block over the freshest buffered audio instead of dropping
+			// it, so the buffer always ends on the most recent audio - that's what
+			// makes the drop back to 1x seamless instead of replaying a stale tail.
+			OverlapFadeTail(samples, numSamples, indexW, INDEX_MASK);
+		} else {
 			overrunCount_++;
 		}
-		// TODO: "Timestretch" by doing a windowed overlap with existing buffer content?
 		return;
 	}
 
@@ -298,7 +372,10 @@ void StereoResampler::PushSamples(const s32 *samples, unsigned int numSamples) {
 		ClampBufferToS16WithVolume(&m_buffer[indexW & INDEX_MASK], samples, numSamples * 2);
 	}
 
-	m_indexW += numSamples * 2;
+	// We're the only writer of m_indexW, so a plain store with release ordering
+	// is enough - no need for an atomic RMW here. The release publishes the
+	// sample data written above to the mixing side.
+	m_indexW.store(indexW + numSamples * 2, std::memory_order_release);
 	lastPushSize_ = numSamples;
 }
 
@@ -316,6 +393,8 @@ void StereoResampler::GetAudioDebugStats(char *buf, size_t bufSize) {
 		"Effective input sample rate: %0.2f\n"
 		"Effective output sample rate: %0.2f\n"
 		"Push size: %d\n"
+		"Device period: %d\n"
+		"Padded frames: %lld\n"
 		"Ratio: %0.6f\n",
 		lastBufSize_,
 		m_maxBufsize,
@@ -328,6 +407,8 @@ void StereoResampler::GetAudioDebugStats(char *buf, size_t bufSize) {
 		effective_input_sample_rate,
 		effective_output_sample_rate,
 		lastPushSize_,
+		devicePeriod_,
+		(long long)paddedFrameCount_,
 		(float)ratio_ / 65536.0f);
 	underrunCountTotal_ += underrunCount_;
 	overrunCountTotal_ += overrunCount_;
@@ -347,5 +428,6 @@ void StereoResampler::ResetStatCounters() {
 	overrunCountTotal_ = 0;
 	inputSampleCount_ = 0;
 	outputSampleCount_ = 0;
+	paddedFrameCount_ = 0;
 	startTime_ = time_now_d();
 }
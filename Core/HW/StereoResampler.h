@@ -43,16 +43,38 @@ public:
 	void GetAudioDebugStats(char *buf, size_t bufSize);
 	void ResetStatCounters();
 
+	// Racy reads from other threads, but only used for stats reporting.
+	int GetUnderrunCountTotal() const {
+		return underrunCountTotal_;
+	}
+	// The host device period in frames, as observed from the pull callbacks.
+	int GetDevicePeriod() const {
+		return devicePeriod_;
+	}
+	int64_t GetOutputFramesTotal() const {
+		return outputSampleCount_;
+	}
+	// Frames padded due to underrun. Diffing this against the output total over an
+	// interval gives the fraction of the audio budget we failed to deliver.
+	int64_t GetPaddedFramesTotal() const {
+		return paddedFrameCount_;
+	}
+
 private:
 	void UpdateBufferSize();
+	// Crossfades a new block over the freshest queued audio when the buffer is full
+	// during fast-forward, instead of dropping it.
+	void OverlapFadeTail(const s32 *samples, unsigned int numSamples, u32 indexW, int indexMask);
 
 	int m_maxBufsize;
 	int m_targetBufsize;
 
 	unsigned int m_input_sample_rate = 44100;
 	int16_t *m_buffer;
-	std::atomic<u32> m_indexW;
-	std::atomic<u32> m_indexR;
+	// Lock-free SPSC ring: the emu thread only writes m_indexW, the audio
+	// thread only writes m_indexR. Synchronization is acquire/release on these.
+	std::atomic<u32> m_indexW{ 0 };
+	std::atomic<u32> m_indexR{ 0 };
 	float m_numLeftI = 0.0f;
 
 	u32 m_frac = 0;
@@ -67,9 +89,11 @@ private:
 	int overrunCountTotal_ = 0;
 
 	int droppedSamples_ = 0;
+	int devicePeriod_ = 0;
 
 	int64_t inputSampleCount_ = 0;
 	int64_t outputSampleCount_ = 0;
+	int64_t paddedFrameCount_ = 0;
 
 	double startTime_ = 0.0;
 };
@@ -441,6 +441,9 @@ const KeyMap_IntStrPair psp_button_names[] = {
 	{VIRTKEY_OPENCHAT, "OpenChat" },
 
 	{VIRTKEY_DEVMENU, "DevMenu"},
+#ifdef USE_PROFILER
+	{VIRTKEY_TRACE_CAPTURE, "Trace Capture"},
+#endif
 	{VIRTKEY_TEXTURE_DUMP, "Texture Dumping"},
 	{VIRTKEY_TEXTURE_REPLACE, "Texture Replacement"},
 	{VIRTKEY_SCREENSHOT, "Screenshot"},
@@ -78,6 +78,7 @@ enum {
 	VIRTKEY_TOGGLE_TOUCH_CONTROLS =  0x40000031,
 	VIRTKEY_RESET_EMULATION = 0x40000032,
 	VIRTKEY_TOGGLE_DEBUGGER = 0x40000033,
+	VIRTKEY_TRACE_CAPTURE = 0x40000034,
 	VIRTKEY_LAST,
 	VIRTKEY_COUNT = VIRTKEY_LAST - VIRTKEY_FIRST
 };
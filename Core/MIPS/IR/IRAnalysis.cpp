@@ -181,6 +181,118 @@ IRUsage IRNextGPRUsage(int gpr, const IRSituation &info) {
 	return IRUsage::UNUSED;
 }
 
+// Only ops that can't affect anything outside the block's own GPR writes: integer
+// arithmetic, plain loads (the poll itself), and exits. Anything else - stores,
+// FP/vec ops, HI/LO, linked loads, syscalls, interpreter fallbacks - disqualifies.
+static bool IROpIsSpinSafe(IROp op) {
+	switch (op) {
+	case IROp::Downcount:
+	case IROp::Nop:
+	case IROp::SetConst:
+	case IROp::Mov:
+	case IROp::Add:
+	case IROp::Sub:
+	case IROp::Neg:
+	case IROp::Not:
+	case IROp::And:
+	case IROp::Or:
+	case IROp::Xor:
+	case IROp::AddConst:
+	case IROp::OptAddConst:
+	case IROp::SubConst:
+	case IROp::AndConst:
+	case IROp::OrConst:
+	case IROp::XorConst:
+	case IROp::OptAndConst:
+	case IROp::OptOrConst:
+	case IROp::Shl:
+	case IROp::Shr:
+	case IROp::Sar:
+	case IROp::Ror:
+	case IROp::ShlImm:
+	case IROp::ShrImm:
+	case IROp::SarImm:
+	case IROp::RorImm:
+	case IROp::Slt:
+	case IROp::SltConst:
+	case IROp::SltU:
+	case IROp::SltUConst:
+	case IROp::Clz:
+	case IROp::MovZ:
+	case IROp::MovNZ:
+	case IROp::Max:
+	case IROp::Min:
+	case IROp::BSwap16:
+	case IROp::BSwap32:
+	case IROp::Ext8to32:
+	case IROp::Ext16to32:
+	case IROp::ReverseBits:
+	case IROp::Load8:
+	case IROp::Load8Ext:
+	case IROp::Load16:
+	case IROp::Load16Ext:
+	case IROp::Load32:
+	case IROp::ValidateAddress8:
+	case IROp::ValidateAddress16:
+	case IROp::ValidateAddress32:
+	case IROp::ExitToConst:
+	case IROp::ExitToConstIfEq:
+	case IROp::ExitToConstIfNeq:
+	case IROp::ExitToConstIfGtZ:
+	case IROp::ExitToConstIfGeZ:
+	case IROp::ExitToConstIfLtZ:
+	case IROp::ExitToConstIfLeZ:
+	case IROp::OptExitToConstIfLt:
+	case IROp::OptExitToConstIfLtU:
+	case IROp::OptExitToConstIfGe:
+	case IROp::OptExitToConstIfGeU:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool IRBlockIsPureSpinLoop(const IRInst *instructions, int numInstructions, u32 blockStart) {
+	bool writtenAnywhere[256]{};
+	bool writtenSoFar[256]{};
+	bool loopsToStart = false;
+
+	for (int i = 0; i < numInstructions; ++i) {
+		const IRInstMeta inst = GetIRMeta(instructions[i]);
+		if (!IROpIsSpinSafe(inst.op))
+			return false;
+		if ((inst.m.flags & IRFLAG_EXIT) && inst.constant == blockStart)
+			loopsToStart = true;
+		int dest = IRDestGPR(inst);
+		if (dest >= 0)
+			writtenAnywhere[dest] = true;
+	}
+	if (!loopsToStart)
+		return false;
+
+	for (int i = 0; i < numInstructions; ++i) {
+		const IRInstMeta inst = GetIRMeta(instructions[i]);
+		// Registers never written in the block are invariant and fine to read.
+		// Reading a written register before the write that produced it means the
+		// value is carried over from the previous iteration (a counter, an
+		// accumulated flag...) - then re-running the block isn't guaranteed to
+		// produce the same state, so we can't fast-forward.
+		IRReg regs[4];
+		int numReads = IRReadsFromGPRs(inst, regs);
+		if (numReads < 0)
+			return false;
+		for (int r = 0; r < numReads; ++r) {
+			if (writtenAnywhere[regs[r]] && !writtenSoFar[regs[r]])
+				return false;
+		}
+		int dest = IRDestGPR(inst);
+		if (dest >= 0)
+			writtenSoFar[dest] = true;
+	}
+
+	return true;
+}
+
 IRUsage IRNextFPRUsage(int fpr, const IRSituation &info) {
 	// Let's only pay attention to standard FP regs and temps.
 	// See MIPS.h for these offsets.
@@ -68,3 +68,10 @@ enum class IRUsage {
 
 IRUsage IRNextGPRUsage(int gpr, const IRSituation &info);
 IRUsage IRNextFPRUsage(int fpr, const IRSituation &info);
+
+// Detects pure polling loops: the block jumps back to its own start, performs no
+// stores or other side effects, and carries no register state between iterations.
+// Re-running such a block can't change anything until a CoreTiming event writes
+// the memory it watches, so the dispatcher may burn the remaining timeslice in
+// whole-iteration units instead of interpreting every spin.
+bool IRBlockIsPureSpinLoop(const IRInst *instructions, int numInstructions, u32 blockStart);
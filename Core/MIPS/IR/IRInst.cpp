@@ -173,6 +173,10 @@ static const IRMeta irMeta[] = {
 	{ IROp::ExitToConstIfLeZ, "ExitIfLeZ", "CG", IRFLAG_EXIT },
 	{ IROp::ExitToConstIfLtZ, "ExitIfLtZ", "CG", IRFLAG_EXIT },
 	{ IROp::ExitToReg, "ExitToReg", "_G", IRFLAG_EXIT },
+	{ IROp::OptExitToConstIfLt, "OptExitIfLt", "GGGC", IRFLAG_EXIT },
+	{ IROp::OptExitToConstIfGe, "OptExitIfGe", "GGGC", IRFLAG_EXIT },
+	{ IROp::OptExitToConstIfLtU, "OptExitIfLtU", "GGGC", IRFLAG_EXIT },
+	{ IROp::OptExitToConstIfGeU, "OptExitIfGeU", "GGGC", IRFLAG_EXIT },
 	{ IROp::Syscall, "Syscall", "_C", IRFLAG_EXIT },
 	{ IROp::Break, "Break", "", IRFLAG_EXIT },
 	{ IROp::SetPC, "SetPC", "_G" },
@@ -220,6 +220,14 @@ enum class IROp : uint8_t {
 
 	ExitToConstIfFpTrue,
 	ExitToConstIfFpFalse,
+
+	// Fused compare+branch for the interpreter (see OptimizeForInterpreter).
+	// Writes the comparison result to dest exactly like Slt/SltU, then exits.
+	OptExitToConstIfLt,   // Slt + ExitIfNeq(dest, zero)
+	OptExitToConstIfGe,   // Slt + ExitIfEq(dest, zero)
+	OptExitToConstIfLtU,  // SltU + ExitIfNeq(dest, zero)
+	OptExitToConstIfGeU,  // SltU + ExitIfEq(dest, zero)
+
 	ExitToPC,  // Used after a syscall to give us a way to do things before returning.
 
 	Syscall,
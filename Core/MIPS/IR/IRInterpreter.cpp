@@ -1131,6 +1131,41 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 				return inst->constant;
 			break;
 
+		// Fused Slt/SltU + branch-on-result. The compare result is still written,
+		// in case it's read on the other side of the branch.
+		case IROp::OptExitToConstIfLt:
+		{
+			u32 result = (s32)mips->r[inst->src1] < (s32)mips->r[inst->src2] ? 1 : 0;
+			mips->r[inst->dest] = result;
+			if (result)
+				return inst->constant;
+			break;
+		}
+		case IROp::OptExitToConstIfGe:
+		{
+			u32 result = (s32)mips->r[inst->src1] < (s32)mips->r[inst->src2] ? 1 : 0;
+			mips->r[inst->dest] = result;
+			if (!result)
+				return inst->constant;
+			break;
+		}
+		case IROp::OptExitToConstIfLtU:
+		{
+			u32 result = mips->r[inst->src1] < mips->r[inst->src2] ? 1 : 0;
+			mips->r[inst->dest] = result;
+			if (result)
+				return inst->constant;
+			break;
+		}
+		case IROp::OptExitToConstIfGeU:
+		{
+			u32 result = mips->r[inst->src1] < mips->r[inst->src2] ? 1 : 0;
+			mips->r[inst->dest] = result;
+			if (!result)
+				return inst->constant;
+			break;
+		}
+
 		case IROp::Downcount:
 			mips->downcount -= (int)inst->constant;
 			break;
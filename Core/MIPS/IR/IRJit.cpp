@@ -29,12 +29,14 @@
 #include "Core/Config.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/Debugger/SymbolMap.h"
 #include "Core/HLE/sceKernelMemory.h"
 #include "Core/MemMap.h"
 #include "Core/MIPS/MIPS.h"
 #include "Core/MIPS/MIPSCodeUtils.h"
 #include "Core/MIPS/MIPSInt.h"
 #include "Core/MIPS/MIPSTables.h"
+#include "Core/MIPS/IR/IRAnalysis.h"
 #include "Core/MIPS/IR/IRRegCache.h"
 #include "Core/MIPS/IR/IRInterpreter.h"
 #include "Core/MIPS/IR/IRJit.h"
@@ -90,6 +92,7 @@ void IRJit::UpdateFCR31() {
 void IRJit::ClearCache() {
 	INFO_LOG(Log::JIT, "IRJit: Clearing the block cache!");
 	blocks_.Clear();
+	functionMissCounts_.clear();
 }
 
 void IRJit::InvalidateCacheAt(u32 em_address, int length) {
@@ -132,6 +135,29 @@ void IRJit::Compile(u32 em_address) {
 		}
 	}
 
+	if (g_Config.bPreloadFunctions && g_symbolMap) {
+		// Region formation: when block misses keep landing inside the same function, that
+		// function is hot, so compile the rest of it in one go. The remaining blocks then
+		// hit the cheap preload-finalize path above instead of full frontend runs.
+		const u32 funcStart = g_symbolMap->GetFunctionStart(em_address);
+		if (funcStart != SymbolMap::INVALID_ADDRESS) {
+			const u32 funcSize = g_symbolMap->GetFunctionSize(funcStart);
+			if (funcSize != SymbolMap::INVALID_ADDRESS && funcSize > 8 && ++functionMissCounts_[funcStart] == REGION_COMPILE_MISS_THRESHOLD) {
+				CompileFunction(funcStart, funcSize);
+				int block_num = blocks_.FindPreloadBlock(em_address);
+				if (block_num != -1) {
+					IRBlock *block = blocks_.GetBlock(block_num);
+					int cookie = compileToNative_ ? block->GetNativeOffset() : block->GetIRArenaOffset();
+					block->Finalize(cookie);
+					if (block->IsValid()) {
+						FinalizeNativeBlock(&blocks_, block_num);
+						return;
+					}
+				}
+			}
+		}
+	}
+
 	std::vector<IRInst> instructions;
 	u32 mipsBytes;
 	if (!CompileBlock(em_address, instructions, mipsBytes, false)) {
@@ -167,6 +193,12 @@ bool IRJit::CompileBlock(u32 em_address, std::vector<IRInst> &instructions, u32
 	}
 
 	IRBlock *b = blocks_.GetBlock(block_num);
+	if (!compileToNative_) {
+		// Only the IR interpreter's dispatcher uses this - native backends have
+		// their own dispatchers and block linking.
+		if (IRBlockIsPureSpinLoop(instructions.data(), (int)instructions.size(), em_address))
+			blocks_.MarkSpinLoop(b->GetIRArenaOffset());
+	}
 	if (preload || mipsTracer.tracing_enabled) {
 		// Hash, then only update page stats, don't link yet.
 		// TODO: Should we always hash?  Then we can reuse blocks.
@@ -289,8 +321,10 @@ void IRJit::RunLoopUntil(u64 globalticks) {
 				const IRInst *instPtr = blocks_.GetArenaPtr() + offset;
 				// First op is always, except when using breakpoints, downcount, to save one dispatch inside IRInterpret.
 				// This branch is very cpu-branch-predictor-friendly so this still beats the dispatch.
+				u32 downcountAmount = 0;
 				if (instPtr->op == IROp::Downcount) {
-					mips->downcount -= instPtr->constant;
+					downcountAmount = instPtr->constant;
+					mips->downcount -= downcountAmount;
 					instPtr++;
 				}
 #ifdef IR_PROFILING
@@ -301,7 +335,33 @@ void IRJit::RunLoopUntil(u64 globalticks) {
 				block->profileStats_.executions += 1;
 				block->profileStats_.totalNanos += elapsedNanos;
 #else
+				const u32 startPC = mips->pc;
 				mips->pc = IRInterpret(mips, instPtr);
+				// Tight-loop fast path: a block that jumps straight back to its own start
+				// (spin/poll loops) gets re-entered without the full emuhack dispatch above.
+				// The downcount is still paid every iteration so event timing is unchanged,
+				// and the first word is re-read so invalidation or self-modifying code still
+				// forces a normal dispatch. Breakpointed blocks have no Downcount op and
+				// never take this path.
+				if (downcountAmount != 0 && mips->pc == startPC && mips->downcount >= 0 &&
+					Memory::ReadUnchecked_U32(startPC) == inst) {
+					if (blocks_.IsSpinLoop(offset)) {
+						// Proven pure busy-wait: no stores, no side effects, no state
+						// carried between iterations. Nothing can change what it observes
+						// until a CoreTiming event runs, so account for the spins it would
+						// have done until the end of the timeslice and skip executing them.
+						// Events then fire in Advance() and the loop re-runs normally,
+						// seeing any memory they wrote.
+						int iterations = mips->downcount / (int)downcountAmount + 1;
+						mips->downcount -= iterations * (int)downcountAmount;
+					} else {
+						do {
+							mips->downcount -= downcountAmount;
+							mips->pc = IRInterpret(mips, instPtr);
+						} while (mips->pc == startPC && mips->downcount >= 0 &&
+							Memory::ReadUnchecked_U32(startPC) == inst);
+					}
+				}
 #endif
 				// Note: this will "jump to zero" on a badly constructed block missing exits.
 				if (!Memory::IsValid4AlignedAddress(mips->pc)) {
@@ -350,6 +410,7 @@ void IRBlockCache::Clear() {
 	}
 	blocks_.clear();
 	byPage_.clear();
+	spinLoopOffsets_.clear();
 	arena_.clear();
 	arena_.shrink_to_fit();
 }
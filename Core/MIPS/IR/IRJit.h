@@ -19,6 +19,7 @@
 
 #include <cstring>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Common/CommonTypes.h"
 #include "Common/CPUDetect.h"
@@ -159,6 +160,15 @@ public:
 
 	int FindPreloadBlock(u32 em_address);
 
+	// Pure spin loop tracking, used by the IR interpreter's dispatcher to
+	// fast-forward busy-waits. Offsets are never reused until Clear().
+	void MarkSpinLoop(u32 arenaOffset) {
+		spinLoopOffsets_.insert(arenaOffset);
+	}
+	bool IsSpinLoop(u32 arenaOffset) const {
+		return spinLoopOffsets_.find(arenaOffset) != spinLoopOffsets_.end();
+	}
+
 	// "Cookie" means the 24 bits we inject into the first instruction of each block.
 	int FindByCookie(int cookie);
 
@@ -198,6 +208,7 @@ private:
 	std::vector<IRBlock> blocks_;
 	std::vector<IRInst> arena_;
 	std::unordered_map<u32, std::vector<int>> byPage_;
+	std::unordered_set<u32> spinLoopOffsets_;
 };
 
 class IRJit : public JitInterface {
@@ -253,6 +264,11 @@ protected:
 
 	bool compilerEnabled_ = true;
 
+	// How many block misses inside the same analyzed function before we compile
+	// the whole function as a region. See IRJit::Compile().
+	enum { REGION_COMPILE_MISS_THRESHOLD = 4 };
+	std::unordered_map<u32, int> functionMissCounts_;
+
 	// where to write branch-likely trampolines. not used atm
 	// u32 blTrampolines_;
 	// int blTrampolineCount_;
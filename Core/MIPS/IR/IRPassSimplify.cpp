@@ -2225,6 +2225,60 @@ bool OptimizeLoadsAfterStores(const IRWriter &in, IRWriter &out, const IROptions
 	return logBlocks;
 }
 
+bool OptimizeVFPUPrefixes(const IRWriter &in, IRWriter &out, const IROptions &opts) {
+	CONDITIONAL_DISABLE;
+
+	// The frontend flushes dirty prefix state to the VFPU ctrl registers at every
+	// point the block might be left or observed. In a 3D-heavy block with several
+	// side exits that's the same three constants stored over and over - almost all
+	// dynamic VFPU ops run with identity prefixes, so the values rarely change.
+	// Track the last constant written to each prefix register and drop rewrites of
+	// the same value. Side exits don't invalidate this: if the exit is taken, the
+	// rest of the block never runs, and the register already holds the value.
+	u32 knownValue[3]{};
+	bool known[3]{};
+
+	bool logBlocks = false;
+	for (IRInst inst : in.GetInstructions()) {
+		switch (inst.op) {
+		case IROp::SetCtrlVFPU:
+			if (inst.dest <= VFPU_CTRL_DPREFIX) {
+				if (known[inst.dest] && knownValue[inst.dest] == inst.constant) {
+					// The register still holds this value, skip the write.
+					continue;
+				}
+				known[inst.dest] = true;
+				knownValue[inst.dest] = inst.constant;
+			}
+			out.Write(inst);
+			break;
+
+		case IROp::SetCtrlVFPUReg:
+		case IROp::SetCtrlVFPUFReg:
+			if (inst.dest <= VFPU_CTRL_DPREFIX)
+				known[inst.dest] = false;
+			out.Write(inst);
+			break;
+
+		case IROp::Interpret:
+		case IROp::CallReplacement:
+		case IROp::Syscall:
+		case IROp::Break:
+		case IROp::Breakpoint:
+			// These can run guest code that modifies the ctrl registers behind our back.
+			known[0] = known[1] = known[2] = false;
+			out.Write(inst);
+			break;
+
+		default:
+			out.Write(inst);
+			break;
+		}
+	}
+
+	return logBlocks;
+}
+
 bool OptimizeForInterpreter(const IRWriter &in, IRWriter &out, const IROptions &opts) {
 	CONDITIONAL_DISABLE;
 	// This tells us to skip an AND op that has been optimized out.
@@ -2292,6 +2346,24 @@ bool OptimizeForInterpreter(const IRWriter &in, IRWriter &out, const IROptions &
 			}
 			out.Write(inst);
 			break;
+		case IROp::Slt:
+		case IROp::SltU:
+			if (!last) {
+				// slt/sltu followed by a branch on the result against zero is very common,
+				// fuse it into one dispatch. The result is still written like Slt does.
+				IRInst next = in.GetInstructions()[i + 1];
+				if ((next.op == IROp::ExitToConstIfNeq || next.op == IROp::ExitToConstIfEq) && next.src1 == inst.dest && next.src2 == 0) {
+					bool exitOnLess = next.op == IROp::ExitToConstIfNeq;
+					if (inst.op == IROp::Slt)
+						inst.op = exitOnLess ? IROp::OptExitToConstIfLt : IROp::OptExitToConstIfGe;
+					else
+						inst.op = exitOnLess ? IROp::OptExitToConstIfLtU : IROp::OptExitToConstIfGeU;
+					inst.constant = next.constant;
+					i++;  // Skip the next instruction.
+				}
+			}
+			out.Write(inst);
+			break;
 		default:
 			out.Write(inst);
 			break;
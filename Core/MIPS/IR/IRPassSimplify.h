@@ -18,4 +18,5 @@ bool ApplyMemoryValidation(const IRWriter &in, IRWriter &out, const IROptions &o
 bool ReduceVec4Flush(const IRWriter &in, IRWriter &out, const IROptions &opts);
 
 bool OptimizeLoadsAfterStores(const IRWriter &in, IRWriter &out, const IROptions &opts);
+bool OptimizeVFPUPrefixes(const IRWriter &in, IRWriter &out, const IROptions &opts);
 bool OptimizeForInterpreter(const IRWriter &in, IRWriter &out, const IROptions &opts);
@@ -120,7 +120,7 @@ void JitBlockCache::Shutdown() {
 // This clears the JIT cache. It's called from JitCache.cpp when the JIT cache
 // is full and when saving and loading states.
 void JitBlockCache::Clear() {
-	block_map_.clear();
+	blockPageIndex_.clear();
 	proxyBlockMap_.clear();
 	for (int i = 0; i < num_blocks_; i++)
 		DestroyBlock(i, DestroyType::CLEAR);
@@ -218,8 +218,22 @@ void JitBlockCache::ProxyBlock(u32 rootAddress, u32 startAddress, u32 size, cons
 void JitBlockCache::AddBlockMap(int block_num) {
 	const JitBlock &b = blocks_[block_num];
 	// Convert the logical address to a physical address for the block map
-	u32 pAddr = b.originalAddress & 0x1FFFFFFF;
-	block_map_[std::make_pair(pAddr + 4 * b.originalSize, pAddr)] = block_num;
+	const u32 pAddr = b.originalAddress & 0x1FFFFFFF;
+	const u32 pLast = pAddr + 4 * b.originalSize - 1;
+	for (u32 page = pAddr >> BLOCK_PAGE_SHIFT; page <= pLast >> BLOCK_PAGE_SHIFT; page++) {
+		blockPageIndex_[page].push_back((u32)block_num);
+	}
+}
+
+static bool RemoveFromBucket(std::vector<u32> &blockNums, u32 block_num) {
+	for (size_t i = 0; i < blockNums.size(); i++) {
+		if (blockNums[i] == block_num) {
+			blockNums[i] = blockNums.back();
+			blockNums.pop_back();
+			return true;
+		}
+	}
+	return false;
 }
 
 void JitBlockCache::RemoveBlockMap(int block_num) {
@@ -229,16 +243,25 @@ void JitBlockCache::RemoveBlockMap(int block_num) {
 	}
 
 	const u32 pAddr = b.originalAddress & 0x1FFFFFFF;
-	auto it = block_map_.find(std::make_pair(pAddr + 4 * b.originalSize, pAddr));
-	if (it != block_map_.end() && it->second == (u32)block_num) {
-		block_map_.erase(it);
-	} else {
-		// It wasn't in there, or it has the wrong key.  Let's search...
-		for (auto it = block_map_.begin(); it != block_map_.end(); ++it) {
-			if (it->second == (u32)block_num) {
-				block_map_.erase(it);
-				break;
-			}
+	const u32 pLast = pAddr + 4 * b.originalSize - 1;
+	bool found = false;
+	for (u32 page = pAddr >> BLOCK_PAGE_SHIFT; page <= pLast >> BLOCK_PAGE_SHIFT; page++) {
+		auto bucket = blockPageIndex_.find(page);
+		if (bucket == blockPageIndex_.end())
+			continue;
+		if (RemoveFromBucket(bucket->second, (u32)block_num))
+			found = true;
+		if (bucket->second.empty())
+			blockPageIndex_.erase(bucket);
+	}
+	if (!found) {
+		// It wasn't where its current address says it should be.  Let's search...
+		for (auto it = blockPageIndex_.begin(); it != blockPageIndex_.end(); ) {
+			RemoveFromBucket(it->second, (u32)block_num);
+			if (it->second.empty())
+				it = blockPageIndex_.erase(it);
+			else
+				++it;
 		}
 	}
 }
@@ -603,25 +626,31 @@ void JitBlockCache::InvalidateICache(u32 address, const u32 length) {
 		return;
 	}
 
-	// Blocks may start and end in overlapping ways, and destroying one invalidates iterators.
-	// So after destroying one, we start over.
-	do {
-	restart:
-		auto next = block_map_.lower_bound(std::make_pair(pAddr, 0));
-		auto last = block_map_.upper_bound(std::make_pair(pEnd + MAX_BLOCK_INSTRUCTIONS, 0));
-		// Note that if next is end(), last will be end() too (equal.)
-		for (; next != last; ++next) {
-			const u32 blockStart = next->first.second;
-			const u32 blockEnd = next->first.first;
+	if (pEnd == pAddr) {
+		return;
+	}
+
+	// Only the page buckets the range touches need to be checked. Blocks can span
+	// pages so the same block may show up in several buckets - the invalid flag
+	// filters out the repeats.
+	for (u32 page = pAddr >> BLOCK_PAGE_SHIFT; page <= (pEnd - 1) >> BLOCK_PAGE_SHIFT; page++) {
+		auto bucket = blockPageIndex_.find(page);
+		if (bucket == blockPageIndex_.end())
+			continue;
+		// DestroyBlock edits the index (and can destroy proxied blocks in other
+		// buckets), so walk a copy.
+		const std::vector<u32> blockNums = bucket->second;
+		for (const u32 blockNum : blockNums) {
+			const JitBlock &b = blocks_[blockNum];
+			if (b.invalid)
+				continue;
+			const u32 blockStart = b.originalAddress & 0x1FFFFFFF;
+			const u32 blockEnd = blockStart + 4 * b.originalSize;
 			if (blockStart < pEnd && blockEnd > pAddr) {
-				DestroyBlock(next->second, DestroyType::INVALIDATE);
-				// Our iterator is now invalid.  Break and search again.
-				// Most of the time there shouldn't be a bunch of matching blocks.
-				goto restart;
+				DestroyBlock((int)blockNum, DestroyType::INVALIDATE);
 			}
 		}
-		// We got here - it wasn't in the map at all (or anymore.)
-	} while (false);
+	}
 }
 
 void JitBlockCache::InvalidateChangedBlocks() {
@@ -668,8 +697,19 @@ void JitBlockCache::ComputeStats(BlockCacheStats &bcStats) const {
 	double totalBloat = 0.0;
 	double maxBloat = 0.0;
 	double minBloat = 1000000000.0;
+	int numExits = 0;
+	int numLinkedExits = 0;
 	for (int i = 0; i < num_blocks_; i++) {
 		const JitBlock *b = GetBlock(i);
+		if (!b->invalid && !b->IsPureProxy()) {
+			for (int e = 0; e < MAX_JIT_BLOCK_EXITS; e++) {
+				if (b->exitAddress[e] != INVALID_EXIT) {
+					numExits++;
+					if (b->linkStatus[e])
+						numLinkedExits++;
+				}
+			}
+		}
 		double codeSize = (double)b->codeSize;
 		if (codeSize == 0)
 			continue;
@@ -689,6 +729,8 @@ void JitBlockCache::ComputeStats(BlockCacheStats &bcStats) const {
 	bcStats.minBloat = (float)minBloat;
 	bcStats.maxBloat = (float)maxBloat;
 	bcStats.avgBloat = (float)(totalBloat / (double)num_blocks_);
+	bcStats.numExits = numExits;
+	bcStats.numLinkedExits = numLinkedExits;
 }
 
 JitBlockDebugInfo JitBlockCache::GetBlockDebugInfo(int blockNum) const {
@@ -18,7 +18,6 @@
 #pragma once
 
 #include <cstdint>
-#include <map>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -42,6 +41,10 @@ struct BlockCacheStats {
 	u32 minBloatBlock;
 	float maxBloat;
 	u32 maxBloatBlock;
+	// Block linking. Exits that aren't linked bounce through the dispatcher.
+	// Zero for jits without native block linking (IR interpreter).
+	int numExits;
+	int numLinkedExits;
 };
 
 enum class DestroyType {
@@ -216,7 +219,15 @@ private:
 
 	int num_blocks_ = 0;
 	std::unordered_multimap<u32, int> links_to_;
-	std::map<std::pair<u32,u32>, u32> block_map_; // (end_addr, start_addr) -> number
+
+	enum {
+		// 4K pages. Blocks can span up to MAX_BLOCK_INSTRUCTIONS * 4 bytes, so a block
+		// may be registered in multiple buckets.
+		BLOCK_PAGE_SHIFT = 12,
+	};
+	// Physical page -> numbers of the blocks overlapping that page. Used so that
+	// InvalidateICache only has to look at the pages the range actually touches.
+	std::unordered_map<u32, std::vector<u32>> blockPageIndex_;
 
 	enum {
 		JITBLOCK_RANGE_SCRATCH = 0,
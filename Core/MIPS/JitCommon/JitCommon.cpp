@@ -17,21 +17,27 @@
 
 #include "ppsspp_config.h"
 #include <cstdlib>
+#include <deque>
 #include <mutex>
 
 #include "ext/disarm.h"
 #include "ext/riscv-disas.h"
 #include "ext/udis86/udis86.h"
 
+#include "Common/File/FileUtil.h"
+#include "Common/File/Path.h"
 #include "Common/LogReporting.h"
 #include "Common/StringUtils.h"
+#include "Common/TimeUtil.h"
 #include "Common/Serialize/Serializer.h"
 #include "Common/Serialize/SerializeFuncs.h"
 
 #include "Core/Util/DisArm64.h"
 #include "Core/Config.h"
 
+#include "Core/MemMap.h"
 #include "Core/MIPS/IR/IRJit.h"
+#include "Core/MIPS/JitCommon/JitBlockCache.h"
 #include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/MIPS/JitCommon/JitState.h"
 #include "Core/MIPS/MIPSCodeUtils.h"
@@ -63,6 +69,114 @@ namespace MIPSComp {
 		jit->Compile(currentMIPS->pc);
 	}
 
+	static std::mutex compileQueueLock;
+	static std::deque<std::pair<u32, u32>> compileQueue;
+
+	void QueueCompileFunction(u32 startAddr, u32 length) {
+		std::lock_guard<std::mutex> guard(compileQueueLock);
+		compileQueue.emplace_back(startAddr, length);
+	}
+
+	void ProcessCompileQueue() {
+		// Budget roughly half a millisecond per call - at one call per flip, even a big
+		// module's worth of functions drains within a few seconds of gameplay.
+		const double deadline = time_now_d() + 0.0005;
+		while (true) {
+			std::pair<u32, u32> entry;
+			{
+				std::lock_guard<std::mutex> guard(compileQueueLock);
+				if (compileQueue.empty())
+					return;
+				entry = compileQueue.front();
+				compileQueue.pop_front();
+			}
+			{
+				std::lock_guard<std::recursive_mutex> guard(jitLock);
+				if (jit)
+					jit->CompileFunction(entry.first, entry.second);
+			}
+			if (time_now_d() >= deadline)
+				return;
+		}
+	}
+
+	void ClearCompileQueue() {
+		std::lock_guard<std::mutex> guard(compileQueueLock);
+		compileQueue.clear();
+	}
+
+	static constexpr u32 BLOCK_ADDRESS_CACHE_MAGIC = 0x434A5050;  // 'PPJC'
+	static constexpr u32 BLOCK_ADDRESS_CACHE_VERSION = 1;
+	// Sanity bound in case the file is corrupt - way more blocks than any real game has.
+	static constexpr u32 BLOCK_ADDRESS_CACHE_MAX_ENTRIES = 262144;
+
+	bool SaveBlockAddressCache(const Path &filename) {
+		std::lock_guard<std::recursive_mutex> guard(jitLock);
+		if (!jit)
+			return false;
+		JitBlockCacheDebugInterface *blockCache = jit->GetBlockCacheDebugInterface();
+		if (!blockCache)
+			return false;
+
+		// Pairs of (entry address, size in bytes) for every live block.
+		std::vector<u32> entries;
+		const int numBlocks = blockCache->GetNumBlocks();
+		entries.reserve(numBlocks * 2);
+		for (int i = 0; i < numBlocks; i++) {
+			JitBlockMeta meta = blockCache->GetBlockMeta(i);
+			if (!meta.valid || meta.sizeInBytes == 0)
+				continue;
+			entries.push_back(meta.addr);
+			entries.push_back(meta.sizeInBytes);
+		}
+		if (entries.empty())
+			return false;
+
+		FILE *f = File::OpenCFile(filename, "wb");
+		if (!f)
+			return false;
+		const u32 header[3] = { BLOCK_ADDRESS_CACHE_MAGIC, BLOCK_ADDRESS_CACHE_VERSION, (u32)(entries.size() / 2) };
+		bool success = fwrite(header, sizeof(header), 1, f) == 1;
+		if (success)
+			success = fwrite(entries.data(), sizeof(u32), entries.size(), f) == entries.size();
+		fclose(f);
+		if (success)
+			INFO_LOG(Log::JIT, "Saved %d jit block addresses to '%s'", (int)(entries.size() / 2), filename.c_str());
+		return success;
+	}
+
+	bool LoadBlockAddressCache(const Path &filename) {
+		FILE *f = File::OpenCFile(filename, "rb");
+		if (!f)
+			return false;
+		u32 header[3];
+		if (fread(header, sizeof(header), 1, f) != 1 || header[0] != BLOCK_ADDRESS_CACHE_MAGIC ||
+			header[1] != BLOCK_ADDRESS_CACHE_VERSION || header[2] == 0 || header[2] > BLOCK_ADDRESS_CACHE_MAX_ENTRIES) {
+			WARN_LOG(Log::JIT, "Ignoring bad jit block address cache '%s'", filename.c_str());
+			fclose(f);
+			return false;
+		}
+		std::vector<u32> entries(header[2] * 2);
+		const bool success = fread(entries.data(), sizeof(u32), entries.size(), f) == entries.size();
+		fclose(f);
+		if (!success)
+			return false;
+
+		int queued = 0;
+		for (u32 i = 0; i < header[2]; i++) {
+			const u32 addr = entries[i * 2];
+			const u32 size = entries[i * 2 + 1];
+			// The game's code layout may have changed (different save, updated game) - bad
+			// entries just result in some extra blocks that never run, but don't queue garbage.
+			if (size == 0 || !Memory::IsValidRange(addr, size))
+				continue;
+			QueueCompileFunction(addr, size);
+			queued++;
+		}
+		INFO_LOG(Log::JIT, "Queued %d jit blocks for precompilation from '%s'", queued, filename.c_str());
+		return queued > 0;
+	}
+
 	void DoDummyJitState(PointerWrap &p) {
 		// This is here so the savestate matches between jit and non-jit.
 		auto s = p.Section("Jit", 1, 2);
@@ -34,6 +34,7 @@ struct JitBlock;
 class JitBlockCache;
 class JitBlockCacheDebugInterface;
 class PointerWrap;
+class Path;
 
 #ifdef USING_QT_UI
 #undef emit
@@ -175,6 +176,20 @@ namespace MIPSComp {
 	extern JitInterface *jit;
 	extern std::recursive_mutex jitLock;
 
+	// Functions discovered by MIPSAnalyst can be queued here and compiled in small,
+	// time-budgeted batches on the CPU thread instead of all at once at module load.
+	// Anything not yet drained just compiles lazily through the dispatcher as before.
+	void QueueCompileFunction(u32 startAddr, u32 length);
+	void ProcessCompileQueue();
+	void ClearCompileQueue();
+
+	// Persistent per-game cache of jit block entry points. On the next boot of the same
+	// game, the recorded entries are queued for precompilation (through the compile queue)
+	// instead of being rediscovered lazily at runtime. The native code itself is not
+	// cached - just where the blocks start, which is what's expensive to find again.
+	bool SaveBlockAddressCache(const Path &filename);
+	bool LoadBlockAddressCache(const Path &filename);
+
 	void DoDummyJitState(PointerWrap &p);
 
 	JitInterface *CreateNativeJit(MIPSState *mipsState, bool useIR);
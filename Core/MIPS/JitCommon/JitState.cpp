@@ -18,6 +18,7 @@
 #include "ppsspp_config.h"
 #include "Common/CPUDetect.h"
 #include "Core/Config.h"
+#include "Core/System.h"
 #include "Core/MIPS/JitCommon/JitState.h"
 #include "Common/MemoryUtil.h"
 
@@ -58,6 +59,12 @@ namespace MIPSComp {
 		continueJumps = false;
 		continueMaxInstructions = 300;
 
+		// Titles known to tolerate aggressive linking opt in via perfhints.ini.
+		if (PSP_CoreParameter().compat.hints().AggressiveBlockLink && !Disabled(JitDisable::BLOCKLINK)) {
+			continueBranches = true;
+			continueJumps = true;
+		}
+
 		useStaticAlloc = false;
 		enablePointerify = false;
 #if PPSSPP_ARCH(ARM64) || PPSSPP_ARCH(RISCV64)
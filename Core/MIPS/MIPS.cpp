@@ -161,6 +161,7 @@ MIPSState::~MIPSState() {
 }
 
 void MIPSState::Shutdown() {
+	MIPSComp::ClearCompileQueue();
 	std::lock_guard<std::recursive_mutex> guard(MIPSComp::jitLock);
 	MIPSComp::JitInterface *oldjit = MIPSComp::jit;
 	if (oldjit) {
@@ -276,11 +277,15 @@ void MIPSState::DoState(PointerWrap &p) {
 	// Reset the jit if we're loading.
 	if (p.mode == p.MODE_READ)
 		Reset();
-	// Assume we're not saving state during a CPU core reset, so no lock.
-	if (MIPSComp::jit)
-		MIPSComp::jit->DoState(p);
-	else
-		MIPSComp::DoDummyJitState(p);
+	// Minimal states skip the jit section - Reset() above already dropped the block
+	// cache, and the jit rebuilds lazily from there like after any state load.
+	if (p.profile != p.PROFILE_MINIMAL) {
+		// Assume we're not saving state during a CPU core reset, so no lock.
+		if (MIPSComp::jit)
+			MIPSComp::jit->DoState(p);
+		else
+			MIPSComp::DoDummyJitState(p);
+	}
 
 	DoArray(p, r, sizeof(r) / sizeof(r[0]));
 	DoArray(p, f, sizeof(f) / sizeof(f[0]));
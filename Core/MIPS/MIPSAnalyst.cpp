@@ -29,6 +29,7 @@
 #include "Common/File/FileUtil.h"
 #include "Common/Log.h"
 #include "Common/StringUtils.h"
+#include "Common/Thread/ParallelLoop.h"
 #include "Common/TimeUtil.h"
 #include "Core/Config.h"
 #include "Core/MemMap.h"
@@ -38,6 +39,7 @@
 #include "Core/MIPS/MIPSTables.h"
 #include "Core/MIPS/MIPSAnalyst.h"
 #include "Core/MIPS/MIPSCodeUtils.h"
+#include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/Debugger/SymbolMap.h"
 #include "Core/Debugger/DebugInterface.h"
 #include "Core/HLE/ReplaceTables.h"
@@ -870,40 +872,61 @@ namespace MIPSAnalyst {
 		return DetermineRegisterUsage(reg, addr, instrs) == USAGE_CLOBBERED;
 	}
 
-	void HashFunctions() {
+	void HashFunctions(bool rehashAll) {
 		std::lock_guard<std::recursive_mutex> guard(functions_lock);
-		std::vector<u32> buffer;
 
+		// Collect the work up front so the parallel loop can index it. After a rescan
+		// following an icache invalidation, only the re-discovered functions need a
+		// hash - the survivors' code didn't change, ForgetFunctions erased the rest.
+		std::vector<AnalyzedFunction *> toHash;
+		toHash.reserve(functions.size());
 		for (auto iter = functions.begin(), end = functions.end(); iter != end; iter++) {
 			AnalyzedFunction &f = *iter;
-			if (!Memory::IsValidRange(f.start, f.end - f.start + 4)) {
+			if (!rehashAll && f.hasHash)
 				continue;
-			}
+			if (!Memory::IsValidRange(f.start, f.end - f.start + 4))
+				continue;
+			toHash.push_back(&f);
+		}
+		if (toHash.empty())
+			return;
 
+		// Each function hashes independently, so fan out across the thread pool - this
+		// dominates module load time for large games. Hold the jit lock so emuhack
+		// resolution doesn't race block invalidation.
+		std::lock_guard<std::recursive_mutex> jitGuard(MIPSComp::jitLock);
+		ParallelRangeLoop(&g_threadManager, [&](int l, int h) {
 			// This is unfortunate.  In case of emuhacks or relocs, we have to make a copy.
-			buffer.resize((f.end - f.start + 4) / 4);
-			size_t pos = 0;
-			for (u32 addr = f.start; addr <= f.end; addr += 4) {
-				u32 validbits = 0xFFFFFFFF;
-				MIPSOpcode instr = Memory::ReadUnchecked_Instruction(addr, true);
-				if (MIPS_IS_EMUHACK(instr)) {
-					f.hasHash = false;
-					goto skip;
+			std::vector<u32> buffer;
+			for (int i = l; i < h; i++) {
+				AnalyzedFunction &f = *toHash[i];
+				buffer.resize((f.end - f.start + 4) / 4);
+				size_t pos = 0;
+				bool hashable = true;
+				for (u32 addr = f.start; addr <= f.end; addr += 4) {
+					u32 validbits = 0xFFFFFFFF;
+					MIPSOpcode instr = Memory::ReadUnchecked_Instruction(addr, true);
+					if (MIPS_IS_EMUHACK(instr)) {
+						hashable = false;
+						break;
+					}
+
+					MIPSInfo flags = MIPSGetInfo(instr);
+					if (flags & IN_IMM16)
+						validbits &= ~0xFFFF;
+					if (flags & IN_IMM26)
+						validbits &= ~0x03FFFFFF;
+					buffer[pos++] = instr & validbits;
 				}
 
-				MIPSInfo flags = MIPSGetInfo(instr);
-				if (flags & IN_IMM16)
-					validbits &= ~0xFFFF;
-				if (flags & IN_IMM26)
-					validbits &= ~0x03FFFFFF;
-				buffer[pos++] = instr & validbits;
+				if (hashable) {
+					f.hash = CityHash64((const char *)&buffer[0], buffer.size() * sizeof(u32));
+					f.hasHash = true;
+				} else {
+					f.hasHash = false;
+				}
 			}
-
-			f.hash = CityHash64((const char *) &buffer[0], buffer.size() * sizeof(u32));
-			f.hasHash = true;
-skip:
-			;
-		}
+		}, 0, (int)toHash.size(), 16);
 	}
 
 	void PrecompileFunction(u32 startAddr, u32 length) {
@@ -922,15 +945,15 @@ skip:
 
 		// TODO: Load from cache file if available instead.
 
-		double st = time_now_d();
+		// Queue them up and let the CPU thread drain the queue a bit at a time
+		// (see MIPSComp::ProcessCompileQueue()), so a large module doesn't stall the load.
 		for (auto iter = functions.begin(), end = functions.end(); iter != end; iter++) {
 			const AnalyzedFunction &f = *iter;
 
-			PrecompileFunction(f.start, f.end - f.start + 4);
+			MIPSComp::QueueCompileFunction(f.start, f.end - f.start + 4);
 		}
-		double et = time_now_d();
 
-		NOTICE_LOG(Log::JIT, "Precompiled %d MIPS functions in %0.2f milliseconds", (int)functions.size(), (et - st) * 1000.0);
+		NOTICE_LOG(Log::JIT, "Queued %d MIPS functions for precompilation", (int)functions.size());
 	}
 
 	static const char *DefaultFunctionName(char buffer[256], u32 startAddr) {
@@ -1179,7 +1202,8 @@ skip:
 	}
 
 	void FinalizeScan(bool insertSymbols) {
-		HashFunctions();
+		// Incremental: functions that survived since the last scan keep their hash.
+		HashFunctions(false);
 
 		if (g_Config.bFuncHashMap || g_Config.bFuncReplacements) {
 			LoadBuiltinHashMap();
@@ -1225,7 +1249,7 @@ skip:
 		}
 
 		// Cheats a little.
-		AnalyzedFunction fun;
+		AnalyzedFunction fun{};
 		fun.start = startAddr;
 		fun.end = startAddr + size - 4;
 		fun.isStraightLeaf = false;  // dunno really
@@ -1233,7 +1257,7 @@ skip:
 		fun.name[63] = 0;
 		functions.push_back(fun);
 
-		HashFunctions();
+		HashFunctions(false);
 	}
 
 	void ForgetFunctions(u32 startAddr, u32 endAddr) {
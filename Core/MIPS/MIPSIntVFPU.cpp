@@ -22,6 +22,7 @@
 #include <algorithm>
 
 #include "Common/Data/Convert/SmallDataConvert.h"
+#include "Common/Math/CrossSIMD.h"
 #include "Common/Math/math_util.h"
 
 #include "Core/Compatibility.h"
@@ -478,6 +479,45 @@ namespace MIPSInt
 
 		// TODO: Always use the more accurate path in interpreter?
 		bool useAccurateDot = USE_VFPU_DOT || PSP_CoreParameter().compat.flags().MoreAccurateVMMUL;
+
+#if PPSSPP_ARCH(SSE2) || PPSSPP_ARCH(ARM_NEON)
+		// Fast path for the common case: full 4x4, no active prefixes, simple dot mode.
+		// One multiply-add chain per output row instead of 16 scalar dots.
+		if (sz == M_4x4 && !useAccurateDot && currentMIPS->HasDefaultPrefix()) {
+#if PPSSPP_ARCH(SSE2)
+			__m128 c0 = _mm_loadu_ps(&s[0]);
+			__m128 c1 = _mm_loadu_ps(&s[4]);
+			__m128 c2 = _mm_loadu_ps(&s[8]);
+			__m128 c3 = _mm_loadu_ps(&s[12]);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+			for (int a = 0; a < 4; a++) {
+				__m128 sum = _mm_mul_ps(c0, _mm_set1_ps(t[a * 4 + 0]));
+				sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(t[a * 4 + 1])));
+				sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(t[a * 4 + 2])));
+				sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(t[a * 4 + 3])));
+				_mm_storeu_ps(&d[a * 4], sum);
+			}
+#else
+			// vld4 deinterleaves, giving us the columns of s directly.
+			float32x4x4_t sc = vld4q_f32(s);
+			for (int a = 0; a < 4; a++) {
+				float32x4_t ta = vld1q_f32(&t[a * 4]);
+				float32x4_t sum = vmulq_laneq_f32(sc.val[0], ta, 0);
+				sum = vmlaq_laneq_f32(sum, sc.val[1], ta, 1);
+				sum = vmlaq_laneq_f32(sum, sc.val[2], ta, 2);
+				sum = vmlaq_laneq_f32(sum, sc.val[3], ta, 3);
+				vst1q_f32(&d[a * 4], sum);
+			}
+#endif
+			// With default prefixes, the D prefix pass below is an identity, skip it.
+			currentMIPS->vfpuCtrl[VFPU_CTRL_DPREFIX] = 0;
+			WriteMatrix(d, sz, vd);
+			PC += 4;
+			EatPrefixes();
+			return;
+		}
+#endif
+
 		for (int a = 0; a < n; a++) {
 			for (int b = 0; b < n; b++) {
 				union { float f; uint32_t u; } sum = { 0.0f };
@@ -1668,6 +1708,38 @@ namespace MIPSInt
 		ReadMatrix(s, msz, vs);
 		ReadVector(t, sz, vt);
 
+#if PPSSPP_ARCH(SSE2) || PPSSPP_ARCH(ARM_NEON)
+		// Fast path for vtfm4 with no active prefixes - by far the most common use
+		// (skinning, transform). All four rows are then plain dots against t.
+		if (!USE_VFPU_DOT && ins == 3 && n == 4 && currentMIPS->HasDefaultPrefix()) {
+#if PPSSPP_ARCH(SSE2)
+			__m128 c0 = _mm_loadu_ps(&s[0]);
+			__m128 c1 = _mm_loadu_ps(&s[4]);
+			__m128 c2 = _mm_loadu_ps(&s[8]);
+			__m128 c3 = _mm_loadu_ps(&s[12]);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+			__m128 sum = _mm_mul_ps(c0, _mm_set1_ps(t[0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(t[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(t[2])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(t[3])));
+			_mm_storeu_ps(d.f, sum);
+#else
+			float32x4x4_t sc = vld4q_f32(s);
+			float32x4_t tv = vld1q_f32(t);
+			float32x4_t sum = vmulq_laneq_f32(sc.val[0], tv, 0);
+			sum = vmlaq_laneq_f32(sum, sc.val[1], tv, 1);
+			sum = vmlaq_laneq_f32(sum, sc.val[2], tv, 2);
+			sum = vmlaq_laneq_f32(sum, sc.val[3], tv, 3);
+			vst1q_f32(d.f, sum);
+#endif
+			currentMIPS->vfpuCtrl[VFPU_CTRL_DPREFIX] = 0;
+			WriteVector(d.f, sz, vd);
+			PC += 4;
+			EatPrefixes();
+			return;
+		}
+#endif
+
 		if (USE_VFPU_DOT) {
 			float t2[4];
 			for (int i = 0; i < 4; i++) {
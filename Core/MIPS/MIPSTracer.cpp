@@ -18,11 +18,104 @@
 #include "Core/MIPS/MIPSTracer.h"
 
 #include <cstring> // for std::memcpy
+#include "Core/MIPS/MIPS.h" // for mipsr4k.ClearJitCache
 #include "Core/MIPS/MIPSTables.h" // for MIPSDisAsm
 #include "Core/MemMap.h" // for Memory::GetPointerUnchecked
 #include "Common/File/FileUtil.h" // for the File::OpenCFile
 
 
+void DeltaTraceRing::put_byte(u8 value) {
+	if (head - tail == buffer.size()) {
+		// Overwrite the oldest byte. Keyframes that lost their first byte are useless now.
+		++tail;
+		overflow = true;
+		while (!keyframes.empty() && keyframes.front() < tail) {
+			keyframes.pop_front();
+		}
+	}
+	buffer[head % buffer.size()] = value;
+	++head;
+}
+
+void DeltaTraceRing::push_back(u32 index) {
+	if (buffer.empty()) {
+		return;
+	}
+
+	if (entries_until_keyframe == 0) {
+		keyframes.push_back(head);
+		put_byte(index & 0xFF);
+		put_byte((index >> 8) & 0xFF);
+		put_byte((index >> 16) & 0xFF);
+		put_byte((index >> 24) & 0xFF);
+		entries_until_keyframe = KEYFRAME_INTERVAL;
+	} else {
+		s32 delta = (s32)(index - prev_index);
+		u32 zigzag = ((u32)delta << 1) ^ (u32)(delta >> 31);
+		do {
+			u8 b = zigzag & 0x7F;
+			zigzag >>= 7;
+			if (zigzag != 0) {
+				b |= 0x80;
+			}
+			put_byte(b);
+		} while (zigzag != 0);
+	}
+	--entries_until_keyframe;
+	prev_index = index;
+}
+
+std::vector<u32> DeltaTraceRing::get_content() const {
+	std::vector<u32> result;
+	if (keyframes.empty()) {
+		return result;
+	}
+
+	u64 pos = keyframes.front();
+	size_t next_keyframe = 0;
+	u32 prev = 0;
+	while (pos < head) {
+		if (next_keyframe < keyframes.size() && pos == keyframes[next_keyframe]) {
+			u32 value = buffer[pos % buffer.size()];
+			value |= (u32)buffer[(pos + 1) % buffer.size()] << 8;
+			value |= (u32)buffer[(pos + 2) % buffer.size()] << 16;
+			value |= (u32)buffer[(pos + 3) % buffer.size()] << 24;
+			pos += 4;
+			++next_keyframe;
+			prev = value;
+		} else {
+			u32 zigzag = 0;
+			int shift = 0;
+			u8 b;
+			do {
+				b = buffer[pos % buffer.size()];
+				++pos;
+				zigzag |= (u32)(b & 0x7F) << shift;
+				shift += 7;
+			} while (b & 0x80);
+			s32 delta = (s32)((zigzag >> 1) ^ (u32)-(s32)(zigzag & 1));
+			prev = (u32)((s32)prev + delta);
+		}
+		result.push_back(prev);
+	}
+	return result;
+}
+
+void DeltaTraceRing::clear() {
+	buffer.clear();
+	head = 0;
+	tail = 0;
+	prev_index = 0;
+	entries_until_keyframe = 0;
+	keyframes.clear();
+	overflow = false;
+}
+
+void DeltaTraceRing::resize(u32 capacity_bytes) {
+	clear();
+	buffer.resize(capacity_bytes);
+}
+
 bool TraceBlockStorage::save_block(const u32* instructions, u32 size) {
 	// 'size' is measured in bytes
 	const auto indexes_count = size / 4;
@@ -152,6 +245,9 @@ void MIPSTracer::start_tracing() {
 	if (!tracing_enabled) {
 		INFO_LOG(Log::JIT, "MIPSTracer enabled");
 		tracing_enabled = true;
+		// Drop all blocks compiled without the trace hook, the same way toggling a
+		// breakpoint does. Blocks compiled from here on carry LogIRBlock.
+		mipsr4k.ClearJitCache();
 	}
 }
 
@@ -159,6 +255,10 @@ void MIPSTracer::stop_tracing() {
 	if (tracing_enabled) {
 		INFO_LOG(Log::JIT, "MIPSTracer disabled");
 		tracing_enabled = false;
+		// Recompile everything without the hook - with the instrumentation gone,
+		// tracing is free when it's off. Safe even mid-compile: the clear is
+		// deferred while we're inside the jit.
+		mipsr4k.ClearJitCache();
 
 #ifdef _DEBUG
 		print_stats();
@@ -171,15 +271,15 @@ inline void MIPSTracer::print_stats() const {
 	INFO_LOG(Log::JIT, "=============== MIPSTracer storage ===============");
 	INFO_LOG(Log::JIT, "Current index = %d, storage size = %d", storage.cur_index, (int)storage.raw_instructions.size());
 
-	// Then the cyclic buffer
+	// Then the compressed ring
 	if (executed_blocks.overflow) {
-		INFO_LOG(Log::JIT, "=============== MIPSTracer cyclic buffer (overflow) ===============");
-		INFO_LOG(Log::JIT, "Trace size = %d, starts from index %d", (int)executed_blocks.buffer.size(), executed_blocks.current_index);
+		INFO_LOG(Log::JIT, "=============== MIPSTracer trace ring (overflow) ===============");
 	}
 	else {
-		INFO_LOG(Log::JIT, "=============== MIPSTracer cyclic buffer (no overflow) ===============");
-		INFO_LOG(Log::JIT, "Trace size = %d, starts from index 0", executed_blocks.current_index);
+		INFO_LOG(Log::JIT, "=============== MIPSTracer trace ring (no overflow) ===============");
 	}
+	INFO_LOG(Log::JIT, "Trace ring: %d/%d bytes used, %d keyframes",
+		(int)executed_blocks.bytes_used(), (int)executed_blocks.buffer.size(), (int)executed_blocks.keyframes.size());
 	// Next, the hash-to-index mapping
 	INFO_LOG(Log::JIT, "=============== MIPSTracer hashes ===============");
 	INFO_LOG(Log::JIT, "Number of unique hashes = %d", (int)hash_to_storage_index.size());
@@ -192,7 +292,9 @@ inline void MIPSTracer::print_stats() const {
 }
 
 void MIPSTracer::initialize(u32 storage_capacity, u32 max_trace_size) {
-	executed_blocks.resize(max_trace_size);
+	// Same byte budget the raw u32 ring used to take - the delta encoding is what
+	// stretches it to several times as many entries.
+	executed_blocks.resize(max_trace_size * sizeof(u32));
 	hash_to_storage_index.reserve(max_trace_size);
 	storage.initialize(storage_capacity);
 	trace_info.reserve(max_trace_size);
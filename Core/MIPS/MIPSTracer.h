@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <deque>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -26,7 +27,6 @@
 #include "Core/MIPS/IR/IRJit.h"
 #include "Common/Log.h"
 #include "Common/File/Path.h"
-#include "Common/Data/Collections/CyclicBuffer.h"
 
 
 struct TraceBlockInfo {
@@ -34,6 +34,40 @@ struct TraceBlockInfo {
 	u32 storage_index;
 };
 
+// Ring of executed-block indices with on-the-fly compression. A trace is dominated
+// by small hops between neighboring blocks (loops, fallthroughs), so instead of raw
+// u32s we store zigzag varint deltas from the previous index - typically one byte per
+// entry instead of four, which makes the same ring budget hold several times more
+// history. Every KEYFRAME_INTERVAL entries the absolute index is stored and its
+// position remembered, so after the ring wraps, decoding restarts at the oldest
+// surviving keyframe and only the entries before it are lost.
+struct DeltaTraceRing {
+	std::vector<u8> buffer;
+	// Absolute byte positions; the ring slot is pos % buffer.size().
+	u64 head = 0;
+	u64 tail = 0;
+	u32 prev_index = 0;
+	u32 entries_until_keyframe = 0;
+	std::deque<u64> keyframes;
+	bool overflow = false;
+
+	static const u32 KEYFRAME_INTERVAL = 64;
+
+	void push_back(u32 index);
+
+	void clear();
+	void resize(u32 capacity_bytes);
+
+	u64 bytes_used() const {
+		return head - tail;
+	}
+
+	std::vector<u32> get_content() const;
+
+private:
+	void put_byte(u8 value);
+};
+
 struct TraceBlockStorage {
 	std::vector<u32> raw_instructions;
 	u32 cur_index;
@@ -71,7 +105,7 @@ struct MIPSTracer {
 	std::vector<TraceBlockInfo> trace_info;
 
 	// The trace might be very big, in that case I don't mind losing the oldest entries.
-	CyclicBuffer<u32> executed_blocks;
+	DeltaTraceRing executed_blocks;
 
 	std::unordered_map<u64, u32> hash_to_storage_index;
 
@@ -107,6 +107,14 @@ bool HandleFault(uintptr_t hostAddress, void *ctx) {
 		return false;
 	inCrashHandler = true;
 
+	// Writes to pages under dirty tracking fault regardless of whether they come from
+	// jitted or host code, so this check goes before any jit-specific filtering.
+	// The page has been unprotected when this returns true - just retry the write.
+	if (DirtyPageTracking_HandleFault(hostAddress)) {
+		inCrashHandler = false;
+		return true;
+	}
+
 	SContext *context = (SContext *)ctx;
 	const uint8_t *codePtr = (uint8_t *)(context->CTX_PC);
 
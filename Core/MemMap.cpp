@@ -22,9 +22,11 @@
 #endif
 
 #include <algorithm>
+#include <cstring>
 #include <mutex>
 
 #include "Common/Common.h"
+#include "Common/MachineContext.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MemArena.h"
 #include "Common/Serialize/Serializer.h"
@@ -44,6 +46,8 @@
 #include "Core/MIPS/JitCommon/JitBlockCache.h"
 #include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Common/Thread/ParallelLoop.h"
+#include "Common/Thread/Waitable.h"
+#include "ext/xxhash.h"
 
 namespace Memory {
 
@@ -77,6 +81,8 @@ u32 g_MemorySize;
 // Used to store the PSP model on game startup.
 u32 g_PSPModel;
 
+u8 *g_softTLB[SOFT_TLB_ENTRIES];
+
 std::recursive_mutex g_shutdownLock;
 
 // We don't declare the IO region in here since its handled by other means.
@@ -309,6 +315,23 @@ bool Init() {
 		return false;
 	}
 
+	// Build the software page table from the views that actually got mapped.
+	memset(g_softTLB, 0, sizeof(g_softTLB));
+	for (size_t i = 0; i < ARRAY_SIZE(views); i++) {
+		const MemoryView &view = views[i];
+		if (!*view.out_ptr || view.size == 0)
+			continue;
+		// Scratchpad mirroring is stricter than the masked page index, leave it out.
+		if (view.size < SOFT_TLB_PAGE_SIZE || (view.virtual_address & 0x3FFFFFFF) == 0x00010000)
+			continue;
+		const u32 start = view.virtual_address & 0x3FFFFFFF;
+		for (u32 off = 0; off + SOFT_TLB_PAGE_SIZE <= view.size; off += SOFT_TLB_PAGE_SIZE) {
+			const u32 page = (start + off) >> SOFT_TLB_PAGE_BITS;
+			if (page < SOFT_TLB_ENTRIES)
+				g_softTLB[page] = *view.out_ptr + off;
+		}
+	}
+
 	INFO_LOG(Log::MemMap, "Memory system initialized. Base at %p (RAM at @ %p, uncached @ %p)",
 		base, m_pPhysicalRAM, m_pUncachedRAM);
 
@@ -397,12 +420,327 @@ void DoState(PointerWrap &p) {
 
 void Shutdown() {
 	std::lock_guard<std::recursive_mutex> guard(g_shutdownLock);
+	CheckpointHash_Stop();
+	DirtyPageTracking_Stop();
+	ShadowRAM_Unmap();
 	u32 flags = 0;
+	memset(g_softTLB, 0, sizeof(g_softTLB));
 	MemoryMap_Shutdown(flags);
 	base = nullptr;
 	DEBUG_LOG(Log::MemMap, "Memory system shut down.");
 }
 
+// ===================
+// Dirty page tracking
+// ===================
+//
+// All RAM views are mapped read-only while tracking is active, so the first write to
+// each page faults. HandleFault() routes such faults here - we mark the page dirty,
+// lift the protection on every view of it and let the write retry. Since writes can
+// come from jitted code as well as from host code holding a GetPointer, this covers
+// both without any instrumentation on the hot paths.
+//
+// The page granularity is the host's protection granularity (16K on Apple Silicon),
+// never less than 4K. A page that faults stays writable until the next Flip().
+
+static std::mutex g_dirtyPageLock;
+static std::vector<u8> g_dirtyPageMap;
+static u32 g_dirtyPageSize;
+static bool g_dirtyTrackingActive = false;
+
+// Calls f(hostPtr, ramOffset, size) for every mapped view of RAM. The extra views are
+// the second and third 31 MB chunks - on standard 32 MB RAM, extra1 holds the last meg.
+template <class F>
+static void ForEachRAMView(F f) {
+	for (int i = 0; i < num_views; i++) {
+		const MemoryView &view = views[i];
+		if (!*view.out_ptr || view.size == 0 || CanIgnoreView(view))
+			continue;
+		u32 ramOffset;
+		if (view.flags & MV_IS_PRIMARY_RAM)
+			ramOffset = 0;
+		else if (view.flags & MV_IS_EXTRA1_RAM)
+			ramOffset = 31 * 1024 * 1024;
+		else if (view.flags & MV_IS_EXTRA2_RAM)
+			ramOffset = 62 * 1024 * 1024;
+		else
+			continue;
+		f(*view.out_ptr, ramOffset, view.size);
+	}
+}
+
+bool DirtyPageTracking_Start() {
+#ifndef MACHINE_CONTEXT_SUPPORTED
+	// Without an exception handler the faults would just crash us.
+	return false;
+#else
+	std::lock_guard<std::mutex> guard(g_dirtyPageLock);
+	if (g_dirtyTrackingActive)
+		return true;
+	if (!base)
+		return false;
+
+	g_dirtyPageSize = std::max(0x1000, GetMemoryProtectPageSize());
+	g_dirtyPageMap.clear();
+	g_dirtyPageMap.resize((g_MemorySize + g_dirtyPageSize - 1) / g_dirtyPageSize, 0);
+
+	ForEachRAMView([](u8 *ptr, u32 ramOffset, u32 size) {
+		ProtectMemoryPages(ptr, size, MEM_PROT_READ);
+	});
+	g_dirtyTrackingActive = true;
+	INFO_LOG(Log::MemMap, "Dirty page tracking started (%d pages of %d bytes)", (int)g_dirtyPageMap.size(), g_dirtyPageSize);
+	return true;
+#endif
+}
+
+void DirtyPageTracking_Stop() {
+	std::lock_guard<std::mutex> guard(g_dirtyPageLock);
+	if (!g_dirtyTrackingActive)
+		return;
+	ForEachRAMView([](u8 *ptr, u32 ramOffset, u32 size) {
+		ProtectMemoryPages(ptr, size, MEM_PROT_READ | MEM_PROT_WRITE);
+	});
+	g_dirtyPageMap.clear();
+	g_dirtyTrackingActive = false;
+	INFO_LOG(Log::MemMap, "Dirty page tracking stopped");
+}
+
+bool DirtyPageTracking_Active() {
+	return g_dirtyTrackingActive;
+}
+
+bool DirtyPageTracking_HandleFault(uintptr_t hostAddress) {
+	if (!g_dirtyTrackingActive)
+		return false;
+
+	std::lock_guard<std::mutex> guard(g_dirtyPageLock);
+	bool handled = false;
+	u32 pageOffset = 0;
+	ForEachRAMView([&](u8 *ptr, u32 ramOffset, u32 size) {
+		if (hostAddress >= (uintptr_t)ptr && hostAddress < (uintptr_t)ptr + size) {
+			pageOffset = (ramOffset + (u32)(hostAddress - (uintptr_t)ptr)) & ~(g_dirtyPageSize - 1);
+			handled = true;
+		}
+	});
+	if (!handled)
+		return false;
+
+	g_dirtyPageMap[pageOffset / g_dirtyPageSize] = 1;
+	// Unprotect this page in every view so later writes through mirrors don't fault.
+	ForEachRAMView([&](u8 *ptr, u32 ramOffset, u32 size) {
+		if (pageOffset >= ramOffset && pageOffset < ramOffset + size)
+			ProtectMemoryPages(ptr + (pageOffset - ramOffset), g_dirtyPageSize, MEM_PROT_READ | MEM_PROT_WRITE);
+	});
+	return true;
+}
+
+void DirtyPageTracking_Flip(std::vector<std::pair<u32, u32>> *dirtyRanges) {
+	std::lock_guard<std::mutex> guard(g_dirtyPageLock);
+	if (!g_dirtyTrackingActive)
+		return;
+
+	for (u32 page = 0; page < (u32)g_dirtyPageMap.size(); page++) {
+		if (!g_dirtyPageMap[page])
+			continue;
+		g_dirtyPageMap[page] = 0;
+
+		u32 offset = page * g_dirtyPageSize;
+		u32 size = std::min(g_dirtyPageSize, g_MemorySize - offset);
+		if (dirtyRanges) {
+			if (!dirtyRanges->empty() && dirtyRanges->back().first + dirtyRanges->back().second == PSP_GetKernelMemoryBase() + offset) {
+				dirtyRanges->back().second += size;
+			} else {
+				dirtyRanges->emplace_back(PSP_GetKernelMemoryBase() + offset, size);
+			}
+		}
+		// Re-arm the protection so the next write gets noticed again.
+		ForEachRAMView([&](u8 *ptr, u32 ramOffset, u32 viewSize) {
+			if (offset >= ramOffset && offset < ramOffset + viewSize)
+				ProtectMemoryPages(ptr + (offset - ramOffset), g_dirtyPageSize, MEM_PROT_READ);
+		});
+	}
+}
+
+// ==============================
+// Shadow RAM + checkpoint hashes
+// ==============================
+//
+// The shadow is a second, read-only host mapping of the RAM chunks, created from the
+// same arena backing as the primary views. Background readers get a stable window
+// into RAM that doesn't interact with the write protection dirty page tracking keeps
+// on the primary views, and can't corrupt guest memory through a stray write.
+//
+// Checkpoint hashing builds on it: a table of per-page hashes is kept up to date by
+// rehashing only the pages the dirty tracking reports, on a worker thread while the
+// emu thread keeps running. Folding the table gives a full-RAM hash per frame for
+// replay verification, at a small fraction of the cost of hashing all of RAM.
+
+struct ShadowChunk {
+	u8 *ptr = nullptr;
+	u32 ramOffset = 0;
+	u32 size = 0;
+};
+static ShadowChunk g_shadowChunks[3];
+static int g_numShadowChunks = 0;
+
+bool ShadowRAM_Map() {
+#if PPSSPP_PLATFORM(UWP)
+	// No file mapping behind the views, nothing to create a second view of.
+	return false;
+#else
+	if (g_numShadowChunks > 0)
+		return true;
+	if (!base)
+		return false;
+
+	// Walk the view table the same way setup and shutdown do, to recover the arena
+	// offset of each non-mirrored RAM chunk.
+	size_t position = 0;
+	size_t last_position = 0;
+	for (int i = 0; i < num_views; i++) {
+		const MemoryView &view = views[i];
+		if (view.size == 0)
+			continue;
+		SKIP(0, view.flags);
+		if (view.flags & MV_MIRROR_PREVIOUS) {
+			position = last_position;
+		} else if ((view.flags & (MV_IS_PRIMARY_RAM | MV_IS_EXTRA1_RAM | MV_IS_EXTRA2_RAM)) && *view.out_ptr) {
+			u8 *shadow = (u8 *)g_arena.CreateView(position, view.size, nullptr);
+			if (!shadow) {
+				ERROR_LOG(Log::MemMap, "ShadowRAM_Map: failed creating shadow view of %08x bytes", view.size);
+				ShadowRAM_Unmap();
+				return false;
+			}
+			// Writes belong on the primary views - the shadow is strictly for readers.
+			ProtectMemoryPages(shadow, view.size, MEM_PROT_READ);
+			ShadowChunk &chunk = g_shadowChunks[g_numShadowChunks++];
+			chunk.ptr = shadow;
+			chunk.ramOffset = (view.flags & MV_IS_PRIMARY_RAM) ? 0 : ((view.flags & MV_IS_EXTRA1_RAM) ? 31 * 1024 * 1024 : 62 * 1024 * 1024);
+			chunk.size = view.size;
+		}
+		last_position = position;
+		position += g_arena.roundup(view.size);
+	}
+	return g_numShadowChunks > 0;
+#endif
+}
+
+void ShadowRAM_Unmap() {
+	for (int i = 0; i < g_numShadowChunks; i++) {
+		g_arena.ReleaseView(0, g_shadowChunks[i].ptr, g_shadowChunks[i].size);
+		g_shadowChunks[i] = ShadowChunk{};
+	}
+	g_numShadowChunks = 0;
+}
+
+const u8 *ShadowRAM_GetPointer(u32 ramOffset) {
+	for (int i = 0; i < g_numShadowChunks; i++) {
+		const ShadowChunk &chunk = g_shadowChunks[i];
+		if (ramOffset >= chunk.ramOffset && ramOffset < chunk.ramOffset + chunk.size)
+			return chunk.ptr + (ramOffset - chunk.ramOffset);
+	}
+	return nullptr;
+}
+
+static std::vector<u64> g_checkpointPageHashes;
+static std::vector<std::pair<u32, u32>> g_checkpointDirty;
+static LimitedWaitable *g_checkpointWaitable = nullptr;
+static u32 g_checkpointPageSize = 0;
+static bool g_checkpointActive = false;
+
+static void CheckpointHashPage(u32 page) {
+	const u32 offset = page * g_checkpointPageSize;
+	const u32 size = std::min(g_checkpointPageSize, g_MemorySize - offset);
+	// The chunk sizes are multiples of the protection granularity, so a page never
+	// straddles two shadow chunks.
+	const u8 *ptr = ShadowRAM_GetPointer(offset);
+	g_checkpointPageHashes[page] = ptr ? XXH3_64bits(ptr, size) : 0;
+}
+
+class CheckpointHashTask : public Task {
+public:
+	CheckpointHashTask(LimitedWaitable *waitable) : waitable_(waitable) {}
+	TaskType Type() const override { return TaskType::CPU_COMPUTE; }
+	TaskPriority Priority() const override { return TaskPriority::LOW; }
+	void Run() override {
+		// The dirty set is normally a small fraction of RAM, not worth fanning out
+		// further - the win is that the emu thread doesn't wait for it.
+		for (const auto &range : g_checkpointDirty) {
+			const u32 start = range.first - PSP_GetKernelMemoryBase();
+			for (u32 offset = start; offset < start + range.second; offset += g_checkpointPageSize)
+				CheckpointHashPage(offset / g_checkpointPageSize);
+		}
+		waitable_->Notify();
+	}
+
+private:
+	LimitedWaitable *waitable_;
+};
+
+bool CheckpointHash_Start() {
+	if (g_checkpointActive)
+		return true;
+	if (!ShadowRAM_Map())
+		return false;
+	// Tracking must be armed before the initial hash, so writes racing the hash get
+	// flagged and rehashed on the first flip instead of lost.
+	if (!DirtyPageTracking_Start())
+		return false;
+
+	g_checkpointPageSize = std::max(0x1000, GetMemoryProtectPageSize());
+	g_checkpointPageHashes.clear();
+	g_checkpointPageHashes.resize((g_MemorySize + g_checkpointPageSize - 1) / g_checkpointPageSize);
+
+	// The one full hash. Everything after this is incremental.
+	ParallelRangeLoop(&g_threadManager, [](int l, int h) {
+		for (int page = l; page < h; page++)
+			CheckpointHashPage((u32)page);
+	}, 0, (int)g_checkpointPageHashes.size(), 64);
+
+	g_checkpointActive = true;
+	INFO_LOG(Log::MemMap, "Checkpoint hashing started (%d pages)", (int)g_checkpointPageHashes.size());
+	return true;
+}
+
+void CheckpointHash_Stop() {
+	if (!g_checkpointActive)
+		return;
+	if (g_checkpointWaitable) {
+		g_checkpointWaitable->WaitAndRelease();
+		g_checkpointWaitable = nullptr;
+	}
+	DirtyPageTracking_Stop();
+	g_checkpointPageHashes.clear();
+	g_checkpointDirty.clear();
+	g_checkpointActive = false;
+}
+
+bool CheckpointHash_Active() {
+	return g_checkpointActive;
+}
+
+u64 CheckpointHash_FrameHash() {
+	if (!g_checkpointActive)
+		return 0;
+
+	// Finish the previous frame's rehash before reading the table. Normally it
+	// completed long ago and this is just a flag check.
+	if (g_checkpointWaitable) {
+		g_checkpointWaitable->WaitAndRelease();
+		g_checkpointWaitable = nullptr;
+	}
+
+	const u64 frameHash = XXH3_64bits(g_checkpointPageHashes.data(), g_checkpointPageHashes.size() * sizeof(u64));
+
+	g_checkpointDirty.clear();
+	DirtyPageTracking_Flip(&g_checkpointDirty);
+	if (!g_checkpointDirty.empty()) {
+		g_checkpointWaitable = new LimitedWaitable();
+		g_threadManager.EnqueueTask(new CheckpointHashTask(g_checkpointWaitable));
+	}
+	return frameHash;
+}
+
 bool IsActive() {
 	return base != nullptr;
 }
@@ -21,6 +21,8 @@
 
 #include <cstring>
 #include <cstdint>
+#include <utility>
+#include <vector>
 #ifndef offsetof
 #include <stddef.h>
 #endif
@@ -88,6 +90,18 @@ enum
 #endif
 };
 
+// Software page table for the slow memory path, and available for jit backends
+// that can't rely on a full fastmem reservation: host pointer to the start of
+// each 16KB guest page, or nullptr for unmapped pages. Indexed by
+// (address & 0x3FFFFFFF) >> SOFT_TLB_PAGE_BITS. Scratchpad is not in the table
+// since its mirroring rules are stricter than the masked index - check it separately.
+enum {
+	SOFT_TLB_PAGE_BITS = 14,
+	SOFT_TLB_PAGE_SIZE = 1 << SOFT_TLB_PAGE_BITS,
+	SOFT_TLB_ENTRIES = 0x0E000000 >> SOFT_TLB_PAGE_BITS,
+};
+extern u8 *g_softTLB[SOFT_TLB_ENTRIES];
+
 enum {
 	MV_MIRROR_PREVIOUS = 1,
 	MV_IS_PRIMARY_RAM = 0x100,
@@ -126,6 +140,40 @@ public:
 // Use it when accessing PSP memory from external threads.
 MemoryInitedLock Lock();
 
+// Dirty page tracking over PSP RAM, driven by write protection faults. One shared
+// page-table scan for consumers like rewind snapshotting, rollback sync and memory
+// breakpoint-style tooling, instead of each of them hashing all of RAM per frame.
+// Start() fails on platforms without a machine-context exception handler.
+bool DirtyPageTracking_Start();
+void DirtyPageTracking_Stop();
+bool DirtyPageTracking_Active();
+// Appends (guest address, size) ranges covering the pages written since the last call,
+// merged where adjacent, and re-arms the write protection on them.
+void DirtyPageTracking_Flip(std::vector<std::pair<u32, u32>> *dirtyRanges);
+// Called by HandleFault. Returns true if the fault was a tracked write, now resolved.
+bool DirtyPageTracking_HandleFault(uintptr_t hostAddress);
+
+// Optional second, read-only host mapping of guest RAM from the same arena backing as
+// the primary views, for background readers (checkpoint hashing, future rollback).
+// Reading through it doesn't interact with the write protection dirty page tracking
+// keeps on the primary views. Not available on UWP.
+bool ShadowRAM_Map();
+void ShadowRAM_Unmap();
+// Host pointer into the shadow for an offset into RAM (0..g_MemorySize), or nullptr.
+const u8 *ShadowRAM_GetPointer(u32 ramOffset);
+
+// Per-frame hashing of all of RAM for replay/determinism verification. Dirty page
+// tracking bounds the rehash to pages written since the previous frame, and the
+// rehashing runs on a worker thread against the shadow mapping while emulation
+// continues. Start() fails where shadow mapping or dirty tracking is unsupported.
+bool CheckpointHash_Start();
+void CheckpointHash_Stop();
+bool CheckpointHash_Active();
+// Call once per frame. Folds the page hash table into the returned full-RAM hash,
+// then flips the dirty set and kicks off background rehashing of the changed pages.
+// The returned hash covers RAM as of the previous call's flip.
+u64 CheckpointHash_FrameHash();
+
 // used by JIT to read instructions. Does not resolve replacements.
 Opcode Read_Opcode_JIT(const u32 _Address);
 // used by JIT. Reads in the "Locked cache" mode
@@ -100,9 +100,18 @@ template <typename T>
 inline void ReadFromHardware(T &var, const u32 address) {
 	// TODO: Figure out the fastest order of tests for both read and write (they are probably different).
 	if ((address & 0x3E000000) == 0x08000000) {
-		// RAM
+		// RAM - the single compare above beats a table lookup for the common case.
 		var = *((const T*)GetPointerUnchecked(address));
-	} else if ((address & 0x3F800000) == 0x04000000) {
+		return;
+	}
+	// VRAM, remaster RAM etc. resolve through the software page table.
+	const u32 masked = address & 0x3FFFFFFF;
+	const u32 page = masked >> SOFT_TLB_PAGE_BITS;
+	if (page < SOFT_TLB_ENTRIES && g_softTLB[page]) {
+		var = *((const T*)(g_softTLB[page] + (masked & (SOFT_TLB_PAGE_SIZE - 1))));
+		return;
+	}
+	if ((address & 0x3F800000) == 0x04000000) {
 		// VRAM
 		var = *((const T*)GetPointerUnchecked(address));
 	} else if ((address & 0xBFFFC000) == 0x00010000) {
@@ -127,7 +136,15 @@ inline void WriteToHardware(u32 address, const T data) {
 	if ((address & 0x3E000000) == 0x08000000) {
 		// RAM
 		*(T*)GetPointerUnchecked(address) = data;
-	} else if ((address & 0x3F800000) == 0x04000000) {
+		return;
+	}
+	const u32 masked = address & 0x3FFFFFFF;
+	const u32 page = masked >> SOFT_TLB_PAGE_BITS;
+	if (page < SOFT_TLB_ENTRIES && g_softTLB[page]) {
+		*(T*)(g_softTLB[page] + (masked & (SOFT_TLB_PAGE_SIZE - 1))) = data;
+		return;
+	}
+	if ((address & 0x3F800000) == 0x04000000) {
 		// VRAM
 		*(T*)GetPointerUnchecked(address) = data;
 	} else if ((address & 0xBFFFC000) == 0x00010000) {
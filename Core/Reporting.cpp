@@ -25,15 +25,13 @@
 #include <set>
 #include <cstdlib>
 #include <cstdarg>
-
-// for crc32
-extern "C" {
-#include "zlib.h"
-}
+#include <algorithm>
+#include <vector>
 
 #include "Core/Reporting.h"
 #include "Common/File/VFS/VFS.h"
 #include "Common/CPUDetect.h"
+#include "Common/Data/Hash/Hash.h"
 #include "Common/File/FileUtil.h"
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Common/StringUtils.h"
@@ -43,6 +41,7 @@ extern "C" {
 #include "Common/Net/Resolve.h"
 #include "Common/Net/URL.h"
 #include "Common/Thread/ThreadUtil.h"
+#include "Common/TimeUtil.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/Config.h"
@@ -56,6 +55,7 @@ extern "C" {
 #include "Core/HLE/Plugins.h"
 #include "Core/HLE/sceKernelMemory.h"
 #include "Core/HLE/scePower.h"
+#include "Core/Util/GameDB.h"
 #include "Core/HW/Display.h"
 #include "GPU/GPUInterface.h"
 #include "GPU/GPUState.h"
@@ -107,21 +107,25 @@ namespace Reporting
 	static u32 CalculateCRC(BlockDevice *blockDevice, std::atomic<bool> *cancel) {
 		auto ga = GetI18NCategory(I18NCat::GAME);
 
-		u32 crc = crc32(0, Z_NULL, 0);
+		u32 crc = 0;
 
-		u8 block[2048];
+		// Read in chunks of 128 blocks (256KB) - on multi-GB ISOs the per-block call
+		// overhead adds up, and hashing bigger runs lets the CRC kernel stream.
+		const u32 blocksPerChunk = 128;
+		std::vector<u8> buffer(blocksPerChunk * 2048);
 		u32 numBlocks = blockDevice->GetNumBlocks();
-		for (u32 i = 0; i < numBlocks; ++i) {
+		for (u32 i = 0; i < numBlocks; i += blocksPerChunk) {
 			if (cancel && *cancel) {
 				g_OSD.RemoveProgressBar("crc", false, 0.0f);
 				return 0;
 			}
-			if (!blockDevice->ReadBlock(i, block, true)) {
-				ERROR_LOG(Log::FileSystem, "Failed to read block for CRC");
+			u32 blocksToRead = std::min(blocksPerChunk, numBlocks - i);
+			if (!blockDevice->ReadBlocks(i, blocksToRead, buffer.data())) {
+				ERROR_LOG(Log::FileSystem, "Failed to read blocks for CRC");
 				g_OSD.RemoveProgressBar("crc", false, 0.0f);
 				return 0;
 			}
-			crc = crc32(crc, block, 2048);
+			crc = hash::Crc32(crc, buffer.data(), blocksToRead * 2048);
 			g_OSD.SetProgressBar("crc", std::string(ga->T("Calculate CRC")), 0.0f, (float)numBlocks, (float)i, 0.5f);
 		}
 
@@ -225,6 +229,103 @@ namespace Reporting
 		PurgeCRC();
 	}
 
+	static std::thread verifyThread;
+	static std::atomic<bool> verifyCancel{};
+	static Path verifyPath;
+	static std::string verifyGameID;
+
+	// Background integrity check of the mounted disc against the GameDB checksum.
+	// Unlike CalculateCRCThread, this runs while the game is playing, so reads are
+	// paced (sleep per chunk) to stay out of the way of the game's own streaming.
+	static int VerifyDiscCRCThread() {
+		SetCurrentThreadName("DiscVerify");
+
+		AndroidJNIThreadContext jniContext;
+
+		std::vector<GameDBInfo> infos;
+		if (!g_gameDB.GetGameInfos(verifyGameID, &infos) || infos.empty()) {
+			INFO_LOG(Log::System, "No GameDB entry for %s, skipping disc verification", verifyGameID.c_str());
+			return 0;
+		}
+
+		FileLoader *fileLoader = ResolveFileLoaderTarget(ConstructFileLoader(verifyPath));
+		BlockDevice *blockDevice = constructBlockDevice(fileLoader);
+
+		u32 crc = 0;
+		bool complete = false;
+		if (blockDevice) {
+			const u32 blocksPerChunk = 128;
+			std::vector<u8> buffer(blocksPerChunk * 2048);
+			u32 numBlocks = blockDevice->GetNumBlocks();
+			complete = true;
+			for (u32 i = 0; i < numBlocks; i += blocksPerChunk) {
+				if (verifyCancel) {
+					complete = false;
+					break;
+				}
+				u32 blocksToRead = std::min(blocksPerChunk, numBlocks - i);
+				if (!blockDevice->ReadBlocks(i, blocksToRead, buffer.data())) {
+					ERROR_LOG(Log::FileSystem, "Disc verification: failed to read blocks at %d", i);
+					complete = false;
+					break;
+				}
+				crc = hash::Crc32(crc, buffer.data(), blocksToRead * 2048);
+				// Caps us at roughly 8 MB/s, so the game's own reads always win.
+				sleep_ms(30);
+			}
+		}
+
+		delete blockDevice;
+		delete fileLoader;
+
+		if (!complete)
+			return 0;
+
+		{
+			// Remember the result - a later manual CRC request becomes instant.
+			std::lock_guard<std::mutex> guard(crcLock);
+			crcResults[verifyPath] = crc;
+		}
+
+		bool anyKnown = false;
+		bool match = false;
+		for (const auto &info : infos) {
+			if (info.crc != 0)
+				anyKnown = true;
+			if (info.crc != 0 && info.crc == crc)
+				match = true;
+		}
+		if (match) {
+			INFO_LOG(Log::System, "Disc image for %s verified OK against GameDB (CRC32 %08x)", verifyGameID.c_str(), crc);
+		} else if (anyKnown) {
+			WARN_LOG(Log::System, "Disc image for %s doesn't match GameDB: got CRC32 %08x", verifyGameID.c_str(), crc);
+			auto ga = GetI18NCategory(I18NCat::GAME);
+			g_OSD.Show(OSDType::MESSAGE_WARNING, ga->T("Disc image doesn't match its known checksum. It may be corrupt."), 8.0f);
+		}
+		return 0;
+	}
+
+	void StartDiscIntegrityCheck(const Path &gamePath, const std::string &gameID) {
+		if (gameID.empty()) {
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> guard(crcLock);
+			if (crcResults.find(gamePath) != crcResults.end()) {
+				// Already hashed this session, nothing new to learn.
+				return;
+			}
+		}
+		if (verifyThread.joinable()) {
+			verifyCancel = true;
+			verifyThread.join();
+		}
+		verifyCancel = false;
+		verifyPath = gamePath;
+		verifyGameID = gameID;
+		verifyThread = std::thread(&VerifyDiscCRCThread);
+	}
+
 	// Returns the full host
 	std::string ServerHost() {
 		if (g_Config.sReportHost.compare("default") == 0)
@@ -362,6 +463,10 @@ namespace Reporting
 
 	void Shutdown() {
 		PurgeCRC();
+		if (verifyThread.joinable()) {
+			verifyCancel = true;
+			verifyThread.join();
+		}
 
 		// Just so it can be enabled in the menu again.
 		Init();
@@ -76,6 +76,11 @@ namespace Reporting
 	// To avoid stalling, call HasCRC() in update() or similar and call this if it returns true.
 	uint32_t RetrieveCRC(const Path &gamePath);
 
+	// Starts a background CRC check of the disc image against the GameDB checksum,
+	// if one is known. Reads are paced so it can safely run while the game plays.
+	// Reports a mismatch through the OSD.
+	void StartDiscIntegrityCheck(const Path &gamePath, const std::string &gameID);
+
 	enum class ReportStatus {
 		WORKING,
 		BUSY,
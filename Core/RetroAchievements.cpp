@@ -49,6 +49,8 @@
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Common/StringUtils.h"
 #include "Common/Crypto/md5.h"
+#include "Common/Thread/ThreadManager.h"
+#include "Common/Thread/Waitable.h"
 #include "Common/UI/IconCache.h"
 
 #include "Core/MemMap.h"
@@ -178,6 +180,39 @@ constexpr double LOGIN_ATTEMPT_INTERVAL_S = 10.0;
 
 #define PSP_MEMORY_OFFSET 0x08000000
 
+// Memory snapshot for off-thread achievement evaluation.
+//
+// rc_client_do_frame reads emulated memory through read_memory_callback, and sets
+// with hundreds of active conditions cost a steady millisecond or more per frame
+// if we run them inline on the emu thread. Instead, we record which addresses the
+// active condition set actually reads, then each frame copy just those bytes into
+// a snapshot buffer and run the evaluation on a worker thread against the snapshot.
+// If an evaluation reads outside the snapshot (the active set changed), it falls
+// back to live memory for that read and the ranges get re-collected next frame.
+struct MemSnapshotRange {
+	uint32_t addr;
+	uint32_t size;
+	uint32_t offset;  // into g_memSnapshotBuffer
+};
+static std::vector<MemSnapshotRange> g_memSnapshotRanges;  // sorted by addr
+static std::vector<uint8_t> g_memSnapshotBuffer;
+static std::set<std::pair<uint32_t, uint32_t>> g_observedReads;
+static bool g_collectingReads = false;  // only touched during a synchronous do_frame
+static std::atomic<bool> g_evalFromSnapshot{};
+static std::atomic<bool> g_memSnapshotDirty{ true };
+static std::mutex g_frameEvalLock;
+static LimitedWaitable *g_frameEvalWaitable;  // non-null while an eval task is in flight
+
+// Any caller about to touch g_rcClient from outside the eval task must go through here.
+static void WaitForFrameEval() {
+	std::lock_guard<std::mutex> guard(g_frameEvalLock);
+	if (g_frameEvalWaitable) {
+		g_frameEvalWaitable->WaitAndRelease();
+		g_frameEvalWaitable = nullptr;
+		g_evalFromSnapshot = false;
+	}
+}
+
 static void TryLoginByToken(bool isInitialAttempt);
 
 rc_client_t *GetClient() {
@@ -227,6 +262,7 @@ size_t GetRichPresenceMessage(char *buffer, size_t bufSize) {
 	if (!IsLoggedIn() || !rc_client_has_rich_presence(g_rcClient)) {
 		return (size_t)-1;
 	}
+	WaitForFrameEval();
 	return rc_client_get_rich_presence_message(g_rcClient, buffer, bufSize);
 }
 
@@ -288,10 +324,52 @@ static uint32_t read_memory_callback(uint32_t address, uint8_t *buffer, uint32_t
 		return 0;
 	}
 
+	if (g_evalFromSnapshot.load(std::memory_order_relaxed)) {
+		// We're on the worker - serve the read from the snapshot if we can.
+		auto iter = std::upper_bound(g_memSnapshotRanges.begin(), g_memSnapshotRanges.end(), address,
+			[](uint32_t addr, const MemSnapshotRange &range) { return addr < range.addr; });
+		if (iter != g_memSnapshotRanges.begin()) {
+			--iter;
+			if (address >= iter->addr && address + num_bytes <= iter->addr + iter->size) {
+				memcpy(buffer, g_memSnapshotBuffer.data() + iter->offset + (address - iter->addr), num_bytes);
+				return num_bytes;
+			}
+		}
+		// The active condition set now reads somewhere new. Read live memory this
+		// once (safe, just possibly a frame off) and re-collect the ranges.
+		g_memSnapshotDirty = true;
+	} else if (g_collectingReads) {
+		g_observedReads.insert(std::make_pair(address, num_bytes));
+	}
+
 	Memory::MemcpyUnchecked(buffer, address, num_bytes);
 	return num_bytes;
 }
 
+// Coalesces the reads observed during a collection pass into sorted ranges.
+static void RebuildMemSnapshotRanges() {
+	g_memSnapshotRanges.clear();
+	uint32_t offset = 0;
+	for (const auto &read : g_observedReads) {
+		uint32_t end = read.first + read.second;
+		if (!g_memSnapshotRanges.empty()) {
+			MemSnapshotRange &last = g_memSnapshotRanges.back();
+			if (read.first <= last.addr + last.size) {
+				// Overlapping or adjacent - extend.
+				if (end > last.addr + last.size) {
+					offset += end - (last.addr + last.size);
+					last.size = end - last.addr;
+				}
+				continue;
+			}
+		}
+		g_memSnapshotRanges.push_back(MemSnapshotRange{ read.first, read.second, offset });
+		offset += read.second;
+	}
+	g_memSnapshotBuffer.resize(offset);
+	g_observedReads.clear();
+}
+
 // This is the HTTP request dispatcher that is provided to the rc_client. Whenever the client
 // needs to talk to the server, it will call this function.
 static void server_call_callback(const rc_api_request_t *request,
@@ -333,6 +411,8 @@ static void event_handler_callback(const rc_client_event_t *event, rc_client_t *
 	switch (event->type) {
 	case RC_CLIENT_EVENT_ACHIEVEMENT_TRIGGERED:
 		// An achievement was earned by the player. The handler should notify the player that the achievement was earned.
+		// The active condition set shrank, so re-collect the watched memory ranges.
+		g_memSnapshotDirty = true;
 		g_OSD.ShowAchievementUnlocked(event->achievement->id);
 		System_PostUIMessage(UIMessage::REQUEST_PLAY_SOUND, "achievement_unlocked");
 		INFO_LOG(Log::Achievements, "Achievement unlocked: '%s' (%d)", event->achievement->title, event->achievement->id);
@@ -366,6 +446,7 @@ static void event_handler_callback(const rc_client_event_t *event, rc_client_t *
 	case RC_CLIENT_EVENT_LEADERBOARD_FAILED:
 	{
 		bool started = event->type == RC_CLIENT_EVENT_LEADERBOARD_STARTED;
+		g_memSnapshotDirty = true;
 		// A leaderboard attempt has started. The handler may show a message with the leaderboard title and /or description indicating the attempt started.
 		const char *title = "";
 		const char *description = "";
@@ -382,6 +463,7 @@ static void event_handler_callback(const rc_client_event_t *event, rc_client_t *
 	}
 	case RC_CLIENT_EVENT_LEADERBOARD_SUBMITTED:
 	{
+		g_memSnapshotDirty = true;
 		INFO_LOG(Log::Achievements, "Leaderboard result submitted: %s", event->leaderboard->title);
 		// Actually showing the result when we get the scoreboard message and have the new rank.
 		break;
@@ -409,6 +491,7 @@ static void event_handler_callback(const rc_client_event_t *event, rc_client_t *
 		break;
 	}
 	case RC_CLIENT_EVENT_ACHIEVEMENT_CHALLENGE_INDICATOR_SHOW:
+		g_memSnapshotDirty = true;
 		INFO_LOG(Log::Achievements, "Challenge indicator show: %s", event->achievement->title);
 		g_OSD.ShowChallengeIndicator(event->achievement->id, true);
 		g_activeChallenges.insert(event->achievement->id);
@@ -416,6 +499,7 @@ static void event_handler_callback(const rc_client_event_t *event, rc_client_t *
 		// to indicate the challenge is active.
 		break;
 	case RC_CLIENT_EVENT_ACHIEVEMENT_CHALLENGE_INDICATOR_HIDE:
+		g_memSnapshotDirty = true;
 		INFO_LOG(Log::Achievements, "Challenge indicator hide: %s", event->achievement->title);
 		g_OSD.ShowChallengeIndicator(event->achievement->id, false);
 		g_activeChallenges.erase(event->achievement->id);
@@ -756,6 +840,7 @@ void UpdateSettings() {
 }
 
 bool Shutdown() {
+	WaitForFrameEval();
 	g_activeChallenges.clear();
 #ifdef RC_CLIENT_SUPPORTS_RAINTEGRATION
 	rc_client_unload_raintegration(g_rcClient);
@@ -768,17 +853,62 @@ bool Shutdown() {
 
 void ResetRuntime() {
 	INFO_LOG(Log::Achievements, "Resetting rcheevos state...");
+	WaitForFrameEval();
 	rc_client_reset(g_rcClient);
 	g_activeChallenges.clear();
+	g_memSnapshotDirty = true;
 }
 
+// Runs rc_client_do_frame on a worker against the memory snapshot. Everything
+// else that touches g_rcClient waits for this through WaitForFrameEval().
+class FrameEvalTask : public Task {
+public:
+	explicit FrameEvalTask(LimitedWaitable *waitable) : waitable_(waitable) {}
+	TaskType Type() const override { return TaskType::CPU_COMPUTE; }
+	TaskPriority Priority() const override { return TaskPriority::HIGH; }
+	void Run() override {
+		rc_client_do_frame(g_rcClient);
+		waitable_->Notify();
+	}
+private:
+	LimitedWaitable *waitable_;
+};
+
 void FrameUpdate() {
 	if (!g_rcClient)
 		return;
-	rc_client_do_frame(g_rcClient);
+	WaitForFrameEval();
+
+	if (g_memSnapshotDirty) {
+		// Collection pass: evaluate synchronously, recording every address the
+		// active condition set reads, and rebuild the snapshot ranges from that.
+		g_observedReads.clear();
+		g_collectingReads = true;
+		rc_client_do_frame(g_rcClient);
+		g_collectingReads = false;
+		RebuildMemSnapshotRanges();
+		g_memSnapshotDirty = false;
+		return;
+	}
+
+	if (g_memSnapshotRanges.empty()) {
+		// Nothing active reads memory - evaluation is cheap, just run it here.
+		rc_client_do_frame(g_rcClient);
+		return;
+	}
+
+	// Fast path: gather the watched ranges in one pass, then evaluate off-thread.
+	for (const auto &range : g_memSnapshotRanges) {
+		Memory::MemcpyUnchecked(g_memSnapshotBuffer.data() + range.offset, range.addr, range.size);
+	}
+	std::lock_guard<std::mutex> guard(g_frameEvalLock);
+	g_evalFromSnapshot = true;
+	g_frameEvalWaitable = new LimitedWaitable();
+	g_threadManager.EnqueueTask(new FrameEvalTask(g_frameEvalWaitable));
 }
 
 void Idle() {
+	WaitForFrameEval();
 	rc_client_idle(g_rcClient);
 
 	double now = time_now_d();
@@ -804,6 +934,13 @@ void Idle() {
 }
 
 void DoState(PointerWrap &p) {
+	// Serializing runtime progress allocates and walks the whole rcheevos state, far
+	// too slow for per-frame minimal snapshots. Those don't need it - rolling back a
+	// few frames within one session doesn't change what's been unlocked.
+	if (p.profile == p.PROFILE_MINIMAL)
+		return;
+
+	WaitForFrameEval();
 	auto sw = p.Section("Achievements", 0, 1);
 	if (!sw) {
 		// Save state is missing the section.
@@ -860,6 +997,7 @@ void DoState(PointerWrap &p) {
 				// TODO: What should we really do here?
 				ERROR_LOG(Log::Achievements, "Error %d deserializing achievement data. Ignoring.", retval);
 			}
+			g_memSnapshotDirty = true;
 			break;
 		}
 		default:
@@ -1046,6 +1184,8 @@ void SetGame(const Path &path, IdentifiedFileType fileType, FileLoader *fileLoad
 
 void UnloadGame() {
 	if (g_rcClient) {
+		WaitForFrameEval();
+		g_memSnapshotDirty = true;
 		rc_client_unload_game(g_rcClient);
 		g_gamePath.clear();
 		s_game_hash.clear();
@@ -16,11 +16,15 @@
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
 #include <thread>
 #include <mutex>
 
+#include <zstd.h>
+
 #include "Common/Data/Text/I18n.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Common/Thread/ThreadUtil.h"
 #include "Common/Data/Text/Parsers.h"
 #include "Common/System/System.h"
@@ -90,14 +94,16 @@ namespace SaveState
 		void *cbUserData;
 	};
 
+	// These states never leave RAM, so both sides use the minimal profile - much
+	// cheaper to take, and the skipped subsystems rebuild lazily after a restore.
 	CChunkFileReader::Error SaveToRam(std::vector<u8> &data) {
 		SaveStart state;
-		return CChunkFileReader::MeasureAndSavePtr(state, &data);
+		return CChunkFileReader::MeasureAndSavePtr(state, &data, PointerWrap::PROFILE_MINIMAL);
 	}
 
 	CChunkFileReader::Error LoadFromRam(std::vector<u8> &data, std::string *errorString) {
 		SaveStart state;
-		return CChunkFileReader::LoadPtr(&data[0], state, errorString);
+		return CChunkFileReader::LoadPtr(&data[0], state, errorString, PointerWrap::PROFILE_MINIMAL);
 	}
 
 	// This ring buffer of states is for rewind save states, which are kept in RAM.
@@ -114,19 +120,17 @@ namespace SaveState
 		}
 
 		~StateRingbuffer() {
-			if (compressThread_.joinable()) {
-				compressThread_.join();
-			}
+			WaitForCompress();
 		}
 
 		CChunkFileReader::Error Save()
 		{
-			rewindLastTime_ = time_now_d();
+			// If the previous snapshot is still compressing on a worker, skip this
+			// interval instead of stalling the emu thread - Process() will try again.
+			if (compressing_)
+				return CChunkFileReader::ERROR_NONE;
 
-			// Make sure we're not processing a previous save. That'll cause a hitch though, but at least won't
-			// crash due to contention over buffer_.
-			if (compressThread_.joinable())
-				compressThread_.join();
+			rewindLastTime_ = time_now_d();
 
 			std::lock_guard<std::mutex> guard(lock_);
 
@@ -159,6 +163,9 @@ namespace SaveState
 
 		CChunkFileReader::Error Restore(std::string *errorString)
 		{
+			// Make sure the newest slot is fully written before we read it back.
+			WaitForCompress();
+
 			std::lock_guard<std::mutex> guard(lock_);
 
 			// No valid states left.
@@ -178,14 +185,36 @@ namespace SaveState
 
 		void ScheduleCompress(std::vector<u8> *result, const std::vector<u8> *state, const std::vector<u8> *base)
 		{
-			if (compressThread_.joinable())
-				compressThread_.join();
-			compressThread_ = std::thread([=]{
-				SetCurrentThreadName("SaveStateCompress");
+			// Runs on the thread manager instead of a freshly spawned thread - rewind
+			// snapshots recur every few seconds, so thread launch cost adds up.
+			compressing_ = true;
+			g_threadManager.EnqueueTask(new CompressTask(this, result, state, base));
+		}
 
+		class CompressTask : public Task {
+		public:
+			CompressTask(StateRingbuffer *ring, std::vector<u8> *result, const std::vector<u8> *state, const std::vector<u8> *base)
+				: ring_(ring), result_(result), state_(state), base_(base) {}
+
+			TaskType Type() const override { return TaskType::CPU_COMPUTE; }
+			TaskPriority Priority() const override { return TaskPriority::LOW; }
+			void Run() override {
 				// Should do no I/O, so no JNI thread context needed.
-				Compress(*result, *state, *base);
-			});
+				ring_->Compress(*result_, *state_, *base_);
+				ring_->compressing_ = false;
+			}
+
+		private:
+			StateRingbuffer *ring_;
+			std::vector<u8> *result_;
+			const std::vector<u8> *state_;
+			const std::vector<u8> *base_;
+		};
+
+		void WaitForCompress()
+		{
+			while (compressing_)
+				sleep_ms(1);
 		}
 
 		void Compress(std::vector<u8> &result, const std::vector<u8> &state, const std::vector<u8> &base)
@@ -196,32 +225,69 @@ namespace SaveState
 				return;
 
 			double start_time = time_now_d();
-			result.clear();
-			result.reserve(512 * 1024);
+			std::vector<u8> diff;
+			diff.reserve(512 * 1024);
 			for (size_t i = 0; i < state.size(); i += BLOCK_SIZE)
 			{
 				int blockSize = std::min(BLOCK_SIZE, (int)(state.size() - i));
 				if (i + blockSize > base.size() || memcmp(&state[i], &base[i], blockSize) != 0)
 				{
-					result.push_back(1);
-					result.insert(result.end(), state.begin() + i, state.begin() + i + blockSize);
+					diff.push_back(1);
+					diff.insert(diff.end(), state.begin() + i, state.begin() + i + blockSize);
 				}
 				else
-					result.push_back(0);
+					diff.push_back(0);
+			}
+
+			// Squeeze the diff down further with zstd - changed blocks still compress
+			// well, which is what makes a reasonable memory budget possible on remasters.
+			// Format: u32 raw diff size (0 = stored raw), then the payload.
+			result.clear();
+			result.resize(sizeof(u32) + ZSTD_compressBound(diff.size()));
+			size_t packedSize = ZSTD_compress(result.data() + sizeof(u32), result.size() - sizeof(u32), diff.data(), diff.size(), 1);
+			u32 rawSize = 0;
+			if (!ZSTD_isError(packedSize) && packedSize < diff.size()) {
+				rawSize = (u32)diff.size();
+				result.resize(sizeof(u32) + packedSize);
+			} else {
+				result.resize(sizeof(u32) + diff.size());
+				memcpy(result.data() + sizeof(u32), diff.data(), diff.size());
 			}
+			memcpy(result.data(), &rawSize, sizeof(u32));
+			result.shrink_to_fit();
+
+			totalBytes_ = TotalBytesLocked();
 
 			double taken_s = time_now_d() - start_time;
 			DEBUG_LOG(Log::SaveState, "Rewind: Compressed save from %d bytes to %d in %0.2f ms.", (int)state.size(), (int)result.size(), taken_s * 1000.0);
 		}
 
-		void LockedDecompress(std::vector<u8> &result, const std::vector<u8> &compressed, const std::vector<u8> &base)
+		void LockedDecompress(std::vector<u8> &result, const std::vector<u8> &packed, const std::vector<u8> &base)
 		{
+			// Undo the zstd layer first - see Compress() for the format.
+			std::vector<u8> diffStorage;
+			const u8 *diff = packed.data() + sizeof(u32);
+			size_t diffSize = packed.size() - sizeof(u32);
+			u32 rawSize = 0;
+			memcpy(&rawSize, packed.data(), sizeof(u32));
+			if (rawSize != 0) {
+				diffStorage.resize(rawSize);
+				size_t actual = ZSTD_decompress(diffStorage.data(), diffStorage.size(), diff, diffSize);
+				if (ZSTD_isError(actual)) {
+					ERROR_LOG(Log::SaveState, "Rewind: zstd decompression failed: %s", ZSTD_getErrorName(actual));
+					result.clear();
+					return;
+				}
+				diff = diffStorage.data();
+				diffSize = actual;
+			}
+
 			result.clear();
 			result.reserve(base.size());
 			auto basePos = base.begin();
-			for (size_t i = 0; i < compressed.size(); )
+			for (size_t i = 0; i < diffSize; )
 			{
-				if (compressed[i] == 0)
+				if (diff[i] == 0)
 				{
 					++i;
 					int blockSize = std::min(BLOCK_SIZE, (int)(base.size() - result.size()));
@@ -231,8 +297,8 @@ namespace SaveState
 				else
 				{
 					++i;
-					int blockSize = std::min(BLOCK_SIZE, (int)(compressed.size() - i));
-					result.insert(result.end(), compressed.begin() + i, compressed.begin() + i + blockSize);
+					int blockSize = std::min(BLOCK_SIZE, (int)(diffSize - i));
+					result.insert(result.end(), diff + i, diff + i + blockSize);
 					i += blockSize;
 					// This check is to avoid advancing basePos out of range, which MSVC catches.
 					// When this happens, we're at the end of decoding anyway.
@@ -243,10 +309,16 @@ namespace SaveState
 			}
 		}
 
+		size_t TotalBytesLocked() const {
+			size_t total = bases_[0].size() + bases_[1].size() + buffer_.size();
+			for (const auto &s : states_)
+				total += s.size();
+			return total;
+		}
+
 		void Clear()
 		{
-			if (compressThread_.joinable())
-				compressThread_.join();
+			WaitForCompress();
 
 			// This lock is mainly for shutdown.
 			std::lock_guard<std::mutex> guard(lock_);
@@ -282,7 +354,12 @@ namespace SaveState
 			// For fast-forwarding, otherwise they may be useless and too close.
 			double now = time_now_d();
 			double diff = now - rewindLastTime_;
-			if (diff < g_Config.iRewindSnapshotInterval)
+			double interval = g_Config.iRewindSnapshotInterval;
+			// Over the memory budget? Back off to half frequency so existing snapshots
+			// age out of the ring before we add larger new ones.
+			if (g_Config.iRewindMemoryBudgetMB > 0 && totalBytes_ > (size_t)g_Config.iRewindMemoryBudgetMB * 1024 * 1024)
+				interval *= 2.0;
+			if (diff < interval)
 				return;
 
 			DEBUG_LOG(Log::SaveState, "Saving rewind state");
@@ -310,7 +387,8 @@ namespace SaveState
 		StateBuffer bases_[2];
 		std::vector<int> baseMapping_;
 		std::mutex lock_;
-		std::thread compressThread_;
+		std::atomic<bool> compressing_{ false };
+		std::atomic<size_t> totalBytes_{ 0 };
 		std::vector<u8> buffer_;
 
 		int base_ = -1;
@@ -572,6 +650,55 @@ namespace SaveState
 		}
 	}
 
+	// Cached per-slot file info. The pause screen queries existence, dates and
+	// screenshots for every slot each time it opens, and each stat/open can be a slow
+	// round trip on Android scoped storage. Since we're the only writer while a game
+	// is running, we remember the answers and invalidate when we touch a slot.
+	struct SlotMeta {
+		bool queried = false;
+		bool hasState = false;
+		bool hasUndoState = false;
+		bool hasScreenshot = false;
+		bool hasModifTime = false;
+		tm modifTime{};
+	};
+
+	static std::mutex g_slotMetaLock;
+	static std::string g_slotMetaGameId;
+	static SlotMeta g_slotMeta[NUM_SLOTS];
+
+	static void InvalidateSlotMeta(int slot) {
+		std::lock_guard<std::mutex> guard(g_slotMetaLock);
+		if (slot < 0 || slot >= NUM_SLOTS) {
+			for (auto &meta : g_slotMeta)
+				meta = SlotMeta{};
+		} else {
+			g_slotMeta[slot] = SlotMeta{};
+		}
+	}
+
+	static SlotMeta GetSlotMeta(const Path &gameFilename, int slot) {
+		std::lock_guard<std::mutex> guard(g_slotMetaLock);
+		std::string gameId = GenerateFullDiscId(gameFilename);
+		if (gameId != g_slotMetaGameId) {
+			for (auto &meta : g_slotMeta)
+				meta = SlotMeta{};
+			g_slotMetaGameId = gameId;
+		}
+		SlotMeta &meta = g_slotMeta[slot];
+		if (!meta.queried) {
+			Path fn = GenerateSaveSlotFilename(gameFilename, slot, STATE_EXTENSION);
+			meta.hasState = File::Exists(fn);
+			if (meta.hasState) {
+				meta.hasModifTime = File::GetModifTime(fn, meta.modifTime);
+			}
+			meta.hasUndoState = File::Exists(GenerateSaveSlotFilename(gameFilename, slot, UNDO_STATE_EXTENSION));
+			meta.hasScreenshot = File::Exists(GenerateSaveSlotFilename(gameFilename, slot, SCREENSHOT_EXTENSION));
+			meta.queried = true;
+		}
+		return meta;
+	}
+
 	void LoadSlot(const Path &gameFilename, int slot, Callback callback, void *cbUserData)
 	{
 		Path fn = GenerateSaveSlotFilename(gameFilename, slot, STATE_EXTENSION);
@@ -639,6 +766,7 @@ namespace SaveState
 		if (!fn.empty()) {
 			Path shot = GenerateSaveSlotFilename(gameFilename, slot, SCREENSHOT_EXTENSION);
 			auto renameCallback = [=](Status status, std::string_view message, void *data) {
+				InvalidateSlotMeta(slot);
 				if (status != Status::FAILURE) {
 					if (g_Config.bEnableStateUndo) {
 						DeleteIfExists(fnUndo);
@@ -662,6 +790,8 @@ namespace SaveState
 				RenameIfExists(shot, shotUndo);
 			}
 			SaveScreenshot(shot, Callback(), 0);
+			// The screenshot rename above already changed the slot's files.
+			InvalidateSlotMeta(slot);
 			Save(fn.WithExtraExtension(".tmp"), slot, renameCallback, cbUserData);
 		} else {
 			if (callback) {
@@ -682,6 +812,7 @@ namespace SaveState
 			// Swap them so they can undo again to redo.  Mistakes happen.
 			SwapIfExists(shotUndo, shot);
 			SwapIfExists(fnUndo, fn);
+			InvalidateSlotMeta(slot);
 			return true;
 		}
 
@@ -698,14 +829,12 @@ namespace SaveState
 
 	bool HasSaveInSlot(const Path &gameFilename, int slot)
 	{
-		Path fn = GenerateSaveSlotFilename(gameFilename, slot, STATE_EXTENSION);
-		return File::Exists(fn);
+		return GetSlotMeta(gameFilename, slot).hasState;
 	}
 
 	bool HasUndoSaveInSlot(const Path &gameFilename, int slot)
 	{
-		Path fn = GenerateSaveSlotFilename(gameFilename, slot, UNDO_STATE_EXTENSION);
-		return File::Exists(fn);
+		return GetSlotMeta(gameFilename, slot).hasUndoState;
 	}
 
 	bool HasUndoLastSave(const Path &gameFilename) 
@@ -718,8 +847,7 @@ namespace SaveState
 
 	bool HasScreenshotInSlot(const Path &gameFilename, int slot)
 	{
-		Path fn = GenerateSaveSlotFilename(gameFilename, slot, SCREENSHOT_EXTENSION);
-		return File::Exists(fn);
+		return GetSlotMeta(gameFilename, slot).hasScreenshot;
 	}
 
 	bool HasUndoLoad(const Path &gameFilename)
@@ -769,14 +897,10 @@ namespace SaveState
 		int newestSlot = -1;
 		tm newestDate = {0};
 		for (int i = 0; i < NUM_SLOTS; i++) {
-			Path fn = GenerateSaveSlotFilename(gameFilename, i, STATE_EXTENSION);
-			if (File::Exists(fn)) {
-				tm time;
-				bool success = File::GetModifTime(fn, time);
-				if (success && newestDate < time) {
-					newestDate = time;
-					newestSlot = i;
-				}
+			SlotMeta meta = GetSlotMeta(gameFilename, i);
+			if (meta.hasModifTime && newestDate < meta.modifTime) {
+				newestDate = meta.modifTime;
+				newestSlot = i;
 			}
 		}
 		return newestSlot;
@@ -786,41 +910,34 @@ namespace SaveState
 		int oldestSlot = -1;
 		tm oldestDate = {0};
 		for (int i = 0; i < NUM_SLOTS; i++) {
-			Path fn = GenerateSaveSlotFilename(gameFilename, i, STATE_EXTENSION);
-			if (File::Exists(fn)) {
-				tm time;
-				bool success = File::GetModifTime(fn, time);
-				if (success && (!oldestDate || oldestDate > time)) {
-					oldestDate = time;
-					oldestSlot = i;
-				}
+			SlotMeta meta = GetSlotMeta(gameFilename, i);
+			if (meta.hasModifTime && (!oldestDate || oldestDate > meta.modifTime)) {
+				oldestDate = meta.modifTime;
+				oldestSlot = i;
 			}
 		}
 		return oldestSlot;
 	}
 
 	std::string GetSlotDateAsString(const Path &gameFilename, int slot) {
-		Path fn = GenerateSaveSlotFilename(gameFilename, slot, STATE_EXTENSION);
-		if (File::Exists(fn)) {
-			tm time;
-			if (File::GetModifTime(fn, time)) {
-				char buf[256];
-				// TODO: Use local time format? Americans and some others might not like ISO standard :)
-				switch (g_Config.iDateFormat) {
-				case PSP_SYSTEMPARAM_DATE_FORMAT_YYYYMMDD:
-					strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &time);
-					break;
-				case PSP_SYSTEMPARAM_DATE_FORMAT_MMDDYYYY:
-					strftime(buf, sizeof(buf), "%m-%d-%Y %H:%M:%S", &time);
-					break;
-				case PSP_SYSTEMPARAM_DATE_FORMAT_DDMMYYYY:
-					strftime(buf, sizeof(buf), "%d-%m-%Y %H:%M:%S", &time);
-					break;
-				default: // Should never happen
-					return "";
-				}
-				return std::string(buf);
+		SlotMeta meta = GetSlotMeta(gameFilename, slot);
+		if (meta.hasModifTime) {
+			char buf[256];
+			// TODO: Use local time format? Americans and some others might not like ISO standard :)
+			switch (g_Config.iDateFormat) {
+			case PSP_SYSTEMPARAM_DATE_FORMAT_YYYYMMDD:
+				strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &meta.modifTime);
+				break;
+			case PSP_SYSTEMPARAM_DATE_FORMAT_MMDDYYYY:
+				strftime(buf, sizeof(buf), "%m-%d-%Y %H:%M:%S", &meta.modifTime);
+				break;
+			case PSP_SYSTEMPARAM_DATE_FORMAT_DDMMYYYY:
+				strftime(buf, sizeof(buf), "%d-%m-%Y %H:%M:%S", &meta.modifTime);
+				break;
+			default: // Should never happen
+				return "";
 			}
+			return std::string(buf);
 		}
 		return "";
 	}
@@ -1057,7 +1174,8 @@ namespace SaveState
 			case SAVESTATE_SAVE_SCREENSHOT:
 			{
 				int maxResMultiplier = 2;
-				tempResult = TakeGameScreenshot(nullptr, op.filename, ScreenshotFormat::JPG, SCREENSHOT_DISPLAY, nullptr, nullptr, maxResMultiplier);
+				// Defer the JPEG encode and write to a background task - no need to block the emu thread on it.
+				tempResult = TakeGameScreenshot(nullptr, op.filename, ScreenshotFormat::JPG, SCREENSHOT_DISPLAY, nullptr, nullptr, maxResMultiplier, true);
 				callbackResult = tempResult ? Status::SUCCESS : Status::FAILURE;
 				if (!tempResult) {
 					ERROR_LOG(Log::SaveState, "Failed to take a screenshot for the savestate! %s", op.filename.c_str());
@@ -1128,5 +1246,8 @@ namespace SaveState
 	{
 		std::lock_guard<std::mutex> guard(mutex);
 		rewindStates.Clear();
+		// The user may delete or copy savestate files while no game is running,
+		// so don't trust the cached slot info across sessions.
+		InvalidateSlotMeta(-1);
 	}
 }
@@ -26,6 +26,7 @@
 #include "Common/File/Path.h"
 #include "Common/Log.h"
 #include "Common/System/Display.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Core/Config.h"
 #include "Core/Screenshot.h"
 #include "Core/Core.h"
@@ -329,7 +330,31 @@ static GPUDebugBuffer ApplyRotation(const GPUDebugBuffer &buf, DisplayRotation r
 	return rotated;
 }
 
-bool TakeGameScreenshot(Draw::DrawContext *draw, const Path &filename, ScreenshotFormat fmt, ScreenshotType type, int *width, int *height, int maxRes) {
+// Encodes and writes an already-captured screenshot on a worker, so savestates
+// and the screenshot hotkey don't pay for the PNG/JPEG encode on their thread.
+class ScreenshotWriteTask : public Task {
+public:
+	ScreenshotWriteTask(const Path &filename, ScreenshotFormat fmt, u8 *bufferRGB888, int w, int h)
+		: filename_(filename), fmt_(fmt), buffer_(bufferRGB888), w_(w), h_(h) {}
+	~ScreenshotWriteTask() {
+		delete[] buffer_;
+	}
+	TaskType Type() const override { return TaskType::IO_BLOCKING; }
+	TaskPriority Priority() const override { return TaskPriority::LOW; }
+	void Run() override {
+		if (!Save888RGBScreenshot(filename_, fmt_, buffer_, w_, h_)) {
+			ERROR_LOG(Log::IO, "Failed to write screenshot to '%s'", filename_.c_str());
+		}
+	}
+private:
+	Path filename_;
+	ScreenshotFormat fmt_;
+	u8 *buffer_;
+	int w_;
+	int h_;
+};
+
+bool TakeGameScreenshot(Draw::DrawContext *draw, const Path &filename, ScreenshotFormat fmt, ScreenshotType type, int *width, int *height, int maxRes, bool deferWrite) {
 	GPUDebugBuffer buf;
 	bool success = false;
 	u32 w = (u32)-1;
@@ -370,7 +395,14 @@ bool TakeGameScreenshot(Draw::DrawContext *draw, const Path &filename, Screensho
 			if (height)
 				*height = h;
 
-			success = Save888RGBScreenshot(filename, fmt, buffer, w, h);
+			if (deferWrite) {
+				// Hand an owned copy to the worker - buffer may point into buf or flipbuffer.
+				u8 *copy = new u8[w * h * 3];
+				memcpy(copy, buffer, w * h * 3);
+				g_threadManager.EnqueueTask(new ScreenshotWriteTask(filename, fmt, copy, w, h));
+			} else {
+				success = Save888RGBScreenshot(filename, fmt, buffer, w, h);
+			}
 		}
 		delete[] flipbuffer;
 	}
@@ -50,7 +50,9 @@
 #include "Core/HDRemaster.h"
 #include "Core/MIPS/MIPS.h"
 #include "Core/MIPS/MIPSAnalyst.h"
+#include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/MIPS/MIPSVFPUUtils.h"
+#include "Core/Debugger/DisassemblyManager.h"
 #include "Core/Debugger/SymbolMap.h"
 #include "Core/System.h"
 #include "Core/HLE/HLE.h"
@@ -67,6 +69,7 @@
 #include "Core/FileSystems/MetaFileSystem.h"
 #include "Core/Loaders.h"
 #include "Core/PSPLoaders.h"
+#include "Core/Reporting.h"
 #include "Core/ELF/ParamSFO.h"
 #include "Core/SaveState.h"
 #include "Common/ExceptionHandlerSetup.h"
@@ -337,6 +340,18 @@ bool CPU_Init(std::string *errorString, FileLoader *loadedFile) {
 		g_Config.AddRecent(filename.ToString());
 	}
 
+	// Queue up last session's jit blocks for precompilation, if we saved any.
+	if (g_Config.bPreloadFunctions && !g_paramSFO.GetDiscID().empty()) {
+		MIPSComp::LoadBlockAddressCache(GetSysDirectory(DIRECTORY_APP_CACHE) / (g_paramSFO.GetDiscID() + ".jitcache"));
+	}
+
+	// Optionally start checking the disc image against GameDB's known checksum in the
+	// background. The reads are paced, so this is safe even for streaming-heavy games.
+	if (g_Config.bVerifyDiscCRC &&
+		(type == IdentifiedFileType::PSP_ISO || type == IdentifiedFileType::PSP_ISO_NP)) {
+		Reporting::StartDiscIntegrityCheck(filename, g_paramSFO.GetDiscID());
+	}
+
 	InstallExceptionHandler(&Memory::HandleFault);
 	return true;
 }
@@ -366,6 +381,12 @@ void CPU_Shutdown() {
 	__KernelShutdown();
 	HLEShutdown();
 
+	// Remember which blocks got compiled so the next boot of this game can pre-queue them.
+	if (g_Config.bPreloadFunctions && !g_paramSFO.GetDiscID().empty()) {
+		File::CreateFullPath(GetSysDirectory(DIRECTORY_APP_CACHE));
+		MIPSComp::SaveBlockAddressCache(GetSysDirectory(DIRECTORY_APP_CACHE) / (g_paramSFO.GetDiscID() + ".jitcache"));
+	}
+
 	pspFileSystem.Shutdown();
 	mipsr4k.Shutdown();
 	Memory::Shutdown();
@@ -581,6 +602,9 @@ void PSP_Shutdown() {
 	Core_NotifyLifecycle(CoreLifecycle::STOPPING);
 	CPU_Shutdown();
 	GPU_Shutdown();
+	// The analyzed disassembly is shared between debugger views and survives them
+	// closing, but it's meaningless (and a lot of memory) once the game is gone.
+	DisassemblyManager::clear();
 	g_paramSFO.Clear();
 	System_SetWindowTitle("");
 	currentMIPS = 0;
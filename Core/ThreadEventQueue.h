@@ -42,8 +42,13 @@ struct ThreadEventQueue : public B {
 	void ScheduleEvent(Event ev) {
 		if (threadEnabled_) {
 			std::lock_guard<std::recursive_mutex> guard(eventsLock_);
+			bool wasEmpty = events_.empty();
 			events_.push_back(ev);
-			eventsWait_.notify_one();
+			// The event loop only ever blocks on an empty queue, so if there was
+			// already something in it there's no sleeper to wake. Skipping the
+			// notify saves a kernel call per event while the queue is busy.
+			if (wasEmpty)
+				eventsWait_.notify_one();
 		} else {
 			events_.push_back(ev);
 		}
@@ -112,10 +117,19 @@ struct ThreadEventQueue : public B {
 				break;
 			}
 
-			for (Event ev = GetNextEvent(); EventType(ev) != EVENT_INVALID; ev = GetNextEvent()) {
-				guard.unlock();
+			// Grab everything that's queued in one go. Processing a batch per lock
+			// acquisition instead of relocking around every single event keeps the
+			// producer/consumer handoff to a couple of context switches per burst
+			// of submissions.
+			std::deque<Event> batch;
+			batch.swap(events_);
+			guard.unlock();
+			for (Event &ev : batch) {
 				ProcessEventIfApplicable(ev, globalticks);
-				guard.lock();
+			}
+			guard.lock();
+			if (events_.empty()) {
+				NotifyDrain();
 			}
 		} while (CoreTiming::GetTicks() < globalticks);
 
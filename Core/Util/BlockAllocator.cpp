@@ -39,6 +39,7 @@ void BlockAllocator::Init(u32 rangeStart, u32 rangeSize, bool suballoc) {
 	//Initial block, covering everything
 	top_ = new Block(rangeStart_, rangeSize_, false, NULL, NULL);
 	bottom_ = top_;
+	freeBlocks_[top_->start] = top_;
 	suballoc_ = suballoc;
 }
 
@@ -51,6 +52,7 @@ void BlockAllocator::Shutdown()
 		bottom_ = next;
 	}
 	top_ = NULL;
+	freeBlocks_.clear();
 }
 
 u32 BlockAllocator::AllocAligned(u32 &size, u32 sizeGrain, u32 grain, bool fromTop, const char *tag)
@@ -70,22 +72,25 @@ u32 BlockAllocator::AllocAligned(u32 &size, u32 sizeGrain, u32 grain, bool fromT
 	// upalign size to grain
 	size = (size + sizeGrain - 1) & ~(sizeGrain - 1);
 
+	// We only walk the free blocks here - in address order, so first-fit picks the exact
+	// same blocks as the old walk over the full list did.
 	if (!fromTop)
 	{
 		//Allocate from bottom of mem
-		for (Block *bp = bottom_; bp != NULL; bp = bp->next)
+		for (auto iter = freeBlocks_.begin(); iter != freeBlocks_.end(); ++iter)
 		{
-			Block &b = *bp;
+			Block &b = *iter->second;
 			u32 offset = b.start % grain;
 			if (offset != 0)
 				offset = grain - offset;
 			u32 needed = offset + size;
-			if (b.taken == false && b.size >= needed)
+			if (b.size >= needed)
 			{
 				if (b.size == needed)
 				{
 					if (offset >= grain_)
 						InsertFreeBefore(&b, offset);
+					freeBlocks_.erase(b.start);
 					b.taken = true;
 					b.SetAllocated(tag, suballoc_);
 					return b.start;
@@ -95,6 +100,7 @@ u32 BlockAllocator::AllocAligned(u32 &size, u32 sizeGrain, u32 grain, bool fromT
 					InsertFreeAfter(&b, b.size - needed);
 					if (offset >= grain_)
 						InsertFreeBefore(&b, offset);
+					freeBlocks_.erase(b.start);
 					b.taken = true;
 					b.SetAllocated(tag, suballoc_);
 					return b.start;
@@ -105,17 +111,18 @@ u32 BlockAllocator::AllocAligned(u32 &size, u32 sizeGrain, u32 grain, bool fromT
 	else
 	{
 		// Allocate from top of mem.
-		for (Block *bp = top_; bp != NULL; bp = bp->prev)
+		for (auto iter = freeBlocks_.rbegin(); iter != freeBlocks_.rend(); ++iter)
 		{
-			Block &b = *bp;
+			Block &b = *iter->second;
 			u32 offset = (b.start + b.size - size) % grain;
 			u32 needed = offset + size;
-			if (b.taken == false && b.size >= needed)
+			if (b.size >= needed)
 			{
 				if (b.size == needed)
 				{
 					if (offset >= grain_)
 						InsertFreeAfter(&b, offset);
+					freeBlocks_.erase(b.start);
 					b.taken = true;
 					b.SetAllocated(tag, suballoc_);
 					return b.start;
@@ -125,6 +132,7 @@ u32 BlockAllocator::AllocAligned(u32 &size, u32 sizeGrain, u32 grain, bool fromT
 					InsertFreeBefore(&b, b.size - needed);
 					if (offset >= grain_)
 						InsertFreeAfter(&b, offset);
+					freeBlocks_.erase(b.start);
 					b.taken = true;
 					b.SetAllocated(tag, suballoc_);
 					return b.start;
@@ -191,6 +199,7 @@ u32 BlockAllocator::AllocAt(u32 position, u32 size, const char *tag)
 			{
 				if (b.size != alignedSize)
 					InsertFreeAfter(&b, b.size - alignedSize);
+				freeBlocks_.erase(b.start);
 				b.taken = true;
 				b.SetAllocated(tag, suballoc_);
 				CheckBlocks();
@@ -201,6 +210,7 @@ u32 BlockAllocator::AllocAt(u32 position, u32 size, const char *tag)
 				InsertFreeBefore(&b, alignedPosition - b.start);
 				if (b.size > alignedSize)
 					InsertFreeAfter(&b, b.size - alignedSize);
+				freeBlocks_.erase(b.start);
 				b.taken = true;
 				b.SetAllocated(tag, suballoc_);
 
@@ -234,6 +244,7 @@ void BlockAllocator::MergeFreeBlocks(Block *fromBlock)
 		else
 			fromBlock->next->prev = prev;
 		prev->next = fromBlock->next;
+		freeBlocks_.erase(fromBlock->start);
 		delete fromBlock;
 		fromBlock = prev;
 		prev = fromBlock->prev;
@@ -250,6 +261,7 @@ void BlockAllocator::MergeFreeBlocks(Block *fromBlock)
 		DEBUG_LOG(Log::sceKernel, "Block Alloc found adjacent free blocks - merging");
 		fromBlock->size += next->size;
 		fromBlock->next = next->next;
+		freeBlocks_.erase(next->start);
 		delete next;
 		next = fromBlock->next;
 	}
@@ -267,6 +279,7 @@ bool BlockAllocator::Free(u32 position)
 	{
 		NotifyMemInfo(suballoc_ ? MemBlockFlags::SUB_FREE : MemBlockFlags::FREE, b->start, b->size, "");
 		b->taken = false;
+		freeBlocks_[b->start] = b;
 		MergeFreeBlocks(b);
 		return true;
 	}
@@ -284,6 +297,7 @@ bool BlockAllocator::FreeExact(u32 position)
 	{
 		NotifyMemInfo(suballoc_ ? MemBlockFlags::SUB_FREE : MemBlockFlags::FREE, b->start, b->size, "");
 		b->taken = false;
+		freeBlocks_[b->start] = b;
 		MergeFreeBlocks(b);
 		return true;
 	}
@@ -303,8 +317,14 @@ BlockAllocator::Block *BlockAllocator::InsertFreeBefore(Block *b, u32 size)
 	else
 		inserted->prev->next = inserted;
 
+	// b's start moves, so if it's free, its index key changes too.
+	if (!b->taken)
+		freeBlocks_.erase(b->start);
+	freeBlocks_[inserted->start] = inserted;
 	b->start += size;
 	b->size -= size;
+	if (!b->taken)
+		freeBlocks_[b->start] = b;
 	return inserted;
 }
 
@@ -317,12 +337,24 @@ BlockAllocator::Block *BlockAllocator::InsertFreeAfter(Block *b, u32 size)
 	else
 		inserted->next->prev = inserted;
 
+	freeBlocks_[inserted->start] = inserted;
 	b->size -= size;
 	return inserted;
 }
 
+void BlockAllocator::RebuildFreeIndex()
+{
+	freeBlocks_.clear();
+	for (Block *bp = bottom_; bp != NULL; bp = bp->next)
+	{
+		if (!bp->taken)
+			freeBlocks_[bp->start] = bp;
+	}
+}
+
 void BlockAllocator::CheckBlocks() const
 {
+	size_t freeCount = 0;
 	for (const Block *bp = bottom_; bp != NULL; bp = bp->next)
 	{
 		const Block &b = *bp;
@@ -333,6 +365,16 @@ void BlockAllocator::CheckBlocks() const
 		if (b.start + b.size > rangeStart_ + rangeSize_ || b.start < rangeStart_) {
 			ERROR_LOG_REPORT(Log::HLE, "Bogus block in allocator");
 		}
+		if (!b.taken) {
+			++freeCount;
+			auto iter = freeBlocks_.find(b.start);
+			if (iter == freeBlocks_.end() || iter->second != bp) {
+				ERROR_LOG_REPORT(Log::HLE, "Free block %08x missing from the free index", b.start);
+			}
+		}
+	}
+	if (freeCount != freeBlocks_.size()) {
+		ERROR_LOG_REPORT(Log::HLE, "Free index out of sync: %d blocks indexed, %d free", (int)freeBlocks_.size(), (int)freeCount);
 	}
 }
 
@@ -341,7 +383,7 @@ const char *BlockAllocator::GetBlockTag(u32 addr) const {
 	return b->tag;
 }
 
-inline BlockAllocator::Block *BlockAllocator::GetBlockFromAddress(u32 addr)
+BlockAllocator::Block *BlockAllocator::GetBlockFromAddress(u32 addr)
 {
 	for (Block *bp = bottom_; bp != NULL; bp = bp->next)
 	{
@@ -401,14 +443,10 @@ void BlockAllocator::ListBlocks() const
 u32 BlockAllocator::GetLargestFreeBlockSize() const
 {
 	u32 maxFreeBlock = 0;
-	for (const Block *bp = bottom_; bp != NULL; bp = bp->next)
+	for (const auto &iter : freeBlocks_)
 	{
-		const Block &b = *bp;
-		if (!b.taken)
-		{
-			if (b.size > maxFreeBlock)
-				maxFreeBlock = b.size;
-		}
+		if (iter.second->size > maxFreeBlock)
+			maxFreeBlock = iter.second->size;
 	}
 	if (maxFreeBlock & (grain_ - 1))
 		WARN_LOG_REPORT(Log::HLE, "GetLargestFreeBlockSize: free size %08x does not align to grain %08x.", maxFreeBlock, grain_);
@@ -418,13 +456,9 @@ u32 BlockAllocator::GetLargestFreeBlockSize() const
 u32 BlockAllocator::GetTotalFreeBytes() const
 {
 	u32 sum = 0;
-	for (const Block *bp = bottom_; bp != NULL; bp = bp->next)
+	for (const auto &iter : freeBlocks_)
 	{
-		const Block &b = *bp;
-		if (!b.taken)
-		{
-			sum += b.size;
-		}
+		sum += iter.second->size;
 	}
 	if (sum & (grain_ - 1))
 		WARN_LOG_REPORT(Log::HLE, "GetTotalFreeBytes: free size %08x does not align to grain %08x.", sum, grain_);
@@ -455,6 +489,7 @@ void BlockAllocator::DoState(PointerWrap &p)
 			top_->next->DoState(p);
 			top_ = top_->next;
 		}
+		RebuildFreeIndex();
 	}
 	else
 	{
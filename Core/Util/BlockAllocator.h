@@ -19,6 +19,8 @@
 
 class PointerWrap;
 
+#include <map>
+
 #include "Common/CommonTypes.h"
 
 class BlockAllocator
@@ -73,6 +75,13 @@ private:
 
 	Block *bottom_ = nullptr;
 	Block *top_ = nullptr;
+
+	// Index of the free blocks only, ordered by address. Alloc walks this instead of the
+	// full block list, which is nearly all taken blocks in alloc-heavy games. Iterating in
+	// address order gives exactly the same first-fit results as the full walk did.
+	// Not saved in states - rebuilt on load.
+	std::map<u32, Block *> freeBlocks_;
+
 	u32 rangeStart_ = 0;
 	u32 rangeSize_ = 0;
 
@@ -84,4 +93,5 @@ private:
 	const Block *GetBlockFromAddress(u32 addr) const;
 	Block *InsertFreeBefore(Block *b, u32 size);
 	Block *InsertFreeAfter(Block *b, u32 size);
+	void RebuildFreeIndex();
 };
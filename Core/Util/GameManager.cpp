@@ -18,8 +18,10 @@
 #include "ppsspp_config.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <set>
 #include <sstream>
@@ -39,7 +41,10 @@
 #include "Common/System/OSD.h"
 #include "Common/File/FileUtil.h"
 #include "Common/StringUtils.h"
+#include "Common/Thread/ParallelLoop.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Common/Thread/ThreadUtil.h"
+#include "Common/TimeUtil.h"
 #include "Core/Config.h"
 #include "Core/Loaders.h"
 #include "Core/ELF/ParamSFO.h"
@@ -447,7 +452,7 @@ void GameManager::InstallZipContents(ZipFileTask task) {
 		Path pspGame = GetSysDirectory(DIRECTORY_GAME);
 		INFO_LOG(Log::HLE, "Installing '%s' into '%s'", task.fileName.c_str(), pspGame.c_str());
 		// InstallZipContents contains code to close z.
-		success = ExtractZipContents(z, pspGame, zipInfo, false);
+		success = ExtractZipContents(z, task.fileName, pspGame, zipInfo, false);
 		break;
 	}
 	case ZipFileContents::ISO_FILE:
@@ -470,7 +475,7 @@ void GameManager::InstallZipContents(ZipFileTask task) {
 			} else {
 				// TODO: Can probably remove this, as we now put .nomedia in /TEXTURES directly.
 				File::CreateEmptyFile(dest / ".nomedia");
-				success = ExtractZipContents(z, dest, zipInfo, true);
+				success = ExtractZipContents(z, task.fileName, dest, zipInfo, true);
 			}
 		} else {
 			zip_close(z);
@@ -481,7 +486,7 @@ void GameManager::InstallZipContents(ZipFileTask task) {
 	case ZipFileContents::SAVE_DATA:
 	{
 		Path pspSaveData = GetSysDirectory(DIRECTORY_SAVEDATA);
-		success = ExtractZipContents(z, pspSaveData, zipInfo, false);
+		success = ExtractZipContents(z, task.fileName, pspSaveData, zipInfo, false);
 		break;
 	}
 	default:
@@ -653,7 +658,7 @@ bool ZipExtractFileToMemory(struct zip *z, int fileIndex, std::string *data) {
 	}
 }
 
-bool GameManager::ExtractFile(struct zip *z, int file_index, const Path &outFilename, size_t *bytesCopied, size_t allBytes) {
+bool GameManager::ExtractFile(struct zip *z, int file_index, const Path &outFilename, std::atomic<size_t> *bytesCopied, size_t allBytes) {
 	struct zip_stat zstat;
 	zip_stat_index(z, file_index, 0, &zstat);
 	size_t size = zstat.size;
@@ -670,7 +675,9 @@ bool GameManager::ExtractFile(struct zip *z, int file_index, const Path &outFile
 			INFO_LOG(Log::HLE, "Writing %d bytes to '%s'", (int)size, outFilename.c_str());
 		}
 		size_t pos = 0;
-		const size_t blockSize = 1024 * 128;
+		// A large block size keeps both the decompressor and the storage device busy
+		// with fewer round trips. Matters a lot on slow Android external storage.
+		const size_t blockSize = 1024 * 1024;
 		u8 *buffer = new u8[blockSize];
 		while (pos < size) {
 			size_t readSize = std::min(blockSize, size - pos);
@@ -716,9 +723,8 @@ bool GameManager::ExtractFile(struct zip *z, int file_index, const Path &outFile
 }
 
 // Doesn't care what it is, just extracts the whole ZIP to the requested location.
-bool GameManager::ExtractZipContents(struct zip *z, const Path &dest, const ZipFileInfo &info, bool allowRoot) {
+bool GameManager::ExtractZipContents(struct zip *z, const Path &zipPath, const Path &dest, const ZipFileInfo &info, bool allowRoot) {
 	size_t allBytes = 0;
-	size_t bytesCopied = 0;
 
 	auto sy = GetI18NCategory(I18NCat::SYSTEM);
 
@@ -773,47 +779,80 @@ bool GameManager::ExtractZipContents(struct zip *z, const Path &dest, const ZipF
 
 	INFO_LOG(Log::HLE, "Created %d directories", (int)createdDirs.size());
 
-	// Now, loop through again in a second pass, writing files.
+	// Now, loop through again in a second pass, writing files. This is fanned out across
+	// a few worker threads - libzip handles aren't thread-safe but are cheap to open, so
+	// each worker gets its own handle on the same file. Inflate is CPU-bound and the
+	// writes are IO-bound, so a handful of parallel streams is usually enough to
+	// saturate the storage device.
 	std::vector<Path> createdFiles;
-	for (int i = 0; i < info.numFiles; i++) {
-		const char *fn = zip_get_name(z, i, 0);
-		// Note that we do NOT write files that are not in a directory, to avoid random
-		// README files etc. (unless allowRoot is true.)
-		if (fileAllowed(fn) && strlen(fn) > (size_t)info.stripChars) {
-			std::string zippedName = fn;
-			fn += info.stripChars;
-			Path outFilename = dest / fn;
-			bool isDir = zippedName.empty() || zippedName.back() == '/';
-			if (isDir)
-				continue;
-
-			if (!ExtractFile(z, i, outFilename, &bytesCopied, allBytes)) {
-				ERROR_LOG(Log::HLE, "Bailing: Failed to extract file: %s -> %s", zippedName.c_str(), outFilename.c_str());
-				goto bail;
-			} else {
-				createdFiles.push_back(outFilename);
+	std::mutex createdFilesLock;
+	std::atomic<size_t> bytesCopied{};
+	std::atomic<int> filesDone{};
+	std::atomic<bool> failed{};
+	const double startTime = time_now_d();
+
+	auto extractRange = [&](int low, int high) {
+		struct zip *zw = ZipOpenPath(zipPath);
+		if (!zw) {
+			ERROR_LOG(Log::HLE, "Failed to open extra zip handle for '%s'", zipPath.c_str());
+			failed = true;
+			return;
+		}
+		for (int i = low; i < high && !failed; i++) {
+			const char *fn = zip_get_name(zw, i, 0);
+			// Note that we do NOT write files that are not in a directory, to avoid random
+			// README files etc. (unless allowRoot is true.)
+			if (fileAllowed(fn) && strlen(fn) > (size_t)info.stripChars) {
+				std::string zippedName = fn;
+				fn += info.stripChars;
+				Path outFilename = dest / fn;
+				bool isDir = zippedName.empty() || zippedName.back() == '/';
+				if (isDir)
+					continue;
+
+				if (!ExtractFile(zw, i, outFilename, &bytesCopied, allBytes)) {
+					ERROR_LOG(Log::HLE, "Bailing: Failed to extract file: %s -> %s", zippedName.c_str(), outFilename.c_str());
+					failed = true;
+					break;
+				} else {
+					std::lock_guard<std::mutex> guard(createdFilesLock);
+					createdFiles.push_back(outFilename);
+				}
 			}
+			int done = ++filesDone;
+			// Show the throughput so the user can tell a slow SD card from a hang.
+			double elapsed = time_now_d() - startTime;
+			double mbPerSec = elapsed > 0.001 ? (double)bytesCopied.load() / (1024.0 * 1024.0) / elapsed : 0.0;
+			std::string message = StringFromFormat("%.*s (%0.1f MB/s)", (int)di->T("Installing...").size(), di->T("Installing...").data(), mbPerSec);
+			g_OSD.SetProgressBar("install", message, 0.0f, 1.0f, 0.1f + done / (float)info.numFiles * 0.9f, 0.1f);
+		}
+		zip_close(zw);
+	};
+
+	if (info.numFiles > 0) {
+		// Cap the number of chunks at four - more streams mostly just add seek pressure.
+		int minSize = std::max(1, (info.numFiles + 3) / 4);
+		ParallelRangeLoop(&g_threadManager, extractRange, 0, info.numFiles, minSize);
+	}
+
+	if (failed) {
+		// We end up here if disk is full or couldn't write to storage for some other reason.
+		zip_close(z);
+		// We don't delete the original in this case. Try to delete the files we created so far.
+		for (size_t i = 0; i < createdFiles.size(); i++) {
+			File::Delete(createdFiles[i]);
+		}
+		for (auto const &iter : createdDirs) {
+			File::DeleteDir(iter);
 		}
-		g_OSD.SetProgressBar("install", di->T("Installing..."), 0.0f, 1.0f, 0.1f + (i + 1) / (float)info.numFiles * 0.9f, 0.1f);
+		SetInstallError(sy->T("Storage full"));
+		return false;
 	}
 
-	INFO_LOG(Log::HLE, "Unzipped %d files (%d bytes / %d).", info.numFiles, (int)bytesCopied, (int)allBytes);
+	INFO_LOG(Log::HLE, "Unzipped %d files (%d bytes / %d).", info.numFiles, (int)bytesCopied.load(), (int)allBytes);
 	zip_close(z);
 	z = nullptr;
 	return true;
-
-bail:
-	// We end up here if disk is full or couldn't write to storage for some other reason.
-	zip_close(z);
-	// We don't delete the original in this case. Try to delete the files we created so far.
-	for (size_t i = 0; i < createdFiles.size(); i++) {
-		File::Delete(createdFiles[i]);
-	}
-	for (auto const &iter : createdDirs) {
-		File::DeleteDir(iter);
-	}
-	SetInstallError(sy->T("Storage full"));
-	return false;
 }
 
 bool GameManager::InstallMemstickZip(struct zip *z, const Path &zipfile, const Path &dest, const ZipFileInfo &info) {
@@ -902,7 +941,7 @@ bool GameManager::InstallZippedISO(struct zip *z, int isoFileIndex, const Path &
 	}
 	outputISOFilename = outputISOFilename / name;
 
-	size_t bytesCopied = 0;
+	std::atomic<size_t> bytesCopied{};
 	bool success = false;
 	auto di = GetI18NCategory(I18NCat::DIALOG);
 	g_OSD.SetProgressBar("install", di->T("Installing..."), 0.0f, 0.0f, 0.0f, 0.1f);
@@ -135,6 +135,46 @@ struct PPGeTextDrawerImage {
 
 static std::map<PPGeTextDrawerCacheKey, PPGeTextDrawerImage> textDrawerImages;
 
+// Shaped glyph runs for the atlas font path. Shaping re-decodes the UTF-8 and does
+// a glyph lookup plus wrapping logic per character, every frame, for every string the
+// save dialog shows - caching the result turns a redraw into a vector copy. Purely
+// host-side derived data, so it's not part of the save state.
+struct PPGeGlyphRunCacheKey {
+	bool operator < (const PPGeGlyphRunCacheKey &other) const {
+		if (align != other.align)
+			return align < other.align;
+		if (wrapType != other.wrapType)
+			return wrapType < other.wrapType;
+		if (wrapWidth != other.wrapWidth)
+			return wrapWidth < other.wrapWidth;
+		if (scale != other.scale)
+			return scale < other.scale;
+		if (lineHeightScale != other.lineHeightScale)
+			return lineHeightScale < other.lineHeightScale;
+		if (x != other.x)
+			return x < other.x;
+		if (y != other.y)
+			return y < other.y;
+		return text < other.text;
+	}
+	std::string text;
+	int align;
+	int wrapType;
+	float wrapWidth;
+	float scale;
+	float lineHeightScale;
+	float x;
+	float y;
+};
+
+struct PPGeGlyphRun {
+	AtlasLineArray lines;
+	AtlasTextMetrics metrics;
+	int lastUsedFrame = 0;
+};
+
+static std::map<PPGeGlyphRunCacheKey, PPGeGlyphRun> glyphRunCache;
+
 void PPGeSetDrawContext(Draw::DrawContext *draw) {
 	g_draw = draw;
 }
@@ -153,9 +193,15 @@ static void PPGeDecimateTextImages(int age = 97);
 
 void PPGeSetTexture(u32 dataAddr, int width, int height);
 
+// Host pointer to the display list buffer, cached in PPGeBegin. Writing commands
+// through it instead of Memory::Write_U32 skips an address translation per command -
+// a dialog frame is hundreds of commands. The written range is reported to the
+// memory tracker in one go in PPGeEnd, which already happened before.
+static u32 *dlHostPtr = nullptr;
+
 //only 0xFFFFFF of data is used
 static void WriteCmd(u8 cmd, u32 data) {
-	Memory::Write_U32((cmd << 24) | (data & 0xFFFFFF), dlWritePtr);
+	dlHostPtr[(dlWritePtr - dlPtr) >> 2] = (cmd << 24) | (data & 0xFFFFFF);
 	dlWritePtr += 4;
 	_dbg_assert_(dlWritePtr <= dlPtr + dlSize);
 }
@@ -306,6 +352,8 @@ void __PPGeInit() {
 	textDrawerInited = PSP_CoreParameter().headLess;
 	textDrawer = nullptr;
 	textDrawerImages.clear();
+	// The cached runs hold pointers into the atlas metadata, which may just have been reloaded.
+	glyphRunCache.clear();
 
 	atlasRequiresReset = false;
 
@@ -413,6 +461,7 @@ void __PPGeShutdown()
 	for (auto im : textDrawerImages)
 		kernelMemory.Free(im.second.ptr);
 	textDrawerImages.clear();
+	glyphRunCache.clear();
 }
 
 void PPGeBegin()
@@ -420,6 +469,10 @@ void PPGeBegin()
 	if (!dlPtr)
 		return;
 
+	// Re-derived every frame since the allocation can move across savestate loads.
+	dlHostPtr = (u32 *)Memory::GetPointerWriteRange(dlPtr, dlSize);
+	_assert_msg_(dlHostPtr != nullptr, "PPGe display list buffer %08x not mapped", dlPtr);
+
 	// Reset write pointers to start of command and data buffers.
 	dlWritePtr = dlPtr;
 	dataWritePtr = dataPtr;
@@ -815,7 +868,23 @@ void PPGePrepareText(std::string_view text, float x, float y, PPGeAlign align, f
 	if (!g_ppge_atlas.IsMetadataLoaded() || g_ppge_atlas.num_fonts < 1) {
 		return;
 	}
+
+	PPGeGlyphRunCacheKey key{ std::string(text), (int)align, WrapType, (float)wrapWidth, scale, lineHeightScale, x, y };
+	auto cached = glyphRunCache.find(key);
+	if (cached != glyphRunCache.end()) {
+		char_lines = cached->second.lines;
+		char_lines_metrics = cached->second.metrics;
+		cached->second.lastUsedFrame = gpuStats.numFlips;
+		return;
+	}
+
 	char_lines_metrics = BreakLines(text, atlasfont, x, y, align, scale, lineHeightScale, WrapType, wrapWidth, false);
+
+	PPGeGlyphRun run;
+	run.lines = char_lines;
+	run.metrics = char_lines_metrics;
+	run.lastUsedFrame = gpuStats.numFlips;
+	glyphRunCache[key] = std::move(run);
 }
 
 static void PPGeResetCurrentText() {
@@ -1054,6 +1123,15 @@ static void PPGeDecimateTextImages(int age) {
 			++it;
 		}
 	}
+
+	// Same policy for cached glyph runs - these are just host memory, though.
+	for (auto it = glyphRunCache.begin(); it != glyphRunCache.end(); ) {
+		if (gpuStats.numFlips - it->second.lastUsedFrame >= age) {
+			it = glyphRunCache.erase(it);
+		} else {
+			++it;
+		}
+	}
 }
 
 void PPGeDrawText(std::string_view text, float x, float y, const PPGeStyle &style) {
@@ -23,6 +23,7 @@
 #include "Common/Net/HTTPServer.h"
 #include "Common/Net/Sinks.h"
 #include "Common/Net/URL.h"
+#include "Common/System/System.h"
 #include "Common/Thread/ThreadUtil.h"
 #include "Common/Log.h"
 #include "Common/File/FileUtil.h"
@@ -33,7 +34,12 @@
 #include "Common/StringUtils.h"
 #include "Core/Config.h"
 #include "Core/Debugger/WebSocket.h"
+#include "Core/HW/Display.h"
+#include "Core/MIPS/JitCommon/JitCommon.h"
+#include "Core/MIPS/JitCommon/JitBlockCache.h"
 #include "Core/WebServer.h"
+#include "GPU/GPU.h"
+#include "GPU/GPUInterface.h"
 
 enum class ServerStatus {
 	STOPPED,
@@ -303,6 +309,7 @@ static void HandleListing(const http::ServerRequest &request) {
 	if (serverFlags & (int)WebServerFlags::DEBUGGER) {
 		request.Out()->Printf("/debugger\n");
 	}
+	request.Out()->Printf("/stats\n");
 }
 
 static bool ServeDebuggerFile(const http::ServerRequest &request) {
@@ -345,6 +352,89 @@ static void RedirectToDebugger(const http::ServerRequest &request) {
 	request.Out()->Push(payload);
 }
 
+// Per-frame performance counters, served at /stats as NDJSON so monitoring tools can
+// scrape live performance without attaching a debugger. Recorded from a flip listener
+// on the emu thread - just a handful of counter copies, so cheap enough to leave
+// registered for the lifetime of the server.
+struct FrameStatRecord {
+	int frame;           // flip count, monotonically increasing while a game runs
+	double time;         // host time at flip, seconds
+	double frameTime;    // seconds since the previous flip
+	int drawCalls;
+	int vertsSubmitted;
+	int jitBlocks;
+	int texturesLoaded;
+	int audioUnderruns;  // total since game start
+	int audioPeriod;     // host device period in frames, as observed from the pull callbacks
+	int64_t audioFramesOut;     // total frames delivered to the device
+	int64_t audioFramesPadded;  // total frames padded due to underrun; diff vs audioFramesOut
+	                            // over an interval for the missed audio budget
+};
+
+static constexpr int FRAME_STATS_RING_SIZE = 256;
+static FrameStatRecord frameStatsRing[FRAME_STATS_RING_SIZE];
+static int frameStatsCount;  // total records written, write pos = count % size
+static std::mutex frameStatsLock;
+static double frameStatsLastFlip;
+
+static void FrameStatsFlipListener(void *) {
+	double now = time_now_d();
+	FrameStatRecord rec{};
+	rec.frame = __DisplayGetFlipCount();
+	rec.time = now;
+	rec.frameTime = frameStatsLastFlip != 0.0 ? now - frameStatsLastFlip : 0.0;
+	frameStatsLastFlip = now;
+	// These are reset each frame by Core_UpdateDebugStats, so sampling at flip gets full frames.
+	rec.drawCalls = gpuStats.numDrawCalls;
+	rec.vertsSubmitted = gpuStats.numVertsSubmitted;
+	if (MIPSComp::jit) {
+		JitBlockCacheDebugInterface *blockCache = MIPSComp::jit->GetBlockCacheDebugInterface();
+		rec.jitBlocks = blockCache ? blockCache->GetNumBlocks() : 0;
+	}
+	rec.texturesLoaded = gpu ? (int)gpu->NumLoadedTextures() : 0;
+	rec.audioUnderruns = System_AudioGetUnderrunCountTotal();
+	System_AudioGetPullStats(&rec.audioPeriod, &rec.audioFramesOut, &rec.audioFramesPadded);
+
+	std::lock_guard<std::mutex> guard(frameStatsLock);
+	frameStatsRing[frameStatsCount % FRAME_STATS_RING_SIZE] = rec;
+	frameStatsCount++;
+}
+
+static void HandleFrameStats(const http::ServerRequest &request) {
+	AndroidJNIThreadContext jniContext;
+
+	// Pass ?after=<frame> to only get records newer than that, so a poller
+	// can resume from the last frame it saw.
+	int afterFrame = -1;
+	std::string after;
+	if (request.GetParamValue("after", &after)) {
+		afterFrame = atoi(after.c_str());
+	}
+
+	FrameStatRecord records[FRAME_STATS_RING_SIZE];
+	int count = 0;
+	{
+		std::lock_guard<std::mutex> guard(frameStatsLock);
+		int first = std::max(0, frameStatsCount - FRAME_STATS_RING_SIZE);
+		for (int i = first; i < frameStatsCount; i++) {
+			const FrameStatRecord &rec = frameStatsRing[i % FRAME_STATS_RING_SIZE];
+			if (rec.frame > afterFrame) {
+				records[count++] = rec;
+			}
+		}
+	}
+
+	request.WriteHttpResponseHeader("1.0", 200, -1, "application/x-ndjson");
+	for (int i = 0; i < count; i++) {
+		const FrameStatRecord &r = records[i];
+		request.Out()->Printf(
+			"{\"frame\":%d,\"time\":%.6f,\"frameTime\":%.6f,\"drawCalls\":%d,\"vertsSubmitted\":%d,\"jitBlocks\":%d,\"texturesLoaded\":%d,\"audioUnderruns\":%d,\"audioPeriod\":%d,\"audioFramesOut\":%lld,\"audioFramesPadded\":%lld}\n",
+			r.frame, r.time, r.frameTime, r.drawCalls, r.vertsSubmitted, r.jitBlocks, r.texturesLoaded, r.audioUnderruns,
+			r.audioPeriod, (long long)r.audioFramesOut, (long long)r.audioFramesPadded);
+	}
+	request.Out()->Flush();
+}
+
 static void HandleFallback(const http::ServerRequest &request) {
 	SetCurrentThreadName("HandleFallback");
 
@@ -412,6 +502,7 @@ static void ExecuteWebServer() {
 	// This lists all the (current) recent ISOs.
 	http->SetFallbackHandler(&HandleFallback);
 	http->RegisterHandler("/debugger", &ForwardDebuggerRequest);
+	http->RegisterHandler("/stats", &HandleFrameStats);
 
 	if (!http->Listen(g_Config.iRemoteISOPort)) {
 		if (!http->Listen(0)) {
@@ -422,6 +513,9 @@ static void ExecuteWebServer() {
 	}
 	UpdateStatus(ServerStatus::RUNNING);
 
+	frameStatsLastFlip = 0.0;
+	__DisplayListenFlip(&FrameStatsFlipListener, nullptr);
+
 	g_Config.iRemoteISOPort = http->Port();
 	RegisterServer(http->Port());
 	double lastRegister = time_now_d();
@@ -435,6 +529,8 @@ static void ExecuteWebServer() {
 		}
 	}
 
+	__DisplayForgetFlip(&FrameStatsFlipListener, nullptr);
+
 	http->Stop();
 	StopAllDebuggers();
 	delete http;
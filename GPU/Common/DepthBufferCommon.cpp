@@ -15,9 +15,12 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include "ppsspp_config.h"
+
 #include <algorithm>
 
 #include "Common/GPU/OpenGL/GLFeatures.h"
+#include "Common/Math/CrossSIMD.h"
 #include "Common/LogReporting.h"
 #include "Core/ConfigValues.h"
 #include "GPU/Common/GPUStateUtils.h"
@@ -254,11 +257,29 @@ bool FramebufferManagerCommon::ReadbackDepthbuffer(Draw::Framebuffer *fbo, int x
 	// TODO: Move this conversion into the backends.
 	if (format16Bit) {
 		// In this case, we used the shader to apply depth scale factors.
-		// This can be SSE'd or NEON'd very efficiently, though ideally we would avoid this conversion by using R16_UNORM for readback.
+		// Ideally we would avoid this conversion entirely by using R16_UNORM for readback.
 		uint16_t *dest = pixels;
 		const u32_le *packed32 = (u32_le *)convBuf_;
 		for (int yp = 0; yp < destH; ++yp) {
-			for (int xp = 0; xp < destW; ++xp) {
+			int xp = 0;
+#if PPSSPP_ARCH(SSE2)
+			for (; xp + 8 <= destW; xp += 8) {
+				// Keep the low 16 bits of each word. Sign-extending before the signed pack
+				// reproduces them exactly.
+				__m128i a = _mm_loadu_si128((const __m128i *)&packed32[xp]);
+				__m128i b = _mm_loadu_si128((const __m128i *)&packed32[xp + 4]);
+				a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+				b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+				_mm_storeu_si128((__m128i *)&dest[xp], _mm_packs_epi32(a, b));
+			}
+#elif PPSSPP_ARCH(ARM_NEON)
+			for (; xp + 8 <= destW; xp += 8) {
+				uint32x4_t a = vld1q_u32((const u32 *)&packed32[xp]);
+				uint32x4_t b = vld1q_u32((const u32 *)&packed32[xp + 4]);
+				vst1q_u16(&dest[xp], vcombine_u16(vmovn_u32(a), vmovn_u32(b)));
+			}
+#endif
+			for (; xp < destW; ++xp) {
 				dest[xp] = packed32[xp] & 0xFFFF;
 			}
 			dest += pixelsStride;
@@ -23,7 +23,9 @@
 #include "Common/LogReporting.h"
 #include "Common/Math/CrossSIMD.h"
 #include "Common/Math/lin/matrix4x4.h"
+#include "Common/TimeUtil.h"
 #include "Core/Config.h"
+#include "Core/System.h"
 #include "GPU/Common/DrawEngineCommon.h"
 #include "GPU/Common/SplineCommon.h"
 #include "GPU/Common/VertexDecoderCommon.h"
@@ -36,7 +38,7 @@ enum {
 	TRANSFORMED_VERTEX_BUFFER_SIZE = VERTEX_BUFFER_MAX * sizeof(TransformedVertex)
 };
 
-DrawEngineCommon::DrawEngineCommon() : decoderMap_(16) {
+DrawEngineCommon::DrawEngineCommon() : dedupMap_(1024), tessCache_(64), vertexDecodeCache_(512), decoderMap_(16) {
 	if (g_Config.bVertexDecoderJit && (g_Config.iCpuCore == (int)CPUCore::JIT || g_Config.iCpuCore == (int)CPUCore::JIT_IR)) {
 		decJitCache_ = new VertexDecoderJitCache();
 	}
@@ -50,12 +52,16 @@ DrawEngineCommon::DrawEngineCommon() : decoderMap_(16) {
 DrawEngineCommon::~DrawEngineCommon() {
 	FreeMemoryPages(decoded_, DECODED_VERTEX_BUFFER_SIZE);
 	FreeMemoryPages(decIndex_, DECODED_INDEX_BUFFER_SIZE);
+	if (dedupRemap_)
+		FreeMemoryPages(dedupRemap_, VERTEX_BUFFER_MAX * sizeof(u16));
 	FreeMemoryPages(transformed_, TRANSFORMED_VERTEX_BUFFER_SIZE);
 	FreeMemoryPages(transformedExpanded_, 3 * TRANSFORMED_VERTEX_BUFFER_SIZE);
 	delete decJitCache_;
 	decoderMap_.Iterate([&](const uint32_t vtype, VertexDecoder *decoder) {
 		delete decoder;
 	});
+	ClearTessCache();
+	ClearVertexDecodeCache();
 	ClearSplineBezierWeights();
 }
 
@@ -130,10 +136,28 @@ void DrawEngineCommon::NotifyConfigChanged() {
 	});
 	decoderMap_.Clear();
 	ClearTrackedVertexArrays();
+	ClearTessCache();
 
 	useHWTransform_ = g_Config.bHardwareTransform;
 	useHWTessellation_ = UpdateUseHWTessellation(g_Config.bHardwareTessellation);
 	decOptions_.applySkinInDecode = g_Config.bSoftwareSkinning;
+
+	dedupVertices_ = PSP_CoreParameter().compat.flags().DedupIndexedVertices;
+	if (dedupVertices_ && !dedupRemap_) {
+		dedupRemap_ = (u16 *)AllocateMemoryPages(VERTEX_BUFFER_MAX * sizeof(u16), MEM_PROT_READ | MEM_PROT_WRITE);
+	}
+
+	cacheDecodedVerts_ = PSP_CoreParameter().compat.hints().CacheDecodedVertices;
+	ClearVertexDecodeCache();
+}
+
+void DrawEngineCommon::ClearVertexDecodeCache() {
+	vertexDecodeCache_.Iterate([](const uint64_t key, CachedDecodedVerts *entry) {
+		delete[] entry->data;
+		delete entry;
+	});
+	vertexDecodeCache_.Clear();
+	vertexDecodeCacheBytes_ = 0;
 }
 
 u32 DrawEngineCommon::NormalizeVertices(u8 *outPtr, u8 *bufPtr, const u8 *inPtr, int lowerBound, int upperBound, u32 vertType, int *vertexSize) {
@@ -565,6 +589,112 @@ bool DrawEngineCommon::TestBoundingBoxFast(const void *vdata, int vertexCount, u
 	return true;
 }
 
+// Clamps curve tessellation to what the patch's projected size can actually show.
+// Games tend to pick one division factor and use it for every patch, so distant
+// terrain gets tessellated just as densely as the patch right in front of the
+// camera. We project the bounding box of the control hull (which always encloses
+// the curve) and limit the division factors so quads stay around a few rendered
+// pixels - only ever reducing what the game asked for, never adding density.
+void DrawEngineCommon::ReduceCurveTessToScreenSize(const void *control_points, u32 vertType, int num_points, int num_patches_u, int num_patches_v, int *tess_u, int *tess_v) {
+	// Nothing left to cut.
+	if (*tess_u <= 2 && *tess_v <= 2)
+		return;
+	if (gstate.isModeThrough())
+		return;
+	// Viewports are more complex on VR, see TestBoundingBox.
+	if (gstate_c.Use(GPU_USE_VIRTUAL_REALITY))
+		return;
+	// Indexed, skinned or morphed control points would need a full decode first - the
+	// common curve cases are none of those, so just leave them at full density.
+	if ((vertType & (GE_VTYPE_IDX_MASK | GE_VTYPE_WEIGHT_MASK | GE_VTYPE_MORPHCOUNT_MASK)) != 0)
+		return;
+
+	VertexDecoder *dec = GetVertexDecoder(vertType);
+	const int stride = dec->VertexSize();
+	const int offset = dec->posoff;
+
+	// Object-space bounds of the control hull.
+	Vec3f bmin = Vec3f(INFINITY, INFINITY, INFINITY);
+	Vec3f bmax = -bmin;
+	for (int i = 0; i < num_points; i++) {
+		float pos[3];
+		switch (vertType & GE_VTYPE_POS_MASK) {
+		case GE_VTYPE_POS_8BIT:
+		{
+			const s8 *data = (const s8 *)control_points + i * stride + offset;
+			for (int j = 0; j < 3; j++)
+				pos[j] = data[j] * (1.0f / 128.0f);
+			break;
+		}
+		case GE_VTYPE_POS_16BIT:
+		{
+			const s16 *data = (const s16 *)((const s8 *)control_points + i * stride + offset);
+			for (int j = 0; j < 3; j++)
+				pos[j] = data[j] * (1.0f / 32768.0f);
+			break;
+		}
+		case GE_VTYPE_POS_FLOAT:
+			memcpy(pos, (const u8 *)control_points + i * stride + offset, sizeof(float) * 3);
+			break;
+		}
+		for (int j = 0; j < 3; j++) {
+			bmin[j] = std::min(bmin[j], pos[j]);
+			bmax[j] = std::max(bmax[j], pos[j]);
+		}
+	}
+
+	float world[16];
+	float view[16];
+	float worldview[16];
+	float worldviewproj[16];
+	ConvertMatrix4x3To4x4(world, gstate.worldMatrix);
+	ConvertMatrix4x3To4x4(view, gstate.viewMatrix);
+	Matrix4ByMatrix4(worldview, world, view);
+	Matrix4ByMatrix4(worldviewproj, worldview, gstate.projMatrix);
+
+	// Project the corners of the bounding box. If any end up on or behind the near
+	// plane, the screen extent is unbounded - leave the patch at full density.
+	float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+	for (int i = 0; i < 8; i++) {
+		const float corner[3] = {
+			(i & 1) ? bmax.x : bmin.x,
+			(i & 2) ? bmax.y : bmin.y,
+			(i & 4) ? bmax.z : bmin.z,
+		};
+		float proj[4];
+		Vec3ByMatrix44(proj, corner, worldviewproj);
+		if (proj[3] <= 0.0f)
+			return;
+		const float invW = 1.0f / proj[3];
+		const float x = proj[0] * invW;
+		const float y = proj[1] * invW;
+		minX = std::min(minX, x);
+		maxX = std::max(maxX, x);
+		minY = std::min(minY, y);
+		maxY = std::max(maxY, y);
+	}
+
+	// NDC extent -> rendered pixels, accounting for render resolution scaling.
+	float renderScale = 1.0f;
+	if (gstate_c.curRTWidth > 0)
+		renderScale = (float)gstate_c.curRTRenderWidth / (float)gstate_c.curRTWidth;
+	const float pixelsX = (maxX - minX) * fabsf(gstate.getViewportXScale()) * renderScale;
+	const float pixelsY = (maxY - minY) * fabsf(gstate.getViewportYScale()) * renderScale;
+	// The hull can be oriented any way on screen, so use the larger extent for both
+	// directions rather than trying to match U/V to a screen axis.
+	const float pixels = std::max(pixelsX, pixelsY);
+
+	// Aim for quads no smaller than about 4 rendered pixels. The hull bound
+	// overestimates the curve's actual extent, so this errs towards extra density.
+	const float pixelsPerQuad = 4.0f;
+	const int limit_u = std::max(2, (int)ceilf(pixels / ((float)num_patches_u * pixelsPerQuad)));
+	const int limit_v = std::max(2, (int)ceilf(pixels / ((float)num_patches_v * pixelsPerQuad)));
+	if (*tess_u > limit_u)
+		*tess_u = limit_u;
+	if (*tess_v > limit_v)
+		*tess_v = limit_v;
+}
+
 // TODO: This probably is not the best interface.
 bool DrawEngineCommon::GetCurrentSimpleVertices(int count, std::vector<GPUDebugVertex> &vertices, std::vector<u16> &indices) {
 	// This is always for the current vertices.
@@ -972,10 +1102,20 @@ bool DrawEngineCommon::SubmitPrim(const void *verts, const void *inds, GEPrimiti
 	return true;
 }
 
+// Draws smaller than this decode fast enough that hashing them is a wash.
+static constexpr int VERTEX_DECODE_CACHE_MIN_VERTS = 64;
+static constexpr size_t VERTEX_DECODE_CACHE_MAX_BYTES = 48 * 1024 * 1024;
+
 void DrawEngineCommon::DecodeVerts(u8 *dest) {
+	// Same convention as msProcessingDisplayLists: only timed while debug stats are collected.
+	double start = coreCollectDebugStats ? time_now_d() : 0.0;
+
 	// Note that this should be able to continue a partial decode - we don't necessarily start from zero here (although we do most of the time).
 	int i = decodeVertsCounter_;
 	int stride = (int)dec_->GetDecVtxFmt().stride;
+	// Bone/morph influenced draws depend on too much state to be worth keying on.
+	const bool cacheEligible = cacheDecodedVerts_ &&
+		(lastVType_ & (GE_VTYPE_WEIGHT_MASK | GE_VTYPE_MORPHCOUNT_MASK)) == 0;
 	for (; i < numDrawVerts_; i++) {
 		DeferredVerts &dv = drawVerts_[i];
 
@@ -989,11 +1129,43 @@ void DrawEngineCommon::DecodeVerts(u8 *dest) {
 			break;
 		}
 
-		// Decode the verts (and at the same time apply morphing/skinning). Simple.
-		dec_->DecodeVerts(dest + numDecodedVerts_ * stride, dv.verts, &dv.uvScale, indexLowerBound, indexUpperBound);
-		numDecodedVerts_ += indexUpperBound - indexLowerBound + 1;
+		const int numVerts = indexUpperBound - indexLowerBound + 1;
+		u8 *out = dest + numDecodedVerts_ * stride;
+		if (cacheEligible && numVerts >= VERTEX_DECODE_CACHE_MIN_VERTS) {
+			// Hashing the source is far cheaper than decoding it, so for big draws this
+			// turns repeat submissions of static meshes into a memcpy.
+			const u8 *src = (const u8 *)dv.verts + indexLowerBound * dec_->VertexSize();
+			const size_t srcSize = (size_t)numVerts * dec_->VertexSize();
+			const u64 seed = XXH3_64bits(&dv.uvScale, sizeof(dv.uvScale)) ^ lastVType_;
+			const u64 hash = XXH3_64bits_withSeed(src, srcSize, seed);
+			const u32 dstSize = (u32)(numVerts * stride);
+			CachedDecodedVerts *cached = nullptr;
+			if (vertexDecodeCache_.Get(hash, &cached) && cached->size == dstSize) {
+				memcpy(out, cached->data, dstSize);
+			} else if (!cached) {
+				dec_->DecodeVerts(out, dv.verts, &dv.uvScale, indexLowerBound, indexUpperBound);
+				if (vertexDecodeCacheBytes_ > VERTEX_DECODE_CACHE_MAX_BYTES) {
+					// Nothing points into the cache (hits are copied out), safe to dump.
+					ClearVertexDecodeCache();
+				}
+				CachedDecodedVerts *entry = new CachedDecodedVerts{ new u8[dstSize], dstSize };
+				memcpy(entry->data, out, dstSize);
+				vertexDecodeCache_.Insert(hash, entry);
+				vertexDecodeCacheBytes_ += dstSize;
+			} else {
+				// Size mismatch on an existing entry - treat as a collision, don't cache.
+				dec_->DecodeVerts(out, dv.verts, &dv.uvScale, indexLowerBound, indexUpperBound);
+			}
+		} else {
+			// Decode the verts (and at the same time apply morphing/skinning). Simple.
+			dec_->DecodeVerts(out, dv.verts, &dv.uvScale, indexLowerBound, indexUpperBound);
+		}
+		numDecodedVerts_ += numVerts;
 	}
 	decodeVertsCounter_ = i;
+
+	if (coreCollectDebugStats)
+		gpuStats.msVertexDecode += time_now_d() - start;
 }
 
 int DrawEngineCommon::DecodeInds() {
@@ -1027,6 +1199,40 @@ int DrawEngineCommon::DecodeInds() {
 	return indexGen.VertexCount();
 }
 
+// Collapses identical vertices in decoded_ and rewrites the indices to match, returning the
+// new vertex count. Helps the GPU's post-transform cache with games that submit heavy geometry
+// as plain triangle lists full of repeated vertices. Opt-in via the DedupIndexedVertices
+// compat flag since the hashing costs CPU time on every flush.
+int DrawEngineCommon::DedupDecodedVertices(int numVerts, u16 *inds, int indexCount) {
+	const int stride = (int)dec_->GetDecVtxFmt().stride;
+	dedupMap_.Clear();
+	int numOut = 0;
+	for (int i = 0; i < numVerts; i++) {
+		const u8 *vert = decoded_ + i * stride;
+		const uint64_t hash = XXH3_64bits(vert, stride);
+		uint32_t existing;
+		if (dedupMap_.Get(hash, &existing)) {
+			// We don't verify the actual bytes - a 64-bit hash collision between vertices
+			// within a single flush is not a realistic concern.
+			dedupRemap_[i] = (u16)existing;
+			continue;
+		}
+		dedupMap_.Insert(hash, (uint32_t)numOut);
+		if (numOut != i) {
+			memcpy(decoded_ + numOut * stride, vert, stride);
+		}
+		dedupRemap_[i] = (u16)numOut;
+		numOut++;
+	}
+	if (numOut != numVerts) {
+		for (int i = 0; i < indexCount; i++) {
+			inds[i] = dedupRemap_[inds[i]];
+		}
+		gpuStats.numVertsDeduped += numVerts - numOut;
+	}
+	return numOut;
+}
+
 bool DrawEngineCommon::CanUseHardwareTransform(int prim) const {
 	if (!useHWTransform_)
 		return false;
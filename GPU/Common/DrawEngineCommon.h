@@ -108,6 +108,10 @@ public:
 	// Doesn't support indexing.
 	bool TestBoundingBoxFast(const void *control_points, int vertexCount, u32 vertType);
 
+	// Reduces curve division factors to match the projected size of the control hull.
+	// Only ever lowers tess_u/tess_v, never raises them.
+	void ReduceCurveTessToScreenSize(const void *control_points, u32 vertType, int num_points, int num_patches_u, int num_patches_v, int *tess_u, int *tess_v);
+
 	void FlushSkin() {
 		bool applySkin = (lastVType_ & GE_VTYPE_WEIGHT_MASK) && decOptions_.applySkinInDecode;
 		if (applySkin) {
@@ -157,6 +161,8 @@ protected:
 
 	void DecodeVerts(u8 *dest);
 	int DecodeInds();
+	int DedupDecodedVertices(int numVerts, u16 *inds, int indexCount);
+	void ClearTessCache();
 
 	// Preprocessing for spline/bezier
 	u32 NormalizeVertices(u8 *outPtr, u8 *bufPtr, const u8 *inPtr, int lowerBound, int upperBound, u32 vertType, int *vertexSize = nullptr);
@@ -246,6 +252,13 @@ protected:
 		}
 	}
 
+	// Worst-case size in bytes that DecodeInds() can write, for decoding indices directly into
+	// GPU-visible memory. The per-draw slack covers the overshoot of the vectorized strip
+	// expansion, which rounds its writes up to whole chunks of triangles.
+	inline u32 ComputeDecodedIndexBound() const {
+		return (u32)(vertexCountInDrawCalls_ * 3 + numDrawInds_ * 24) * sizeof(u16);
+	}
+
 	inline int RemainingIndices(const uint16_t *inds) const {
 		return DECODED_INDEX_BUFFER_SIZE / sizeof(uint16_t) - (inds - decIndex_);
 	}
@@ -263,6 +276,37 @@ protected:
 	u8 *decoded_ = nullptr;
 	u16 *decIndex_ = nullptr;
 
+	// Optional vertex dedup pass (DedupIndexedVertices compat flag), see DedupDecodedVertices.
+	bool dedupVertices_ = false;
+	u16 *dedupRemap_ = nullptr;
+	DenseHashMap<uint64_t, uint32_t> dedupMap_;
+
+	// Cache of CPU-tessellated patches, keyed on a hash of the control points and tessellation
+	// state. Static curved geometry like terrain gets resubmitted identically every frame, so
+	// re-tessellating it is wasted work. Implementation lives in SplineCommon.cpp.
+	struct CachedTessellation {
+		SimpleVertex *vertices;
+		u16 *indices;
+		int vertexCount;
+		int indexCount;
+		u32 vertType;  // post-normalization vertex type of the cached output
+	};
+	DenseHashMap<uint64_t, CachedTessellation *> tessCache_;
+	size_t tessCacheBytes_ = 0;
+
+	// Opt-in decoded-vertex cache (the CacheDecodedVertices perf hint), for titles that
+	// resubmit large static meshes identically every frame. Keyed on a hash of the raw
+	// PSP vertex bytes plus the decode state, so changed source data simply stops
+	// hitting - the hash check takes the place of dirty-page invalidation.
+	struct CachedDecodedVerts {
+		u8 *data;
+		u32 size;
+	};
+	void ClearVertexDecodeCache();
+	bool cacheDecodedVerts_ = false;
+	DenseHashMap<uint64_t, CachedDecodedVerts *> vertexDecodeCache_;
+	size_t vertexDecodeCacheBytes_ = 0;
+
 	// Cached vertex decoders
 	DenseHashMap<u32, VertexDecoder *> decoderMap_;
 	VertexDecoderJitCache *decJitCache_ = nullptr;
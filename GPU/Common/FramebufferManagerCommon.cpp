@@ -57,6 +57,8 @@ static size_t FormatFramebufferName(const VirtualFramebuffer *vfb, char *tag, si
 FramebufferManagerCommon::FramebufferManagerCommon(Draw::DrawContext *draw)
 	: draw_(draw), draw2D_(draw_) {
 	presentation_ = new PresentationCommon(draw);
+	compatFlags_ = &PSP_CoreParameter().compat.flags();
+	preferDelayedReadbacks_ = compatFlags_->AllowDelayedReadbacks || PSP_CoreParameter().compat.hints().ReadbackLatencyFrames > 0;
 }
 
 FramebufferManagerCommon::~FramebufferManagerCommon() {
@@ -94,9 +96,9 @@ bool FramebufferManagerCommon::UpdateRenderSize(int msaaLevel) {
 	const bool newRender = renderWidth_ != (float)PSP_CoreParameter().renderWidth || renderHeight_ != (float)PSP_CoreParameter().renderHeight || msaaLevel_ != msaaLevel;
 
 	int effectiveBloomHack = g_Config.iBloomHack;
-	if (PSP_CoreParameter().compat.flags().ForceLowerResolutionForEffectsOn) {
+	if (compatFlags_->ForceLowerResolutionForEffectsOn) {
 		effectiveBloomHack = 3;
-	} else if (PSP_CoreParameter().compat.flags().ForceLowerResolutionForEffectsOff) {
+	} else if (compatFlags_->ForceLowerResolutionForEffectsOff) {
 		effectiveBloomHack = 0;
 	}
 
@@ -131,6 +133,13 @@ void FramebufferManagerCommon::BeginFrame() {
 	DecimateFBOs();
 	presentation_->BeginFrame();
 	currentRenderVfb_ = nullptr;
+
+	// Delayed readbacks have landed once the GPU finishes the frame they were issued
+	// in, so anything a few flips old no longer needs sync protection.
+	if (!pendingReadbacks_.empty()) {
+		pendingReadbacks_.erase(std::remove_if(pendingReadbacks_.begin(), pendingReadbacks_.end(),
+			[](const PendingReadback &p) { return gpuStats.numFlips - p.issueFrame >= 3; }), pendingReadbacks_.end());
+	}
 }
 
 bool FramebufferManagerCommon::PresentedThisFrame() const {
@@ -400,7 +409,7 @@ VirtualFramebuffer *FramebufferManagerCommon::DoSetRenderFrameBuffer(Framebuffer
 	}
 
 	// Compatibility hack for Killzone, see issue #6207.
-	if (PSP_CoreParameter().compat.flags().SplitFramebufferMargin && params.fb_format == GE_FORMAT_8888) {
+	if (compatFlags_->SplitFramebufferMargin && params.fb_format == GE_FORMAT_8888) {
 		ApplyKillzoneFramebufferSplit(&params, &drawing_width);
 	} else {
 		gstate_c.SetCurRTOffset(0, 0);
@@ -418,7 +427,7 @@ VirtualFramebuffer *FramebufferManagerCommon::DoSetRenderFrameBuffer(Framebuffer
 			if (!normal_vfb) {
 				normal_vfb = v;
 			}
-		} else if (!PSP_CoreParameter().compat.flags().DisallowFramebufferAtOffset && !PSP_CoreParameter().compat.flags().SplitFramebufferMargin &&
+		} else if (!compatFlags_->DisallowFramebufferAtOffset && !compatFlags_->SplitFramebufferMargin &&
 			v->fb_stride == params.fb_stride && v->fb_format == params.fb_format) {
 			u32 v_fb_first_line_end_ptr = v->fb_address + v->fb_stride * bpp;
 			u32 v_fb_end_ptr = v->fb_address + v->fb_stride * v->height * bpp;
@@ -435,7 +444,7 @@ VirtualFramebuffer *FramebufferManagerCommon::DoSetRenderFrameBuffer(Framebuffer
 					drawing_width += x_offset;
 					break;
 				}
-			} else if (PSP_CoreParameter().compat.flags().FramebufferAllowLargeVerticalOffset &&
+			} else if (compatFlags_->FramebufferAllowLargeVerticalOffset &&
 				params.fb_address > v->fb_address && v->fb_stride > 0 && (params.fb_address - v->fb_address) % v->FbStrideInBytes() == 0 &&
 				params.fb_address != 0x04088000 && v->fb_address != 0x04000000) {  // Heuristic to avoid merging the main framebuffers.
 				y_offset = (params.fb_address - v->fb_address) / v->FbStrideInBytes();
@@ -516,7 +525,7 @@ VirtualFramebuffer *FramebufferManagerCommon::DoSetRenderFrameBuffer(Framebuffer
 
 		if (!resized && renderScaleFactor_ != 1 && vfb->renderScaleFactor == 1) {
 			// Might be time to change this framebuffer - have we used depth?
-			if ((vfb->usageFlags & FB_USAGE_COLOR_MIXED_DEPTH) && !PSP_CoreParameter().compat.flags().ForceLowerResolutionForEffectsOn) {
+			if ((vfb->usageFlags & FB_USAGE_COLOR_MIXED_DEPTH) && !compatFlags_->ForceLowerResolutionForEffectsOn) {
 				ResizeFramebufFBO(vfb, vfb->width, vfb->height, true);
 				_assert_(vfb->renderScaleFactor != 1);
 			}
@@ -573,12 +582,17 @@ VirtualFramebuffer *FramebufferManagerCommon::DoSetRenderFrameBuffer(Framebuffer
 			// TODO: Is it worth trying to upload the depth buffer (only if it wasn't copied above..?)
 		}
 
-		DiscardFramebufferCopy();
+		UpdateUnsampledTargetSkip(vfb, true);
+
+		// Keep the self-texturing copy if the buffer it was made from is untouched - we may
+		// come right back to it. If it's been written to, the copy is stale.
+		DiscardFramebufferCopyIfStale();
 
 		// We already have it!
 	} else if (vfb != currentRenderVfb_) {
 		// Use it as a render target.
 		DEBUG_LOG(Log::FrameBuf, "Switching render target to FBO for %08x: %d x %d x %d ", vfb->fb_address, vfb->width, vfb->height, vfb->fb_format);
+		UpdateUnsampledTargetSkip(vfb, false);
 		vfb->usageFlags |= FB_USAGE_RENDER_COLOR;
 		vfb->last_frame_render = gpuStats.numFlips;
 		frameLastFramebufUsed_ = gpuStats.numFlips;
@@ -592,10 +606,11 @@ VirtualFramebuffer *FramebufferManagerCommon::DoSetRenderFrameBuffer(Framebuffer
 		CopyToColorFromOverlappingFramebuffers(vfb);
 		gstate_c.usingDepth = false;  // reset depth buffer tracking
 
-		DiscardFramebufferCopy();
+		DiscardFramebufferCopyIfStale();
 	} else {
 		// Something changed, but we still got the same framebuffer we were already rendering to.
 		// Might not be a lot to do here, we check in NotifyRenderFramebufferUpdated
+		UpdateUnsampledTargetSkip(vfb, false);
 		vfb->last_frame_render = gpuStats.numFlips;
 		frameLastFramebufUsed_ = gpuStats.numFlips;
 		vfb->dirtyAfterDisplay = true;
@@ -729,7 +744,7 @@ void FramebufferManagerCommon::CopyToDepthFromOverlappingFramebuffers(VirtualFra
 			// Really hate to do this, but tracking the depth swizzle state across multiple
 			// copies is not easy.
 			Draw2DShader shader = DRAW2D_565_TO_DEPTH;
-			if (PSP_CoreParameter().compat.flags().DeswizzleDepth) {
+			if (compatFlags_->DeswizzleDepth) {
 				shader = DRAW2D_565_TO_DEPTH_DESWIZZLE;
 			}
 
@@ -822,7 +837,7 @@ void FramebufferManagerCommon::CopyToColorFromOverlappingFramebuffers(VirtualFra
 
 			// TODO: Get rid of the compatibility flag check.
 			if ((dstColorStart - srcColorStart) % strideInBytes == 0
-				&& PSP_CoreParameter().compat.flags().AllowLargeFBTextureOffsets) {
+				&& compatFlags_->AllowLargeFBTextureOffsets) {
 				// Buffers are aligned.
 				yOffset = ((int)dstColorStart - (int)srcColorStart) / strideInBytes;
 				if (yOffset <= -(int)src->height) {
@@ -886,7 +901,7 @@ void FramebufferManagerCommon::CopyToColorFromOverlappingFramebuffers(VirtualFra
 				pipeline = Get2DPipeline(DRAW2D_COPY_COLOR);
 				pass_name = "copy_color";
 			} else {
-				if (PSP_CoreParameter().compat.flags().BlueToAlpha) {
+				if (compatFlags_->BlueToAlpha) {
 					WARN_LOG_ONCE(bta, Log::FrameBuf, "WARNING: Reinterpret encountered with BlueToAlpha on");
 				}
 
@@ -1028,6 +1043,37 @@ void FramebufferManagerCommon::BlitFramebufferDepth(VirtualFramebuffer *src, Vir
 	draw_->Invalidate(InvalidationFlags::CACHED_RENDER_STATE);
 }
 
+// Heuristic for the SkipUnsampledRenderTargets compat flag: a target that keeps getting rendered
+// without ever being displayed, textured from, read back or used as a CLUT is most likely a
+// shadow/reflection buffer that nothing looks at right now - don't spend GPU time on it.
+// Re-evaluated on the first render pass to the target each frame, so a target that starts
+// getting sampled again recovers after showing at most one stale frame.
+void FramebufferManagerCommon::UpdateUnsampledTargetSkip(VirtualFramebuffer *vfb, bool isNewTarget) {
+	if (!compatFlags_->SkipUnsampledRenderTargets || !useBufferedRendering_) {
+		gstate_c.skipDrawReason &= ~SKIPDRAW_UNSAMPLED_FB;
+		return;
+	}
+
+	if (isNewTarget) {
+		vfb->unsampledRenders = 0;
+	} else if (vfb->last_frame_render < gpuStats.numFlips) {
+		// First render pass to this target this frame - did anything consume it since the last one?
+		int lastSampled = std::max(std::max(vfb->last_frame_used, vfb->last_frame_displayed), vfb->last_frame_clut);
+		if (lastSampled >= vfb->last_frame_render || (vfb->usageFlags & FB_USAGE_DISPLAYED_FRAMEBUFFER)) {
+			vfb->unsampledRenders = 0;
+		} else {
+			vfb->unsampledRenders++;
+		}
+	}
+
+	// A few frames of grace, so targets that are sampled with a frame or two of latency don't flicker.
+	if (vfb->unsampledRenders >= 3) {
+		gstate_c.skipDrawReason |= SKIPDRAW_UNSAMPLED_FB;
+	} else {
+		gstate_c.skipDrawReason &= ~SKIPDRAW_UNSAMPLED_FB;
+	}
+}
+
 void FramebufferManagerCommon::NotifyRenderFramebufferCreated(VirtualFramebuffer *vfb) {
 	if (!useBufferedRendering_) {
 		// Let's ignore rendering to targets that have not (yet) been displayed.
@@ -1058,7 +1104,7 @@ void FramebufferManagerCommon::DownloadFramebufferOnSwitch(VirtualFramebuffer *v
 		// Saving each frame would be slow.
 
 		// TODO: This type of download could be made async, for less stutter on framebuffer creation.
-		if (GetSkipGPUReadbackMode() == SkipGPUReadbackMode::NO_SKIP && !PSP_CoreParameter().compat.flags().DisableFirstFrameReadback) {
+		if (GetSkipGPUReadbackMode() == SkipGPUReadbackMode::NO_SKIP && !compatFlags_->DisableFirstFrameReadback) {
 			ReadFramebufferToMemory(vfb, 0, 0, vfb->safeWidth, vfb->safeHeight, RASTER_COLOR, Draw::ReadbackMode::BLOCK);
 			vfb->usageFlags = (vfb->usageFlags | FB_USAGE_DOWNLOAD | FB_USAGE_FIRST_FRAME_SAVED) & ~FB_USAGE_DOWNLOAD_CLEAR;
 			vfb->safeWidth = 0;
@@ -1090,7 +1136,19 @@ void FramebufferManagerCommon::NotifyRenderFramebufferSwitched(VirtualFramebuffe
 		}
 
 		if (ShouldDownloadFramebufferDepth(prevVfb)) {
-			ReadFramebufferToMemory(prevVfb, 0, 0, prevVfb->width, prevVfb->height, RasterChannel::RASTER_DEPTH, Draw::ReadbackMode::BLOCK);
+			// Full depth downloads cost multiple ms on mobile, and most depth-reading games only
+			// sample a small area. If we've seen which tiles the CPU actually reads (through the
+			// paths we can observe - see NotifyDepthbufferRead), only download those.
+			int x = 0, y = 0, w = prevVfb->width, h = prevVfb->height;
+			if (prevVfb->depthReadX1 != 0) {
+				x = std::min<int>(prevVfb->depthReadX0, prevVfb->width);
+				y = std::min<int>(prevVfb->depthReadY0, prevVfb->height);
+				w = std::min<int>(prevVfb->depthReadX1 + 1, prevVfb->width) - x;
+				h = std::min<int>(prevVfb->depthReadY1 + 1, prevVfb->height) - y;
+			}
+			if (w > 0 && h > 0) {
+				ReadFramebufferToMemory(prevVfb, x, y, w, h, RasterChannel::RASTER_DEPTH, Draw::ReadbackMode::BLOCK);
+			}
 		}
 	}
 
@@ -1207,7 +1265,7 @@ void FramebufferManagerCommon::DrawPixels(VirtualFramebuffer *vfb, int dstX, int
 
 	DrawTextureFlags flags;
 	if (useBufferedRendering_ && vfb && vfb->fbo) {
-		if (channel == RASTER_DEPTH || PSP_CoreParameter().compat.flags().NearestFilteringOnFramebufferCreate) {
+		if (channel == RASTER_DEPTH || compatFlags_->NearestFilteringOnFramebufferCreate) {
 			flags = DRAWTEX_NEAREST;
 		} else {
 			flags = DRAWTEX_LINEAR;
@@ -1269,9 +1327,10 @@ bool FramebufferManagerCommon::BindFramebufferAsColorTexture(int stage, VirtualF
 		// Self-texturing, need a copy currently (some backends can potentially support it though).
 		WARN_LOG_ONCE(selfTextureCopy, Log::G3D, "Attempting to texture from current render target (src=%08x / target=%08x / flags=%d), making a copy", framebuffer->fb_address, currentRenderVfb_->fb_address, flags);
 		// TODO: Maybe merge with bvfbs_?  Not sure if those could be packing, and they're created at a different size.
-		if (currentFramebufferCopy_ && (flags & BINDFBCOLOR_UNCACHED) == 0) {
+		if (currentFramebufferCopy_ && currentFramebufferCopySrc_ == framebuffer && (flags & BINDFBCOLOR_UNCACHED) == 0) {
 			// We have a copy already that hasn't been invalidated, let's keep using it.
 			draw_->BindFramebufferAsTexture(currentFramebufferCopy_, stage, Draw::FB_COLOR_BIT, layer);
+			gpuStats.numElidedSelfTexCopies++;
 			return true;
 		}
 
@@ -1289,6 +1348,8 @@ bool FramebufferManagerCommon::BindFramebufferAsColorTexture(int stage, VirtualF
 			// TODO: Improve on this.
 			if (!partial && (flags & BINDFBCOLOR_UNCACHED) == 0) {
 				currentFramebufferCopy_ = renderCopy;
+				currentFramebufferCopySrc_ = framebuffer;
+				currentFramebufferCopySeq_ = framebuffer->colorWriteSeq;
 			}
 			gpuStats.numCopiesForSelfTex++;
 		} else {
@@ -1829,10 +1890,10 @@ void FramebufferManagerCommon::ResizeFramebufFBO(VirtualFramebuffer *vfb, int w,
 		break;
 	}
 
-	if ((vfb->usageFlags & FB_USAGE_COLOR_MIXED_DEPTH) && !PSP_CoreParameter().compat.flags().ForceLowerResolutionForEffectsOn) {
+	if ((vfb->usageFlags & FB_USAGE_COLOR_MIXED_DEPTH) && !compatFlags_->ForceLowerResolutionForEffectsOn) {
 		force1x = false;
 	}
-	if (PSP_CoreParameter().compat.flags().Force04154000Download && vfb->fb_address == 0x04154000) {
+	if (compatFlags_->Force04154000Download && vfb->fb_address == 0x04154000) {
 		force1x = true;
 	}
 
@@ -2148,7 +2209,7 @@ bool FramebufferManagerCommon::NotifyFramebufferCopy(u32 src, u32 dst, int size,
 	if (!dstBuffer && srcBuffer && channel != RASTER_DEPTH) {
 		// Note - if we're here, we're in a memcpy, not a block transfer. Not allowing IntraVRAMBlockTransferAllowCreateFB.
 		// Technically, that makes BlockTransferAllowCreateFB a bit of a misnomer.
-		bool allowCreateFB = (PSP_CoreParameter().compat.flags().BlockTransferAllowCreateFB || GetSkipGPUReadbackMode() == SkipGPUReadbackMode::COPY_TO_TEXTURE);
+		bool allowCreateFB = (compatFlags_->BlockTransferAllowCreateFB || GetSkipGPUReadbackMode() == SkipGPUReadbackMode::COPY_TO_TEXTURE);
 		if (allowCreateFB && !(flags & GPUCopyFlag::DISALLOW_CREATE_VFB)) {
 			dstBuffer = CreateRAMFramebuffer(dst, srcBuffer->width, srcBuffer->height, srcBuffer->fb_stride, srcBuffer->fb_format);
 			dstY = 0;
@@ -2200,7 +2261,7 @@ bool FramebufferManagerCommon::NotifyFramebufferCopy(u32 src, u32 dst, int size,
 			WARN_LOG_ONCE(btdcpyheight, Log::FrameBuf, "Memcpy fbo download %08x -> %08x skipped, %d+%d is taller than %d", src, dst, srcY, srcH, srcBuffer->bufferHeight);
 		} else if (GetSkipGPUReadbackMode() == SkipGPUReadbackMode::NO_SKIP && (!srcBuffer->memoryUpdated || channel == RASTER_DEPTH)) {
 			Draw::ReadbackMode readbackMode = Draw::ReadbackMode::BLOCK;
-			if (PSP_CoreParameter().compat.flags().AllowDelayedReadbacks) {
+			if (preferDelayedReadbacks_) {
 				readbackMode = Draw::ReadbackMode::OLD_DATA_OK;
 			}
 			ReadFramebufferToMemory(srcBuffer, 0, srcY, srcBuffer->width, srcH, channel, readbackMode);
@@ -2249,7 +2310,7 @@ bool FramebufferManagerCommon::FindTransferFramebuffer(u32 basePtr, int stride_p
 		// Two cases so far of games depending on depth copies: Iron Man in issue #16530 (buffer->buffer)
 		// and also #17878 where a game does ram->buffer to an auto-swizzling (|0x600000) address,
 		// to initialize Z with a pre-rendered depth buffer.
-		if (vfb->z_address == basePtr && vfb->BufferByteStride(RASTER_DEPTH) == byteStride && PSP_CoreParameter().compat.flags().BlockTransferDepth) {
+		if (vfb->z_address == basePtr && vfb->BufferByteStride(RASTER_DEPTH) == byteStride && compatFlags_->BlockTransferDepth) {
 			WARN_LOG_N_TIMES(z_xfer, 5, Log::FrameBuf, "FindTransferFramebuffer: found matching depth buffer, %08x (dest=%d, bpp=%d)", basePtr, (int)destination, bpp);
 			candidate.channel = RASTER_DEPTH;
 			candidate.x_bytes = x_pixels * bpp;
@@ -2611,9 +2672,9 @@ bool FramebufferManagerCommon::NotifyBlockTransferBefore(u32 dstBasePtr, int dst
 
 	if (srcBuffer && !dstBuffer) {
 		// In here, we can't read from dstRect.
-		if (PSP_CoreParameter().compat.flags().BlockTransferAllowCreateFB ||
+		if (compatFlags_->BlockTransferAllowCreateFB ||
 			GetSkipGPUReadbackMode() == SkipGPUReadbackMode::COPY_TO_TEXTURE ||
-			(PSP_CoreParameter().compat.flags().IntraVRAMBlockTransferAllowCreateFB &&
+			(compatFlags_->IntraVRAMBlockTransferAllowCreateFB &&
 				Memory::IsVRAMAddress(srcRect.vfb->fb_address) && Memory::IsVRAMAddress(dstBasePtr))) {
 			GEBufferFormat ramFormat;
 			// Try to guess the appropriate format. We only know the bpp from the block transfer command (16 or 32 bit).
@@ -2731,7 +2792,7 @@ bool FramebufferManagerCommon::NotifyBlockTransferBefore(u32 dstBasePtr, int dst
 		// NotifyBlockTransferAfter will take care of the rest.
 		return false;
 	} else if (srcBuffer) {
-		if (width == 48 && height == 48 && srcY == 224 && srcX == 432 && PSP_CoreParameter().compat.flags().TacticsOgreEliminateDebugReadback) {
+		if (width == 48 && height == 48 && srcY == 224 && srcX == 432 && compatFlags_->TacticsOgreEliminateDebugReadback) {
 			return false;
 		}
 
@@ -2751,7 +2812,7 @@ bool FramebufferManagerCommon::NotifyBlockTransferBefore(u32 dstBasePtr, int dst
 					WARN_LOG_ONCE(btdheight, Log::G3D, "Block transfer download %08x -> %08x dangerous, %d+%d is taller than %d", srcBasePtr, dstBasePtr, srcRect.y, srcRect.h, srcRect.vfb->bufferHeight);
 				}
 				Draw::ReadbackMode readbackMode = Draw::ReadbackMode::BLOCK;
-				if (PSP_CoreParameter().compat.flags().AllowDelayedReadbacks) {
+				if (preferDelayedReadbacks_) {
 					readbackMode = Draw::ReadbackMode::OLD_DATA_OK;
 				}
 				ReadFramebufferToMemory(srcRect.vfb, static_cast<int>(srcX * srcXFactor), srcY, static_cast<int>(srcRect.w_bytes * srcXFactor), srcRect.h, RASTER_COLOR, readbackMode);
@@ -2869,6 +2930,9 @@ void FramebufferManagerCommon::NotifyRenderResized(int msaaLevel) {
 
 void FramebufferManagerCommon::NotifyConfigChanged() {
 	updatePostShaders_ = true;
+	// Re-cache the compat-derived values, in case a different game was loaded.
+	compatFlags_ = &PSP_CoreParameter().compat.flags();
+	preferDelayedReadbacks_ = compatFlags_->AllowDelayedReadbacks || PSP_CoreParameter().compat.hints().ReadbackLatencyFrames > 0;
 }
 
 void FramebufferManagerCommon::DestroyAllFBOs() {
@@ -3002,6 +3066,11 @@ bool FramebufferManagerCommon::GetFramebuffer(u32 fb_address, int fb_stride, GEB
 			tempVfb.renderScaleFactor = maxScaleFactor;
 			BlitFramebuffer(&tempVfb, 0, 0, vfb, 0, 0, vfb->width, vfb->height, 0, RASTER_COLOR, "Blit_GetFramebuffer");
 
+			// The temp FBO pool is shared by size, so we may just have overwritten the cached self-texturing copy.
+			if (tempFBO == currentFramebufferCopy_) {
+				DiscardFramebufferCopy();
+			}
+
 			bound = tempFBO;
 		} else {
 			bound = vfb->fbo;
@@ -3192,6 +3261,108 @@ void FramebufferManagerCommon::ReadbackFramebuffer(VirtualFramebuffer *vfb, int
 		gpuStats.numBlockingReadbacks++;
 	} else {
 		gpuStats.numReadbacks++;
+		// Remember the range so we can force the data through if the CPU reads it
+		// before the delayed copy has landed. See FlushPendingReadbacks.
+		PendingReadback pending{ fb_address + dstByteOffset, (u32)dstSize, vfb->fb_address, x, y, w, h, channel, gpuStats.numFlips };
+		pendingReadbacks_.push_back(pending);
+	}
+}
+
+void FramebufferManagerCommon::FlushPendingReadbacks(u32 addr, u32 size) {
+	if (pendingReadbacks_.empty())
+		return;
+	addr &= 0x3FFFFFFF;
+	if (Memory::IsVRAMAddress(addr))
+		addr &= 0x041FFFFF;
+
+	bool flushed = false;
+	for (auto &pending : pendingReadbacks_) {
+		if (addr + size <= pending.addr || addr >= pending.addr + pending.size)
+			continue;
+		VirtualFramebuffer *vfb = GetVFBAt(pending.fb_address);
+		if (vfb && vfb->fbo) {
+			WARN_LOG_N_TIMES(syncrb, 5, Log::FrameBuf, "Delayed readback of %08x read before it landed, syncing", pending.addr);
+			ReadbackFramebuffer(vfb, pending.x, pending.y, pending.w, pending.h, pending.channel, Draw::ReadbackMode::BLOCK);
+			flushed = true;
+		}
+		pending.size = 0;  // Mark handled.
+	}
+	pendingReadbacks_.erase(std::remove_if(pendingReadbacks_.begin(), pendingReadbacks_.end(),
+		[](const PendingReadback &p) { return p.size == 0; }), pendingReadbacks_.end());
+
+	if (flushed) {
+		draw_->Invalidate(InvalidationFlags::CACHED_RENDER_STATE);
+		textureCache_->ForgetLastTexture();
+		RebindFramebuffer("RebindFramebuffer - FlushPendingReadbacks");
+	}
+}
+
+// Called for CPU reads we can actually observe (sceDmacMemcpy and similar hooked paths - there
+// are no fault hooks on plain loads, so raw pointer reads stay invisible). Records which 64x64
+// tiles of a depth buffer the game reads, so the forced depth downloads for depth-reading games
+// can be narrowed to those tiles. Buffers with no observed reads keep full downloads.
+void FramebufferManagerCommon::NotifyDepthbufferRead(u32 addr, u32 size) {
+	if (!compatFlags_->ReadbackDepth)
+		return;
+	addr &= 0x3FFFFFFF;
+	if (Memory::IsVRAMAddress(addr))
+		addr &= 0x041FFFFF;
+
+	bool flushed = false;
+	for (auto vfb : vfbs_) {
+		if (vfb->z_address == 0 || vfb->z_stride == 0 || !(vfb->usageFlags & FB_USAGE_RENDER_DEPTH))
+			continue;
+		const u32 zAddr = vfb->z_address & 0x041FFFFF;
+		const u32 zSize = (u32)vfb->BufferByteSize(RASTER_DEPTH);
+		if (addr + size <= zAddr || addr >= zAddr + zSize)
+			continue;
+
+		const u32 byteStride = (u32)vfb->ZStrideInBytes();
+		const u32 start = std::max(addr, zAddr) - zAddr;
+		const u32 end = std::min(addr + size, zAddr + zSize) - zAddr;  // Exclusive.
+		int x0 = 0;
+		int x1 = vfb->width - 1;
+		const int y0 = (int)(start / byteStride);
+		const int y1 = (int)((end - 1) / byteStride);
+		if (y0 == y1) {
+			// Within a single row we can narrow horizontally too.
+			x0 = (int)((start % byteStride) / 2);
+			x1 = (int)(((end - 1) % byteStride) / 2);
+		}
+		// Snap outwards to 64x64 tiles.
+		x0 &= ~63;
+		const int ty0 = y0 & ~63;
+		x1 |= 63;
+		const int ty1 = y1 | 63;
+
+		if (vfb->depthReadX1 == 0) {
+			vfb->depthReadX0 = x0;
+			vfb->depthReadY0 = ty0;
+			vfb->depthReadX1 = x1;
+			vfb->depthReadY1 = ty1;
+		} else if (x0 < vfb->depthReadX0 || ty0 < vfb->depthReadY0 || x1 > vfb->depthReadX1 || ty1 > vfb->depthReadY1) {
+			// The game started reading outside the region we've been downloading - sync the
+			// new tiles now so this read doesn't see stale data, and widen for next time.
+			const int sx = std::min<int>(x0, vfb->width);
+			const int sy = std::min<int>(ty0, vfb->height);
+			const int sw = std::min<int>(x1 + 1, vfb->width) - sx;
+			const int sh = std::min<int>(ty1 + 1, vfb->height) - sy;
+			if (sw > 0 && sh > 0 && vfb->fbo) {
+				WARN_LOG_N_TIMES(depthregion, 5, Log::FrameBuf, "Depth read outside downloaded region of %08x, syncing", vfb->z_address);
+				ReadbackFramebuffer(vfb, sx, sy, sw, sh, RASTER_DEPTH, Draw::ReadbackMode::BLOCK);
+				flushed = true;
+			}
+			vfb->depthReadX0 = std::min<u16>(vfb->depthReadX0, x0);
+			vfb->depthReadY0 = std::min<u16>(vfb->depthReadY0, ty0);
+			vfb->depthReadX1 = std::max<u16>(vfb->depthReadX1, x1);
+			vfb->depthReadY1 = std::max<u16>(vfb->depthReadY1, ty1);
+		}
+	}
+
+	if (flushed) {
+		draw_->Invalidate(InvalidationFlags::CACHED_RENDER_STATE);
+		textureCache_->ForgetLastTexture();
+		RebindFramebuffer("RebindFramebuffer - NotifyDepthbufferRead");
 	}
 }
 
@@ -3452,6 +3623,11 @@ void FramebufferManagerCommon::BlitFramebuffer(VirtualFramebuffer *dst, int dstX
 		return;
 	}
 
+	if (channel == RASTER_COLOR) {
+		// The destination's contents change, so any cached copy of it is no longer current.
+		dst->colorWriteSeq++;
+	}
+
 	bool useBlit = channel == RASTER_COLOR ? draw_->GetDeviceCaps().framebufferBlitSupported : false;
 	bool useCopy = channel == RASTER_COLOR ? draw_->GetDeviceCaps().framebufferCopySupported : false;
 	if (dst == currentRenderVfb_ || dst->fbo->MultiSampleLevel() != 0 || src->fbo->MultiSampleLevel() != 0) {
@@ -126,6 +126,15 @@ struct VirtualFramebuffer {
 	// Tracking for downloads-to-CLUT.
 	u16 clutUpdatedBytes;
 
+	// Bounding box (inclusive, in PSP pixels, snapped to 64x64 tiles) of the depth buffer reads
+	// we've observed from the CPU side. Used to narrow forced depth downloads - games that read
+	// depth usually sample a small area. Valid when depthReadX1 != 0 (zero-init means no reads seen).
+	// See FramebufferManagerCommon::NotifyDepthbufferRead.
+	u16 depthReadX0;
+	u16 depthReadY0;
+	u16 depthReadX1;
+	u16 depthReadY1;
+
 	// Means that the whole image has already been read back to memory - used when combining small readbacks (gameUsesSequentialCopies_).
 	bool memoryUpdated;
 
@@ -139,6 +148,11 @@ struct VirtualFramebuffer {
 	int colorBindSeq;
 	int depthBindSeq;
 
+	// Sequence number of the last write to the color contents (draw flush, color blit or upload).
+	// Lets us tell whether a cached copy of this buffer is still current, so repeated self-texturing
+	// copies with an unchanged source can be elided. See BindFramebufferAsColorTexture.
+	int colorWriteSeq;
+
 	// These are mainly used for garbage collection purposes and similar.
 	// Cannot be used to determine new-ness against a similar other buffer, since they are
 	// only at frame granularity.
@@ -151,6 +165,10 @@ struct VirtualFramebuffer {
 	int last_frame_depth_updated;
 	int last_frame_depth_render;
 
+	// Consecutive frames this was rendered to without anything sampling it in between.
+	// Only maintained when the SkipUnsampledRenderTargets compat flag is on, see UpdateUnsampledTargetSkip.
+	int unsampledRenders;
+
 	// Convenience methods
 	inline int WidthInBytes() const { return width * BufferFormatBytesPerPixel(fb_format); }
 	inline int BufferWidthInBytes() const { return bufferWidth * BufferFormatBytesPerPixel(fb_format); }
@@ -281,6 +299,7 @@ struct DrawPixelsEntry {
 
 struct GPUDebugBuffer;
 class DrawEngineCommon;
+struct CompatFlags;
 class PresentationCommon;
 class ShaderManagerCommon;
 class TextureCacheCommon;
@@ -355,6 +374,11 @@ public:
 	bool BindFramebufferAsColorTexture(int stage, VirtualFramebuffer *framebuffer, int flags, int layer);
 	void ReadFramebufferToMemory(VirtualFramebuffer *vfb, int x, int y, int w, int h, RasterChannel channel, Draw::ReadbackMode mode);
 
+	// Completes any delayed readback overlapping [addr, addr + size) with a blocking re-read.
+	// Called when the CPU is about to consume the data, so it can't wait for the copy to land.
+	void FlushPendingReadbacks(u32 addr, u32 size);
+	void NotifyDepthbufferRead(u32 addr, u32 size);
+
 	void DownloadFramebufferForClut(u32 fb_address, u32 loadBytes);
 	bool DrawFramebufferToOutput(const u8 *srcPixels, int srcStride, GEBufferFormat srcPixelFormat);
 
@@ -484,6 +508,15 @@ public:
 
 	void DiscardFramebufferCopy() {
 		currentFramebufferCopy_ = nullptr;
+		currentFramebufferCopySrc_ = nullptr;
+	}
+
+	// Like DiscardFramebufferCopy, but keeps the copy if the source buffer hasn't been written to
+	// since it was made - in that case a new copy would just repeat the same blit.
+	void DiscardFramebufferCopyIfStale() {
+		if (currentFramebufferCopySrc_ && currentFramebufferCopySrc_->colorWriteSeq != currentFramebufferCopySeq_) {
+			DiscardFramebufferCopy();
+		}
 	}
 
 	bool PresentedThisFrame() const;
@@ -512,6 +545,8 @@ protected:
 
 	void EstimateDrawingSize(u32 fb_address, int fb_stride, GEBufferFormat fb_format, int viewport_width, int viewport_height, int region_width, int region_height, int scissor_width, int scissor_height, int &drawing_width, int &drawing_height);
 
+	void UpdateUnsampledTargetSkip(VirtualFramebuffer *vfb, bool isNewTarget);
+
 	void NotifyRenderFramebufferCreated(VirtualFramebuffer *vfb);
 	static void NotifyRenderFramebufferUpdated(VirtualFramebuffer *vfb);
 	void NotifyRenderFramebufferSwitched(VirtualFramebuffer *prevVfb, VirtualFramebuffer *vfb, bool isClearingDepth);
@@ -536,6 +571,7 @@ protected:
 	int GetFramebufferLayers() const;
 
 	static void SetColorUpdated(VirtualFramebuffer *dstBuffer, int skipDrawReason) {
+		dstBuffer->colorWriteSeq++;
 		dstBuffer->memoryUpdated = false;
 		dstBuffer->clutUpdatedBytes = 0;
 		dstBuffer->dirtyAfterDisplay = true;
@@ -576,6 +612,9 @@ protected:
 	VirtualFramebuffer *currentRenderVfb_ = nullptr;
 
 	Draw::Framebuffer *currentFramebufferCopy_ = nullptr;
+	// The source buffer and its write sequence number at the time currentFramebufferCopy_ was made.
+	VirtualFramebuffer *currentFramebufferCopySrc_ = nullptr;
+	int currentFramebufferCopySeq_ = 0;
 
 	// The range of PSP memory that may contain FBOs.  So we can skip iterating.
 	u32 framebufColorRangeEnd_ = 0;
@@ -591,6 +630,18 @@ protected:
 
 	bool gameUsesSequentialCopies_ = false;
 
+	// Delayed (non-blocking) readbacks whose data may not have hit RAM yet.
+	// If the CPU reads such a region before the copy lands, we redo it blocking.
+	struct PendingReadback {
+		u32 addr;
+		u32 size;
+		u32 fb_address;
+		int x, y, w, h;
+		RasterChannel channel;
+		int issueFrame;
+	};
+	std::vector<PendingReadback> pendingReadbacks_;
+
 	// Sampled in BeginFrame/UpdateSize for safety.
 	float renderWidth_ = 0.0f;
 	float renderHeight_ = 0.0f;
@@ -602,6 +653,11 @@ protected:
 	int bloomHack_ = 0;
 	bool updatePostShaders_ = false;
 
+	// Cached from compat at construction and NotifyConfigChanged(), so readback and
+	// framebuffer-matching decisions don't pay a PSP_CoreParameter() call per flag check.
+	const CompatFlags *compatFlags_ = nullptr;
+	bool preferDelayedReadbacks_ = false;
+
 	Draw::DataFormat preferredPixelsFormat_ = Draw::DataFormat::R8G8B8A8_UNORM;
 
 	struct TempFBOInfo {
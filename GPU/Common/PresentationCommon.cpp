@@ -15,13 +15,17 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
-#include <set>
 #include <cstdint>
-#include <algorithm>
+#include <set>
 
 #include "Common/GPU/thin3d.h"
 
+#include "Common/Thread/ParallelLoop.h"
+#include "Common/Thread/ThreadManager.h"
+
 #include "Common/System/Display.h"
 #include "Common/System/System.h"
 #include "Common/System/OSD.h"
@@ -232,6 +236,20 @@ void PresentationCommon::CalculatePostShaderUniforms(int bufferWidth, int buffer
 	uniforms->setting[3] = GetShaderSettingValue(shaderInfo, 3, "SettingCurrentValue4");
 }
 
+template <typename T>
+static void DoRelease(T *&obj) {
+	if (obj)
+		obj->Release();
+	obj = nullptr;
+}
+
+template <typename T>
+static void DoReleaseVector(std::vector<T *> &list) {
+	for (auto &obj : list)
+		obj->Release();
+	list.clear();
+}
+
 static std::string ReadShaderSrc(const Path &filename) {
 	size_t sz = 0;
 	char *data = (char *)g_VFS.ReadFile(filename.c_str(), &sz);
@@ -267,30 +285,66 @@ bool PresentationCommon::UpdatePostShader() {
 		shaderInfo = GetFullPostShadersChain(g_Config.vPostShaderNames);
 	}
 
-	DestroyPostShader();
 	if (shaderInfo.empty()) {
-		usePostShader_ = false;
+		DestroyPostShader();
 		return false;
 	}
 
+	// Translate all the stages in parallel on worker threads - for heavy presets the
+	// GLSL translation is most of the cost of a rebuild. Module and pipeline creation
+	// happen on this thread afterwards, the draw context isn't thread-safe.
+	std::vector<std::string> vsSources(shaderInfo.size());
+	std::vector<std::string> fsSources(shaderInfo.size());
+	std::vector<std::string> errors(shaderInfo.size());
+	std::atomic<bool> translateFailed{};
+	ParallelRangeLoop(&g_threadManager, [&](int l, int h) {
+		for (int i = l; i < h; i++) {
+			if (!TranslatePostShaderSources(shaderInfo[i], &vsSources[i], &fsSources[i], &errors[i]))
+				translateFailed = true;
+		}
+	}, 0, (int)shaderInfo.size(), 1);
+
+	if (translateFailed) {
+		for (size_t i = 0; i < errors.size(); ++i) {
+			if (!errors[i].empty()) {
+				ERROR_LOG(Log::FrameBuf, "Failed to build post-processing program from %s and %s!\n%s", shaderInfo[i]->vertexShaderFile.c_str(), shaderInfo[i]->fragmentShaderFile.c_str(), errors[i].c_str());
+				ShowPostShaderError(errors[i]);
+				break;
+			}
+		}
+		// Keep the previous chain rendering rather than dropping to no post-processing.
+		return usePostShader_;
+	}
+
+	// Build the new chain into locals, so the previous one stays usable until the
+	// whole new chain is known good.
+	std::vector<Draw::Pipeline *> pipelines;
+	std::vector<Draw::Framebuffer *> framebuffers;
+	std::vector<ShaderInfo> infos;
+	// The usage list is only consulted while building a chain, for ping-ponging
+	// between intermediate framebuffers, so it's fine to reset it here.
+	postShaderFBOUsage_.clear();
+
 	bool usePreviousFrame = false;
 	bool usePreviousAtOutputResolution = false;
 	for (size_t i = 0; i < shaderInfo.size(); ++i) {
 		const ShaderInfo *next = i + 1 < shaderInfo.size() ? shaderInfo[i + 1] : nullptr;
 		Draw::Pipeline *postPipeline = nullptr;
-		if (!BuildPostShader(shaderInfo[i], next, &postPipeline)) {
-			DestroyPostShader();
-			return false;
+		if (!BuildPostShader(shaderInfo[i], next, vsSources[i], fsSources[i], &framebuffers, &postPipeline)) {
+			DoReleaseVector(pipelines);
+			DoReleaseVector(framebuffers);
+			return usePostShader_;
 		}
 		_dbg_assert_(postPipeline);
-		postShaderPipelines_.push_back(postPipeline);
-		postShaderInfo_.push_back(*shaderInfo[i]);
+		pipelines.push_back(postPipeline);
+		infos.push_back(*shaderInfo[i]);
 		if (shaderInfo[i]->usePreviousFrame) {
 			usePreviousFrame = true;
 			usePreviousAtOutputResolution = shaderInfo[i]->outputResolution;
 		}
 	}
 
+	std::vector<Draw::Framebuffer *> prevFramebuffers;
 	if (usePreviousFrame) {
 		int w = usePreviousAtOutputResolution ? pixelWidth_ : renderWidth_;
 		int h = usePreviousAtOutputResolution ? pixelHeight_ : renderHeight_;
@@ -298,23 +352,31 @@ bool PresentationCommon::UpdatePostShader() {
 		_dbg_assert_(w > 0 && h > 0);
 
 		static constexpr int FRAMES = 2;
-		previousFramebuffers_.resize(FRAMES);
-		previousIndex_ = 0;
-
 		for (int i = 0; i < FRAMES; ++i) {
-			previousFramebuffers_[i] = draw_->CreateFramebuffer({ w, h, 1, 1, 0, false, "inter_presentation" });
-			if (!previousFramebuffers_[i]) {
-				DestroyPostShader();
-				return false;
+			Draw::Framebuffer *fb = draw_->CreateFramebuffer({ w, h, 1, 1, 0, false, "inter_presentation" });
+			if (!fb) {
+				DoReleaseVector(prevFramebuffers);
+				DoReleaseVector(pipelines);
+				DoReleaseVector(framebuffers);
+				return usePostShader_;
 			}
+			prevFramebuffers.push_back(fb);
 		}
 	}
 
+	// The new chain is complete - now swap out the old one.
+	DestroyPostShader();
+	postShaderPipelines_ = std::move(pipelines);
+	postShaderFramebuffers_ = std::move(framebuffers);
+	postShaderInfo_ = std::move(infos);
+	previousFramebuffers_ = std::move(prevFramebuffers);
+	previousIndex_ = 0;
+
 	usePostShader_ = true;
 	return true;
 }
 
-bool PresentationCommon::CompilePostShader(const ShaderInfo *shaderInfo, Draw::Pipeline **outPipeline) const {
+bool PresentationCommon::TranslatePostShaderSources(const ShaderInfo *shaderInfo, std::string *vsSource, std::string *fsSource, std::string *errorString) const {
 	_assert_(shaderInfo);
 
 	std::string vsSourceGLSL = ReadShaderSrc(shaderInfo->vertexShaderFile);
@@ -323,12 +385,46 @@ bool PresentationCommon::CompilePostShader(const ShaderInfo *shaderInfo, Draw::P
 		return false;
 	}
 
+	// All post shaders are written in GLSL 1.0 so that's the "from" language. If no translation
+	// is needed, just pass the source through.
+	if (lang_ == GLSL_1xx) {
+		*vsSource = vsSourceGLSL;
+		*fsSource = fsSourceGLSL;
+		return true;
+	}
+
 	std::string vsError;
 	std::string fsError;
+	bool vsOK = TranslateShader(vsSource, lang_, draw_->GetShaderLanguageDesc(), nullptr, vsSourceGLSL, GLSL_1xx, ShaderStage::Vertex, &vsError);
+	bool fsOK = TranslateShader(fsSource, lang_, draw_->GetShaderLanguageDesc(), nullptr, fsSourceGLSL, GLSL_1xx, ShaderStage::Fragment, &fsError);
+	if (!vsOK || !fsOK) {
+		*errorString = vsError + "\n" + fsError;
+		return false;
+	}
+	return true;
+}
 
-	// All post shaders are written in GLSL 1.0 so that's what we pass in here as a "from" language.
-	Draw::ShaderModule *vs = CompileShaderModule(ShaderStage::Vertex, GLSL_1xx, vsSourceGLSL, &vsError);
-	Draw::ShaderModule *fs = CompileShaderModule(ShaderStage::Fragment, GLSL_1xx, fsSourceGLSL, &fsError);
+bool PresentationCommon::CompilePostShader(const ShaderInfo *shaderInfo, Draw::Pipeline **outPipeline) const {
+	std::string vsSource;
+	std::string fsSource;
+	std::string errorString;
+	if (!TranslatePostShaderSources(shaderInfo, &vsSource, &fsSource, &errorString)) {
+		// DO NOT turn this into an ERROR_LOG_REPORT, as it will pollute our logs with all kinds of
+		// user shader experiments.
+		ERROR_LOG(Log::FrameBuf, "Failed to build post-processing program from %s and %s!\n%s", shaderInfo->vertexShaderFile.c_str(), shaderInfo->fragmentShaderFile.c_str(), errorString.c_str());
+		ShowPostShaderError(errorString);
+		return false;
+	}
+	return CreatePostShaderPipeline(shaderInfo, vsSource, fsSource, outPipeline);
+}
+
+bool PresentationCommon::CreatePostShaderPipeline(const ShaderInfo *shaderInfo, const std::string &vsSource, const std::string &fsSource, Draw::Pipeline **outPipeline) const {
+	std::string vsError;
+	std::string fsError;
+
+	// The sources are already in lang_, so no further translation happens here.
+	Draw::ShaderModule *vs = CompileShaderModule(ShaderStage::Vertex, lang_, vsSource, &vsError);
+	Draw::ShaderModule *fs = CompileShaderModule(ShaderStage::Fragment, lang_, fsSource, &fsError);
 
 	// Don't worry, CompileShaderModule makes sure they get freed if one succeeded.
 	if (!fs || !vs) {
@@ -362,8 +458,8 @@ bool PresentationCommon::CompilePostShader(const ShaderInfo *shaderInfo, Draw::P
 	return true;
 }
 
-bool PresentationCommon::BuildPostShader(const ShaderInfo * shaderInfo, const ShaderInfo * next, Draw::Pipeline **outPipeline) {
-	if (!CompilePostShader(shaderInfo, outPipeline)) {
+bool PresentationCommon::BuildPostShader(const ShaderInfo *shaderInfo, const ShaderInfo *next, const std::string &vsSource, const std::string &fsSource, std::vector<Draw::Framebuffer *> *framebuffers, Draw::Pipeline **outPipeline) {
+	if (!CreatePostShaderPipeline(shaderInfo, vsSource, fsSource, outPipeline)) {
 		return false;
 	}
 
@@ -372,8 +468,8 @@ bool PresentationCommon::BuildPostShader(const ShaderInfo * shaderInfo, const Sh
 		int nextHeight = renderHeight_;
 
 		// When chaining, we use the previous resolution as a base, rather than the render resolution.
-		if (!postShaderFramebuffers_.empty())
-			draw_->GetFramebufferDimensions(postShaderFramebuffers_.back(), &nextWidth, &nextHeight);
+		if (!framebuffers->empty())
+			draw_->GetFramebufferDimensions(framebuffers->back(), &nextWidth, &nextHeight);
 
 		if (next && next->isUpscalingFilter) {
 			// Force 1x for this shader, so the next can upscale.
@@ -393,7 +489,7 @@ bool PresentationCommon::BuildPostShader(const ShaderInfo * shaderInfo, const Sh
 			nextHeight = (int)rc.h;
 		}
 
-		if (!AllocateFramebuffer(nextWidth, nextHeight)) {
+		if (!AllocateFramebuffer(nextWidth, nextHeight, framebuffers)) {
 			(*outPipeline)->Release();
 			*outPipeline = nullptr;
 			return false;
@@ -403,16 +499,16 @@ bool PresentationCommon::BuildPostShader(const ShaderInfo * shaderInfo, const Sh
 	return true;
 }
 
-bool PresentationCommon::AllocateFramebuffer(int w, int h) {
+bool PresentationCommon::AllocateFramebuffer(int w, int h, std::vector<Draw::Framebuffer *> *framebuffers) {
 	using namespace Draw;
 
 	// First, let's try to find a framebuffer of the right size that is NOT the most recent.
-	Framebuffer *last = postShaderFramebuffers_.empty() ? nullptr : postShaderFramebuffers_.back();
+	Framebuffer *last = framebuffers->empty() ? nullptr : framebuffers->back();
 	for (const auto &prev : postShaderFBOUsage_) {
 		if (prev.w == w && prev.h == h && prev.fbo != last) {
 			// Great, this one's perfect.  Ref it for when we release.
 			prev.fbo->AddRef();
-			postShaderFramebuffers_.push_back(prev.fbo);
+			framebuffers->push_back(prev.fbo);
 			return true;
 		}
 	}
@@ -424,7 +520,7 @@ bool PresentationCommon::AllocateFramebuffer(int w, int h) {
 	}
 
 	postShaderFBOUsage_.push_back({ fbo, w, h });
-	postShaderFramebuffers_.push_back(fbo);
+	framebuffers->push_back(fbo);
 	return true;
 }
 
@@ -523,20 +619,6 @@ void PresentationCommon::CreateDeviceObjects() {
 	restorePostShader_ = false;
 }
 
-template <typename T>
-static void DoRelease(T *&obj) {
-	if (obj)
-		obj->Release();
-	obj = nullptr;
-}
-
-template <typename T>
-static void DoReleaseVector(std::vector<T *> &list) {
-	for (auto &obj : list)
-		obj->Release();
-	list.clear();
-}
-
 void PresentationCommon::DestroyDeviceObjects() {
 	DoRelease(texColor_);
 	DoRelease(texColorRBSwizzle_);
@@ -131,9 +131,13 @@ protected:
 
 	Draw::ShaderModule *CompileShaderModule(ShaderStage stage, ShaderLanguage lang, const std::string &src, std::string *errorString) const;
 	Draw::Pipeline *CreatePipeline(std::vector<Draw::ShaderModule *> shaders, bool postShader, const UniformBufferDesc *uniformDesc) const;
+	// Reads and translates both stages to lang_. Pure CPU work, safe to run on a worker thread.
+	bool TranslatePostShaderSources(const ShaderInfo *shaderInfo, std::string *vsSource, std::string *fsSource, std::string *errorString) const;
+	// Takes sources already in lang_. Must run on the thread owning the draw context.
+	bool CreatePostShaderPipeline(const ShaderInfo *shaderInfo, const std::string &vsSource, const std::string &fsSource, Draw::Pipeline **outPipeline) const;
 	bool CompilePostShader(const ShaderInfo *shaderInfo, Draw::Pipeline **outPipeline) const;
-	bool BuildPostShader(const ShaderInfo *shaderInfo, const ShaderInfo *next, Draw::Pipeline **outPipeline);
-	bool AllocateFramebuffer(int w, int h);
+	bool BuildPostShader(const ShaderInfo *shaderInfo, const ShaderInfo *next, const std::string &vsSource, const std::string &fsSource, std::vector<Draw::Framebuffer *> *framebuffers, Draw::Pipeline **outPipeline);
+	bool AllocateFramebuffer(int w, int h, std::vector<Draw::Framebuffer *> *framebuffers);
 
 	bool BindSource(int binding, bool bindStereo);
 
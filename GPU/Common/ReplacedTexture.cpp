@@ -16,6 +16,7 @@
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
 #include <algorithm>
+#include <ctime>
 
 #include "ppsspp_config.h"
 
@@ -144,6 +145,44 @@ void ReplacedTexture::PurgeIfNotUsedSinceTime(double t) {
 	SetState(ReplacementState::UNLOADED);
 }
 
+// Forces a reload from disk on next use, whether the data is currently resident or not.
+// Used on texture pack reload when the files changed. Returns false if a load is in
+// flight - we leave those alone and they'll simply show the data that was on disk.
+bool ReplacedTexture::PurgeForReload() {
+	if (threadWaitable_) {
+		if (threadWaitable_->WaitFor(0.0)) {
+			delete threadWaitable_;
+			threadWaitable_ = nullptr;
+		} else {
+			return false;
+		}
+	}
+
+	switch (State()) {
+	case ReplacementState::ACTIVE:
+		data_.clear();
+		for (auto &level : levels_) {
+			// Unlike idle purging, we drop the file references too - the reload is
+			// specifically because the files changed.
+			vfs_->ReleaseFile(level.fileRef);
+		}
+		levels_.clear();
+		fmt = Draw::DataFormat::UNDEFINED;
+		alphaStatus_ = ReplacedTextureAlpha::UNKNOWN;
+		SetState(ReplacementState::UNLOADED);
+		return true;
+	case ReplacementState::NOT_FOUND:
+		// A matching file may have appeared.
+		SetState(ReplacementState::UNLOADED);
+		return true;
+	case ReplacementState::UNLOADED:
+		// Already going to reload on next use.
+		return true;
+	default:
+		return false;
+	}
+}
+
 // This can only return true if ACTIVE or NOT_FOUND.
 bool ReplacedTexture::Poll(double budget) {
 	_assert_(vfs_ != nullptr);
@@ -203,6 +242,10 @@ void ReplacedTexture::Prepare(VFSBackend *vfs) {
 
 	this->vfs_ = vfs;
 
+	// Note when we last read the files, so pack reloads can tell whether they
+	// changed afterwards. File mtimes are in unix time, hence not time_now_d().
+	loadUnixTime_ = (uint64_t)time(nullptr);
+
 	std::unique_lock<std::mutex> lock(lock_);
 
 	fmt = Draw::DataFormat::UNDEFINED;
@@ -495,8 +538,9 @@ ReplacedTexture::LoadLevelResult ReplacedTexture::LoadLevelData(VFSFileReference
 				*pixelFormat = Draw::DataFormat::R8G8B8A8_UNORM;
 			}
 		} else if (transcoder.is_uastc()) {
-			// TODO: Try to recover some indication of alpha from the actual data blocks.
-			alphaStatus_ = ReplacedTextureAlpha::UNKNOWN;
+			// The KTX2 data format descriptor says whether the image carries alpha, so we
+			// don't have to guess from the transcoded pixels later.
+			alphaStatus_ = transcoder.get_has_alpha() ? ReplacedTextureAlpha::UNKNOWN : ReplacedTextureAlpha::FULL;
 			// Let's pick a suitable compatible format.
 			if (desc_.formatSupport.bc7) {
 				transcoderFormat = basist::transcoder_texture_format::cTFBC7_RGBA;
@@ -504,6 +548,16 @@ ReplacedTexture::LoadLevelResult ReplacedTexture::LoadLevelData(VFSFileReference
 			} else if (desc_.formatSupport.astc) {
 				transcoderFormat = basist::transcoder_texture_format::cTFASTC_4x4_RGBA;
 				*pixelFormat = Draw::DataFormat::ASTC_4x4_UNORM_BLOCK;
+			} else if (desc_.formatSupport.etc2) {
+				// Common on older mobile GPUs that predate ASTC. Opaque images fit in
+				// ETC1's 64 bits per block, alpha needs the extra EAC block.
+				if (transcoder.get_has_alpha()) {
+					transcoderFormat = basist::transcoder_texture_format::cTFETC2_RGBA;
+					*pixelFormat = Draw::DataFormat::ETC2_R8G8B8A8_UNORM_BLOCK;
+				} else {
+					transcoderFormat = basist::transcoder_texture_format::cTFETC1_RGB;
+					*pixelFormat = Draw::DataFormat::ETC2_R8G8B8_UNORM_BLOCK;
+				}
 			} else {
 				// Transcode to RGBA8 instead as a fallback. A bit slow and takes a lot of memory, but better than nothing.
 				WARN_LOG(Log::G3D, "Replacement texture format not supported - transcoding to RGBA8888");
@@ -526,32 +580,44 @@ ReplacedTexture::LoadLevelResult ReplacedTexture::LoadLevelData(VFSFileReference
 
 		data_.resize(numMips);
 
-		basist::ktx2_transcoder_state transcodeState;  // Each thread needs one of these.
-
 		transcoder.start_transcoding();
-		levels_.reserve(numMips);
-		for (int i = 0; i < numMips; i++) {
-			std::vector<uint8_t> &out = data_[mipLevel + i];
 
-			basist::ktx2_image_level_info levelInfo{};
-			bool result = transcoder.get_image_level_info(levelInfo, i, 0, 0);
+		// Collect the level infos and size the output buffers up front, then fan the actual
+		// transcoding out across the thread pool - with a 4K level 0 that's where all the
+		// time goes. transcode_image_level is thread-safe as long as each call gets its own
+		// transcoder state.
+		std::vector<basist::ktx2_image_level_info> levelInfos(numMips);
+		for (int i = 0; i < numMips; i++) {
+			bool result = transcoder.get_image_level_info(levelInfos[i], i, 0, 0);
 			_dbg_assert_(result);
 
-			size_t dataSizeBytes = levelInfo.m_total_blocks * blockSize;
-			size_t outputSize = levelInfo.m_total_blocks;
-			size_t outputPitch = levelInfo.m_num_blocks_x;
+			size_t dataSizeBytes = levelInfos[i].m_total_blocks * blockSize;
 			// Support transcoded-to-RGBA8888 images too.
 			if (!bc) {
-				dataSizeBytes = levelInfo.m_orig_width * levelInfo.m_orig_height * 4;
-				outputSize = levelInfo.m_orig_width * levelInfo.m_orig_height;
-				outputPitch = levelInfo.m_orig_width;
+				dataSizeBytes = levelInfos[i].m_orig_width * levelInfos[i].m_orig_height * 4;
 			}
-			data_[i].resize(dataSizeBytes);
+			data_[mipLevel + i].resize(dataSizeBytes);
+		}
+
+		ParallelRangeLoop(&g_threadManager, [&](int low, int high) {
+			basist::ktx2_transcoder_state transcodeState;  // Each thread needs one of these.
+			for (int i = low; i < high; i++) {
+				const basist::ktx2_image_level_info &levelInfo = levelInfos[i];
+				size_t outputSize = levelInfo.m_total_blocks;
+				size_t outputPitch = levelInfo.m_num_blocks_x;
+				if (!bc) {
+					outputSize = levelInfo.m_orig_width * levelInfo.m_orig_height;
+					outputPitch = levelInfo.m_orig_width;
+				}
+				transcodeState.clear();
+				transcoder.transcode_image_level(i, 0, 0, data_[mipLevel + i].data(), (uint32_t)outputSize, transcoderFormat, 0, (uint32_t)outputPitch, levelInfo.m_orig_height, -1, -1, &transcodeState);
+			}
+		}, 0, numMips, 1);
 
-			transcodeState.clear();
-			transcoder.transcode_image_level(i, 0, 0, &out[0], (uint32_t)outputSize, transcoderFormat, 0, (uint32_t)outputPitch, level.h, -1, -1, &transcodeState);
-			level.w = levelInfo.m_orig_width;
-			level.h = levelInfo.m_orig_height;
+		levels_.reserve(numMips);
+		for (int i = 0; i < numMips; i++) {
+			level.w = levelInfos[i].m_orig_width;
+			level.h = levelInfos[i].m_orig_height;
 			if (i != 0)
 				level.fileRef = nullptr;
 			levels_.push_back(level);
@@ -187,11 +187,14 @@ private:
 	void Prepare(VFSBackend *vfs);
 	LoadLevelResult LoadLevelData(VFSFileReference *fileRef, const std::string &filename, int level, Draw::DataFormat *pixelFormat);
 	void PurgeIfNotUsedSinceTime(double t);
+	bool PurgeForReload();
 
 	std::vector<std::vector<uint8_t>> data_;
 	std::vector<ReplacedTextureLevel> levels_;
 
 	double lastUsed_ = 0.0;
+	// Unix time of the last Prepare, for comparison with file mtimes on pack reload.
+	uint64_t loadUnixTime_ = 0;
 	LimitedWaitable *threadWaitable_ = nullptr;
 	std::mutex lock_;
 	Draw::DataFormat fmt = Draw::DataFormat::UNDEFINED;  // NOTE: Right now, the only supported format is Draw::DataFormat::R8G8B8A8_UNORM.
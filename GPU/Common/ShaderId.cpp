@@ -67,6 +67,36 @@ std::string VertexShaderDesc(const VShaderID &id) {
 	return desc.str();
 }
 
+// In light ubershader mode, the first few light permutations seen still get
+// specialized shaders - the hot configurations of a scene show up immediately and
+// persistently, while the long tail of rare permutations shares the ubershader.
+// The set is sticky for the session so a permutation never flips between the two,
+// which would just end up creating both variants.
+static u32 specializedLightConfigs[16];
+static int numSpecializedLightConfigs;
+
+void ResetSpecializedLightConfigs() {
+	numSpecializedLightConfigs = 0;
+}
+
+static bool ShouldSpecializeLightConfig() {
+	u32 config = gstate.getMaterialUpdate() & 7;
+	for (int i = 0; i < 4; i++) {
+		if (gstate.isLightChanEnabled(i)) {
+			config |= (0x10 | (gstate.getLightComputation(i) << 2) | gstate.getLightType(i)) << (3 + i * 5);
+		}
+	}
+	for (int i = 0; i < numSpecializedLightConfigs; i++) {
+		if (specializedLightConfigs[i] == config)
+			return true;
+	}
+	if (numSpecializedLightConfigs < (int)ARRAY_SIZE(specializedLightConfigs)) {
+		specializedLightConfigs[numSpecializedLightConfigs++] = config;
+		return true;
+	}
+	return false;
+}
+
 void ComputeVertexShaderID(VShaderID *id_out, VertexDecoder *vertexDecoder, bool useHWTransform, bool useHWTessellation, bool weightsAsFloat, bool useSkinInDecode) {
 	u32 vertType = vertexDecoder->VertexType();
 
@@ -131,7 +161,7 @@ void ComputeVertexShaderID(VShaderID *id_out, VertexDecoder *vertexDecoder, bool
 		if (gstate.isLightingEnabled()) {
 			// doShadeMapping is stored as UVGenMode, and light type doesn't matter for shade mapping.
 			id.SetBit(VS_BIT_LIGHTING_ENABLE);
-			if (gstate_c.Use(GPU_USE_LIGHT_UBERSHADER)) {
+			if (gstate_c.Use(GPU_USE_LIGHT_UBERSHADER) && !ShouldSpecializeLightConfig()) {
 				id.SetBit(VS_BIT_LIGHT_UBERSHADER);
 			} else {
 				id.SetBits(VS_BIT_MATERIAL_UPDATE, 3, gstate.getMaterialUpdate());
@@ -283,6 +283,9 @@ class Bugs;
 class VertexDecoder;
 
 void ComputeVertexShaderID(VShaderID *id, VertexDecoder *vertexDecoder, bool useHWTransform, bool useHWTessellation, bool weightsAsFloat, bool useSkinInDecode);
+// Clears the set of light permutations that get specialized shaders in light
+// ubershader mode. Call when starting a new game.
+void ResetSpecializedLightConfigs();
 // Generates a compact string that describes the shader. Useful in a list to get an overview
 // of the current flora of shaders.
 std::string VertexShaderDesc(const VShaderID &id);
@@ -125,6 +125,271 @@ static bool IsReallyAClear(const TransformedVertex *transformed, int numVerts, f
 	return true;
 }
 
+// Through mode vertices are barely touched, but 2D-heavy games push enough of them that the
+// per-vertex format checks show up. Instantiate the loop over them instead so each draw picks
+// a branch-free body once.
+template <bool hasColor, bool hasUV>
+static void TransformThrough(VertexReader &reader, TransformedVertex *transformed, int numDecodedVerts, u32 materialAmbientRGBA, float uscale, float vscale) {
+	for (int index = 0; index < numDecodedVerts; index++) {
+		// Do not touch the coordinates or the colors. No lighting.
+		reader.Goto(index);
+		// TODO: Write to a flexible buffer, we don't always need all four components.
+		TransformedVertex &vert = transformed[index];
+		reader.ReadPos(vert.pos);
+		vert.pos_w = 1.0f;
+
+		if (hasColor) {
+			vert.color0_32 = reader.ReadColor0_8888();
+		} else {
+			vert.color0_32 = materialAmbientRGBA;
+		}
+
+		if (hasUV) {
+			reader.ReadUV(vert.uv);
+
+			vert.u *= uscale;
+			vert.v *= vscale;
+		} else {
+			vert.u = 0.0f;
+			vert.v = 0.0f;
+		}
+		vert.uv_w = 1.0f;
+
+		// Ignore color1 and fog, never used in throughmode anyway.
+		// The w of uv is also never used (hardcoded to 1.0.)
+	}
+}
+
+// UV generation and the view/projection transform, shared between the lit and unlit loops below.
+template <bool hasNormal, GETexMapMode uvGenMode>
+static inline void FinishVertex(TransformedVertex &vert, const float pos[3], const float ruv[2],
+	const Vec3f &normal, const Vec3f &worldnormal, const float worldpos[3], const Vec4f &c0, const Vec4f &c1,
+	const float *projMatrix, float widthFactor, float heightFactor, float fog_end, float fog_slope) {
+	float uv[3] = {0, 0, 1};
+
+	// Perform texture coordinate generation after the transform and lighting - one style of UV depends on lights.
+	switch (uvGenMode) {
+	case GE_TEXMAP_TEXTURE_COORDS:	// UV mapping
+	case GE_TEXMAP_UNKNOWN: // Seen in Riviera.  Unsure of meaning, but this works.
+		// We always prescale in the vertex decoder now.
+		uv[0] = ruv[0];
+		uv[1] = ruv[1];
+		uv[2] = 1.0f;
+		break;
+
+	case GE_TEXMAP_TEXTURE_MATRIX:
+		{
+			// Projection mapping
+			Vec3f source(0.0f, 0.0f, 1.0f);
+			switch (gstate.getUVProjMode())	{
+			case GE_PROJMAP_POSITION: // Use model space XYZ as source
+				source = pos;
+				break;
+
+			case GE_PROJMAP_UV: // Use unscaled UV as source
+				source = Vec3f(ruv[0], ruv[1], 0.0f);
+				break;
+
+			case GE_PROJMAP_NORMALIZED_NORMAL: // Use normalized normal as source
+				source = normal.Normalized(cpu_info.bSSE4_1);
+				if (!hasNormal) {
+					ERROR_LOG_REPORT(Log::G3D, "Normal projection mapping without normal?");
+				}
+				break;
+
+			case GE_PROJMAP_NORMAL: // Use non-normalized normal as source!
+				source = normal;
+				if (!hasNormal) {
+					ERROR_LOG_REPORT(Log::G3D, "Normal projection mapping without normal?");
+				}
+				break;
+			}
+
+			float uvw[3];
+			Vec3ByMatrix43(uvw, &source.x, gstate.tgenMatrix);
+			uv[0] = uvw[0];
+			uv[1] = uvw[1];
+			uv[2] = uvw[2];
+		}
+		break;
+
+	case GE_TEXMAP_ENVIRONMENT_MAP:
+		// Shade mapping - use two light sources to generate U and V.
+		{
+			auto getLPosFloat = [&](int l, int i) {
+				return getFloat24(gstate.lpos[l * 3 + i]);
+			};
+			auto getLPos = [&](int l) {
+				return Vec3f(getLPosFloat(l, 0), getLPosFloat(l, 1), getLPosFloat(l, 2));
+			};
+			auto calcShadingLPos = [&](int l) {
+				Vec3f pos = getLPos(l);
+				return pos.NormalizedOr001(cpu_info.bSSE4_1);
+			};
+			// Might not have lighting enabled, so don't use lighter.
+			Vec3f lightpos0 = calcShadingLPos(gstate.getUVLS0());
+			Vec3f lightpos1 = calcShadingLPos(gstate.getUVLS1());
+
+			uv[0] = (1.0f + Dot(lightpos0, worldnormal))/2.0f;
+			uv[1] = (1.0f + Dot(lightpos1, worldnormal))/2.0f;
+			uv[2] = 1.0f;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	uv[0] = uv[0] * widthFactor;
+	uv[1] = uv[1] * heightFactor;
+
+	// Transform the coord by the view matrix.
+	float v[3];
+	Vec3ByMatrix43(v, worldpos, gstate.viewMatrix);
+	const float fogCoef = (v[2] + fog_end) * fog_slope;
+
+	// TODO: Write to a flexible buffer, we don't always need all four components.
+	Vec3ByMatrix44(vert.pos, v, projMatrix);
+	vert.fog = fogCoef;
+	memcpy(&vert.uv, uv, 3 * sizeof(float));
+	vert.color0_32 = c0.ToRGBA();
+	vert.color1_32 = c1.ToRGBA();
+
+	// Vertex depth rounding is done in the shader, to simulate the 16-bit depth buffer.
+}
+
+// The full transform loop, specialized over the per-draw state it used to re-check per vertex:
+// normal presence, lighting, and the UV gen mode. The combination is selected once per draw
+// below, similar to how the software renderer enumerates its pixel function variants.
+template <bool hasNormal, bool lighting, GETexMapMode uvGenMode>
+static void TransformVerts(VertexReader &reader, TransformedVertex *transformed, int numDecodedVerts,
+	Lighter &lighter, const Vec4f &materialAmbientRGBA, const float *projMatrix,
+	float widthFactor, float heightFactor, float fog_end, float fog_slope, bool lmode) {
+	const bool hasUV = reader.hasUV();
+	const bool hasColor = reader.hasColor0();
+
+	auto readVertex = [&](int index, float pos[3], float ruv[2], Vec4f &unlitColor, Vec3f &normal, Vec3f &worldnormal, float worldpos[3]) {
+		reader.Goto(index);
+		reader.ReadPos(pos);
+
+		ruv[0] = 0.0f;
+		ruv[1] = 0.0f;
+		if (hasUV)
+			reader.ReadUV(ruv);
+
+		if (hasColor)
+			reader.ReadColor0(unlitColor.AsArray());
+		else
+			unlitColor = materialAmbientRGBA;
+
+		normal = Vec3f(0, 0, 1);
+		worldnormal = Vec3f(0, 0, 1);
+		if (hasNormal)
+			reader.ReadNrm(normal.AsArray());
+
+		Vec3ByMatrix43(worldpos, pos, gstate.worldMatrix);
+		if (hasNormal) {
+			if (gstate.areNormalsReversed()) {
+				normal = -normal;
+			}
+			Norm3ByMatrix43(worldnormal.AsArray(), normal.AsArray(), gstate.worldMatrix);
+			worldnormal = worldnormal.NormalizedOr001(cpu_info.bSSE4_1);
+		}
+	};
+
+	if (lighting) {
+		// Light four vertices per iteration - see Lighter::Light4.
+		for (int index = 0; index < numDecodedVerts; index += 4) {
+			const int count = std::min(numDecodedVerts - index, 4);
+
+			float pos[4][3];
+			float ruv[4][2];
+			Vec4f unlitColor[4];
+			Vec3f normal[4];
+			Vec3f worldnormal[4];
+			Vec3f worldpos[4];
+			for (int j = 0; j < count; j++) {
+				readVertex(index + j, pos[j], ruv[j], unlitColor[j], normal[j], worldnormal[j], worldpos[j].AsArray());
+			}
+			// Duplicate the last vertex into the unused lanes of a partial batch.
+			for (int j = count; j < 4; j++) {
+				unlitColor[j] = unlitColor[count - 1];
+				worldnormal[j] = worldnormal[count - 1];
+				worldpos[j] = worldpos[count - 1];
+			}
+
+			float colorIn[4][4];
+			for (int j = 0; j < 4; j++) {
+				memcpy(colorIn[j], unlitColor[j].AsArray(), sizeof(colorIn[j]));
+			}
+			float litColor0[4][4];
+			float litColor1[4][4];
+			lighter.Light4(litColor0, litColor1, colorIn, worldpos, worldnormal);
+
+			for (int j = 0; j < count; j++) {
+				Vec4f c0;
+				Vec4f c1 = Vec4f(0, 0, 0, 0);
+				// Don't ignore gstate.lmode - we should send two colors in that case
+				for (int k = 0; k < 4; k++) {
+					c0[k] = litColor0[j][k];
+				}
+				if (lmode) {
+					// Separate colors
+					for (int k = 0; k < 4; k++) {
+						c1[k] = litColor1[j][k];
+					}
+				} else {
+					// Summed color into c0 (will clamp in ToRGBA().)
+					for (int k = 0; k < 4; k++) {
+						c0[k] += litColor1[j][k];
+					}
+				}
+				FinishVertex<hasNormal, uvGenMode>(transformed[index + j], pos[j], ruv[j], normal[j], worldnormal[j],
+					worldpos[j].AsArray(), c0, c1, projMatrix, widthFactor, heightFactor, fog_end, fog_slope);
+			}
+		}
+	} else {
+		for (int index = 0; index < numDecodedVerts; index++) {
+			float pos[3];
+			float ruv[2];
+			Vec4f unlitColor;
+			Vec3f normal;
+			Vec3f worldnormal;
+			Vec3f worldpos;
+			readVertex(index, pos, ruv, unlitColor, normal, worldnormal, worldpos.AsArray());
+
+			const Vec4f c1 = Vec4f(0, 0, 0, 0);
+			FinishVertex<hasNormal, uvGenMode>(transformed[index], pos, ruv, normal, worldnormal,
+				worldpos.AsArray(), unlitColor, c1, projMatrix, widthFactor, heightFactor, fog_end, fog_slope);
+		}
+	}
+}
+
+typedef void (*TransformFunc)(VertexReader &, TransformedVertex *, int, Lighter &, const Vec4f &, const float *, float, float, float, float, bool);
+
+template <bool hasNormal, bool lighting>
+static TransformFunc GetTransformFunc(GETexMapMode uvGenMode) {
+	switch (uvGenMode) {
+	case GE_TEXMAP_TEXTURE_MATRIX:
+		return &TransformVerts<hasNormal, lighting, GE_TEXMAP_TEXTURE_MATRIX>;
+	case GE_TEXMAP_ENVIRONMENT_MAP:
+		return &TransformVerts<hasNormal, lighting, GE_TEXMAP_ENVIRONMENT_MAP>;
+	case GE_TEXMAP_TEXTURE_COORDS:
+	case GE_TEXMAP_UNKNOWN:
+	default:
+		// The mode is a 2-bit field, nothing else is possible.
+		return &TransformVerts<hasNormal, lighting, GE_TEXMAP_TEXTURE_COORDS>;
+	}
+}
+
+static TransformFunc GetTransformFunc(bool hasNormal, bool lighting, GETexMapMode uvGenMode) {
+	if (hasNormal) {
+		return lighting ? GetTransformFunc<true, true>(uvGenMode) : GetTransformFunc<true, false>(uvGenMode);
+	} else {
+		return lighting ? GetTransformFunc<false, true>(uvGenMode) : GetTransformFunc<false, false>(uvGenMode);
+	}
+}
+
 void SoftwareTransform::SetProjMatrix(const float mtx[14], bool invertedX, bool invertedY, const Lin::Vec3 &trans, const Lin::Vec3 &scale) {
 	memcpy(&projMatrix_.m, mtx, 16 * sizeof(float));
 
@@ -178,196 +443,17 @@ void SoftwareTransform::Transform(int prim, u32 vertType, const DecVtxFormat &de
 	VertexReader reader(decoded, decVtxFormat, vertType);
 	if (throughmode) {
 		const u32 materialAmbientRGBA = gstate.getMaterialAmbientRGBA();
-		const bool hasColor = reader.hasColor0();
-		const bool hasUV = reader.hasUV();
-		for (int index = 0; index < numDecodedVerts; index++) {
-			// Do not touch the coordinates or the colors. No lighting.
-			reader.Goto(index);
-			// TODO: Write to a flexible buffer, we don't always need all four components.
-			TransformedVertex &vert = transformed[index];
-			reader.ReadPos(vert.pos);
-			vert.pos_w = 1.0f;
-
-			if (hasColor) {
-				vert.color0_32 = reader.ReadColor0_8888();
-			} else {
-				vert.color0_32 = materialAmbientRGBA;
-			}
-
-			if (hasUV) {
-				reader.ReadUV(vert.uv);
-
-				vert.u *= uscale;
-				vert.v *= vscale;
-			} else {
-				vert.u = 0.0f;
-				vert.v = 0.0f;
-			}
-			vert.uv_w = 1.0f;
-
-			// Ignore color1 and fog, never used in throughmode anyway.
-			// The w of uv is also never used (hardcoded to 1.0.)
-		}
+		void (*transformThrough)(VertexReader &, TransformedVertex *, int, u32, float, float) =
+			reader.hasColor0()
+				? (reader.hasUV() ? &TransformThrough<true, true> : &TransformThrough<true, false>)
+				: (reader.hasUV() ? &TransformThrough<false, true> : &TransformThrough<false, false>);
+		transformThrough(reader, transformed, numDecodedVerts, materialAmbientRGBA, uscale, vscale);
 	} else {
 		const Vec4f materialAmbientRGBA = Vec4f::FromRGBA(gstate.getMaterialAmbientRGBA());
-		// Okay, need to actually perform the full transform.
-		for (int index = 0; index < numDecodedVerts; index++) {
-			reader.Goto(index);
-
-			float v[3] = {0, 0, 0};
-			Vec4f c0 = Vec4f(1, 1, 1, 1);
-			Vec4f c1 = Vec4f(0, 0, 0, 0);
-			float uv[3] = {0, 0, 1};
-			float fogCoef = 1.0f;
-
-			float out[3];
-			float pos[3];
-			Vec3f normal(0, 0, 1);
-			Vec3f worldnormal(0, 0, 1);
-			reader.ReadPos(pos);
-
-			float ruv[2] = { 0.0f, 0.0f };
-			if (reader.hasUV())
-				reader.ReadUV(ruv);
-
-			Vec4f unlitColor;
-			if (reader.hasColor0())
-				reader.ReadColor0(unlitColor.AsArray());
-			else
-				unlitColor = materialAmbientRGBA;
-			if (reader.hasNormal())
-				reader.ReadNrm(normal.AsArray());
-
-			Vec3ByMatrix43(out, pos, gstate.worldMatrix);
-			if (reader.hasNormal()) {
-				if (gstate.areNormalsReversed()) {
-					normal = -normal;
-				}
-				Norm3ByMatrix43(worldnormal.AsArray(), normal.AsArray(), gstate.worldMatrix);
-				worldnormal = worldnormal.NormalizedOr001(cpu_info.bSSE4_1);
-			}
-
-			// Perform lighting here if enabled.
-			if (gstate.isLightingEnabled()) {
-				float litColor0[4];
-				float litColor1[4];
-				lighter.Light(litColor0, litColor1, unlitColor.AsArray(), out, worldnormal);
-
-				// Don't ignore gstate.lmode - we should send two colors in that case
-				for (int j = 0; j < 4; j++) {
-					c0[j] = litColor0[j];
-				}
-				if (lmode) {
-					// Separate colors
-					for (int j = 0; j < 4; j++) {
-						c1[j] = litColor1[j];
-					}
-				} else {
-					// Summed color into c0 (will clamp in ToRGBA().)
-					for (int j = 0; j < 4; j++) {
-						c0[j] += litColor1[j];
-					}
-				}
-			} else {
-				for (int j = 0; j < 4; j++) {
-					c0[j] = unlitColor[j];
-				}
-				if (lmode) {
-					// c1 is already 0.
-				}
-			}
-
-			// Perform texture coordinate generation after the transform and lighting - one style of UV depends on lights.
-			switch (gstate.getUVGenMode()) {
-			case GE_TEXMAP_TEXTURE_COORDS:	// UV mapping
-			case GE_TEXMAP_UNKNOWN: // Seen in Riviera.  Unsure of meaning, but this works.
-				// We always prescale in the vertex decoder now.
-				uv[0] = ruv[0];
-				uv[1] = ruv[1];
-				uv[2] = 1.0f;
-				break;
-
-			case GE_TEXMAP_TEXTURE_MATRIX:
-				{
-					// Projection mapping
-					Vec3f source(0.0f, 0.0f, 1.0f);
-					switch (gstate.getUVProjMode())	{
-					case GE_PROJMAP_POSITION: // Use model space XYZ as source
-						source = pos;
-						break;
-
-					case GE_PROJMAP_UV: // Use unscaled UV as source
-						source = Vec3f(ruv[0], ruv[1], 0.0f);
-						break;
-
-					case GE_PROJMAP_NORMALIZED_NORMAL: // Use normalized normal as source
-						source = normal.Normalized(cpu_info.bSSE4_1);
-						if (!reader.hasNormal()) {
-							ERROR_LOG_REPORT(Log::G3D, "Normal projection mapping without normal?");
-						}
-						break;
-
-					case GE_PROJMAP_NORMAL: // Use non-normalized normal as source!
-						source = normal;
-						if (!reader.hasNormal()) {
-							ERROR_LOG_REPORT(Log::G3D, "Normal projection mapping without normal?");
-						}
-						break;
-					}
-
-					float uvw[3];
-					Vec3ByMatrix43(uvw, &source.x, gstate.tgenMatrix);
-					uv[0] = uvw[0];
-					uv[1] = uvw[1];
-					uv[2] = uvw[2];
-				}
-				break;
-
-			case GE_TEXMAP_ENVIRONMENT_MAP:
-				// Shade mapping - use two light sources to generate U and V.
-				{
-					auto getLPosFloat = [&](int l, int i) {
-						return getFloat24(gstate.lpos[l * 3 + i]);
-					};
-					auto getLPos = [&](int l) {
-						return Vec3f(getLPosFloat(l, 0), getLPosFloat(l, 1), getLPosFloat(l, 2));
-					};
-					auto calcShadingLPos = [&](int l) {
-						Vec3f pos = getLPos(l);
-						return pos.NormalizedOr001(cpu_info.bSSE4_1);
-					};
-					// Might not have lighting enabled, so don't use lighter.
-					Vec3f lightpos0 = calcShadingLPos(gstate.getUVLS0());
-					Vec3f lightpos1 = calcShadingLPos(gstate.getUVLS1());
-
-					uv[0] = (1.0f + Dot(lightpos0, worldnormal))/2.0f;
-					uv[1] = (1.0f + Dot(lightpos1, worldnormal))/2.0f;
-					uv[2] = 1.0f;
-				}
-				break;
-
-			default:
-				// Illegal
-				ERROR_LOG_REPORT(Log::G3D, "Impossible UV gen mode? %d", gstate.getUVGenMode());
-				break;
-			}
-
-			uv[0] = uv[0] * widthFactor;
-			uv[1] = uv[1] * heightFactor;
-
-			// Transform the coord by the view matrix.
-			Vec3ByMatrix43(v, out, gstate.viewMatrix);
-			fogCoef = (v[2] + fog_end) * fog_slope;
-
-			// TODO: Write to a flexible buffer, we don't always need all four components.
-			Vec3ByMatrix44(transformed[index].pos, v, projMatrix_.m);
-			transformed[index].fog = fogCoef;
-			memcpy(&transformed[index].uv, uv, 3 * sizeof(float));
-			transformed[index].color0_32 = c0.ToRGBA();
-			transformed[index].color1_32 = c1.ToRGBA();
-
-			// Vertex depth rounding is done in the shader, to simulate the 16-bit depth buffer.
-		}
+		// Okay, need to actually perform the full transform. Pick the specialization for this draw's state.
+		TransformFunc transformFunc = GetTransformFunc(reader.hasNormal(), gstate.isLightingEnabled(), gstate.getUVGenMode());
+		transformFunc(reader, transformed, numDecodedVerts, lighter, materialAmbientRGBA, projMatrix_.m,
+			widthFactor, heightFactor, fog_end, fog_slope, lmode);
 	}
 
 	// Here's the best opportunity to try to detect rectangles used to clear the screen, and
@@ -485,6 +485,20 @@ void DrawEngineCommon::ClearSplineBezierWeights() {
 	Spline3DWeight::weightsCache.Clear();
 }
 
+// Total budget for cached tessellation output. When exceeded, the whole cache is dumped -
+// patches are cheap to regenerate once, so no fancy eviction policy is needed.
+static const size_t TESS_CACHE_MAX_BYTES = 8 * 1024 * 1024;
+
+void DrawEngineCommon::ClearTessCache() {
+	tessCache_.Iterate([](const uint64_t key, CachedTessellation *entry) {
+		delete[] entry->vertices;
+		delete[] entry->indices;
+		delete entry;
+	});
+	tessCache_.Clear();
+	tessCacheBytes_ = 0;
+}
+
 // Specialize to make instance (to avoid link error).
 template void DrawEngineCommon::SubmitCurve<BezierSurface>(const void *control_points, const void *indices, BezierSurface &surface, u32 vertType, int *bytesRead, const char *scope);
 template void DrawEngineCommon::SubmitCurve<SplineSurface>(const void *control_points, const void *indices, SplineSurface &surface, u32 vertType, int *bytesRead, const char *scope);
@@ -510,56 +524,127 @@ void DrawEngineCommon::SubmitCurve(const void *control_points, const void *indic
 	VertexDecoder *origVDecoder = GetVertexDecoder(GetVertTypeID(vertType, gstate.getUVGenMode(), decOptions_.applySkinInDecode));
 	*bytesRead = num_points * origVDecoder->VertexSize();
 
-	// Simplify away bones and morph before proceeding
-	// There are normally not a lot of control points so just splitting decoded should be reasonably safe, although not great.
-	SimpleVertex *simplified_control_points = (SimpleVertex *)managedBuf.Allocate(sizeof(SimpleVertex) * (index_upper_bound + 1));
-	if (!simplified_control_points) {
-		ERROR_LOG(Log::G3D, "Failed to allocate space for simplified control points, skipping curve draw");
-		return;
-	}
-
-	u8 *temp_buffer = managedBuf.Allocate(sizeof(SimpleVertex) * num_points);
-	if (!temp_buffer) {
-		ERROR_LOG(Log::G3D, "Failed to allocate space for temp buffer, skipping curve draw");
-		return;
+	// Adapt the division factors to the projected size of the control hull - distant
+	// patches don't need anywhere near the density games typically ask for. Done
+	// before the cache key is computed so the adjusted factors are part of the key.
+	ReduceCurveTessToScreenSize(control_points, vertType, num_points, surface.num_patches_u, surface.num_patches_v, &surface.tess_u, &surface.tess_v);
+
+	// See if we have this patch cached. Static curved geometry like terrain gets resubmitted
+	// with identical control points every frame, and CPU tessellation is expensive.
+	// Bone/morph influenced control points depend on too much state to be worth keying on.
+	const bool cacheable = !CanUseHardwareTessellation(surface.primType) &&
+		(vertType & (GE_VTYPE_WEIGHT_MASK | GE_VTYPE_MORPHCOUNT_MASK)) == 0;
+	uint64_t tessKey = 0;
+	CachedTessellation *cached = nullptr;
+	if (cacheable) {
+		if (tessCacheBytes_ > TESS_CACHE_MAX_BYTES) {
+			// Deferred draws can still point into the cache, so flush before dumping it.
+			DispatchFlush();
+			ClearTessCache();
+		}
+		// All the state that feeds into the tessellated output has to be part of the key.
+		const u32 state[] = {
+			vertType,
+			(u32)surface.tess_u, (u32)surface.tess_v,
+			(u32)surface.num_points_u, (u32)surface.num_points_v,
+			(u32)surface.type_u, (u32)surface.type_v,
+			(u32)surface.primType, (u32)surface.patchFacing,
+			(u32)gstate.isLightingEnabled(),
+			(vertType & GE_VTYPE_COL_MASK) ? 0 : gstate.getMaterialAmbientRGBA(),  // default vertex color
+		};
+		tessKey = XXH3_64bits(state, sizeof(state));
+		// With indices, the control point array is only as large as the highest index reached.
+		const size_t cpBytes = (size_t)(indices ? index_upper_bound + 1 : num_points) * origVDecoder->VertexSize();
+		tessKey = XXH3_64bits_withSeed(control_points, cpBytes, tessKey);
+		if (indices) {
+			const int indexSize = 1 << (((vertType & GE_VTYPE_IDX_MASK) >> GE_VTYPE_IDX_SHIFT) - 1);
+			tessKey = XXH3_64bits_withSeed(indices, num_points * indexSize, tessKey);
+		}
+		if (vertType & GE_VTYPE_TC_MASK) {
+			// The UV scale gets baked into the vertices during normalization.
+			tessKey = XXH3_64bits_withSeed(&gstate_c.uv, sizeof(gstate_c.uv), tessKey);
+		}
+		tessCache_.Get(tessKey, &cached);
 	}
 
 	u32 origVertType = vertType;
-	vertType = NormalizeVertices((u8 *)simplified_control_points, temp_buffer, (u8 *)control_points, index_lower_bound, index_upper_bound, vertType);
+	OutputBuffers output;
 
-	VertexDecoder *vdecoder = GetVertexDecoder(vertType);
+	if (cached) {
+		output.vertices = cached->vertices;
+		output.indices = cached->indices;
+		output.count = cached->indexCount;
+		vertType = cached->vertType;
+	} else {
+		// Simplify away bones and morph before proceeding
+		// There are normally not a lot of control points so just splitting decoded should be reasonably safe, although not great.
+		SimpleVertex *simplified_control_points = (SimpleVertex *)managedBuf.Allocate(sizeof(SimpleVertex) * (index_upper_bound + 1));
+		if (!simplified_control_points) {
+			ERROR_LOG(Log::G3D, "Failed to allocate space for simplified control points, skipping curve draw");
+			return;
+		}
 
-	int vertexSize = vdecoder->VertexSize();
-	if (vertexSize != sizeof(SimpleVertex)) {
-		ERROR_LOG(Log::G3D, "Something went really wrong, vertex size: %d vs %d", vertexSize, (int)sizeof(SimpleVertex));
-	}
+		u8 *temp_buffer = managedBuf.Allocate(sizeof(SimpleVertex) * num_points);
+		if (!temp_buffer) {
+			ERROR_LOG(Log::G3D, "Failed to allocate space for temp buffer, skipping curve draw");
+			return;
+		}
 
-	// Make an array of pointers to the control points, to get rid of indices.
-	const SimpleVertex **points = (const SimpleVertex **)managedBuf.Allocate(sizeof(SimpleVertex *) * num_points);
-	if (!points) {
-		ERROR_LOG(Log::G3D, "Failed to allocate space for control point pointers, skipping curve draw");
-		return;
-	}
-	for (int idx = 0; idx < num_points; idx++)
-		points[idx] = simplified_control_points + (indices ? ConvertIndex(idx) : idx);
+		vertType = NormalizeVertices((u8 *)simplified_control_points, temp_buffer, (u8 *)control_points, index_lower_bound, index_upper_bound, vertType);
 
-	OutputBuffers output;
-	output.vertices = (SimpleVertex *)(decoded_ + DECODED_VERTEX_BUFFER_SIZE / 2);
-	output.indices = decIndex_;
-	output.count = 0;
+		VertexDecoder *vdecoder = GetVertexDecoder(vertType);
 
-	int maxVerts = DECODED_VERTEX_BUFFER_SIZE / 2 / vertexSize;
+		int vertexSize = vdecoder->VertexSize();
+		if (vertexSize != sizeof(SimpleVertex)) {
+			ERROR_LOG(Log::G3D, "Something went really wrong, vertex size: %d vs %d", vertexSize, (int)sizeof(SimpleVertex));
+		}
 
-	surface.Init(maxVerts);
+		// Make an array of pointers to the control points, to get rid of indices.
+		const SimpleVertex **points = (const SimpleVertex **)managedBuf.Allocate(sizeof(SimpleVertex *) * num_points);
+		if (!points) {
+			ERROR_LOG(Log::G3D, "Failed to allocate space for control point pointers, skipping curve draw");
+			return;
+		}
+		for (int idx = 0; idx < num_points; idx++)
+			points[idx] = simplified_control_points + (indices ? ConvertIndex(idx) : idx);
 
-	if (CanUseHardwareTessellation(surface.primType)) {
-		HardwareTessellation(output, surface, origVertType, points, tessDataTransfer);
-	} else {
-		ControlPoints cpoints(points, num_points, managedBuf);
-		if (cpoints.IsValid())
-			SoftwareTessellation(output, surface, origVertType, cpoints);
-		else
-			ERROR_LOG(Log::G3D, "Failed to allocate space for control point values, skipping curve draw");
+		output.vertices = (SimpleVertex *)(decoded_ + DECODED_VERTEX_BUFFER_SIZE / 2);
+		output.indices = decIndex_;
+		output.count = 0;
+
+		int maxVerts = DECODED_VERTEX_BUFFER_SIZE / 2 / vertexSize;
+
+		surface.Init(maxVerts);
+
+		if (CanUseHardwareTessellation(surface.primType)) {
+			HardwareTessellation(output, surface, origVertType, points, tessDataTransfer);
+		} else {
+			ControlPoints cpoints(points, num_points, managedBuf);
+			if (cpoints.IsValid())
+				SoftwareTessellation(output, surface, origVertType, cpoints);
+			else
+				ERROR_LOG(Log::G3D, "Failed to allocate space for control point values, skipping curve draw");
+		}
+
+		if (cacheable && output.count > 0) {
+			// The output only references the verts the indices reach, so that's all we need to copy.
+			int vertexCount = 0;
+			for (int i = 0; i < output.count; i++)
+				vertexCount = std::max(vertexCount, (int)output.indices[i] + 1);
+			const size_t entryBytes = vertexCount * sizeof(SimpleVertex) + output.count * sizeof(u16);
+			if (entryBytes <= TESS_CACHE_MAX_BYTES / 4) {
+				CachedTessellation *entry = new CachedTessellation();
+				entry->vertices = new SimpleVertex[vertexCount];
+				memcpy(entry->vertices, output.vertices, vertexCount * sizeof(SimpleVertex));
+				entry->indices = new u16[output.count];
+				memcpy(entry->indices, output.indices, output.count * sizeof(u16));
+				entry->vertexCount = vertexCount;
+				entry->indexCount = output.count;
+				entry->vertType = vertType;
+				tessCache_.Insert(tessKey, entry);
+				tessCacheBytes_ += entryBytes;
+			}
+		}
 	}
 
 	u32 vertTypeWithIndex16 = (vertType & ~GE_VTYPE_IDX_MASK) | GE_VTYPE_IDX_16BIT;
@@ -23,6 +23,7 @@
 #include "GPU/Math3D.h"
 #include "GPU/ge_constants.h"
 #include "Core/Config.h"
+#include "Core/System.h"
 
 #define HALF_CEIL(x) (x + 1) / 2 // Integer ceil = (int)ceil((float)x / 2.0f)
 
@@ -69,7 +70,12 @@ struct SurfaceInfo {
 		if (tess_u < 1) tess_u = 1;
 		if (tess_v < 1) tess_v = 1;
 
-		switch (g_Config.iSplineBezierQuality) {
+		// A per-title hint beats the global setting, if present.
+		int quality = PSP_CoreParameter().compat.hints().SplineQuality;
+		if (quality < 0)
+			quality = g_Config.iSplineBezierQuality;
+
+		switch (quality) {
 		case LOW_QUALITY:
 			tess_u = 2;
 			tess_v = 2;
@@ -15,8 +15,11 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include "ppsspp_config.h"
+
 #include "Common/GPU/Shader.h"
 #include "Common/GPU/ShaderWriter.h"
+#include "Common/Math/CrossSIMD.h"
 #include "Core/Config.h"
 #include "Core/ConfigValues.h"
 #include "GPU/Common/StencilCommon.h"
@@ -24,37 +27,45 @@
 #include "GPU/Common/FramebufferManagerCommon.h"
 #include "GPU/Common/TextureCacheCommon.h"
 
-static u8 StencilBits5551(const u8 *ptr8, u32 numPixels) {
-	const u32 *ptr = (const u32 *)ptr8;
-
-	for (u32 i = 0; i < numPixels / 2; ++i) {
-		if (ptr[i] & 0x80008000) {
-			return 1;
-		}
-	}
-	return 0;
-}
-
-static u8 StencilBits4444(const u8 *ptr8, u32 numPixels) {
-	const u32 *ptr = (const u32 *)ptr8;
+// OR-reduces a span of 32-bit words. Used below to find which stencil bits are in use,
+// so scans the whole framebuffer - worth vectorizing since games doing stencil shadows
+// re-upload every frame.
+static u32 OrReduce32(const u32 *ptr, u32 count) {
 	u32 bits = 0;
-
-	for (u32 i = 0; i < numPixels / 2; ++i) {
+	u32 i = 0;
+#if PPSSPP_ARCH(SSE2)
+	__m128i acc = _mm_setzero_si128();
+	for (; i + 4 <= count; i += 4) {
+		acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i *)&ptr[i]));
+	}
+	acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+	acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+	bits = _mm_cvtsi128_si32(acc);
+#elif PPSSPP_ARCH(ARM_NEON)
+	uint32x4_t acc = vdupq_n_u32(0);
+	for (; i + 4 <= count; i += 4) {
+		acc = vorrq_u32(acc, vld1q_u32(&ptr[i]));
+	}
+	uint32x2_t fold = vorr_u32(vget_low_u32(acc), vget_high_u32(acc));
+	bits = vget_lane_u32(fold, 0) | vget_lane_u32(fold, 1);
+#endif
+	for (; i < count; ++i) {
 		bits |= ptr[i];
 	}
+	return bits;
+}
 
+static u8 StencilBits5551(const u8 *ptr8, u32 numPixels) {
+	return (OrReduce32((const u32 *)ptr8, numPixels / 2) & 0x80008000) != 0 ? 1 : 0;
+}
+
+static u8 StencilBits4444(const u8 *ptr8, u32 numPixels) {
+	u32 bits = OrReduce32((const u32 *)ptr8, numPixels / 2);
 	return ((bits >> 12) & 0xF) | (bits >> 28);
 }
 
 static u8 StencilBits8888(const u8 *ptr8, u32 numPixels) {
-	const u32 *ptr = (const u32 *)ptr8;
-	u32 bits = 0;
-
-	for (u32 i = 0; i < numPixels; ++i) {
-		bits |= ptr[i];
-	}
-
-	return bits >> 24;
+	return OrReduce32((const u32 *)ptr8, numPixels) >> 24;
 }
 
 static bool CheckStencilBits(const u8 *src, const VirtualFramebuffer *dstBuffer, int &values, u8 &usedBits) {
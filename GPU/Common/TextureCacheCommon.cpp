@@ -101,6 +101,7 @@
 TextureCacheCommon::TextureCacheCommon(Draw::DrawContext *draw, Draw2D *draw2D)
 	: draw_(draw), draw2D_(draw2D), replacer_(draw) {
 	decimationCounter_ = TEXCACHE_DECIMATION_INTERVAL;
+	compatFlags_ = &PSP_CoreParameter().compat.flags();
 
 	// It's only possible to have 1KB of palette entries, although we allow 2KB in a hack.
 	clutBufRaw_ = (u32 *)AllocateAlignedMemory(2048, 16);
@@ -120,6 +121,13 @@ TextureCacheCommon::TextureCacheCommon(Draw::DrawContext *draw, Draw2D *draw2D)
 	tmpTexBufRearrange_.resize(512 * 512);   // 1MB
 
 	textureShaderCache_ = new TextureShaderCache(draw, draw2D_);
+
+	// High-res replacement packs can easily outgrow the age-based decimation on cards with
+	// limited memory, so when the backend can tell us how much device-local memory there is,
+	// cap the cache at a fraction of it and evict cost-aware. See Decimate().
+	if (draw_->GetDeviceCaps().deviceLocalMemoryBytes > 0) {
+		vramBudgetBytes_ = draw_->GetDeviceCaps().deviceLocalMemoryBytes / 4;
+	}
 }
 
 TextureCacheCommon::~TextureCacheCommon() {
@@ -133,6 +141,8 @@ TextureCacheCommon::~TextureCacheCommon() {
 void TextureCacheCommon::StartFrame() {
 	ForgetLastTexture();
 	textureShaderCache_->Decimate();
+	// Temp FBOs may get decimated and framebuffers destroyed, don't reuse across frames.
+	lastDepal_ = DepalResult{};
 	timesInvalidatedAllThisFrame_ = 0;
 	replacementTimeThisFrame_ = 0.0;
 
@@ -152,6 +162,23 @@ void TextureCacheCommon::StartFrame() {
 	} else {
 		Decimate(nullptr, false);
 	}
+
+	if (replacementReloadNextFrame_) {
+		replacementReloadNextFrame_ = false;
+		if (replacer_.ReloadChangedTextures() >= 0) {
+			// Rebuild the entries whose replacement got flushed (or that have none, in case
+			// a matching file was added), so they run through FindReplacement again. The
+			// unaffected majority of the cache is left alone.
+			for (auto &iter : cache_) {
+				TexCacheEntry *entry = iter.second.get();
+				if (!entry->replacedTexture || entry->replacedTexture->State() == ReplacementState::UNLOADED) {
+					entry->status |= TexCacheEntry::STATUS_FORCE_REBUILD;
+					entry->replacedTexture = nullptr;
+				}
+			}
+			ForgetLastTexture();
+		}
+	}
 }
 
 // Produces a signed 1.23.8 value.
@@ -501,10 +528,12 @@ TexCacheEntry *TextureCacheCommon::SetTexture() {
 
 				if (entry->framesUntilNextFullHash < diff) {
 					// Exponential backoff up to 512 frames.  Textures are often reused.
+					// Titles can tune the cap through perfhints.ini - longer for textures that
+					// never change in place, shorter if they animate and the backoff causes glitches.
 					if (entry->numFrames > 32) {
 						// Also, try to add some "randomness" to avoid rehashing several textures the same frame.
 						// textureName is unioned with texturePtr and vkTex so will work for the other backends.
-						entry->framesUntilNextFullHash = std::min(512, entry->numFrames) + (((intptr_t)(entry->textureName) >> 12) & 15);
+						entry->framesUntilNextFullHash = std::min(textureHashBackoffMax_, entry->numFrames) + (((intptr_t)(entry->textureName) >> 12) & 15);
 					} else {
 						entry->framesUntilNextFullHash = entry->numFrames;
 					}
@@ -724,7 +753,7 @@ bool TextureCacheCommon::GetBestFramebufferCandidate(const TextureDefinition &en
 	int bestRelevancy = -1;
 	size_t bestIndex = -1;
 
-	bool kzCompat = PSP_CoreParameter().compat.flags().SplitFramebufferMargin;
+	bool kzCompat = compatFlags_->SplitFramebufferMargin;
 
 	// We simply use the sequence counter as relevancy nowadays.
 	for (size_t i = 0; i < candidates.size(); i++) {
@@ -739,7 +768,7 @@ bool TextureCacheCommon::GetBestFramebufferCandidate(const TextureDefinition &en
 			relevancy -= 2;
 		}
 
-		if (candidate.match.xOffset != 0 && PSP_CoreParameter().compat.flags().DisallowFramebufferAtOffset) {
+		if (candidate.match.xOffset != 0 && compatFlags_->DisallowFramebufferAtOffset) {
 			continue;
 		}
 
@@ -818,8 +847,43 @@ void TextureCacheCommon::Decimate(TexCacheEntry *exceptThisOne, bool forcePressu
 		VERBOSE_LOG(Log::G3D, "Decimated texture cache, saved %d estimated bytes - now %d bytes", had - cacheSizeEstimate_, cacheSizeEstimate_);
 	}
 
+	// Second-chance, cost-aware pass: if we're over the VRAM budget even after the age-based
+	// pass, evict the cheapest-to-rebuild bytes first until we fit. Per-entry build cost is
+	// recorded when the texture is built, so expensive decodes and scales (replacement packs,
+	// scaler output) are the last to go.
+	if (vramBudgetBytes_ > 0 && (u64)cacheSizeEstimate_ > vramBudgetBytes_) {
+		struct Candidate {
+			u64 key;
+			float costPerByte;
+		};
+		std::vector<Candidate> candidates;
+		candidates.reserve(cache_.size());
+		for (const auto &iter : cache_) {
+			const TexCacheEntry *entry = iter.second.get();
+			// Never evict what's in use this frame.
+			if (entry == exceptThisOne || entry->lastFrame >= gpuStats.numFlips)
+				continue;
+			const u32 size = std::max(EstimateTexMemoryUsage(entry), (u32)1);
+			candidates.push_back(Candidate{ iter.first, entry->buildCostMs / (float)size });
+		}
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+			return a.costPerByte < b.costPerByte;
+		});
+		const u32 had = cacheSizeEstimate_;
+		ForgetLastTexture();
+		for (const Candidate &candidate : candidates) {
+			if ((u64)cacheSizeEstimate_ <= vramBudgetBytes_)
+				break;
+			DeleteTexture(cache_.find(candidate.key));
+		}
+		if (had != cacheSizeEstimate_) {
+			INFO_LOG(Log::G3D, "Texture cache over %d MB VRAM budget, evicted %d estimated bytes. %s",
+				(int)(vramBudgetBytes_ >> 20), had - cacheSizeEstimate_, GetCacheHistogramString().c_str());
+		}
+	}
+
 	// If enabled, we also need to clear the secondary cache.
-	if (PSP_CoreParameter().compat.flags().SecondaryTextureCache && (forcePressure || secondCacheSizeEstimate_ >= TEXCACHE_SECOND_MIN_PRESSURE)) {
+	if (compatFlags_->SecondaryTextureCache && (forcePressure || secondCacheSizeEstimate_ >= TEXCACHE_SECOND_MIN_PRESSURE)) {
 		const u32 had = secondCacheSizeEstimate_;
 
 		for (TexCache::iterator iter = secondCache_.begin(); iter != secondCache_.end(); ) {
@@ -844,6 +908,21 @@ void TextureCacheCommon::Decimate(TexCacheEntry *exceptThisOne, bool forcePressu
 	replacer_.Decimate(forcePressure ? ReplacerDecimateMode::FORCE_PRESSURE : ReplacerDecimateMode::NEW_FRAME);
 }
 
+std::string TextureCacheCommon::GetCacheHistogramString() const {
+	static const u32 classLimits[4] = { 64 * 1024, 256 * 1024, 1024 * 1024, 4 * 1024 * 1024 };
+	int counts[5]{};
+	for (const auto &iter : cache_) {
+		const u32 size = EstimateTexMemoryUsage(iter.second.get());
+		size_t c = 0;
+		while (c < ARRAY_SIZE(classLimits) && size >= classLimits[c])
+			c++;
+		counts[c]++;
+	}
+	return StringFromFormat("<64K: %d <256K: %d <1M: %d <4M: %d >=4M: %d (%d MB, budget %d MB)",
+		counts[0], counts[1], counts[2], counts[3], counts[4],
+		(int)(cacheSizeEstimate_ >> 20), (int)(vramBudgetBytes_ >> 20));
+}
+
 void TextureCacheCommon::DecimateVideos() {
 	for (auto iter = videos_.begin(); iter != videos_.end(); ) {
 		if (iter->flips + VIDEO_DECIMATE_AGE < gpuStats.numFlips) {
@@ -854,6 +933,18 @@ void TextureCacheCommon::DecimateVideos() {
 	}
 }
 
+// Returns the sequence number of the most recent tracked video upload covering texaddr, or -1 if none.
+int TextureCacheCommon::LastVideoUploadSeq(u32 texaddr) const {
+	texaddr &= 0x3FFFFFFF;
+	int seq = -1;
+	for (auto &info : videos_) {
+		if (texaddr >= info.addr && texaddr < info.addr + info.size && info.seq > seq) {
+			seq = info.seq;
+		}
+	}
+	return seq;
+}
+
 bool TextureCacheCommon::IsVideo(u32 texaddr) const {
 	texaddr &= 0x3FFFFFFF;
 	for (auto &info : videos_) {
@@ -882,6 +973,8 @@ void TextureCacheCommon::HandleTextureChange(TexCacheEntry *const entry, const c
 	if (entry->GetHashStatus() == TexCacheEntry::STATUS_RELIABLE) {
 		entry->SetHashStatus(TexCacheEntry::STATUS_HASHING);
 	}
+	// It changed, so it has to earn back its clean streak from scratch.
+	entry->numCleanChecks = 0;
 
 	// Also, mark any textures with the same address but different clut.  They need rechecking.
 	if (entry->cluthash != 0) {
@@ -905,6 +998,10 @@ void TextureCacheCommon::HandleTextureChange(TexCacheEntry *const entry, const c
 }
 
 void TextureCacheCommon::NotifyFramebuffer(VirtualFramebuffer *framebuffer, FramebufferNotification msg) {
+	if (msg == NOTIFY_FB_DESTROYED && lastDepal_.vfb == framebuffer) {
+		lastDepal_ = DepalResult{};
+	}
+
 	const u32 fb_addr = framebuffer->fb_address;
 	const u32 z_addr = framebuffer->z_address;
 
@@ -1044,7 +1141,7 @@ bool TextureCacheCommon::MatchFramebuffer(
 			(fb_format == GE_FORMAT_8888 && entry.format == GE_TFMT_CLUT32) ||
 			(fb_format != GE_FORMAT_8888 && entry.format == GE_TFMT_CLUT16) ||
 			(fb_format == GE_FORMAT_8888 && entry.format == GE_TFMT_CLUT8) ||
-			(fb_format == GE_FORMAT_5551 && entry.format == GE_TFMT_CLUT8 && PSP_CoreParameter().compat.flags().SOCOMClut8Replacement);
+			(fb_format == GE_FORMAT_5551 && entry.format == GE_TFMT_CLUT8 && compatFlags_->SOCOMClut8Replacement);
 
 		const int texBitsPerPixel = TextureFormatBitsPerPixel(entry.format);
 		const int byteOffset = texaddr - addr;
@@ -1061,7 +1158,7 @@ bool TextureCacheCommon::MatchFramebuffer(
 		} else if (byteOffset < 0) {
 			int texelOffset = 8 * byteOffset / texBitsPerPixel;
 			// We don't support negative Y offsets, and negative X offsets are only for the Killzone workaround.
-			if (texelOffset < -(int)entry.bufw || !PSP_CoreParameter().compat.flags().SplitFramebufferMargin) {
+			if (texelOffset < -(int)entry.bufw || !compatFlags_->SplitFramebufferMargin) {
 				return false;
 			}
 			matchInfo->xOffset = entry.bufw == 0 ? 0 : -(-texelOffset % (int)entry.bufw);
@@ -1083,7 +1180,7 @@ bool TextureCacheCommon::MatchFramebuffer(
 
 		// Trying to play it safe.  Below 0x04110000 is almost always framebuffers.
 		// TODO: Maybe we can reduce this check and find a better way above 0x04110000?
-		if (matchInfo->yOffset > MAX_SUBAREA_Y_OFFSET_SAFE && addr > 0x04110000 && !PSP_CoreParameter().compat.flags().AllowLargeFBTextureOffsets) {
+		if (matchInfo->yOffset > MAX_SUBAREA_Y_OFFSET_SAFE && addr > 0x04110000 && !compatFlags_->AllowLargeFBTextureOffsets) {
 			WARN_LOG_ONCE(subareaIgnored, Log::G3D, "Ignoring possible texturing from framebuffer at %08x +%dx%d / %dx%d", fb_address, matchInfo->xOffset, matchInfo->yOffset, framebuffer->width, framebuffer->height);
 			return false;
 		}
@@ -1150,7 +1247,7 @@ void TextureCacheCommon::SetTextureFramebuffer(const AttachCandidate &candidate)
 		// We need to force it, since we may have set it on a texture before attaching.
 		int texWidth = framebuffer->bufferWidth;
 		int texHeight = framebuffer->bufferHeight;
-		if (candidate.channel == RASTER_COLOR && gstate.getTextureFormat() == GE_TFMT_CLUT8 && framebuffer->fb_format == GE_FORMAT_5551 && PSP_CoreParameter().compat.flags().SOCOMClut8Replacement) {
+		if (candidate.channel == RASTER_COLOR && gstate.getTextureFormat() == GE_TFMT_CLUT8 && framebuffer->fb_format == GE_FORMAT_5551 && compatFlags_->SOCOMClut8Replacement) {
 			// See #16210. UV must be adjusted as if the texture was twice the width.
 			texWidth *= 2.0f;
 		}
@@ -1296,12 +1393,19 @@ void TextureCacheCommon::NotifyConfigChanged() {
 
 	standardScaleFactor_ = scaleFactor;
 
+	// Re-cache the compat-derived values, in case a different game was loaded.
+	compatFlags_ = &PSP_CoreParameter().compat.flags();
+	int backoffMax = PSP_CoreParameter().compat.hints().TextureHashBackoffMax;
+	textureHashBackoffMax_ = backoffMax > 0 ? backoffMax : 512;
+	int reliableAfter = PSP_CoreParameter().compat.hints().TextureHashReliableAfter;
+	textureHashReliableAfter_ = reliableAfter != 0 ? reliableAfter : 8;
+
 	replacer_.NotifyConfigChanged();
 }
 
 void TextureCacheCommon::NotifyWriteFormattedFromMemory(u32 addr, int size, int width, GEBufferFormat fmt) {
 	addr &= 0x3FFFFFFF;
-	videos_.push_back({ addr, (u32)size, gpuStats.numFlips });
+	videos_.push_back({ addr, (u32)size, gpuStats.numFlips, ++videoUploadSeq_ });
 }
 
 void TextureCacheCommon::LoadClut(u32 clutAddr, u32 loadBytes) {
@@ -1360,7 +1464,7 @@ void TextureCacheCommon::LoadClut(u32 clutAddr, u32 loadBytes) {
 				// the framebuffer with the smallest offset. This is yet another framebuffer matching
 				// loop with its own rules, eventually we'll probably want to do something
 				// more systematic.
-				bool okAge = !PSP_CoreParameter().compat.flags().LoadCLUTFromCurrentFrameOnly || framebuffer->last_frame_render == gpuStats.numFlips;  // Here we can try heuristics.
+				bool okAge = !compatFlags_->LoadCLUTFromCurrentFrameOnly || framebuffer->last_frame_render == gpuStats.numFlips;  // Here we can try heuristics.
 				if (matchRange && !inMargin && offset < (int)clutRenderOffset_) {
 					if (okAge) {
 						WARN_LOG_N_TIMES(clutfb, 5, Log::G3D, "Detected LoadCLUT(%d bytes) from framebuffer %08x (%s), last render %d frames ago, byte offset %d, pixel offset %d",
@@ -1423,7 +1527,7 @@ void TextureCacheCommon::LoadClut(u32 clutAddr, u32 loadBytes) {
 	// It's possible for a game to load CLUT outside valid memory without crashing, should result in zeroes.
 	u32 bytes = Memory::ValidSize(clutAddr, loadBytes);
 	_assert_(bytes <= 2048);
-	bool performDownload = PSP_CoreParameter().compat.flags().AllowDownloadCLUT;
+	bool performDownload = compatFlags_->AllowDownloadCLUT;
 	if (GPURecord::IsActive())
 		performDownload = true;
 	if (clutRenderAddress_ != 0xFFFFFFFF && performDownload) {
@@ -1766,13 +1870,22 @@ CheckAlphaResult TextureCacheCommon::DecodeTextureLevel(u8 *out, int outPitch, G
 		const bool mipmapShareClut = gstate.isClutSharedForMipmaps();
 		const int clutSharingOffset = mipmapShareClut ? 0 : level * 16;
 
-		if (swizzled) {
+		// The generic deindex branches below can read the swizzled blocks directly
+		// (fused deswizzle+CLUT, one pass). The remaining branches still want linear
+		// data and deswizzle up front.
+		bool fused = swizzled && w <= bufw;
+		auto deswizzle4 = [&]() {
 			tmpTexBuf32_.resize(bufw * ((h + 7) & ~7));
 			UnswizzleFromMem(tmpTexBuf32_.data(), bufw / 2, texptr, bufw, h, 0);
 			texptr = (u8 *)tmpTexBuf32_.data();
-		}
+			fused = false;
+		};
+		if (swizzled && !fused)
+			deswizzle4();
 
 		if (toClut8) {
+			if (fused)
+				deswizzle4();
 			// We just need to expand from 4 to 8 bits.
 			for (int y = 0; y < h; ++y) {
 				Expand4To8Bits((u8 *)out + outPitch * y, texptr + (bufw * y) / 2, w);
@@ -1789,6 +1902,8 @@ CheckAlphaResult TextureCacheCommon::DecodeTextureLevel(u8 *out, int outPitch, G
 			// The w > 1 check is to not need a case that handles a single pixel
 			// in DeIndexTexture4Optimal<u16>.
 			if (clutAlphaLinear_ && mipmapShareClut && !expandTo32bit && w >= 4) {
+				if (fused)
+					deswizzle4();
 				// We don't bother with fullalpha here (clutAlphaLinear_)
 				// Here, reverseColors means the CLUT is already reversed.
 				if (reverseColors) {
@@ -1813,15 +1928,23 @@ CheckAlphaResult TextureCacheCommon::DecodeTextureLevel(u8 *out, int outPitch, G
 						ConvertFormatToRGBA8888(clutformat, expandClut_, clut, 512);
 					}
 					fullAlphaMask = 0xFF000000;
-					for (int y = 0; y < h; ++y) {
-						DeIndexTexture4<u32>((u32 *)(out + outPitch * y), texptr + (bufw * y) / 2, w, expandClut_, &alphaSum);
+					if (fused) {
+						DeIndexTexture4Swizzled<u32>((u32 *)out, outPitch, texptr, bufw, w, h, expandClut_, &alphaSum);
+					} else {
+						for (int y = 0; y < h; ++y) {
+							DeIndexTexture4<u32>((u32 *)(out + outPitch * y), texptr + (bufw * y) / 2, w, expandClut_, &alphaSum);
+						}
 					}
 				} else {
 					// If we're reversing colors, the CLUT was already reversed, no special handling needed.
 					const u16 *clut = GetCurrentClut<u16>() + clutSharingOffset;
 					fullAlphaMask = ClutFormatToFullAlpha(clutformat, reverseColors);
-					for (int y = 0; y < h; ++y) {
-						DeIndexTexture4<u16>((u16 *)(out + outPitch * y), texptr + (bufw * y) / 2, w, clut, &alphaSum);
+					if (fused) {
+						DeIndexTexture4Swizzled<u16>((u16 *)out, outPitch, texptr, bufw, w, h, clut, &alphaSum);
+					} else {
+						for (int y = 0; y < h; ++y) {
+							DeIndexTexture4<u16>((u16 *)(out + outPitch * y), texptr + (bufw * y) / 2, w, clut, &alphaSum);
+						}
 					}
 				}
 			}
@@ -1837,8 +1960,12 @@ CheckAlphaResult TextureCacheCommon::DecodeTextureLevel(u8 *out, int outPitch, G
 		{
 			const u32 *clut = GetCurrentClut<u32>() + clutSharingOffset;
 			fullAlphaMask = 0xFF000000;
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture4<u32>((u32 *)(out + outPitch * y), texptr + (bufw * y) / 2, w, clut, &alphaSum);
+			if (fused) {
+				DeIndexTexture4Swizzled<u32>((u32 *)out, outPitch, texptr, bufw, w, h, clut, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture4<u32>((u32 *)(out + outPitch * y), texptr + (bufw * y) / 2, w, clut, &alphaSum);
+				}
 			}
 		}
 		break;
@@ -1992,10 +2119,15 @@ CheckAlphaResult TextureCacheCommon::ReadIndexedTex(u8 *out, int outPitch, int l
 	int w = gstate.getTextureWidth(level);
 	int h = gstate.getTextureHeight(level);
 
-	if (gstate.isTextureSwizzled()) {
+	// Normally we deindex straight from the swizzled data (fused), saving a pass over
+	// the texture and the bounce buffer. Only if a row is wider than the stride do we
+	// need linear data, since such rows run over into the next one.
+	bool fused = gstate.isTextureSwizzled();
+	if (fused && w > bufw) {
 		tmpTexBuf32_.resize(bufw * ((h + 7) & ~7));
 		UnswizzleFromMem(tmpTexBuf32_.data(), bufw * bytesPerIndex, texptr, bufw, h, bytesPerIndex);
 		texptr = (u8 *)tmpTexBuf32_.data();
+		fused = false;
 	}
 
 	// Misshitsu no Sacrifice has separate CLUT data, this is a hack to allow it.
@@ -2032,20 +2164,32 @@ CheckAlphaResult TextureCacheCommon::ReadIndexedTex(u8 *out, int outPitch, int l
 	{
 		switch (bytesPerIndex) {
 		case 1:
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture((u16 *)(out + outPitch * y), (const u8 *)texptr + bufw * y, w, clut16, &alphaSum);
+			if (fused) {
+				DeIndexTextureSwizzled<u8>((u16 *)out, outPitch, texptr, bufw, w, h, clut16, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture((u16 *)(out + outPitch * y), (const u8 *)texptr + bufw * y, w, clut16, &alphaSum);
+				}
 			}
 			break;
 
 		case 2:
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture((u16 *)(out + outPitch * y), (const u16_le *)texptr + bufw * y, w, clut16, &alphaSum);
+			if (fused) {
+				DeIndexTextureSwizzled<u16_le>((u16 *)out, outPitch, texptr, bufw, w, h, clut16, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture((u16 *)(out + outPitch * y), (const u16_le *)texptr + bufw * y, w, clut16, &alphaSum);
+				}
 			}
 			break;
 
 		case 4:
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture((u16 *)(out + outPitch * y), (const u32_le *)texptr + bufw * y, w, clut16, &alphaSum);
+			if (fused) {
+				DeIndexTextureSwizzled<u32_le>((u16 *)out, outPitch, texptr, bufw, w, h, clut16, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture((u16 *)(out + outPitch * y), (const u32_le *)texptr + bufw * y, w, clut16, &alphaSum);
+				}
 			}
 			break;
 		}
@@ -2057,20 +2201,32 @@ CheckAlphaResult TextureCacheCommon::ReadIndexedTex(u8 *out, int outPitch, int l
 
 		switch (bytesPerIndex) {
 		case 1:
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture((u32 *)(out + outPitch * y), (const u8 *)texptr + bufw * y, w, clut32, &alphaSum);
+			if (fused) {
+				DeIndexTextureSwizzled<u8>((u32 *)out, outPitch, texptr, bufw, w, h, clut32, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture((u32 *)(out + outPitch * y), (const u8 *)texptr + bufw * y, w, clut32, &alphaSum);
+				}
 			}
 			break;
 
 		case 2:
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture((u32 *)(out + outPitch * y), (const u16_le *)texptr + bufw * y, w, clut32, &alphaSum);
+			if (fused) {
+				DeIndexTextureSwizzled<u16_le>((u32 *)out, outPitch, texptr, bufw, w, h, clut32, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture((u32 *)(out + outPitch * y), (const u16_le *)texptr + bufw * y, w, clut32, &alphaSum);
+				}
 			}
 			break;
 
 		case 4:
-			for (int y = 0; y < h; ++y) {
-				DeIndexTexture((u32 *)(out + outPitch * y), (const u32_le *)texptr + bufw * y, w, clut32, &alphaSum);
+			if (fused) {
+				DeIndexTextureSwizzled<u32_le>((u32 *)out, outPitch, texptr, bufw, w, h, clut32, &alphaSum);
+			} else {
+				for (int y = 0; y < h; ++y) {
+					DeIndexTexture((u32 *)(out + outPitch * y), (const u32_le *)texptr + bufw * y, w, clut32, &alphaSum);
+				}
 			}
 			break;
 		}
@@ -2155,7 +2311,9 @@ void TextureCacheCommon::ApplyTexture() {
 	// Okay, now actually rebuild the texture if needed.
 	if (nextNeedsRebuild_) {
 		_assert_(!entry->texturePtr);
+		double buildStart = time_now_d();
 		BuildTexture(entry);
+		entry->buildCostMs = (float)((time_now_d() - buildStart) * 1000.0);
 		ForgetLastTexture();
 	}
 
@@ -2358,36 +2516,58 @@ void TextureCacheCommon::ApplyTextureFramebuffer(VirtualFramebuffer *framebuffer
 			gstate_c.Dirty(DIRTY_TEXTURE_PARAMS);
 		}
 
-		Draw::Framebuffer *depalFBO = framebufferManager_->GetTempFBO(TempFBO::DEPAL, depalWidth, framebuffer->renderHeight);
-		draw_->BindTexture(0, nullptr);
-		draw_->BindTexture(1, nullptr);
-		draw_->BindFramebufferAsRenderTarget(depalFBO, { Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE }, "Depal");
-		draw_->InvalidateFramebuffer(Draw::FB_INVALIDATION_STORE, Draw::FB_DEPTH_BIT | Draw::FB_STENCIL_BIT);
-		draw_->SetScissorRect(u1, v1, u2 - u1, v2 - v1);
-		Draw::Viewport viewport{ 0.0f, 0.0f, (float)depalWidth, (float)framebuffer->renderHeight, 0.0f, 1.0f };
-		draw_->SetViewport(viewport);
+		// UI-heavy games often run dozens of identical depal passes back to back, so if
+		// nothing relevant changed since the last pass this frame, just rebind its result.
+		const bool cacheable = !depth && clutRenderAddress_ == 0xFFFFFFFF &&
+			framebuffer != framebufferManager_->GetCurrentRenderVFB();
+		const bool reuseLast = cacheable && lastDepal_.fbo != nullptr &&
+			lastDepal_.vfb == framebuffer && lastDepal_.colorBindSeq == framebuffer->colorBindSeq &&
+			lastDepal_.clutHash == clutHash_ && lastDepal_.clutMode == clutMode &&
+			lastDepal_.texFormat == texFormat &&
+			lastDepal_.u1 == u1 && lastDepal_.v1 == v1 && lastDepal_.u2 == u2 && lastDepal_.v2 == v2;
 
-		draw_->BindFramebufferAsTexture(framebuffer->fbo, 0, depth ? Draw::FB_DEPTH_BIT : Draw::FB_COLOR_BIT, Draw::ALL_LAYERS);
-		if (clutRenderAddress_ == 0xFFFFFFFF) {
-			draw_->BindTexture(1, clutTexture.texture);
+		Draw::Framebuffer *depalFBO;
+		if (reuseLast) {
+			depalFBO = lastDepal_.fbo;
 		} else {
-			draw_->BindFramebufferAsTexture(dynamicClutFbo_, 1, Draw::FB_COLOR_BIT, 0);
-		}
-		Draw::SamplerState *nearest = textureShaderCache_->GetSampler(false);
-		Draw::SamplerState *clutSampler = textureShaderCache_->GetSampler(smoothedDepal);
-		draw_->BindSamplerStates(0, 1, &nearest);
-		draw_->BindSamplerStates(1, 1, &clutSampler);
+			depalFBO = framebufferManager_->GetTempFBO(TempFBO::DEPAL, depalWidth, framebuffer->renderHeight);
+			draw_->BindTexture(0, nullptr);
+			draw_->BindTexture(1, nullptr);
+			draw_->BindFramebufferAsRenderTarget(depalFBO, { Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE }, "Depal");
+			draw_->InvalidateFramebuffer(Draw::FB_INVALIDATION_STORE, Draw::FB_DEPTH_BIT | Draw::FB_STENCIL_BIT);
+			draw_->SetScissorRect(u1, v1, u2 - u1, v2 - v1);
+			Draw::Viewport viewport{ 0.0f, 0.0f, (float)depalWidth, (float)framebuffer->renderHeight, 0.0f, 1.0f };
+			draw_->SetViewport(viewport);
+
+			draw_->BindFramebufferAsTexture(framebuffer->fbo, 0, depth ? Draw::FB_DEPTH_BIT : Draw::FB_COLOR_BIT, Draw::ALL_LAYERS);
+			if (clutRenderAddress_ == 0xFFFFFFFF) {
+				draw_->BindTexture(1, clutTexture.texture);
+			} else {
+				draw_->BindFramebufferAsTexture(dynamicClutFbo_, 1, Draw::FB_COLOR_BIT, 0);
+			}
+			Draw::SamplerState *nearest = textureShaderCache_->GetSampler(false);
+			Draw::SamplerState *clutSampler = textureShaderCache_->GetSampler(smoothedDepal);
+			draw_->BindSamplerStates(0, 1, &nearest);
+			draw_->BindSamplerStates(1, 1, &clutSampler);
+
+			draw2D_->Blit(textureShader, u1, v1, u2, v2, u1, v1, u2, v2, framebuffer->renderWidth, framebuffer->renderHeight, depalWidth, framebuffer->renderHeight, false, framebuffer->renderScaleFactor);
+
+			gpuStats.numDepal++;
 
-		draw2D_->Blit(textureShader, u1, v1, u2, v2, u1, v1, u2, v2, framebuffer->renderWidth, framebuffer->renderHeight, depalWidth, framebuffer->renderHeight, false, framebuffer->renderScaleFactor);
+			if (cacheable) {
+				lastDepal_ = DepalResult{ depalFBO, framebuffer, framebuffer->colorBindSeq, clutHash_, clutMode, texFormat, u1, v1, u2, v2 };
+			} else {
+				// Something else now owns the temp FBO contents.
+				lastDepal_ = DepalResult{};
+			}
 
-		gpuStats.numDepal++;
+			draw_->BindTexture(0, nullptr);
+			framebufferManager_->RebindFramebuffer("ApplyTextureFramebuffer");
+		}
 
 		gstate_c.curTextureWidth = texWidth;
 		gstate_c.Dirty(DIRTY_UVSCALEOFFSET);
 
-		draw_->BindTexture(0, nullptr);
-		framebufferManager_->RebindFramebuffer("ApplyTextureFramebuffer");
-
 		draw_->BindFramebufferAsTexture(depalFBO, 0, Draw::FB_COLOR_BIT, Draw::ALL_LAYERS);
 		BoundFramebufferTexture();
 
@@ -2465,6 +2645,8 @@ void TextureCacheCommon::ApplyTextureDepal(TexCacheEntry *entry) {
 	}
 
 	Draw::Framebuffer *depalFBO = framebufferManager_->GetTempFBO(TempFBO::DEPAL, texWidth, texHeight);
+	// This may overwrite the last framebuffer depal result if the sizes match.
+	lastDepal_ = DepalResult{};
 	draw_->BindTexture(0, nullptr);
 	draw_->BindTexture(1, nullptr);
 	draw_->BindFramebufferAsRenderTarget(depalFBO, { Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE }, "Depal");
@@ -2558,6 +2740,25 @@ bool TextureCacheCommon::CheckFullHash(TexCacheEntry *entry, bool &doDelete) {
 		return false;
 	}
 
+	if (isVideo) {
+		// Video frames only arrive through the tracked HLE upload path, so the upload
+		// sequence tells us everything the pixel hash would: no new upload means
+		// unchanged, a new upload means the mpeg code just replaced the pixels. Either
+		// way there's no reason to read the buffer back - these are often large (512x512)
+		// and would otherwise get fully hashed once per decoded frame.
+		int uploadSeq = LastVideoUploadSeq(entry->addr);
+		if (uploadSeq >= 0) {
+			if (uploadSeq == entry->lastVideoUploadSeq) {
+				return true;
+			}
+			entry->lastVideoUploadSeq = uploadSeq;
+			// Fold the sequence into the stored hash so this entry doesn't accidentally
+			// match anything (like a secondary cache entry) once real hashing resumes.
+			entry->fullhash = (entry->fullhash + 0xA535A535) * 11 + ((u32)uploadSeq & 0xFF);
+			return false;
+		}
+	}
+
 	u32 fullhash;
 	{
 		PROFILE_THIS_SCOPE("texhash");
@@ -2570,6 +2771,16 @@ bool TextureCacheCommon::CheckFullHash(TexCacheEntry *entry, bool &doDelete) {
 				// Reset to STATUS_HASHING.
 				entry->SetHashStatus(TexCacheEntry::STATUS_HASHING);
 				entry->status &= ~TexCacheEntry::STATUS_CHANGE_FREQUENT;
+			} else if (entry->GetHashStatus() == TexCacheEntry::STATUS_HASHING && textureHashReliableAfter_ > 0) {
+				// Every full rehash that finds no change is evidence the texture is
+				// static. After enough consecutive clean checks we stop hashing it
+				// entirely - Invalidate() drops it back to STATUS_HASHING if the
+				// memory is ever written, and the minihash still guards every bind.
+				if (entry->numCleanChecks < 0xFFFF)
+					entry->numCleanChecks++;
+				if (entry->numCleanChecks >= textureHashReliableAfter_) {
+					entry->SetHashStatus(TexCacheEntry::STATUS_RELIABLE);
+				}
 			}
 		} else if (entry->numFrames > TEXCACHE_FRAME_CHANGE_FREQUENT_REGAIN_TRUST) {
 			entry->status &= ~TexCacheEntry::STATUS_CHANGE_FREQUENT;
@@ -2579,7 +2790,7 @@ bool TextureCacheCommon::CheckFullHash(TexCacheEntry *entry, bool &doDelete) {
 	}
 
 	// Don't give up just yet.  Let's try the secondary cache if it's been invalidated before.
-	if (PSP_CoreParameter().compat.flags().SecondaryTextureCache) {
+	if (compatFlags_->SecondaryTextureCache) {
 		// Don't forget this one was unreliable (in case we match a secondary entry.)
 		entry->status |= TexCacheEntry::STATUS_UNRELIABLE;
 
@@ -2674,6 +2885,7 @@ void TextureCacheCommon::Invalidate(u32 addr, int size, GPUInvalidationType type
 			if (entry->GetHashStatus() == TexCacheEntry::STATUS_RELIABLE) {
 				entry->SetHashStatus(TexCacheEntry::STATUS_HASHING);
 			}
+			entry->numCleanChecks = 0;
 			if (type == GPU_INVALIDATE_FORCE) {
 				// Just random values to force the hash not to match.
 				entry->fullhash = (entry->fullhash ^ 0x12345678) + 13;
@@ -2713,6 +2925,7 @@ void TextureCacheCommon::InvalidateAll(GPUInvalidationType /*unused*/) {
 		if (iter->second->GetHashStatus() == TexCacheEntry::STATUS_RELIABLE) {
 			iter->second->SetHashStatus(TexCacheEntry::STATUS_HASHING);
 		}
+		iter->second->numCleanChecks = 0;
 		iter->second->invalidHint++;
 	}
 }
@@ -2721,6 +2934,10 @@ void TextureCacheCommon::ClearNextFrame() {
 	clearCacheNextFrame_ = true;
 }
 
+void TextureCacheCommon::ReplacementReloadNextFrame() {
+	replacementReloadNextFrame_ = true;
+}
+
 std::string AttachCandidate::ToString() const {
 	return StringFromFormat("[%s seq:%d rel:%d C:%08x/%d(%s) Z:%08x/%d X:%d Y:%d reint: %s]",
 		RasterChannelToString(this->channel),
@@ -2843,7 +3060,7 @@ bool TextureCacheCommon::PrepareBuildTexture(BuildTexturePlan &plan, TexCacheEnt
 		}
 	}
 
-	if (PSP_CoreParameter().compat.flags().ForceLowerResolutionForEffectsOn && gstate.FrameBufStride() < 0x1E0) {
+	if (compatFlags_->ForceLowerResolutionForEffectsOn && gstate.FrameBufStride() < 0x1E0) {
 		// A bit of an esoteric workaround - force off upscaling for static textures that participate directly in small-resolution framebuffer effects.
 		// This fixes the water in Outrun/DiRT 2 with upscaling enabled.
 		plan.scaleFactor = 1;
@@ -2855,6 +3072,15 @@ bool TextureCacheCommon::PrepareBuildTexture(BuildTexturePlan &plan, TexCacheEnt
 		plan.scaleFactor = 1;
 	}
 
+	// A slow scaler on a texture bigger than the whole per-frame budget hitches badly the
+	// first time the texture shows up (5x xBRZ on a 512x512 takes tens of ms). Upload it at
+	// base resolution now and let the deferred STATUS_TO_SCALE path upgrade it a frame later,
+	// the same way we handle frequently-changing textures.
+	if (entry->numFrames == 0 && plan.scaleFactor != 1 && plan.slowScaler && plan.w * plan.h > TEXCACHE_MAX_TEXELS_SCALED) {
+		entry->status |= TexCacheEntry::STATUS_TO_SCALE;
+		plan.scaleFactor = 1;
+	}
+
 	if (plan.scaleFactor != 1) {
 		if (texelsScaledThisFrame_ >= TEXCACHE_MAX_TEXELS_SCALED && plan.slowScaler) {
 			entry->status |= TexCacheEntry::STATUS_TO_SCALE;
@@ -49,6 +49,7 @@ enum FramebufferNotification {
 struct VirtualFramebuffer;
 class TextureReplacer;
 class ShaderManagerCommon;
+struct CompatFlags;
 
 enum class TexDecodeFlags {
 	EXPAND32 = 1,
@@ -190,10 +191,18 @@ struct TexCacheEntry {
 	int lastFrame;
 	int numFrames;
 	int numInvalidated;
+	// Sequence number of the video upload we last saw, see CheckFullHash.
+	int lastVideoUploadSeq;
 	u32 framesUntilNextFullHash;
 	u32 fullhash;
 	u32 cluthash;
 	u16 maxSeenV;
+	// Consecutive full rehashes that found no change. Enough of them promotes the
+	// entry to STATUS_RELIABLE, see CheckFullHash.
+	u16 numCleanChecks;
+	// Wall time spent in the last BuildTexture, in ms. Expensive builds (replacements,
+	// scaler output) get to stay in the cache longer under VRAM pressure, see Decimate.
+	float buildCostMs;
 	ReplacedTexture *replacedTexture;
 
 	TexStatus GetHashStatus() {
@@ -349,6 +358,7 @@ public:
 	void Invalidate(u32 addr, int size, GPUInvalidationType type);
 	void InvalidateAll(GPUInvalidationType type);
 	void ClearNextFrame();
+	void ReplacementReloadNextFrame();
 
 	TextureShaderCache *GetTextureShaderCache() { return textureShaderCache_; }
 
@@ -366,6 +376,15 @@ public:
 		return cache_.size();
 	}
 
+	// Debug histogram of the cache contents by estimated size class, for the stats overlay.
+	std::string GetCacheHistogramString() const;
+
+	// Overrides the default VRAM budget (a quarter of device-local memory). 0 disables
+	// budget-driven eviction, leaving only the age-based decimation.
+	void SetVRAMBudget(u64 bytes) {
+		vramBudgetBytes_ = bytes;
+	}
+
 	bool IsFakeMipmapChange() {
 		return PSP_CoreParameter().compat.flags().FakeMipmapChange && gstate.getTexLevelMode() == GE_TEXLEVEL_MODE_CONST;
 	}
@@ -435,6 +454,7 @@ protected:
 
 	void DecimateVideos();
 	bool IsVideo(u32 texaddr) const;
+	int LastVideoUploadSeq(u32 texaddr) const;
 
 	static CheckAlphaResult CheckCLUTAlpha(const uint8_t *pixelData, GEPaletteFormat clutFmt, int w);
 
@@ -483,6 +503,7 @@ protected:
 	ShaderManagerCommon *shaderManager_;
 
 	bool clearCacheNextFrame_ = false;
+	bool replacementReloadNextFrame_ = false;
 	bool lowMemoryMode_ = false;
 
 	int decimationCounter_;
@@ -494,6 +515,7 @@ protected:
 
 	TexCache cache_;
 	u32 cacheSizeEstimate_ = 0;
+	u64 vramBudgetBytes_ = 0;  // 0 = no budget enforcement.
 
 	TexCache secondCache_;
 	u32 secondCacheSizeEstimate_ = 0;
@@ -502,8 +524,10 @@ protected:
 		u32 addr;
 		u32 size;
 		int flips;
+		int seq;
 	};
 	std::vector<VideoInfo> videos_;
+	int videoUploadSeq_ = 0;
 
 	AlignedVector<u32, 16> tmpTexBuf32_;
 	AlignedVector<u32, 16> tmpTexBufRearrange_;
@@ -535,9 +559,31 @@ protected:
 	Draw::Framebuffer *dynamicClutTemp_ = nullptr;
 	Draw::Framebuffer *dynamicClutFbo_ = nullptr;
 
+	// Result of the most recent depal blit, so back-to-back draws with the same
+	// framebuffer and CLUT can rebind it instead of redoing the pass.
+	struct DepalResult {
+		Draw::Framebuffer *fbo = nullptr;
+		VirtualFramebuffer *vfb = nullptr;
+		int colorBindSeq = 0;
+		u32 clutHash = 0;
+		u32 clutMode = 0;
+		GETextureFormat texFormat = GE_TFMT_5650;
+		float u1 = 0.0f;
+		float v1 = 0.0f;
+		float u2 = 0.0f;
+		float v2 = 0.0f;
+	};
+	DepalResult lastDepal_;
+
 	int standardScaleFactor_;
 	int shaderScaleFactor_ = 0;
 
+	// Cached from compat at construction and NotifyConfigChanged(), so the per-bind
+	// paths don't pay a PSP_CoreParameter() call per flag check.
+	const CompatFlags *compatFlags_ = nullptr;
+	int textureHashBackoffMax_ = 512;
+	int textureHashReliableAfter_ = 8;
+
 	const char *nextChangeReason_;
 	bool nextNeedsRehash_;
 	bool nextNeedsChange_;
@@ -19,6 +19,8 @@
 
 #include "ppsspp_config.h"
 
+#include <algorithm>
+
 #include "Common/Common.h"
 #include "Common/Swap.h"
 #include "Core/MemMap.h"
@@ -224,6 +226,39 @@ inline void DeIndexTexture4OptimalRev(u16 *dest, const u8 *indexed, int length,
 	}
 }
 
+// Fused deswizzle + CLUT apply. The swizzled layout is blocks of 16 bytes by 8 rows,
+// so each texel row consists of contiguous 16-byte chunks spaced 128 bytes apart -
+// we can walk them directly and deindex in the same pass, skipping the separate
+// unswizzle step and its bounce buffer. Requires w <= bufw (the normal case), so a
+// row never runs past its own chunks.
+template <typename IndexT, typename ClutT>
+inline void DeIndexTextureSwizzled(/*WRITEONLY*/ ClutT *dest, int outPitch, const u8 *swizzled, int bufw, int w, int h, const ClutT *clut, u32 *outAlphaSum) {
+	const int rowWidth = bufw * (int)sizeof(IndexT);
+	const int chunkTexels = 16 / (int)sizeof(IndexT);
+	for (int y = 0; y < h; ++y) {
+		ClutT *destRow = (ClutT *)((u8 *)dest + outPitch * y);
+		const u8 *rowBase = swizzled + (y & ~7) * rowWidth + (y & 7) * 16;
+		for (int x = 0; x < w; x += chunkTexels) {
+			const IndexT *indexed = (const IndexT *)(rowBase + (x / chunkTexels) * 128);
+			DeIndexTexture(destRow + x, indexed, std::min(chunkTexels, w - x), clut, outAlphaSum);
+		}
+	}
+}
+
+// Same, for 4-bit indices. A 16-byte chunk holds 32 texels.
+template <typename ClutT>
+inline void DeIndexTexture4Swizzled(/*WRITEONLY*/ ClutT *dest, int outPitch, const u8 *swizzled, int bufw, int w, int h, const ClutT *clut, u32 *outAlphaSum) {
+	const int rowWidth = bufw / 2;
+	for (int y = 0; y < h; ++y) {
+		ClutT *destRow = (ClutT *)((u8 *)dest + outPitch * y);
+		const u8 *rowBase = swizzled + (y & ~7) * rowWidth + (y & 7) * 16;
+		for (int x = 0; x < w; x += 32) {
+			const u8 *indexed = rowBase + (x >> 5) * 128;
+			DeIndexTexture4(destRow + x, indexed, std::min(32, w - x), clut, outAlphaSum);
+		}
+	}
+}
+
 template <typename ClutT>
 inline void DeIndexTexture4(ClutT *dest, const u32 texaddr, int length, const ClutT *clut) {
 	const u8 *indexed = (const u8 *) Memory::GetPointer(texaddr);
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <ctime>
 #include <memory>
 #include <png.h>
 
@@ -51,6 +52,12 @@
 
 static const std::string INI_FILENAME = "textures.ini";
 static const std::string ZIP_FILENAME = "textures.zip";
+static const std::string PREFETCH_FILENAME = "prefetch.txt";
+
+// Only prefetch replacements that were first used within this long after pack load,
+// they're the ones that would otherwise pop in during the opening moments.
+static const double PREFETCH_WINDOW_SECONDS = 30.0;
+static const size_t MAX_PREFETCH_LOG = 4096;
 static const std::string NEW_TEXTURE_DIR = "new/";
 static const int VERSION = 1;
 static const double MAX_CACHE_SIZE = 4.0;
@@ -69,6 +76,7 @@ TextureReplacer::TextureReplacer(Draw::DrawContext *draw) {
 }
 
 TextureReplacer::~TextureReplacer() {
+	SavePrefetchLog();
 	for (auto iter : levelCache_) {
 		delete iter.second;
 	}
@@ -76,6 +84,9 @@ TextureReplacer::~TextureReplacer() {
 }
 
 void TextureReplacer::NotifyConfigChanged() {
+	// basePath_ may be about to change, flush the log for the old pack first.
+	SavePrefetchLog();
+
 	gameID_ = g_paramSFO.GetDiscID();
 
 	bool wasReplaceEnabled = replaceEnabled_;
@@ -119,6 +130,11 @@ bool TextureReplacer::LoadIni() {
 	hashranges_.clear();
 	filtering_.clear();
 	reducehashranges_.clear();
+	rootHashFiles_.clear();
+	rootHashFilesValid_ = false;
+	prefetchLog_.clear();
+	prefetchSeen_.clear();
+	prefetchLogDirty_ = false;
 
 	allowVideo_ = false;
 	ignoreAddress_ = false;
@@ -190,13 +206,31 @@ bool TextureReplacer::LoadIni() {
 			}
 
 			ComputeAliasMap(filenameMap);
+
+			for (const auto &pair : filenameMap) {
+				rootHashFiles_.insert(pair.first);
+			}
+			rootHashFilesValid_ = true;
+		}
+	}
+
+	if (iniLoaded) {
+		// Also index the hash-named files in the root (the no-ini path above did this as part
+		// of building the alias map). With the index, FindReplacement can answer misses for
+		// textures without an alias through a single hash probe, no filesystem checks.
+		std::map<ReplacementCacheKey, std::map<int, std::string>> filenameMap;
+		ScanForHashNamedFiles(dir, filenameMap);
+		for (const auto &pair : filenameMap) {
+			rootHashFiles_.insert(pair.first);
 		}
+		rootHashFilesValid_ = true;
 	}
 
 	auto gr = GetI18NCategory(I18NCat::GRAPHICS);
 	g_OSD.Show(OSDType::MESSAGE_SUCCESS, gr->T("Texture replacement pack activated"), 2.0f);
 
 	vfs_ = dir;
+	packLoadUnixTime_ = (uint64_t)time(nullptr);
 
 	// If we have stuff loaded from before, need to update the vfs pointers to avoid
 	// crash on exit. The actual problem is that we tend to call LoadIni a little too much...
@@ -210,6 +244,12 @@ bool TextureReplacer::LoadIni() {
 		INFO_LOG(Log::G3D, "Texture pack activated from '%s'", basePath_.c_str());
 	}
 
+	// Start background loads of the replacements the game needed early last session,
+	// so they're ready before their first draw instead of popping in.
+	prefetchStartTime_ = time_now_d();
+	LoadPrefetchLog();
+	PrefetchFromLog();
+
 	// The ini doesn't have to exist for the texture directory or zip to be valid.
 	return true;
 }
@@ -551,6 +591,66 @@ u32 TextureReplacer::ComputeHash(u32 addr, int bufw, int w, int h, bool swizzled
 	}
 }
 
+void TextureReplacer::LoadPrefetchLog() {
+	std::string contents;
+	if (!File::ReadTextFileToString(basePath_ / PREFETCH_FILENAME, &contents))
+		return;
+
+	std::vector<std::string> lines;
+	SplitString(contents, '\n', lines);
+	for (const std::string &line : lines) {
+		PrefetchEntry entry{};
+		if (sscanf(line.c_str(), "%16llx%8x %d %d %lf", &entry.cachekey, &entry.hash, &entry.w, &entry.h, &entry.firstSeen) != 5)
+			continue;
+		if (prefetchSeen_.insert(ReplacementCacheKey(entry.cachekey, entry.hash)).second)
+			prefetchLog_.push_back(entry);
+	}
+}
+
+void TextureReplacer::SavePrefetchLog() {
+	if (!prefetchLogDirty_ || !replaceEnabled_)
+		return;
+
+	std::string contents;
+	contents.reserve(prefetchLog_.size() * 48);
+	for (const PrefetchEntry &entry : prefetchLog_) {
+		char line[96];
+		snprintf(line, sizeof(line), "%016llx%08x %d %d %0.3f\n", entry.cachekey, entry.hash, entry.w, entry.h, entry.firstSeen);
+		contents += line;
+	}
+	if (File::WriteStringToFile(true, contents, basePath_ / PREFETCH_FILENAME))
+		prefetchLogDirty_ = false;
+}
+
+void TextureReplacer::PrefetchFromLog() {
+	if (prefetchLog_.empty() || !g_Config.bReplaceTextures)
+		return;
+
+	// The log is in first-use order, so the most urgent loads get queued first.
+	int started = 0;
+	for (const PrefetchEntry &entry : prefetchLog_) {
+		if (entry.firstSeen > PREFETCH_WINDOW_SECONDS)
+			continue;
+		ReplacedTexture *texture = FindReplacement(entry.cachekey, entry.hash, entry.w, entry.h);
+		if (texture && texture->State() == ReplacementState::UNLOADED) {
+			texture->Poll(0.0);
+			started++;
+		}
+	}
+	if (started > 0) {
+		INFO_LOG(Log::G3D, "Prefetching %d replacement textures recorded in %s", started, PREFETCH_FILENAME.c_str());
+	}
+}
+
+void TextureReplacer::RecordFirstUse(u64 cachekey, u32 hash, int w, int h) {
+	if (!prefetchSeen_.insert(ReplacementCacheKey(cachekey, hash)).second)
+		return;
+	if (prefetchLog_.size() >= MAX_PREFETCH_LOG)
+		return;
+	prefetchLog_.push_back(PrefetchEntry{ cachekey, hash, w, h, time_now_d() - prefetchStartTime_ });
+	prefetchLogDirty_ = true;
+}
+
 ReplacedTexture *TextureReplacer::FindReplacement(u64 cachekey, u32 hash, int w, int h) {
 	// Only actually replace if we're replacing.  We might just be saving.
 	if (!Enabled() || !g_Config.bReplaceTextures) {
@@ -593,6 +693,15 @@ ReplacedTexture *TextureReplacer::FindReplacement(u64 cachekey, u32 hash, int w,
 	FindFiltering(cachekey, hash, &desc.forceFiltering);
 
 	if (!foundAlias) {
+		// No alias, so the replacement would have to be a hash-named file in the pack root.
+		// If we have the root index, a probe settles it - no need to go stat a bunch of
+		// candidate filenames that were never there.
+		if (rootHashFilesValid_ && rootHashFiles_.find(ReplacementCacheKey(cachekey, hash)) == rootHashFiles_.end()) {
+			ReplacedTextureRef ref{};
+			cache_.emplace(std::make_pair(replacementKey, ref));
+			return nullptr;
+		}
+
 		// We'll just need to generate the names for each level.
 		// By default, we look for png since that's also what's dumped.
 		// For other file formats, use the ini to create aliases.
@@ -615,6 +724,11 @@ ReplacedTexture *TextureReplacer::FindReplacement(u64 cachekey, u32 hash, int w,
 	}
 
 	_dbg_assert_(!hashfiles.empty());
+
+	// At this point a replacement plausibly exists, remember the first-use order for
+	// prefetching on the next boot.
+	RecordFirstUse(cachekey, hash, w, h);
+
 	// OK, we might already have a matching texture, we use hashfiles as a key. Look it up in the level cache.
 	auto iter = levelCache_.find(hashfiles);
 	if (iter != levelCache_.end()) {
@@ -869,6 +983,80 @@ void TextureReplacer::Decimate(ReplacerDecimateMode mode) {
 	lastTextureCacheSizeGB_ = totalSizeGB;
 }
 
+int TextureReplacer::ReloadChangedTextures() {
+	if (!replaceEnabled_ || !vfs_) {
+		return -1;
+	}
+
+	// Figure out which loaded replacements have changed files. For directory packs we can
+	// compare each file's mtime against the time the texture was prepared. Zip packs only
+	// expose the zip's own timestamp, so a changed zip flushes every loaded texture.
+	std::vector<ReplacedTexture *> changed;
+	if (vfsIsZip_) {
+		File::FileInfo zipInfo;
+		if (File::GetFileInfo(basePath_ / ZIP_FILENAME, &zipInfo) && (uint64_t)zipInfo.mtime + 1 >= packLoadUnixTime_) {
+			for (auto &item : levelCache_) {
+				changed.push_back(item.second);
+			}
+		}
+	} else {
+		for (auto &item : levelCache_) {
+			ReplacedTexture *texture = item.second;
+			bool anyExists = false;
+			bool fileChanged = false;
+			for (const std::string &filename : texture->desc_.filenames) {
+				if (filename.empty()) {
+					continue;
+				}
+				File::FileInfo info;
+				if (!vfs_->GetFileInfo(filename.c_str(), &info)) {
+					continue;
+				}
+				anyExists = true;
+				// The +1 covers the one second granularity of mtimes.
+				if ((uint64_t)info.mtime + 1 >= texture->loadUnixTime_) {
+					fileChanged = true;
+					break;
+				}
+			}
+			// A texture whose files all disappeared counts as changed too, so it falls
+			// back to the original on the next bind.
+			if (fileChanged || (!anyExists && texture->State() == ReplacementState::ACTIVE)) {
+				changed.push_back(texture);
+			}
+		}
+	}
+
+	// Flush the changed textures back to UNLOADED while the VFS that created their file
+	// references is still alive - they'll reload through the normal async path on next use.
+	int flushed = 0;
+	for (ReplacedTexture *texture : changed) {
+		std::lock_guard<std::mutex> guard(texture->lock_);
+		if (texture->PurgeForReload()) {
+			flushed++;
+		}
+	}
+
+	// Re-read the inis to pick up alias/filtering/hashrange edits. This recreates the VFS
+	// (reopening the zip if there is one) and fixes up the pointers of loaded textures.
+	replaceEnabled_ = LoadIni();
+	if (!replaceEnabled_) {
+		return -1;
+	}
+
+	// Drop the negative lookup entries so files added since the pack was loaded get another
+	// chance. Positive entries stay - unchanged textures keep resolving to the same object.
+	for (auto it = cache_.begin(); it != cache_.end(); ) {
+		if (!it->second.texture) {
+			it = cache_.erase(it);
+		} else {
+			++it;
+		}
+	}
+
+	return flushed;
+}
+
 template <typename Key, typename Value>
 static typename std::unordered_map<Key, Value>::const_iterator LookupWildcard(const std::unordered_map<Key, Value> &map, Key &key, u64 cachekey, u32 hash, bool ignoreAddress) {
 	auto alias = map.find(key);
@@ -22,6 +22,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <map>
 #include <vector>
 
@@ -120,6 +121,12 @@ public:
 
 	void Decimate(ReplacerDecimateMode mode);
 
+	// Incremental pack reload for pack authors: re-reads the ini, then flushes only
+	// the loaded replacements whose files changed on disk so they reload through the
+	// normal async path. Returns the number of textures flushed, or -1 if replacement
+	// isn't active. The texture cache is responsible for rebuilding affected entries.
+	int ReloadChangedTextures();
+
 	static bool GenerateIni(const std::string &gameID, Path &generatedFilename);
 	static bool IniExists(const std::string &gameID);
 
@@ -143,6 +150,11 @@ protected:
 	static void ScanForHashNamedFiles(VFSBackend *dir, std::map<ReplacementCacheKey, std::map<int, std::string>> &filenameMap);
 	void ComputeAliasMap(const std::map<ReplacementCacheKey, std::map<int, std::string>> &filenameMap);
 
+	void LoadPrefetchLog();
+	void SavePrefetchLog();
+	void PrefetchFromLog();
+	void RecordFirstUse(u64 cachekey, u32 hash, int w, int h);
+
 	bool replaceEnabled_ = false;
 	bool saveEnabled_ = false;
 	bool allowVideo_ = false;
@@ -161,6 +173,8 @@ protected:
 
 	VFSBackend *vfs_ = nullptr;
 	bool vfsIsZip_ = false;
+	// Unix time when the pack was (re)loaded, to detect zip pack changes by mtime.
+	uint64_t packLoadUnixTime_ = 0;
 
 	GPUFormatSupport formatSupport_{};
 
@@ -171,6 +185,24 @@ protected:
 	std::unordered_map<ReplacementCacheKey, std::string> aliases_;
 	std::unordered_map<ReplacementCacheKey, TextureFiltering> filtering_;
 
+	// Index of hash-named files in the pack root, built once at load time so misses
+	// can be answered with a hash probe instead of filesystem checks per level.
+	std::unordered_set<ReplacementCacheKey> rootHashFiles_;
+	bool rootHashFilesValid_ = false;
+
+	// First-use log from the previous session, driving speculative prefetch at load.
+	struct PrefetchEntry {
+		u64 cachekey;
+		u32 hash;
+		int w;
+		int h;
+		double firstSeen;  // seconds after the pack was loaded
+	};
+	std::vector<PrefetchEntry> prefetchLog_;
+	std::unordered_set<ReplacementCacheKey> prefetchSeen_;
+	double prefetchStartTime_ = 0.0;
+	bool prefetchLogDirty_ = false;
+
 	std::unordered_map<ReplacementCacheKey, ReplacedTextureRef> cache_;
 	std::unordered_map<ReplacementCacheKey, SavedTextureCacheData> savedCache_;
 
@@ -51,6 +51,10 @@ Lighter::Lighter(int vertType) {
 		lconv[l] = getFloat24(gstate.lconv[l]);
 		int i = l * 3;
 		if (gstate.isLightChanEnabled(l)) {
+			enabledLights_[numEnabledLights_++] = l;
+			lightType_[l] = gstate.getLightType(l);
+			doSpecular_[l] = gstate.isUsingSpecularLight(l);
+			poweredDiffuse_[l] = gstate.isUsingPoweredDiffuseLight(l);
 			lpos[l] = Vec3fFromGE(&gstate.lpos[i]);
 			ldir[l] = Vec3fFromGE(&gstate.ldir[i]);
 			latt[l] = Vec3fFromGE(&gstate.latt[i]);
@@ -91,12 +95,9 @@ void Lighter::Light(float colorOut0[4], float colorOut1[4], const float colorIn[
 	Color4 lightSum0 = globalAmbient * *ambient + materialEmissive;
 	Color4 lightSum1(0, 0, 0, 0);
 
-	for (int l = 0; l < 4; l++) {
-		// can we skip this light?
-		if (!gstate.isLightChanEnabled(l))
-			continue;
-
-		GELightType type = gstate.getLightType(l);
+	for (int i = 0; i < numEnabledLights_; i++) {
+		const int l = enabledLights_[i];
+		const GELightType type = lightType_[l];
 
 		Vec3f toLight(0, 0, 0);
 		Vec3f lightDir(0, 0, 0);
@@ -106,8 +107,8 @@ void Lighter::Light(float colorOut0[4], float colorOut1[4], const float colorIn[
 		else
 			toLight = lpos[l] - pos;
 
-		bool doSpecular = gstate.isUsingSpecularLight(l);
-		bool poweredDiffuse = gstate.isUsingPoweredDiffuseLight(l);
+		const bool doSpecular = doSpecular_[l];
+		const bool poweredDiffuse = poweredDiffuse_[l];
 
 		float distanceToLight = toLight.Length();
 		float dot = 0.0f;
@@ -162,10 +163,8 @@ void Lighter::Light(float colorOut0[4], float colorOut1[4], const float colorIn[
 			}
 		}
 
-		if (gstate.isLightChanEnabled(l)) {
-			Color4 lightAmbient(lcolor[0][l], 0.0f);
-			lightSum0 += (lightAmbient * *ambient + diff) * lightScale;
-		}
+		Color4 lightAmbient(lcolor[0][l], 0.0f);
+		lightSum0 += (lightAmbient * *ambient + diff) * lightScale;
 	}
 
 	// The colors must eventually be clamped, but we expect the caller to do that.
@@ -174,3 +173,159 @@ void Lighter::Light(float colorOut0[4], float colorOut1[4], const float colorIn[
 		colorOut1[i] = lightSum1[i];
 	}
 }
+
+// Lane-wise helpers for the four-vertex path. Written componentwise so they work on
+// every arch - these compile down to single vector instructions when auto-vectorized.
+static inline Vec4f Vec4Max0(const Vec4f &v) {
+	return Vec4f(v.x > 0.0f ? v.x : 0.0f, v.y > 0.0f ? v.y : 0.0f, v.z > 0.0f ? v.z : 0.0f, v.w > 0.0f ? v.w : 0.0f);
+}
+
+static inline Vec4f Vec4Sqrt(const Vec4f &v) {
+#if defined(_M_SSE)
+	return Vec4f(_mm_sqrt_ps(SAFE_M128(v.vec)));
+#else
+	return Vec4f(sqrtf(v.x), sqrtf(v.y), sqrtf(v.z), sqrtf(v.w));
+#endif
+}
+
+static inline Vec4f Vec4Div(const Vec4f &a, const Vec4f &b) {
+	return Vec4f(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+}
+
+// 1/v for positive lanes, 0 for the rest. Matches the "skip normalization at zero
+// distance" behavior of the one-vertex path.
+static inline Vec4f Vec4RecipOrZero(const Vec4f &v) {
+	return Vec4f(v.x > 0.0f ? 1.0f / v.x : 0.0f, v.y > 0.0f ? 1.0f / v.y : 0.0f,
+		v.z > 0.0f ? 1.0f / v.z : 0.0f, v.w > 0.0f ? 1.0f / v.w : 0.0f);
+}
+
+// There's no vector powf, so this stays scalar per lane.
+static inline Vec4f Vec4Pow(const Vec4f &v, float e) {
+	return Vec4f(powf(v.x, e), powf(v.y, e), powf(v.z, e), powf(v.w, e));
+}
+
+static inline Vec4f Vec4SelectGT0(const Vec4f &test, const Vec4f &ifPos, const Vec4f &ifNot) {
+	return Vec4f(test.x > 0.0f ? ifPos.x : ifNot.x, test.y > 0.0f ? ifPos.y : ifNot.y,
+		test.z > 0.0f ? ifPos.z : ifNot.z, test.w > 0.0f ? ifPos.w : ifNot.w);
+}
+
+void Lighter::Light4(float colorOut0[4][4], float colorOut1[4][4], const float colorIn[4][4], const Vec3f pos[4], const Vec3f norm[4]) {
+	// Transpose the inputs to SoA, one Vec4f lane per vertex.
+	const Vec4f posX(pos[0].x, pos[1].x, pos[2].x, pos[3].x);
+	const Vec4f posY(pos[0].y, pos[1].y, pos[2].y, pos[3].y);
+	const Vec4f posZ(pos[0].z, pos[1].z, pos[2].z, pos[3].z);
+	const Vec4f normX(norm[0].x, norm[1].x, norm[2].x, norm[3].x);
+	const Vec4f normY(norm[0].y, norm[1].y, norm[2].y, norm[3].y);
+	const Vec4f normZ(norm[0].z, norm[1].z, norm[2].z, norm[3].z);
+
+	// Material sources, per channel. The input color is the only per-vertex one.
+	Vec4f in[4];
+	for (int c = 0; c < 4; c++)
+		in[c] = Vec4f(colorIn[0][c], colorIn[1][c], colorIn[2][c], colorIn[3][c]);
+
+	Vec4f ambient[4];
+	Vec4f diffuse[4];
+	Vec4f specular[4];
+	for (int c = 0; c < 4; c++) {
+		ambient[c] = (materialUpdate_ & 1) ? in[c] : Vec4f::AssignToAll(materialAmbient[c]);
+		diffuse[c] = (materialUpdate_ & 2) ? in[c] : Vec4f::AssignToAll(materialDiffuse[c]);
+		specular[c] = (materialUpdate_ & 4) ? in[c] : Vec4f::AssignToAll(materialSpecular[c]);
+	}
+
+	Vec4f sum0[4];
+	Vec4f sum1[4];
+	for (int c = 0; c < 4; c++) {
+		sum0[c] = ambient[c] * globalAmbient[c] + Vec4f::AssignToAll(materialEmissive[c]);
+		sum1[c] = Vec4f::AssignToAll(0.0f);
+	}
+
+	for (int i = 0; i < numEnabledLights_; i++) {
+		const int l = enabledLights_[i];
+		const GELightType type = lightType_[l];
+
+		Vec4f toX, toY, toZ;
+		if (type == GE_LIGHTTYPE_DIRECTIONAL) {
+			toX = Vec4f::AssignToAll(lpos[l].x);  // lightdir is for spotlights
+			toY = Vec4f::AssignToAll(lpos[l].y);
+			toZ = Vec4f::AssignToAll(lpos[l].z);
+		} else {
+			toX = Vec4f::AssignToAll(lpos[l].x) - posX;
+			toY = Vec4f::AssignToAll(lpos[l].y) - posY;
+			toZ = Vec4f::AssignToAll(lpos[l].z) - posZ;
+		}
+
+		const Vec4f distSq = toX * toX + toY * toY + toZ * toZ;
+		const Vec4f dist = Vec4Sqrt(distSq);
+		const Vec4f invDist = Vec4RecipOrZero(dist);
+		toX = toX * invDist;
+		toY = toY * invDist;
+		toZ = toZ * invDist;
+
+		// Clamp dot to zero.
+		Vec4f dot = Vec4Max0(toX * normX + toY * normY + toZ * normZ);
+		if (poweredDiffuse_[l])
+			dot = Vec4Pow(dot, specCoef_);
+
+		// Attenuation
+		Vec4f lightScale;
+		switch (type) {
+		case GE_LIGHTTYPE_DIRECTIONAL:
+			lightScale = Vec4f::AssignToAll(1.0f);
+			break;
+		case GE_LIGHTTYPE_POINT:
+			lightScale = Vec4Div(Vec4f::AssignToAll(1.0f),
+				Vec4f::AssignToAll(latt[l].x) + dist * latt[l].y + distSq * latt[l].z).Clamp(0.0f, 1.0f);
+			break;
+		case GE_LIGHTTYPE_SPOT:
+		case GE_LIGHTTYPE_UNKNOWN:
+		default:
+			{
+				// The cone test doesn't vectorize nicely, keep it scalar per lane.
+				const Vec3f lightDir = ldir[l].NormalizedOr001(cpu_info.bSSE4_1);
+				for (int v = 0; v < 4; v++) {
+					const Vec3f toLight(toX[v], toY[v], toZ[v]);
+					const float angle = Dot(toLight.NormalizedOr001(cpu_info.bSSE4_1), lightDir);
+					float scale = 0.0f;
+					if (angle >= lcutoff[l]) {
+						const float d = dist[v];
+						scale = clamp(1.0f / (latt[l].x + latt[l].y * d + latt[l].z * d * d), 0.0f, 1.0f) * powf(angle, lconv[l]);
+					}
+					lightScale[v] = scale;
+				}
+			}
+			break;
+		}
+
+		// Ambient + diffuse. The light colors have no alpha, so the alpha sums are untouched.
+		for (int c = 0; c < 3; c++) {
+			sum0[c] += (ambient[c] * lcolor[0][l][c] + diffuse[c] * lcolor[1][l][c] * dot) * lightScale;
+		}
+
+		// Real PSP specular - the half vector uses a fixed (0, 0, 1) viewer.
+		if (doSpecular_[l]) {
+			Vec4f halfX = toX;
+			Vec4f halfY = toY;
+			Vec4f halfZ = toZ + Vec4f::AssignToAll(1.0f);
+			const Vec4f halfLen = Vec4Sqrt(halfX * halfX + halfY * halfY + halfZ * halfZ);
+			const Vec4f invHalfLen = Vec4RecipOrZero(halfLen);
+			halfX = halfX * invHalfLen;
+			halfY = halfY * invHalfLen;
+			// Degenerate half vectors become (0, 0, 1), like NormalizedOr001 in the one-vertex path.
+			halfZ = Vec4SelectGT0(halfLen, halfZ * invHalfLen, Vec4f::AssignToAll(1.0f));
+
+			const Vec4f specDot = halfX * normX + halfY * normY + halfZ * normZ;
+			const Vec4f specScale = Vec4SelectGT0(specDot, Vec4Pow(specDot, specCoef_) * lightScale, Vec4f::AssignToAll(0.0f));
+			for (int c = 0; c < 3; c++) {
+				sum1[c] += specular[c] * lcolor[2][l][c] * specScale;
+			}
+		}
+	}
+
+	// The colors must eventually be clamped, but we expect the caller to do that.
+	for (int v = 0; v < 4; v++) {
+		for (int c = 0; c < 4; c++) {
+			colorOut0[v][c] = sum0[c][v];
+			colorOut1[v][c] = sum1[c][v];
+		}
+	}
+}
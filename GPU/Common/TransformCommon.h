@@ -66,6 +66,9 @@ class Lighter {
 public:
 	Lighter(int vertType);
 	void Light(float colorOut0[4], float colorOut1[4], const float colorIn[4], const Vec3f &pos, const Vec3f &normal);
+	// Lights four vertices at once, SoA-style internally. The extra lanes of a partial
+	// batch should just duplicate a real vertex - their outputs are computed but can be ignored.
+	void Light4(float colorOut0[4][4], float colorOut1[4][4], const float colorIn[4][4], const Vec3f pos[4], const Vec3f norm[4]);
 
 private:
 	inline Vec3f Vec3fFromGE(const u32 *values) const {
@@ -92,5 +95,13 @@ private:
 	float lcutoff[4];
 	float lconv[4];
 	float lcolor[3][4][3];
+
+	// Decoded once in the constructor so the per-vertex paths don't have to
+	// pick apart gstate for every vertex.
+	int numEnabledLights_ = 0;
+	int enabledLights_[4]{};
+	GELightType lightType_[4]{};
+	bool doSpecular_[4]{};
+	bool poweredDiffuse_[4]{};
 };
 
@@ -22,6 +22,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/CPUDetect.h"
+#include "Common/Math/CrossSIMD.h"
 #include "Common/Data/Convert/ColorConv.h"
 #include "Common/Log.h"
 #include "Common/LogReporting.h"
@@ -1305,6 +1306,23 @@ void VertexDecoder::SetVertexType(u32 fmt, const VertexDecoderOptions &options,
 
 	_assert_msg_(decFmt.uvfmt == DEC_FLOAT_2 || decFmt.uvfmt == DEC_NONE, "Reader only supports float UV");
 
+	// Float UV + RGBA8888 + float position (no normals/weights/morph) is stored in exactly
+	// the layout we decode to, so the whole range can be copied straight through, skipping
+	// the per-vertex steps. Vertex-heavy games use this format a lot. We verify the layout
+	// match via the offsets instead of hardcoding it, to be safe against format changes.
+	if (morphcount == 1 && weighttype == 0 && !throughmode && nrm == 0 &&
+		tc == (GE_VTYPE_TC_FLOAT >> GE_VTYPE_TC_SHIFT) &&
+		col == (GE_VTYPE_COL_8888 >> GE_VTYPE_COL_SHIFT) &&
+		pos == (GE_VTYPE_POS_FLOAT >> GE_VTYPE_POS_SHIFT) &&
+		!g_DoubleTextureCoordinates &&
+		tcoff == decFmt.uvoff && coloff == decFmt.c0off && posoff == decFmt.posoff &&
+		size == decFmt.stride) {
+		directCopy_ = true;
+		// If UVs get prescaled, we can only copy directly when the scale is identity,
+		// which we have to check per draw.
+		directCopyNeedsIdentityUV_ = gstate.getUVGenMode() == GE_TEXMAP_TEXTURE_COORDS || gstate.getUVGenMode() == GE_TEXMAP_UNKNOWN;
+	}
+
 	// Only use the handwritten decoders if we have SSE or NEON. Don't want to use these on RISC-V, probably?
 #if PPSSPP_ARCH(ARM_NEON) || PPSSPP_ARCH(SSE2)
 	// See GetVertTypeID
@@ -1351,6 +1369,22 @@ void VertexDecoder::DecodeVerts(u8 *decodedptr, const void *verts, const UVScale
 		return;
 	}
 
+	if (directCopy_ && !validateJit) {
+		if (!directCopyNeedsIdentityUV_ ||
+			(uvScaleOffset->uScale == 1.0f && uvScaleOffset->vScale == 1.0f && uvScaleOffset->uOff == 0.0f && uvScaleOffset->vOff == 0.0f)) {
+			memcpy(decodedptr, startPtr, count * size);
+			// Still need the full alpha tracking that Step_Color8888 does.
+			const u8 *alpha = startPtr + coloff + 3;
+			for (int i = 0; i < count; i++, alpha += size) {
+				if (*alpha != 255) {
+					gstate_c.vertexFullAlpha = false;
+					break;
+				}
+			}
+			return;
+		}
+	}
+
 	if (jitted_ && !validateJit) {
 		// We've compiled the steps into optimized machine code, so just jump!
 		jitted_(startPtr, decodedptr, count, uvScaleOffset);
@@ -1360,6 +1394,8 @@ void VertexDecoder::DecodeVerts(u8 *decodedptr, const void *verts, const UVScale
 		prescaleUV_ = uvScaleOffset;
 		// Interpret the decode steps
 		for (; count; count--) {
+			// The source is read strictly front to back, so give the prefetcher a head start.
+			PREFETCH_READ(ptr + PREFETCH_DISTANCE);
 			const int steps = numSteps_;
 			for (int i = 0; i < steps; i++) {
 				steps_[i](this, ptr, decoded);
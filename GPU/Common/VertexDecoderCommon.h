@@ -452,6 +452,11 @@ public:
 
 	bool throughmode;
 	bool skinInDecode;
+	// The raw PSP format matches the decoded layout exactly, so DecodeVerts can
+	// copy the whole range instead of stepping per vertex. See SetVertexType.
+	bool directCopy_ = false;
+	// Direct copy is only valid if the per-draw UV prescale is identity.
+	bool directCopyNeedsIdentityUV_ = false;
 	// With morph and weights, this can be more than 256 bytes.
 	u16 size;
 	u8 onesize_;
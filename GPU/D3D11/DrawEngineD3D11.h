@@ -55,6 +55,15 @@ public:
 };
 
 // Handles transform, lighting and drawing.
+//
+// NOTE: Unlike the Vulkan and OpenGL backends, which record through their threaded render
+// managers, D3D11 records directly on the emu thread through the immediate context, so
+// emulation and submission don't overlap and heavy scenes are capped by a single thread.
+// Fixing that would need a D3D11 equivalent of VulkanRenderManager - a command mirror
+// replayed on a render thread (deferred contexts are not enough on their own, as most
+// drivers serialize them internally) - which means restructuring all of GPU/D3D11 and
+// thin3d_d3d11 against such a manager. Too large to do piecemeal; if it's ever tackled,
+// mirror the Vulkan backend's architecture.
 class DrawEngineD3D11 : public DrawEngineCommon {
 public:
 	DrawEngineD3D11(Draw::DrawContext *draw, ID3D11Device *device, ID3D11DeviceContext *context);
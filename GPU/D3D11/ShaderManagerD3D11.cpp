@@ -30,6 +30,7 @@
 #include "Common/Log.h"
 #include "Common/CommonTypes.h"
 #include "Core/Config.h"
+#include "GPU/GPU.h"
 #include "GPU/Math3D.h"
 #include "GPU/GPUState.h"
 #include "GPU/ge_constants.h"
@@ -153,18 +154,21 @@ uint64_t ShaderManagerD3D11::UpdateUniforms(bool useBufferedRendering) {
 			context_->Map(push_base, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
 			memcpy(map.pData, &ub_base, sizeof(ub_base));
 			context_->Unmap(push_base, 0);
+			gpuStats.numUniformUploadBytes += (int)sizeof(ub_base);
 		}
 		if (dirty & DIRTY_LIGHT_UNIFORMS) {
 			LightUpdateUniforms(&ub_lights, dirty);
 			context_->Map(push_lights, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
 			memcpy(map.pData, &ub_lights, sizeof(ub_lights));
 			context_->Unmap(push_lights, 0);
+			gpuStats.numUniformUploadBytes += (int)sizeof(ub_lights);
 		}
 		if (dirty & DIRTY_BONE_UNIFORMS) {
 			BoneUpdateUniforms(&ub_bones, dirty);
 			context_->Map(push_bones, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
 			memcpy(map.pData, &ub_bones, sizeof(ub_bones));
 			context_->Unmap(push_bones, 0);
+			gpuStats.numUniformUploadBytes += (int)sizeof(ub_bones);
 		}
 	}
 	gstate_c.CleanUniforms();
@@ -67,6 +67,13 @@ bool IsActive() {
 	return active;
 }
 
+bool NeedsSlowInterpreter() {
+	// Attached but idle costs nothing: only armed breakpoints, stepping or prim
+	// restrictions require seeing every command. hasBreakpoints flips through the
+	// GPUBreakpoints callback as breakpoints are added and removed.
+	return active && (breakNext != BreakNext::NONE || hasBreakpoints || !restrictPrimRanges.empty());
+}
+
 void SetBreakNext(BreakNext next) {
 	SetActive(true);
 	breakNext = next;
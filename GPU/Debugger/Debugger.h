@@ -36,6 +36,10 @@ enum class BreakNext {
 
 void SetActive(bool flag);
 bool IsActive();
+// True only while per-command instrumentation is required (breakpoints armed, stepping,
+// or prim restrictions active). The GE run loop selection keys off this, so an attached
+// but idle debugger runs the same fast path as release.
+bool NeedsSlowInterpreter();
 
 void SetBreakNext(BreakNext next);
 void SetBreakCount(int c, bool relative = false);
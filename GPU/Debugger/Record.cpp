@@ -50,6 +50,8 @@ namespace GPURecord {
 
 static bool active = false;
 static std::atomic<bool> nextFrame = false;
+static int framesToRecord = 1;
+static int framesRecorded = 0;
 static int flipLastAction = -1;
 static int flipFinishAt = -1;
 static uint32_t lastEdramTrans = 0x400;
@@ -159,6 +161,7 @@ static bool BeginRecording() {
 
 	active = true;
 	nextFrame = false;
+	framesRecorded = 0;
 	lastTextures.clear();
 	lastRenderTargets.clear();
 	flipLastAction = gpuStats.numFlips;
@@ -608,9 +611,14 @@ bool IsActivePending() {
 }
 
 bool RecordNextFrame(const std::function<void(const Path &)> callback) {
+	return RecordNextFrames(1, callback);
+}
+
+bool RecordNextFrames(int numFrames, const std::function<void(const Path &)> callback) {
 	if (!nextFrame) {
 		flipLastAction = gpuStats.numFlips;
 		flipFinishAt = -1;
+		framesToRecord = std::max(numFrames, 1);
 		writeCallback = callback;
 		nextFrame = true;
 		return true;
@@ -818,8 +826,15 @@ void NotifyDisplay(u32 framebuf, int stride, int fmt) {
 	commands.push_back({ CommandType::DISPLAY, sz, ptr });
 
 	if (writePending) {
-		NOTICE_LOG(Log::System, "Recording complete on display");
-		FinishRecording();
+		if (++framesRecorded >= framesToRecord) {
+			NOTICE_LOG(Log::System, "Recording complete on display");
+			FinishRecording();
+		} else {
+			// Keep capturing into the same dump. Repeated textures and vertex data
+			// are found in the pushbuf and referenced by offset, so extra frames
+			// mostly just add their changed data.
+			flipLastAction = gpuStats.numFlips;
+		}
 	}
 }
 
@@ -852,7 +867,7 @@ void NotifyBeginFrame() {
 		NOTICE_LOG(Log::System, "Recording starting on frame...");
 		BeginRecording();
 		// If we began on a BeginFrame, end on a BeginFrame.
-		flipFinishAt = gpuStats.numFlips + 1;
+		flipFinishAt = gpuStats.numFlips + framesToRecord;
 	}
 }
 
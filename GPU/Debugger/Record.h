@@ -28,6 +28,10 @@ namespace GPURecord {
 bool IsActive();
 bool IsActivePending();
 bool RecordNextFrame(const std::function<void(const Path &)> callback);
+// Captures several consecutive frames into a single dump. Data that repeats
+// frame to frame is stored once and referenced by offset, so this stays much
+// smaller than separate dumps.
+bool RecordNextFrames(int numFrames, const std::function<void(const Path &)> callback);
 void ClearCallback();
 
 void NotifyCommand(u32 pc);
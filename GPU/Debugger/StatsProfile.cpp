@@ -0,0 +1,179 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Common/Data/Format/IniFile.h"
+#include "Common/File/FileUtil.h"
+#include "Common/Log.h"
+#include "Common/StringUtils.h"
+#include "Core/Config.h"
+#include "Core/ELF/ParamSFO.h"
+#include "Core/System.h"
+#include "GPU/GPU.h"
+#include "GPU/Debugger/StatsProfile.h"
+
+namespace GPUStatsProfile {
+
+// Bucket 0 holds zero frames, bucket n holds values in [2^(n-1), 2^n).
+// Coarse, but two buckets of movement is an unambiguous regression, and the
+// profile stays a handful of ini lines per metric.
+constexpr int NUM_BUCKETS = 33;
+
+// Don't save or compare profiles from very short sessions - a run that never
+// got past the intro isn't a usable baseline.
+constexpr uint64_t MIN_SAMPLES = 300;
+
+// Thresholds for flagging a shift against the previous run.
+constexpr double MEAN_SHIFT_RATIO = 1.3;
+constexpr double MEAN_SHIFT_MIN_ABS = 10.0;
+constexpr int P90_BUCKET_SHIFT = 2;
+
+struct Histogram {
+	uint64_t total = 0;
+	uint32_t buckets[NUM_BUCKETS]{};
+
+	void Add(uint64_t value) {
+		int b = 0;
+		while (b < NUM_BUCKETS - 1 && (value >> b) != 0)
+			b++;
+		buckets[b]++;
+		total += value;
+	}
+};
+
+// All access happens on the CPU thread (flips and HLE shutdown), no lock needed.
+static uint64_t g_samples;
+static Histogram g_draws;
+static Histogram g_verts;
+static Histogram g_readbacks;
+static Histogram g_texLoads;
+
+struct Metric {
+	const char *name;
+	Histogram *hist;
+};
+
+static const Metric g_metrics[] = {
+	{"Draws", &g_draws},
+	{"Verts", &g_verts},
+	{"Readbacks", &g_readbacks},
+	{"TextureLoads", &g_texLoads},
+};
+
+void NotifyFlip() {
+	if (!g_Config.bGpuStatsProfile)
+		return;
+	g_draws.Add(gpuStats.numDrawCalls);
+	g_verts.Add(gpuStats.numVertsSubmitted);
+	g_readbacks.Add(gpuStats.numReadbacks + gpuStats.numBlockingReadbacks);
+	g_texLoads.Add(gpuStats.numTexturesDecoded);
+	g_samples++;
+}
+
+static int PercentileBucket(const Histogram &hist, int percent) {
+	const uint64_t target = (g_samples * percent + 99) / 100;
+	uint64_t cumulative = 0;
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		cumulative += hist.buckets[i];
+		if (cumulative >= target)
+			return i;
+	}
+	return NUM_BUCKETS - 1;
+}
+
+// Upper end of a bucket, for readable log messages.
+static uint64_t BucketCeiling(int bucket) {
+	return bucket == 0 ? 0 : ((uint64_t)1 << bucket) - 1;
+}
+
+static void CompareAgainst(IniFile &baseline, const std::string &discID) {
+	std::string oldBuild;
+	baseline.Get("Profile", "Build", &oldBuild, "unknown");
+	int shifts = 0;
+	for (const Metric &metric : g_metrics) {
+		const Section *section = baseline.GetSection(metric.name);
+		if (!section)
+			continue;
+		double oldMean = 0.0, newMean = (double)metric.hist->total / (double)g_samples;
+		int oldP90 = 0, newP90 = PercentileBucket(*metric.hist, 90);
+		if (!section->Get("Mean", &oldMean, 0.0))
+			continue;
+		section->Get("P90Bucket", &oldP90, 0);
+
+		const double lo = std::min(oldMean, newMean), hi = std::max(oldMean, newMean);
+		const bool meanShifted = hi >= MEAN_SHIFT_MIN_ABS && hi > lo * MEAN_SHIFT_RATIO;
+		const bool tailShifted = abs(newP90 - oldP90) >= P90_BUCKET_SHIFT;
+		if (meanShifted || tailShifted) {
+			shifts++;
+			WARN_LOG(Log::G3D, "GPU profile shift for %s: %s/frame mean %.1f -> %.1f, p90 <%llu -> <%llu (baseline build %s, this build %s)",
+				discID.c_str(), metric.name, oldMean, newMean,
+				(unsigned long long)BucketCeiling(oldP90), (unsigned long long)BucketCeiling(newP90),
+				oldBuild.c_str(), PPSSPP_GIT_VERSION);
+		}
+	}
+	if (shifts == 0) {
+		NOTICE_LOG(Log::G3D, "GPU profile for %s matches the previous run (build %s)", discID.c_str(), oldBuild.c_str());
+	}
+}
+
+void Shutdown() {
+	if (g_samples == 0)
+		return;
+
+	const std::string discID = g_paramSFO.GetDiscID();
+	if (g_samples >= MIN_SAMPLES && !discID.empty()) {
+		const Path dumpDir = GetSysDirectory(DIRECTORY_DUMP);
+		File::CreateFullPath(dumpDir);
+		const Path path = dumpDir / (discID + "_gpuprofile.ini");
+
+		IniFile baseline;
+		if (baseline.Load(path)) {
+			CompareAgainst(baseline, discID);
+		}
+
+		IniFile ini;
+		Section *profile = ini.GetOrCreateSection("Profile");
+		profile->Set("Build", PPSSPP_GIT_VERSION);
+		profile->Set("Frames", g_samples);
+		for (const Metric &metric : g_metrics) {
+			Section *section = ini.GetOrCreateSection(metric.name);
+			section->Set("Mean", (double)metric.hist->total / (double)g_samples);
+			section->Set("P50Bucket", PercentileBucket(*metric.hist, 50));
+			section->Set("P90Bucket", PercentileBucket(*metric.hist, 90));
+			std::string buckets;
+			for (int i = 0; i < NUM_BUCKETS; i++) {
+				buckets += StringFromFormat(i == 0 ? "%u" : " %u", metric.hist->buckets[i]);
+			}
+			section->Set("Buckets", buckets);
+		}
+		if (!ini.Save(path)) {
+			WARN_LOG(Log::G3D, "Failed to save GPU profile to '%s'", path.c_str());
+		} else {
+			NOTICE_LOG(Log::G3D, "Saved GPU profile (%d frames) to '%s'", (int)g_samples, path.c_str());
+		}
+	}
+
+	g_samples = 0;
+	for (const Metric &metric : g_metrics) {
+		*metric.hist = Histogram{};
+	}
+}
+
+}  // namespace GPUStatsProfile
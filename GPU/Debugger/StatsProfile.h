@@ -0,0 +1,40 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+// Per-title sampling profiler for the gpuStats frame counters.
+//
+// While enabled (GPUStatsProfile = True in the ini), every display flip samples
+// the per-frame counters (draws, verts, readbacks, texture loads) into
+// log2-bucket histograms. When the game shuts down, the aggregated profile is
+// written to the DUMP directory and compared against the previous run's profile
+// for the same title, logging a warning for every distribution that shifted
+// beyond thresholds - so comparing builds on a title becomes a log grep instead
+// of eyeballing the debug overlay.
+
+namespace GPUStatsProfile {
+
+// Call at display flip, before the frame counters are reset. Cheap no-op when
+// the profiler is disabled.
+void NotifyFlip();
+
+// Saves the profile, compares against the previous run and resets. Safe to
+// call when nothing was recorded.
+void Shutdown();
+
+}  // namespace GPUStatsProfile
@@ -38,6 +38,7 @@ enum SkipDrawReasonFlags {
 	SKIPDRAW_NON_DISPLAYED_FB = 2,   // Skip drawing to FBO:s that have not been displayed.
 	SKIPDRAW_BAD_FB_TEXTURE = 4,
 	SKIPDRAW_WINDOW_MINIMIZED = 8, // Don't draw when the host window is minimized.
+	SKIPDRAW_UNSAMPLED_FB = 16,  // Skip drawing to offscreen targets nothing has sampled for a few frames (SkipUnsampledRenderTargets compat flag).
 };
 
 enum class ShaderDepalMode {
@@ -79,8 +80,11 @@ struct GPUStatistics {
 		numCulledDraws = 0;
 		numDrawSyncs = 0;
 		numListSyncs = 0;
+		numStallUpdates = 0;
+		numStallUpdatesSkipped = 0;
 		numVertsSubmitted = 0;
 		numVertsDecoded = 0;
+		numVertsDeduped = 0;
 		numUncachedVertsDrawn = 0;
 		numTextureInvalidations = 0;
 		numTextureInvalidationsByFramebuffer = 0;
@@ -95,6 +99,7 @@ struct GPUStatistics {
 		numReadbacks = 0;
 		numUploads = 0;
 		numCachedUploads = 0;
+		numUniformUploadBytes = 0;
 		numDepal = 0;
 		numClears = 0;
 		numDepthCopies = 0;
@@ -102,11 +107,13 @@ struct GPUStatistics {
 		numColorCopies = 0;
 		numCopiesForShaderBlend = 0;
 		numCopiesForSelfTex = 0;
+		numElidedSelfTexCopies = 0;
 		numBlockTransfers = 0;
 		numReplacerTrackedTex = 0;
 		numCachedReplacedTextures = 0;
 		numClutTextures = 0;
 		msProcessingDisplayLists = 0;
+		msVertexDecode = 0;
 		vertexGPUCycles = 0;
 		otherGPUCycles = 0;
 	}
@@ -117,11 +124,14 @@ struct GPUStatistics {
 	int numCulledDraws;
 	int numDrawSyncs;
 	int numListSyncs;
+	int numStallUpdates;
+	int numStallUpdatesSkipped;
 	int numFlushes;
 	int numBBOXJumps;
 	int numPlaneUpdates;
 	int numVertsSubmitted;
 	int numVertsDecoded;
+	int numVertsDeduped;
 	int numUncachedVertsDrawn;
 	int numTextureInvalidations;
 	int numTextureInvalidationsByFramebuffer;
@@ -133,6 +143,7 @@ struct GPUStatistics {
 	int numReadbacks;
 	int numUploads;
 	int numCachedUploads;
+	int numUniformUploadBytes;
 	int numDepal;
 	int numClears;
 	int numDepthCopies;
@@ -140,11 +151,13 @@ struct GPUStatistics {
 	int numColorCopies;
 	int numCopiesForShaderBlend;
 	int numCopiesForSelfTex;
+	int numElidedSelfTexCopies;
 	int numBlockTransfers;
 	int numReplacerTrackedTex;
 	int numCachedReplacedTextures;
 	int numClutTextures;
 	double msProcessingDisplayLists;
+	double msVertexDecode;
 	int vertexGPUCycles;
 	int otherGPUCycles;
 
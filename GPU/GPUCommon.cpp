@@ -501,8 +501,22 @@ u32 GPUCommon::UpdateStall(int listid, u32 newstall) {
 	if (dl.state == PSP_GE_DL_STATE_COMPLETED)
 		return SCE_KERNEL_ERROR_ALREADY;
 
+	gpuStats.numStallUpdates++;
 	dl.stall = newstall & 0x0FFFFFFF;
-	
+
+	// Games that pump the stall address per object generate thousands of these per
+	// frame. If the next list to run is still stalled after the update, spinning up
+	// the interpreter would just re-discover the stall - skip it. Lists that haven't
+	// started yet (context save, state transition) still take the full path.
+	int nextIndex = GetNextListIndex();
+	if (nextIndex != -1) {
+		const DisplayList &next = dls[nextIndex];
+		if (next.state == PSP_GE_DL_STATE_RUNNING && next.started && next.pc == next.stall) {
+			gpuStats.numStallUpdatesSkipped++;
+			return 0;
+		}
+	}
+
 	ProcessDLQueue();
 
 	return 0;
@@ -660,9 +674,11 @@ bool GPUCommon::InterpretList(DisplayList &list) {
 
 	gpuState = list.pc == list.stall ? GPUSTATE_STALL : GPUSTATE_RUNNING;
 
-	// To enable breakpoints, we don't do fast matrix loads while debugger active.
-	debugRecording_ = GPUDebug::IsActive() || GPURecord::IsActive();
-	const bool useFastRunLoop = !dumpThisFrame_ && !debugRecording_;
+	// To enable breakpoints, we don't do fast matrix loads while they're armed. An attached
+	// but idle debugger stays on the fast run loop - only arming breakpoints (or stepping,
+	// prim restrictions, recording) swaps in the instrumented interpreter.
+	debugRecording_ = GPUDebug::NeedsSlowInterpreter() || GPURecord::IsActive();
+	bool useFastRunLoop = !dumpThisFrame_ && !debugRecording_;
 	while (gpuState == GPUSTATE_RUNNING) {
 		{
 			if (list.pc == list.stall) {
@@ -677,6 +693,11 @@ bool GPUCommon::InterpretList(DisplayList &list) {
 			SlowRunLoop(list);
 		}
 
+		// Re-check between slices, so arming breakpoints from another thread takes
+		// effect without waiting for the whole list to finish.
+		debugRecording_ = GPUDebug::NeedsSlowInterpreter() || GPURecord::IsActive();
+		useFastRunLoop = !dumpThisFrame_ && !debugRecording_;
+
 		{
 			downcount = list.stall == 0 ? 0x0FFFFFFF : (list.stall - list.pc) / 4;
 
@@ -1277,7 +1298,7 @@ void GPUCommon::FlushImm() {
 	if (immCount_ == 0 || immPrim_ == GE_PRIM_INVALID)
 		return;
 
-	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB)) {
+	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB | SKIPDRAW_UNSAMPLED_FB)) {
 		// No idea how many cycles to skip, heh.
 		immCount_ = 0;
 		return;
@@ -1878,6 +1899,13 @@ bool GPUCommon::PerformMemoryCopy(u32 dest, u32 src, int size, GPUCopyFlag flags
 		// Let's not ignore this yet but if we hit this, we should investigate.
 	}
 
+	// If a delayed readback of the source region is still in flight, complete it now
+	// so the copy below sees the actual data instead of whatever was there before.
+	framebufferManager_->FlushPendingReadbacks(src, size);
+	// Also note reads of depth buffers, so forced depth downloads can be narrowed
+	// to the region the game actually looks at.
+	framebufferManager_->NotifyDepthbufferRead(src, size);
+
 	// Track stray copies of a framebuffer in RAM. MotoGP does this.
 	if (framebufferManager_->MayIntersectFramebufferColor(src) || framebufferManager_->MayIntersectFramebufferColor(dest)) {
 		if (!framebufferManager_->NotifyFramebufferCopy(src, dest, size, flags, gstate_c.skipDrawReason)) {
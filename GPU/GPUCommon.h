@@ -226,6 +226,7 @@ public:
 
 protected:
 	void ClearCacheNextFrame() override {}
+	void ReloadTextureReplacementNextFrame() override {}
 
 	virtual void CheckRenderResized() {}
 
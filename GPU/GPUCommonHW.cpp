@@ -1,4 +1,5 @@
 #include "Common/Profiler/Profiler.h"
+#include "Common/Math/CrossSIMD.h"
 
 #include "Common/GPU/thin3d.h"
 #include "Common/Serialize/Serializer.h"
@@ -9,6 +10,7 @@
 #include "Core/Util/PPGeDraw.h"
 
 #include "GPU/GPUCommonHW.h"
+#include "GPU/Common/ShaderId.h"
 #include "GPU/Common/SplineCommon.h"
 #include "GPU/Common/DrawEngineCommon.h"
 #include "GPU/Common/TextureCacheCommon.h"
@@ -362,6 +364,9 @@ const CommonCommandTableEntry commonCommandTable[] = {
 GPUCommonHW::GPUCommonHW(GraphicsContext *gfxCtx, Draw::DrawContext *draw) : GPUCommon(gfxCtx, draw) {
 	memset(cmdInfo_, 0, sizeof(cmdInfo_));
 
+	// New game, so the set of light permutations worth specializing starts over.
+	ResetSpecializedLightConfigs();
+
 	// Convert the command table to a faster format, and check for dupes.
 	std::set<u8> dupeCheck;
 	for (size_t i = 0; i < ARRAY_SIZE(commonCommandTable); i++) {
@@ -472,13 +477,13 @@ void GPUCommonHW::UpdateCmdInfo() {
 		cmdInfo_[GE_CMD_VERTEXTYPE].func = &GPUCommonHW::Execute_VertexType;
 	}
 
-	// Reconfigure for light ubershader or not.
+	// Reconfigure for light ubershader or not. Note that even with the ubershader, the
+	// shader state stays dirty on light changes - the hottest light permutations still
+	// get specialized shaders, so the ID depends on the light config. See ShaderId.cpp.
 	for (int i = 0; i < 4; i++) {
 		if (gstate_c.Use(GPU_USE_LIGHT_UBERSHADER)) {
-			cmdInfo_[GE_CMD_LIGHTENABLE0 + i].RemoveDirty(DIRTY_VERTEXSHADER_STATE);
-			cmdInfo_[GE_CMD_LIGHTENABLE0 + i].AddDirty(DIRTY_LIGHT_CONTROL);
-			cmdInfo_[GE_CMD_LIGHTTYPE0 + i].RemoveDirty(DIRTY_VERTEXSHADER_STATE);
-			cmdInfo_[GE_CMD_LIGHTTYPE0 + i].AddDirty(DIRTY_LIGHT_CONTROL);
+			cmdInfo_[GE_CMD_LIGHTENABLE0 + i].AddDirty(DIRTY_LIGHT_CONTROL | DIRTY_VERTEXSHADER_STATE);
+			cmdInfo_[GE_CMD_LIGHTTYPE0 + i].AddDirty(DIRTY_LIGHT_CONTROL | DIRTY_VERTEXSHADER_STATE);
 		} else {
 			cmdInfo_[GE_CMD_LIGHTENABLE0 + i].RemoveDirty(DIRTY_LIGHT_CONTROL);
 			cmdInfo_[GE_CMD_LIGHTENABLE0 + i].AddDirty(DIRTY_VERTEXSHADER_STATE);
@@ -488,8 +493,7 @@ void GPUCommonHW::UpdateCmdInfo() {
 	}
 
 	if (gstate_c.Use(GPU_USE_LIGHT_UBERSHADER)) {
-		cmdInfo_[GE_CMD_MATERIALUPDATE].RemoveDirty(DIRTY_VERTEXSHADER_STATE);
-		cmdInfo_[GE_CMD_MATERIALUPDATE].AddDirty(DIRTY_LIGHT_CONTROL);
+		cmdInfo_[GE_CMD_MATERIALUPDATE].AddDirty(DIRTY_LIGHT_CONTROL | DIRTY_VERTEXSHADER_STATE);
 	} else {
 		cmdInfo_[GE_CMD_MATERIALUPDATE].RemoveDirty(DIRTY_LIGHT_CONTROL);
 		cmdInfo_[GE_CMD_MATERIALUPDATE].AddDirty(DIRTY_VERTEXSHADER_STATE);
@@ -563,6 +567,10 @@ void GPUCommonHW::ClearCacheNextFrame() {
 	textureCache_->ClearNextFrame();
 }
 
+void GPUCommonHW::ReloadTextureReplacementNextFrame() {
+	textureCache_->ReplacementReloadNextFrame();
+}
+
 // Needs to be called on GPU thread, not reporting thread.
 void GPUCommonHW::BuildReportingInfo() {
 	using namespace Draw;
@@ -832,35 +840,64 @@ void GPUCommonHW::FastRunLoop(DisplayList &list) {
 
 	const CommandInfo *cmdInfo = cmdInfo_;
 	int dc = downcount;
-	for (; dc > 0; --dc) {
+	while (dc > 0) {
 		// We know that display list PCs have the upper nibble == 0 - no need to mask the pointer
-		const u32 op = *(const u32_le *)(Memory::base + list.pc);
-		const u32 cmd = op >> 24;
-		const CommandInfo &info = cmdInfo[cmd];
+		u32 op = *(const u32_le *)(Memory::base + list.pc);
+		u32 cmd = op >> 24;
+		uint64_t flags = cmdInfo[cmd].flags;
+
+		if ((flags & (FLAG_EXECUTE | FLAG_EXECUTEONCHANGE)) == 0) {
+			// Data-only run. Games emit long fixed sequences of state setters between draws,
+			// and since no handler can run until the next EXECUTE command, we can eat them in
+			// a tight straight-line loop here: flush once before the first actual state change
+			// (later flushes in the run would just early-out anyway), then only write the
+			// state words and accumulate the dirty bits, applied in one go at the end.
+			uint64_t dirty = 0;
+			bool flushed = false;
+			do {
+				const u32 diff = op ^ gstate.cmdmem[cmd];
+				if (diff != 0) {
+					if (!flushed && (flags & FLAG_FLUSHBEFOREONCHANGE)) {
+						drawEngineCommon_->DispatchFlush();
+						flushed = true;
+					}
+					gstate.cmdmem[cmd] = op;
+					dirty |= flags >> 8;
+				}
+				list.pc += 4;
+				if ((list.pc & 63) == 0) {
+					// Crossing into a new cache line; get the next one on the way.
+					PREFETCH_READ(Memory::base + list.pc + PREFETCH_DISTANCE);
+				}
+				if (--dc == 0)
+					break;
+				op = *(const u32_le *)(Memory::base + list.pc);
+				cmd = op >> 24;
+				flags = cmdInfo[cmd].flags;
+			} while ((flags & (FLAG_EXECUTE | FLAG_EXECUTEONCHANGE)) == 0);
+			if (dirty)
+				gstate_c.Dirty(dirty);
+			continue;
+		}
+
 		const u32 diff = op ^ gstate.cmdmem[cmd];
 		if (diff == 0) {
-			if (info.flags & FLAG_EXECUTE) {
+			if (flags & FLAG_EXECUTE) {
 				downcount = dc;
-				(this->*info.func)(op, diff);
+				(this->*cmdInfo[cmd].func)(op, diff);
 				dc = downcount;
 			}
 		} else {
-			uint64_t flags = info.flags;
 			if (flags & FLAG_FLUSHBEFOREONCHANGE) {
 				drawEngineCommon_->DispatchFlush();
 			}
 			gstate.cmdmem[cmd] = op;
-			if (flags & (FLAG_EXECUTE | FLAG_EXECUTEONCHANGE)) {
-				downcount = dc;
-				(this->*info.func)(op, diff);
-				dc = downcount;
-			} else {
-				uint64_t dirty = flags >> 8;
-				if (dirty)
-					gstate_c.Dirty(dirty);
-			}
+			downcount = dc;
+			(this->*cmdInfo[cmd].func)(op, diff);
+			dc = downcount;
 		}
 		list.pc += 4;
+		--dc;
 	}
 	downcount = 0;
 }
@@ -960,7 +997,7 @@ void GPUCommonHW::Execute_Prim(u32 op, u32 diff) {
 
 	u32 count = op & 0xFFFF;
 	// Must check this after SetRenderFrameBuffer so we know SKIPDRAW_NON_DISPLAYED_FB.
-	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB)) {
+	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB | SKIPDRAW_UNSAMPLED_FB)) {
 		// Rough estimate, not sure what's correct.
 		cyclesExecuted += vertexCost_ * count;
 		if (gstate.isModeClear()) {
@@ -1224,6 +1261,12 @@ void GPUCommonHW::Execute_Prim(u32 op, u32 diff) {
 			break;
 
 		default:
+			// State commands with unchanged data and no execute handler are complete no-ops in
+			// the main interpreter too (see FastRunLoop), so we can consume them and keep the
+			// batch going. UI-heavy games re-issue identical state between tiny draws a lot.
+			if (data == gstate.cmdmem[data >> 24] && !(cmdInfo_[data >> 24].flags & FLAG_EXECUTE)) {
+				break;
+			}
 			// All other commands might need a flush or something, stop this inner loop.
 			goto bail;
 		}
@@ -1260,7 +1303,7 @@ void GPUCommonHW::Execute_Bezier(u32 op, u32 diff) {
 
 	// This also make skipping drawing very effective.
 	VirtualFramebuffer *vfb = framebufferManager_->SetRenderFrameBuffer(gstate_c.IsDirty(DIRTY_FRAMEBUF), gstate_c.skipDrawReason);
-	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB)) {
+	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB | SKIPDRAW_UNSAMPLED_FB)) {
 		// TODO: Should this eat some cycles?  Probably yes.  Not sure if important.
 		return;
 	}
@@ -1332,7 +1375,7 @@ void GPUCommonHW::Execute_Spline(u32 op, u32 diff) {
 
 	// This also make skipping drawing very effective.
 	VirtualFramebuffer *vfb = framebufferManager_->SetRenderFrameBuffer(gstate_c.IsDirty(DIRTY_FRAMEBUF), gstate_c.skipDrawReason);
-	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB)) {
+	if (gstate_c.skipDrawReason & (SKIPDRAW_SKIPFRAME | SKIPDRAW_NON_DISPLAYED_FB | SKIPDRAW_UNSAMPLED_FB)) {
 		// TODO: Should this eat some cycles?  Probably yes.  Not sure if important.
 		return;
 	}
@@ -1746,25 +1789,34 @@ void GPUCommonHW::Execute_TexFlush(u32 op, u32 diff) {
 	// Games call this when they need the effect of drawing to be visible to texturing.
 	// And for a bunch of other reasons, but either way, this is what we need to do.
 	// It's possible we could also use this as a hint for the texture cache somehow.
-	framebufferManager_->DiscardFramebufferCopy();
+	// If nothing has actually been drawn to the copied buffer since the copy was made,
+	// we get to keep it - games spam this command, and re-copying identical contents is wasted work.
+	framebufferManager_->DiscardFramebufferCopyIfStale();
+}
+
+size_t GPUCommonHW::NumLoadedTextures() const {
+	return textureCache_->NumLoadedTextures();
 }
 
 size_t GPUCommonHW::FormatGPUStatsCommon(char *buffer, size_t size) {
 	float vertexAverageCycles = gpuStats.numVertsSubmitted > 0 ? (float)gpuStats.vertexGPUCycles / (float)gpuStats.numVertsSubmitted : 0.0f;
 	return snprintf(buffer, size,
-		"DL processing time: %0.2f ms, %d drawsync, %d listsync\n"
+		"DL processing time: %0.2f ms, %d drawsync, %d listsync, %d stall upd (%d skipped)\n"
 		"Draw: %d (%d dec, %d culled), flushes %d, clears %d, bbox jumps %d (%d updates)\n"
-		"Vertices: %d dec: %d drawn: %d\n"
+		"Vertices: %d dec: %d drawn: %d deduped: %d\n"
 		"FBOs active: %d (evaluations: %d)\n"
 		"Textures: %d, dec: %d, invalidated: %d, hashed: %d kB, clut %d\n"
-		"readbacks %d (%d non-block), upload %d (cached %d), depal %d\n"
+		"Tex sizes: %s\n"
+		"readbacks %d (%d non-block), upload %d (cached %d), depal %d, uniforms %d kB\n"
 		"block transfers: %d\n"
 		"replacer: tracks %d references, %d unique textures\n"
-		"Cpy: depth %d, color %d, reint %d, blend %d, self %d\n"
+		"Cpy: depth %d, color %d, reint %d, blend %d, self %d (%d elided)\n"
 		"GPU cycles: %d (%0.1f per vertex)\n%s",
 		gpuStats.msProcessingDisplayLists * 1000.0f,
 		gpuStats.numDrawSyncs,
 		gpuStats.numListSyncs,
+		gpuStats.numStallUpdates,
+		gpuStats.numStallUpdatesSkipped,
 		gpuStats.numDrawCalls,
 		gpuStats.numVertexDecodes,
 		gpuStats.numCulledDraws,
@@ -1775,6 +1827,7 @@ size_t GPUCommonHW::FormatGPUStatsCommon(char *buffer, size_t size) {
 		gpuStats.numVertsSubmitted,
 		gpuStats.numVertsDecoded,
 		gpuStats.numUncachedVertsDrawn,
+		gpuStats.numVertsDeduped,
 		(int)framebufferManager_->NumVFBs(),
 		gpuStats.numFramebufferEvaluations,
 		(int)textureCache_->NumLoadedTextures(),
@@ -1782,10 +1835,12 @@ size_t GPUCommonHW::FormatGPUStatsCommon(char *buffer, size_t size) {
 		gpuStats.numTextureInvalidations,
 		gpuStats.numTextureDataBytesHashed / 1024,
 		gpuStats.numClutTextures,
+		textureCache_->GetCacheHistogramString().c_str(),
 		gpuStats.numBlockingReadbacks,
 		gpuStats.numReadbacks,
 		gpuStats.numUploads,
 		gpuStats.numCachedUploads,
+		gpuStats.numUniformUploadBytes / 1024,
 		gpuStats.numDepal,
 		gpuStats.numBlockTransfers,
 		gpuStats.numReplacerTrackedTex,
@@ -1795,6 +1850,7 @@ size_t GPUCommonHW::FormatGPUStatsCommon(char *buffer, size_t size) {
 		gpuStats.numReinterpretCopies,
 		gpuStats.numCopiesForShaderBlend,
 		gpuStats.numCopiesForSelfTex,
+		gpuStats.numElidedSelfTexCopies,
 		gpuStats.vertexGPUCycles + gpuStats.otherGPUCycles,
 		vertexAverageCycles,
 		debugRecording_ ? "(debug-recording)" : ""
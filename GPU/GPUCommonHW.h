@@ -71,6 +71,8 @@ public:
 
 	bool PresentedThisFrame() const override;
 
+	size_t NumLoadedTextures() const override;
+
 private:
 	void CheckDepthUsage(VirtualFramebuffer *vfb) override;
 	void CheckFlushOp(int cmd, u32 diff);
@@ -81,6 +83,7 @@ protected:
 
 	void PreExecuteOp(u32 op, u32 diff) override;
 	void ClearCacheNextFrame() override;
+	void ReloadTextureReplacementNextFrame() override;
 
 	// Needs to be called on GPU thread, not reporting thread.
 	void BuildReportingInfo() override;
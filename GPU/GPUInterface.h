@@ -220,6 +220,9 @@ public:
 	// Tells the GPU to update the gpuStats structure.
 	virtual void GetStats(char *buffer, size_t bufsize) = 0;
 
+	// Current number of entries in the texture cache. 0 if the backend has no texture cache (softgpu).
+	virtual size_t NumLoadedTextures() const { return 0; }
+
 	// Invalidate any cached content sourced from the specified range.
 	// If size = -1, invalidate everything.
 	virtual void InvalidateCache(u32 addr, int size, GPUInvalidationType type) = 0;
@@ -237,6 +240,10 @@ public:
 	// Will cause the texture cache to be cleared at the start of the next frame.
 	virtual void ClearCacheNextFrame() = 0;
 
+	// Re-reads the texture replacement pack at the start of the next frame, reloading
+	// only the textures whose files changed. For texture pack authors.
+	virtual void ReloadTextureReplacementNextFrame() = 0;
+
 	// Internal hack to avoid interrupts from "PPGe" drawing (utility UI, etc)
 	virtual void EnableInterrupts(bool enable) = 0;
 
@@ -26,6 +26,7 @@
 #include "GPU/Software/BinManager.h"
 #include "GPU/Software/Rasterizer.h"
 #include "GPU/Software/RasterizerRectangle.h"
+#include "GPU/Software/SoftGpu.h"
 
 // Sometimes useful for debugging.
 static constexpr bool FORCE_SINGLE_THREAD = false;
@@ -338,6 +339,93 @@ void BinManager::MarkPendingWrites(const Rasterizer::RasterizerState &state) {
 		pendingWrites_[1].Expand(gstate.getDepthBufAddress() & mirrorMask, 2, gstate.DepthBufStride(), scissorTL, scissorBR);
 }
 
+void BinManager::MarkDepthRaise(const Rasterizer::RasterizerState &state) {
+	if (depthRaisePending_ || !state.pixelID.depthWrite)
+		return;
+
+	// In clear mode, depthWrite means a depth clear, which can store any value.
+	// Otherwise, only LESS/LEQUAL tests guarantee stored depth never increases.
+	const GEComparison depthFunc = state.pixelID.DepthTestFunc();
+	if (state.pixelID.clearMode || (depthFunc != GE_COMP_LESS && depthFunc != GE_COMP_LEQUAL)) {
+		depthRaisePending_ = true;
+		// Any already built grid can no longer be trusted for later items.
+		coarseZValid_ = false;
+	}
+}
+
+void BinManager::BuildCoarseZ() {
+	PROFILE_THIS_SCOPE("bin_coarsez");
+
+	const BinItem &first = queue_.PeekNext();
+	const uint32_t stride = states_[first.stateIndex].pixelID.cached.depthbufStride;
+	if (stride == 0 || depthbuf.as16 == nullptr)
+		return;
+
+	const DrawingCoords tl = TransformUnit::ScreenToDrawing(queueRange_.x1, queueRange_.y1);
+	const DrawingCoords br = TransformUnit::ScreenToDrawing(queueRange_.x2, queueRange_.y2);
+	coarseZOriginX_ = tl.x / COARSE_Z_TILE_PIXELS;
+	coarseZOriginY_ = tl.y / COARSE_Z_TILE_PIXELS;
+	coarseZTilesX_ = br.x / COARSE_Z_TILE_PIXELS - coarseZOriginX_ + 1;
+	coarseZTilesY_ = br.y / COARSE_Z_TILE_PIXELS - coarseZOriginY_ + 1;
+	coarseZMax_.resize(coarseZTilesX_ * coarseZTilesY_);
+
+	// Only scan the drawn range - a tile max over a superset of the pixels an
+	// item can touch is still a valid upper bound, a subset wouldn't be.
+	for (int ty = 0; ty < coarseZTilesY_; ++ty) {
+		const int y1 = std::max((coarseZOriginY_ + ty) * COARSE_Z_TILE_PIXELS, (int)tl.y);
+		const int y2 = std::min((coarseZOriginY_ + ty) * COARSE_Z_TILE_PIXELS + COARSE_Z_TILE_PIXELS - 1, (int)br.y);
+		for (int tx = 0; tx < coarseZTilesX_; ++tx) {
+			const int x1 = std::max((coarseZOriginX_ + tx) * COARSE_Z_TILE_PIXELS, (int)tl.x);
+			const int x2 = std::min((coarseZOriginX_ + tx) * COARSE_Z_TILE_PIXELS + COARSE_Z_TILE_PIXELS - 1, (int)br.x);
+
+			uint16_t maxZ = 0;
+			for (int y = y1; y <= y2; ++y) {
+				const u16 *row = depthbuf.Get16Ptr(x1, y, stride);
+				for (int x = x1; x <= x2; ++x)
+					maxZ = std::max(maxZ, row[x - x1]);
+			}
+			coarseZMax_[ty * coarseZTilesX_ + tx] = maxZ;
+		}
+	}
+
+	coarseZValid_ = true;
+}
+
+bool BinManager::RejectedByCoarseZ(const BinItem &item, const Rasterizer::RasterizerState &state) {
+	if (!coarseZValid_ || item.type != BinItemType::TRIANGLE)
+		return false;
+
+	// Skipping is only safe when a failed depth test has no side effects.
+	if (state.pixelID.clearMode || state.pixelID.stencilTest)
+		return false;
+	const GEComparison depthFunc = state.pixelID.DepthTestFunc();
+	if (depthFunc != GE_COMP_LESS && depthFunc != GE_COMP_LEQUAL)
+		return false;
+
+	// Interpolation stays within the vertex range, but allow one unit of
+	// rounding slop and treat the test as LEQUAL to stay conservative.
+	const int minZ = (int)std::min(std::min(item.v0.screenpos.z, item.v1.screenpos.z), item.v2.screenpos.z) - 1;
+	const DrawingCoords tl = TransformUnit::ScreenToDrawing(item.range.x1, item.range.y1);
+	const DrawingCoords br = TransformUnit::ScreenToDrawing(item.range.x2, item.range.y2);
+	const int tx1 = tl.x / COARSE_Z_TILE_PIXELS - coarseZOriginX_;
+	const int ty1 = tl.y / COARSE_Z_TILE_PIXELS - coarseZOriginY_;
+	const int tx2 = br.x / COARSE_Z_TILE_PIXELS - coarseZOriginX_;
+	const int ty2 = br.y / COARSE_Z_TILE_PIXELS - coarseZOriginY_;
+	// Items queued after the grid was built may extend outside it.
+	if (tx1 < 0 || ty1 < 0 || tx2 >= coarseZTilesX_ || ty2 >= coarseZTilesY_)
+		return false;
+
+	for (int ty = ty1; ty <= ty2; ++ty) {
+		for (int tx = tx1; tx <= tx2; ++tx) {
+			if (minZ <= coarseZMax_[ty * coarseZTilesX_ + tx])
+				return false;
+		}
+	}
+
+	coarseZRejects_++;
+	return true;
+}
+
 inline void BinDirtyRange::Expand(uint32_t newBase, uint32_t bpp, uint32_t stride, const DrawingCoords &tl, const DrawingCoords &br) {
 	const uint32_t w = br.x - tl.x + 1;
 	const uint32_t h = br.y - tl.y + 1;
@@ -395,6 +483,7 @@ void BinManager::AddTriangle(const VertexData &v0, const VertexData &v1, const V
 		Drain();
 	queue_.Push(BinItem{ BinItemType::TRIANGLE, stateIndex_, range, v0, v1, v2 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, v2);
+	MarkDepthRaise(states_[stateIndex_]);
 	Expand(range);
 }
 
@@ -407,6 +496,7 @@ void BinManager::AddClearRect(const VertexData &v0, const VertexData &v1) {
 		Drain();
 	queue_.Push(BinItem{ BinItemType::CLEAR_RECT, stateIndex_, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, true);
+	MarkDepthRaise(states_[stateIndex_]);
 	Expand(range);
 }
 
@@ -419,6 +509,7 @@ void BinManager::AddRect(const VertexData &v0, const VertexData &v1) {
 		Drain();
 	queue_.Push(BinItem{ BinItemType::RECT, stateIndex_, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, true);
+	MarkDepthRaise(states_[stateIndex_]);
 	Expand(range);
 }
 
@@ -431,6 +522,7 @@ void BinManager::AddSprite(const VertexData &v0, const VertexData &v1) {
 		Drain();
 	queue_.Push(BinItem{ BinItemType::SPRITE, stateIndex_, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, true);
+	MarkDepthRaise(states_[stateIndex_]);
 	Expand(range);
 }
 
@@ -443,6 +535,7 @@ void BinManager::AddLine(const VertexData &v0, const VertexData &v1) {
 		Drain();
 	queue_.Push(BinItem{ BinItemType::LINE, stateIndex_, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, false);
+	MarkDepthRaise(states_[stateIndex_]);
 	Expand(range);
 }
 
@@ -455,6 +548,7 @@ void BinManager::AddPoint(const VertexData &v0) {
 		Drain();
 	queue_.Push(BinItem{ BinItemType::POINT, stateIndex_, range, v0 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0);
+	MarkDepthRaise(states_[stateIndex_]);
 	Expand(range);
 }
 
@@ -478,16 +572,23 @@ void BinManager::Drain(bool flushing) {
 				maxTasks_ = std::min(g_threadManager.GetNumLooperThreads(), MAX_POSSIBLE_TASKS);
 		}
 
+		// Cut the range into more strips than we have tasks, and deal them out
+		// round-robin below. With equal-size strips pinned 1:1 to threads, a skewed
+		// screen-space distribution (HUD on one side, action on the other) leaves
+		// some cores idle; interleaving two strips per queue evens that out while
+		// keeping each queue single-producer/single-consumer.
+		const int strips = maxTasks_ > 1 ? maxTasks_ * 2 : 1;
+
 		taskRanges_.clear();
 		if (h2 >= 18 && w2 >= h2 * 4) {
-			int bin_w = std::max(4, (w2 + maxTasks_ - 1) / maxTasks_) * SCREEN_SCALE_FACTOR * 2;
+			int bin_w = std::max(4, (w2 + strips - 1) / strips) * SCREEN_SCALE_FACTOR * 2;
 			taskRanges_.push_back(BinCoords{ tl.x, tl.y, queueRange_.x1 + bin_w - 1, br.y - 1 });
 			for (int x = queueRange_.x1 + bin_w; x <= queueRange_.x2; x += bin_w) {
 				int x2 = x + bin_w > queueRange_.x2 ? br.x : x + bin_w;
 				taskRanges_.push_back(BinCoords{ x, tl.y, x2 - 1, br.y - 1 });
 			}
 		} else if (h2 >= 18 && w2 >= 18) {
-			int bin_h = std::max(4, (h2 + maxTasks_ - 1) / maxTasks_) * SCREEN_SCALE_FACTOR * 2;
+			int bin_h = std::max(4, (h2 + strips - 1) / strips) * SCREEN_SCALE_FACTOR * 2;
 			taskRanges_.push_back(BinCoords{ tl.x, tl.y, br.x - 1, queueRange_.y1 + bin_h - 1 });
 			for (int y = queueRange_.y1 + bin_h; y <= queueRange_.y2; y += bin_h) {
 				int y2 = y + bin_h > queueRange_.y2 ? br.y : y + bin_h;
@@ -502,25 +603,42 @@ void BinManager::Drain(bool flushing) {
 	OptimizePendingStates(pendingStateIndex_, stateIndex_);
 	pendingStateIndex_ = stateIndex_;
 
+	// With a big enough batch, scan the depth buffer into the coarse grid so
+	// whole triangles behind the current depth can be skipped below.
+	if (!coarseZValid_ && !depthRaisePending_ && (int)queue_.Size() >= COARSE_Z_MIN_PRIMS)
+		BuildCoarseZ();
+
 	if (taskRanges_.size() <= 1) {
 		PROFILE_THIS_SCOPE("bin_drain_single");
 		while (!queue_.Empty()) {
 			const BinItem &item = queue_.PeekNext();
-			DrawBinItem(item, states_[item.stateIndex]);
+			if (!RejectedByCoarseZ(item, states_[item.stateIndex]))
+				DrawBinItem(item, states_[item.stateIndex]);
 			queue_.SkipNext();
 		}
 	} else {
+		// Strips are dealt round-robin onto the task queues - there can be more
+		// strips than queues, see the split above. Each item carries its clipped
+		// range, so one queue serving multiple strips stays correct.
+		const int numQueues = std::min((int)taskRanges_.size(), maxTasks_);
 		int max = flushing ? QUEUED_PRIMS : QUEUED_PRIMS / 2;
 		while (!queue_.Empty()) {
 			const BinItem &item = queue_.PeekNext();
+			if (RejectedByCoarseZ(item, states_[item.stateIndex])) {
+				queue_.SkipNext();
+				if (--max <= 0)
+					break;
+				continue;
+			}
 			for (int i = 0; i < (int)taskRanges_.size(); ++i) {
 				const BinCoords range = taskRanges_[i].Intersect(item.range);
 				if (range.Invalid())
 					continue;
 
-				if (taskQueues_[i].NearFull()) {
+				BinItemQueue &taskQueue = taskQueues_[i % numQueues];
+				if (taskQueue.NearFull()) {
 					// This shouldn't often happen, but if it does, wait for space.
-					if (taskQueues_[i].Full())
+					if (taskQueue.Full())
 						waitable_->Wait();
 					// If we're not flushing and not near full, let's just continue later.
 					// Near full means we'd drain on next prim, so better to finish it now.
@@ -528,10 +646,10 @@ void BinManager::Drain(bool flushing) {
 						max = 0;
 				}
 
-				BinItem &taskItem = taskQueues_[i].PeekPush();
+				BinItem &taskItem = taskQueue.PeekPush();
 				taskItem = item;
 				taskItem.range = range;
-				taskQueues_[i].PushPeeked();
+				taskQueue.PushPeeked();
 			}
 			queue_.SkipNext();
 			if (--max <= 0)
@@ -539,7 +657,7 @@ void BinManager::Drain(bool flushing) {
 		}
 
 		int threads = 0;
-		for (int i = 0; i < (int)taskRanges_.size(); ++i) {
+		for (int i = 0; i < numQueues; ++i) {
 			if (taskQueues_[i].Empty())
 				continue;
 			threads++;
@@ -587,6 +705,10 @@ void BinManager::Flush(const char *reason) {
 	pendingOverlap_ = false;
 	pendingReads_.clear();
 
+	// Everything's drawn, so the next batch tracks depth raises from scratch.
+	coarseZValid_ = false;
+	depthRaisePending_ = false;
+
 	// We'll need to set the pending writes and reads again, since we just flushed it.
 	dirty_ |= SoftDirty::BINNER_RANGE | SoftDirty::BINNER_OVERLAP;
 
@@ -700,12 +822,13 @@ void BinManager::GetStats(char *buffer, size_t bufsize) {
 		"Slowest frame flush: %s (%0.4f)\n"
 		"Slowest recent flush: %s (%0.4f)\n"
 		"Total flush time: %0.4f (%05.2f%%, last 2: %05.2f%%)\n"
-		"Thread enqueues: %d, count %d",
+		"Thread enqueues: %d, count %d\n"
+		"Coarse Z rejects: %d",
 		slowestFlushReason_, slowestFlushTime_,
 		slowestTotalReason, slowestTotalTime,
 		slowestRecentReason, slowestRecentTime,
 		allTotal, allTotal * (6000.0 / 1.001), recentTotal * (3000.0 / 1.001),
-		enqueues_, mostThreads_);
+		enqueues_, mostThreads_, coarseZRejects_);
 }
 
 void BinManager::ResetStats() {
@@ -715,6 +838,7 @@ void BinManager::ResetStats() {
 	slowestFlushTime_ = 0.0;
 	enqueues_ = 0;
 	mostThreads_ = 0;
+	coarseZRejects_ = 0;
 }
 
 inline BinCoords BinCoords::Intersect(const BinCoords &range) const {
@@ -236,6 +236,10 @@ protected:
 	static constexpr int QUEUED_CLUTS = 512;
 	// About 360 KB, but we have usually 16 or less of them, so 5 MB - 22 MB.
 	static constexpr int QUEUED_PRIMS = 2048;
+	// Tile size of the coarse max-depth grid used for early rejection.
+	static constexpr int COARSE_Z_TILE_PIXELS = 8;
+	// Scanning the depth buffer isn't worth it for small batches.
+	static constexpr int COARSE_Z_MIN_PRIMS = 32;
 
 	typedef BinQueue<Rasterizer::RasterizerState, QUEUED_STATES> BinStateQueue;
 	typedef BinQueue<BinClut, QUEUED_CLUTS> BinClutQueue;
@@ -262,6 +266,17 @@ private:
 	BinDirtyRange pendingWrites_[2]{};
 	std::unordered_map<uint32_t, BinDirtyRange> pendingReads_;
 
+	// Coarse max-depth grid ("hi-Z") over the drawn range, one entry per 8x8 tile.
+	// Only usable while every pending item can only decrease stored depth.
+	std::vector<uint16_t> coarseZMax_;
+	int coarseZOriginX_ = 0;
+	int coarseZOriginY_ = 0;
+	int coarseZTilesX_ = 0;
+	int coarseZTilesY_ = 0;
+	bool coarseZValid_ = false;
+	bool depthRaisePending_ = false;
+	int coarseZRejects_ = 0;
+
 	bool pendingOverlap_ = false;
 	bool creatingState_ = false;
 	uint16_t pendingStateIndex_ = 0;
@@ -276,6 +291,9 @@ private:
 
 	void MarkPendingReads(const Rasterizer::RasterizerState &state);
 	void MarkPendingWrites(const Rasterizer::RasterizerState &state);
+	void MarkDepthRaise(const Rasterizer::RasterizerState &state);
+	void BuildCoarseZ();
+	bool RejectedByCoarseZ(const BinItem &item, const Rasterizer::RasterizerState &state);
 	bool HasTextureWrite(const Rasterizer::RasterizerState &state);
 	static bool IsExactSelfRender(const Rasterizer::RasterizerState &state, const BinItem &item);
 	void OptimizePendingStates(uint16_t first, uint16_t last);
@@ -145,6 +145,13 @@ private:
 	int stackIDOffset_ = 0;
 	bool colorIs16Bit_ = false;
 #endif
+#if PPSSPP_ARCH(ARM64_NEON)
+	void Discard();
+	void Discard(Arm64Gen::CCFlags cc);
+
+	// Used for any test failure.
+	std::vector<Arm64Gen::FixupBranch> discards_;
+#endif
 };
 
 #if defined(__clang__) || defined(__GNUC__)
@@ -0,0 +1,306 @@
+// Copyright (c) 2023- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include "ppsspp_config.h"
+#if PPSSPP_ARCH(ARM64_NEON)
+
+#include "Common/Arm64Emitter.h"
+#include "GPU/GPUState.h"
+#include "GPU/Software/DrawPixel.h"
+#include "GPU/Software/SoftGpu.h"
+#include "GPU/ge_constants.h"
+
+using namespace Arm64Gen;
+
+namespace Rasterizer {
+
+// This backend doesn't handle the full pixel pipeline like the x86 one (yet.)
+// It sticks to the common case: a non-clear write to a 32-bit target without
+// blending, tests, fog, or dithering.  Anything else returns nullptr here and
+// runs through the C++ path, which is already NEON optimized.
+static bool SupportedSingle(const PixelFuncID &id) {
+	if (id.clearMode || id.FBFormat() != GE_FORMAT_8888)
+		return false;
+	if (id.AlphaTestFunc() != GE_COMP_ALWAYS || id.colorTest || id.stencilTest)
+		return false;
+	if (id.alphaBlend || id.applyFog || id.dithering || id.applyLogicOp || id.applyColorWriteMask)
+		return false;
+	return true;
+}
+
+SingleFunc PixelJitCache::CompileSingle(const PixelFuncID &id) {
+	if (!SupportedSingle(id))
+		return nullptr;
+
+	// Setup the reg cache and disallow spill for arguments.
+	regCache_.SetupABI({
+		RegCache::GEN_ARG_X,
+		RegCache::GEN_ARG_Y,
+		RegCache::GEN_ARG_Z,
+		RegCache::GEN_ARG_FOG,
+		RegCache::VEC_ARG_COLOR,
+		RegCache::GEN_ARG_ID,
+	});
+
+	// Everything we touch is caller saved, so no prolog/epilog is needed.
+	BeginWrite(512);
+	Describe("Init");
+	const u8 *start = AlignCode16();
+	bool success = true;
+
+	// Start with the depth range.
+	success = success && Jit_ApplyDepthRange(id);
+
+	if (!id.clearMode)
+		success = success && Jit_DepthTest(id);
+	success = success && Jit_WriteDepth(id);
+	success = success && Jit_WriteColor(id);
+
+	// Any discarded pixel jumps straight to the return.
+	for (auto &fixup : discards_) {
+		SetJumpTarget(fixup);
+	}
+	discards_.clear();
+
+	RET();
+
+	static constexpr RegCache::Purpose purposes[] = {
+		RegCache::GEN_ARG_X,
+		RegCache::GEN_ARG_Y,
+		RegCache::GEN_ARG_Z,
+		RegCache::GEN_ARG_FOG,
+		RegCache::GEN_ARG_ID,
+		RegCache::VEC_ARG_COLOR,
+		RegCache::GEN_COLOR_OFF,
+		RegCache::GEN_DEPTH_OFF,
+	};
+	for (RegCache::Purpose p : purposes) {
+		if (regCache_.Has(p))
+			regCache_.ForceRelease(p);
+	}
+
+	if (!success) {
+		regCache_.Reset(false);
+		EndWrite();
+		ResetCodePtr(GetOffset(start));
+		return nullptr;
+	}
+
+	FlushIcache();
+	EndWrite();
+	regCache_.Reset(true);
+	return (SingleFunc)start;
+}
+
+RegCache::Reg PixelJitCache::GetPixelID() {
+	return regCache_.Find(RegCache::GEN_ARG_ID);
+}
+
+void PixelJitCache::UnlockPixelID(RegCache::Reg &r) {
+	regCache_.Unlock(r, RegCache::GEN_ARG_ID);
+}
+
+RegCache::Reg PixelJitCache::GetColorOff(const PixelFuncID &id) {
+	if (!regCache_.Has(RegCache::GEN_COLOR_OFF)) {
+		Describe("GetColorOff");
+		ARM64Reg r = regCache_.Alloc(RegCache::GEN_COLOR_OFF);
+		ARM64Reg argYReg = regCache_.Find(RegCache::GEN_ARG_Y);
+		if (id.useStandardStride) {
+			LSL(DecodeReg(r), DecodeReg(argYReg), 9);
+		} else {
+			ARM64Reg idReg = GetPixelID();
+			LDRH(INDEX_UNSIGNED, DecodeReg(r), idReg, offsetof(PixelFuncID, cached.framebufStride));
+			UnlockPixelID(idReg);
+			MUL(DecodeReg(r), DecodeReg(r), DecodeReg(argYReg));
+		}
+		regCache_.Unlock(argYReg, RegCache::GEN_ARG_Y);
+
+		ARM64Reg argXReg = regCache_.Find(RegCache::GEN_ARG_X);
+		ADD(DecodeReg(r), DecodeReg(r), DecodeReg(argXReg));
+		regCache_.Unlock(argXReg, RegCache::GEN_ARG_X);
+
+		ARM64Reg temp = regCache_.Alloc(RegCache::GEN_TEMP_HELPER);
+		MOVP2R(temp, &fb.data);
+		LDR(INDEX_UNSIGNED, temp, temp, 0);
+		// The offset is zero extended by the 32-bit math above, only 8888 is supported.
+		ADD(r, temp, r, ArithOption(r, ST_LSL, 2));
+		regCache_.Release(temp, RegCache::GEN_TEMP_HELPER);
+
+		// Retain it, because we can't recalculate this.
+		regCache_.ForceRetain(RegCache::GEN_COLOR_OFF);
+		return r;
+	}
+	return regCache_.Find(RegCache::GEN_COLOR_OFF);
+}
+
+RegCache::Reg PixelJitCache::GetDepthOff(const PixelFuncID &id) {
+	if (!regCache_.Has(RegCache::GEN_DEPTH_OFF)) {
+		Describe("GetDepthOff");
+		ARM64Reg r = regCache_.Alloc(RegCache::GEN_DEPTH_OFF);
+		ARM64Reg argYReg = regCache_.Find(RegCache::GEN_ARG_Y);
+		if (id.useStandardStride) {
+			LSL(DecodeReg(r), DecodeReg(argYReg), 9);
+		} else {
+			ARM64Reg idReg = GetPixelID();
+			LDRH(INDEX_UNSIGNED, DecodeReg(r), idReg, offsetof(PixelFuncID, cached.depthbufStride));
+			UnlockPixelID(idReg);
+			MUL(DecodeReg(r), DecodeReg(r), DecodeReg(argYReg));
+		}
+		regCache_.Unlock(argYReg, RegCache::GEN_ARG_Y);
+
+		ARM64Reg argXReg = regCache_.Find(RegCache::GEN_ARG_X);
+		ADD(DecodeReg(r), DecodeReg(r), DecodeReg(argXReg));
+		regCache_.Unlock(argXReg, RegCache::GEN_ARG_X);
+
+		ARM64Reg temp = regCache_.Alloc(RegCache::GEN_TEMP_HELPER);
+		MOVP2R(temp, &depthbuf.data);
+		LDR(INDEX_UNSIGNED, temp, temp, 0);
+		ADD(r, temp, r, ArithOption(r, ST_LSL, 1));
+		regCache_.Release(temp, RegCache::GEN_TEMP_HELPER);
+
+		// Retain it, because we can't recalculate this.
+		regCache_.ForceRetain(RegCache::GEN_DEPTH_OFF);
+		return r;
+	}
+	return regCache_.Find(RegCache::GEN_DEPTH_OFF);
+}
+
+void PixelJitCache::Discard() {
+	discards_.push_back(B());
+}
+
+void PixelJitCache::Discard(Arm64Gen::CCFlags cc) {
+	discards_.push_back(B(cc));
+}
+
+bool PixelJitCache::Jit_ApplyDepthRange(const PixelFuncID &id) {
+	if (!id.applyDepthRange || id.earlyZChecks)
+		return true;
+
+	Describe("ApplyDepthR");
+	ARM64Reg idReg = GetPixelID();
+	ARM64Reg zReg = regCache_.Find(RegCache::GEN_ARG_Z);
+	ARM64Reg tempReg = regCache_.Alloc(RegCache::GEN_TEMP0);
+
+	LDR(INDEX_UNSIGNED, DecodeReg(tempReg), idReg, offsetof(PixelFuncID, cached.minz));
+	CMP(DecodeReg(zReg), DecodeReg(tempReg));
+	Discard(CC_LT);
+	LDR(INDEX_UNSIGNED, DecodeReg(tempReg), idReg, offsetof(PixelFuncID, cached.maxz));
+	CMP(DecodeReg(zReg), DecodeReg(tempReg));
+	Discard(CC_GT);
+
+	regCache_.Release(tempReg, RegCache::GEN_TEMP0);
+	regCache_.Unlock(zReg, RegCache::GEN_ARG_Z);
+	UnlockPixelID(idReg);
+	return true;
+}
+
+bool PixelJitCache::Jit_DepthTest(const PixelFuncID &id) {
+	if (id.earlyZChecks || id.DepthTestFunc() == GE_COMP_ALWAYS)
+		return true;
+	if (id.DepthTestFunc() == GE_COMP_NEVER) {
+		Discard();
+		return true;
+	}
+
+	Describe("DepthTest");
+	ARM64Reg depthOffReg = GetDepthOff(id);
+	ARM64Reg zReg = regCache_.Find(RegCache::GEN_ARG_Z);
+	ARM64Reg tempReg = regCache_.Alloc(RegCache::GEN_TEMP0);
+	LDRH(INDEX_UNSIGNED, DecodeReg(tempReg), depthOffReg, 0);
+	CMP(DecodeReg(zReg), DecodeReg(tempReg));
+	regCache_.Release(tempReg, RegCache::GEN_TEMP0);
+	regCache_.Unlock(zReg, RegCache::GEN_ARG_Z);
+	regCache_.Unlock(depthOffReg, RegCache::GEN_DEPTH_OFF);
+
+	// Discard when the test fails.
+	switch (id.DepthTestFunc()) {
+	case GE_COMP_EQUAL:
+		Discard(CC_NEQ);
+		break;
+	case GE_COMP_NOTEQUAL:
+		Discard(CC_EQ);
+		break;
+	case GE_COMP_LESS:
+		Discard(CC_GE);
+		break;
+	case GE_COMP_LEQUAL:
+		Discard(CC_GT);
+		break;
+	case GE_COMP_GREATER:
+		Discard(CC_LE);
+		break;
+	case GE_COMP_GEQUAL:
+		Discard(CC_LT);
+		break;
+	default:
+		break;
+	}
+	return true;
+}
+
+bool PixelJitCache::Jit_WriteDepth(const PixelFuncID &id) {
+	if (!id.depthWrite || id.clearMode)
+		return true;
+
+	Describe("WriteDepth");
+	ARM64Reg depthOffReg = GetDepthOff(id);
+	ARM64Reg zReg = regCache_.Find(RegCache::GEN_ARG_Z);
+	STRH(INDEX_UNSIGNED, DecodeReg(zReg), depthOffReg, 0);
+	regCache_.Unlock(zReg, RegCache::GEN_ARG_Z);
+	regCache_.Unlock(depthOffReg, RegCache::GEN_DEPTH_OFF);
+	return true;
+}
+
+bool PixelJitCache::Jit_WriteColor(const PixelFuncID &id) {
+	ARM64Reg colorOffReg = GetColorOff(id);
+
+	Describe("WriteColor");
+	// First, clamp the color to 8 bits per channel and pack it up.
+	ARM64Reg colorReg = regCache_.Find(RegCache::VEC_ARG_COLOR);
+	ARM64Reg zeroVecReg = regCache_.Alloc(RegCache::VEC_TEMP0);
+	ARM64Reg maxVecReg = regCache_.Alloc(RegCache::VEC_TEMP1);
+	fp.MOVI(32, zeroVecReg, 0);
+	fp.MOVI(32, maxVecReg, 0xFF);
+	fp.SMAX(32, colorReg, colorReg, zeroVecReg);
+	fp.SMIN(32, colorReg, colorReg, maxVecReg);
+	fp.XTN(16, EncodeRegToDouble(colorReg), colorReg);
+	fp.XTN(8, EncodeRegToDouble(colorReg), colorReg);
+	regCache_.Release(maxVecReg, RegCache::VEC_TEMP1);
+	regCache_.Release(zeroVecReg, RegCache::VEC_TEMP0);
+
+	ARM64Reg newColorReg = regCache_.Alloc(RegCache::GEN_TEMP0);
+	ARM64Reg oldColorReg = regCache_.Alloc(RegCache::GEN_TEMP1);
+	fp.UMOV(32, DecodeReg(newColorReg), colorReg, 0);
+	regCache_.Unlock(colorReg, RegCache::VEC_ARG_COLOR);
+
+	// The destination alpha is the stencil, which we aren't writing, so keep it.
+	LDR(INDEX_UNSIGNED, DecodeReg(oldColorReg), colorOffReg, 0);
+	ANDI2R(DecodeReg(newColorReg), DecodeReg(newColorReg), 0x00FFFFFF);
+	ANDI2R(DecodeReg(oldColorReg), DecodeReg(oldColorReg), 0xFF000000);
+	ORR(DecodeReg(newColorReg), DecodeReg(newColorReg), DecodeReg(oldColorReg));
+	STR(INDEX_UNSIGNED, DecodeReg(newColorReg), colorOffReg, 0);
+
+	regCache_.Release(oldColorReg, RegCache::GEN_TEMP1);
+	regCache_.Release(newColorReg, RegCache::GEN_TEMP0);
+	regCache_.Unlock(colorOffReg, RegCache::GEN_COLOR_OFF);
+	return true;
+}
+
+};
+
+#endif
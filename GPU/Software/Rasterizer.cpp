@@ -968,7 +968,7 @@ static inline Vec4<float> EdgeRecip(const Vec4<int> &w0, const Vec4<int> &w1, co
 #endif
 }
 
-template <bool clearMode, bool useSSE4>
+template <bool clearMode, bool interpColor, bool applyFog, bool useSSE4>
 void DrawTriangleSlice(
 	const VertexData& v0, const VertexData& v1, const VertexData& v2,
 	int x1, int y1, int x2, int y2,
@@ -997,10 +997,10 @@ void DrawTriangleSlice(
 	// All the z values are the same, no interpolation required.
 	// This is common, and when we interpolate, we lose accuracy.
 	const bool flatZ = v0.screenpos.z == v1.screenpos.z && v0.screenpos.z == v2.screenpos.z;
-	const bool flatColorAll = !state.shadeGouraud;
-	const bool flatColor0 = flatColorAll || (v0.color0 == v1.color0 && v0.color0 == v2.color0);
-	const bool flatColor1 = flatColorAll || (v0.color1 == v1.color1 && v0.color1 == v2.color1);
-	const bool noFog = clearMode || !pixelID.applyFog || (v0.fogdepth >= 1.0f && v1.fogdepth >= 1.0f && v2.fogdepth >= 1.0f);
+	// Whether any color interpolation happens at all is decided at dispatch in
+	// DrawTriangle - here we only distinguish which of the two colors varies.
+	const bool flatColor0 = !interpColor || (v0.color0 == v1.color0 && v0.color0 == v2.color0);
+	const bool flatColor1 = !interpColor || (v0.color1 == v1.color1 && v0.color1 == v2.color1);
 
 	if (pixelID.applyDepthRange && flatZ) {
 		if (v0.screenpos.z < pixelID.cached.minz || v0.screenpos.z > pixelID.cached.maxz)
@@ -1157,7 +1157,7 @@ void DrawTriangleSlice(
 				}
 
 				Vec4<int> fog = Vec4<int>::AssignToAll(255);
-				if (!noFog) {
+				if constexpr (applyFog) {
 					Vec4<float> fogdepths = w0.Cast<float>() * v0.fogdepth + w1.Cast<float>() * v1.fogdepth + w2.Cast<float>() * v2.fogdepth;
 					fogdepths = fogdepths * wsum_recip;
 					for (int i = 0; i < 4; ++i) {
@@ -1208,11 +1208,36 @@ void DrawTriangleSlice(
 void DrawTriangle(const VertexData &v0, const VertexData &v1, const VertexData &v2, const BinCoords &range, const RasterizerState &state) {
 	PROFILE_THIS_SCOPE("draw_tri");
 
-	auto drawSlice = cpu_info.bSSE4_1 ?
-		(state.pixelID.clearMode ? &DrawTriangleSlice<true, true> : &DrawTriangleSlice<false, true>) :
-		(state.pixelID.clearMode ? &DrawTriangleSlice<true, false> : &DrawTriangleSlice<false, false>);
+	typedef void (*DrawSliceFunc)(const VertexData &, const VertexData &, const VertexData &, int, int, int, int, const RasterizerState &);
+	// Indexed by clearMode * 8 + interpColor * 4 + applyFog * 2 + useSSE4.
+	static constexpr DrawSliceFunc drawSliceTable[16] = {
+		&DrawTriangleSlice<false, false, false, false>,
+		&DrawTriangleSlice<false, false, false, true>,
+		&DrawTriangleSlice<false, false, true, false>,
+		&DrawTriangleSlice<false, false, true, true>,
+		&DrawTriangleSlice<false, true, false, false>,
+		&DrawTriangleSlice<false, true, false, true>,
+		&DrawTriangleSlice<false, true, true, false>,
+		&DrawTriangleSlice<false, true, true, true>,
+		&DrawTriangleSlice<true, false, false, false>,
+		&DrawTriangleSlice<true, false, false, true>,
+		&DrawTriangleSlice<true, false, true, false>,
+		&DrawTriangleSlice<true, false, true, true>,
+		&DrawTriangleSlice<true, true, false, false>,
+		&DrawTriangleSlice<true, true, false, true>,
+		&DrawTriangleSlice<true, true, true, false>,
+		&DrawTriangleSlice<true, true, true, true>,
+	};
+
+	// Select a slice specialized for this triangle's attributes - in high-tri,
+	// low-fill scenes the per-quad checks otherwise dominate over actual shading.
+	const bool interpColor = state.shadeGouraud &&
+		(v0.color0 != v1.color0 || v0.color0 != v2.color0 || v0.color1 != v1.color1 || v0.color1 != v2.color1);
+	const bool applyFog = !state.pixelID.clearMode && state.pixelID.applyFog &&
+		!(v0.fogdepth >= 1.0f && v1.fogdepth >= 1.0f && v2.fogdepth >= 1.0f);
 
-	drawSlice(v0, v1, v2, range.x1, range.y1, range.x2, range.y2, state);
+	int index = (state.pixelID.clearMode ? 8 : 0) | (interpColor ? 4 : 0) | (applyFog ? 2 : 0) | (cpu_info.bSSE4_1 ? 1 : 0);
+	drawSliceTable[index](v0, v1, v2, range.x1, range.y1, range.x2, range.y2, state);
 }
 
 void DrawRectangle(const VertexData &v0, const VertexData &v1, const BinCoords &range, const RasterizerState &rastState) {
@@ -33,6 +33,7 @@
 #include "Common/GPU/GPUBackendCommon.h"
 #include "Common/GPU/Vulkan/VulkanMemory.h"
 #include "Common/GPU/Vulkan/VulkanImage.h"
+#include "Common/GPU/Vulkan/VulkanRenderManager.h"
 #include "Common/Data/Text/Parsers.h"
 #include "GPU/Vulkan/GPU_Vulkan.h"
 #include "GPU/Vulkan/VulkanUtil.h"
@@ -74,6 +75,11 @@ void DrawGPUMemoryVis(UIContext *ui, GPUInterface *gpu) {
 		str << "Overall " << NiceSizeFormat(totalUsedBytes) << " used out of " << NiceSizeFormat(totalBudget) << " available" << std::endl;
 	}
 
+	VulkanRenderManager *renderManager = (VulkanRenderManager *)draw->GetNativeObject(Draw::NativeObject::RENDER_MANAGER);
+	if (renderManager) {
+		str << "Pipeline compile queue depth: " << renderManager->GetCompileQueueDepth() << std::endl;
+	}
+
 	str << "Push buffers:" << std::endl;
 
 	// Now list the various push buffers.
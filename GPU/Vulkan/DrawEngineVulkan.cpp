@@ -195,6 +195,7 @@ void DrawEngineVulkan::DirtyAllUBOs() {
 	baseBuf = VK_NULL_HANDLE;
 	lightBuf = VK_NULL_HANDLE;
 	boneBuf = VK_NULL_HANDLE;
+	numBonesUploaded_ = 0;
 	dirtyUniforms_ = DIRTY_BASE_UNIFORMS | DIRTY_LIGHT_UNIFORMS | DIRTY_BONE_UNIFORMS;
 	imageView = VK_NULL_HANDLE;
 	sampler = VK_NULL_HANDLE;
@@ -256,12 +257,18 @@ void DrawEngineVulkan::DoFlush() {
 	if (useHWTransform) {
 		VkBuffer vbuf = VK_NULL_HANDLE;
 		VkBuffer ibuf = VK_NULL_HANDLE;
+		// Pure draws have no indices to remap, and with software skinning the vertices differ anyway.
+		const bool dedup = dedupVertices_ && !decOptions_.applySkinInDecode && !CollectedPureDraw();
 		if (decOptions_.applySkinInDecode && (lastVType_ & GE_VTYPE_WEIGHT_MASK)) {
 			// If software skinning, we're predecoding into "decoded". So make sure we're done, then push that content.
 			DecodeVerts(decoded_);
 			VkDeviceSize size = numDecodedVerts_ * dec_->GetDecVtxFmt().stride;
 			u8 *dest = (u8 *)pushVertex_->Allocate(size, 4, &vbuf, &vbOffset);
 			memcpy(dest, decoded_, size);
+		} else if (dedup) {
+			// Decode to CPU memory - the dedup pass below has to read the vertices back,
+			// which rules out decoding straight into the pushbuffer. Pushed after dedup.
+			DecodeVerts(decoded_);
 		} else {
 			// Figure out how much pushbuffer space we need to allocate.
 			int vertsToDecode = ComputeNumVertsToDecode();
@@ -273,7 +280,35 @@ void DrawEngineVulkan::DoFlush() {
 		int vertexCount;
 		int maxIndex;
 		bool useElements;
-		DecodeIndsAndGetData(&prim, &vertexCount, &maxIndex, &useElements, false);
+		if (CollectedPureDraw()) {
+			prim = drawInds_[0].prim;
+			vertexCount = numDecodedVerts_;
+			maxIndex = numDecodedVerts_;
+			useElements = false;
+		} else if (dedup) {
+			// Indices stay in CPU memory here since the dedup remap has to rewrite them.
+			vertexCount = DecodeInds();
+			const int numVerts = DedupDecodedVertices(numDecodedVerts_, decIndex_, vertexCount);
+			const VkDeviceSize size = numVerts * dec_->GetDecVtxFmt().stride;
+			u8 *dest = (u8 *)pushVertex_->Allocate(size, 4, &vbuf, &vbOffset);
+			memcpy(dest, decoded_, size);
+			ibOffset = (uint32_t)pushIndex_->Push(decIndex_, sizeof(uint16_t) * vertexCount, 4, &ibuf);
+			maxIndex = numVerts;
+			prim = IndexGenerator::GeneralPrim((GEPrimitiveType)drawInds_[0].prim);
+			useElements = true;
+		} else {
+			// Decode the indices directly into the pushbuffer too, like the vertices. The final
+			// size isn't known until strips and fans have been expanded, so allocate the worst
+			// case and hand back what we didn't use.
+			u8 *idest = pushIndex_->Allocate(ComputeDecodedIndexBound(), 4, &ibuf, &ibOffset);
+			indexGen.Setup((u16 *)idest);
+			vertexCount = DecodeInds();
+			indexGen.Setup(decIndex_);
+			pushIndex_->TrimLastAllocation(ibOffset, sizeof(uint16_t) * vertexCount);
+			maxIndex = numDecodedVerts_;
+			prim = IndexGenerator::GeneralPrim((GEPrimitiveType)drawInds_[0].prim);
+			useElements = true;
+		}
 
 		bool hasColor = (lastVType_ & GE_VTYPE_COL_MASK) != GE_VTYPE_COL_NONE;
 		if (gstate.isModeThrough()) {
@@ -371,9 +406,6 @@ void DrawEngineVulkan::DoFlush() {
 			baseUBOOffset, lightUBOOffset, boneUBOOffset,
 		};
 		if (useElements) {
-			if (!ibuf) {
-				ibOffset = (uint32_t)pushIndex_->Push(decIndex_, sizeof(uint16_t) * vertexCount, 4, &ibuf);
-			}
 			renderManager->DrawIndexed(descSetIndex, ARRAY_SIZE(dynamicUBOOffsets), dynamicUBOOffsets, vbuf, vbOffset, ibuf, ibOffset, vertexCount, 1);
 		} else {
 			renderManager->Draw(descSetIndex, ARRAY_SIZE(dynamicUBOOffsets), dynamicUBOOffsets, vbuf, vbOffset, vertexCount);
@@ -591,14 +623,21 @@ void DrawEngineVulkan::UpdateUBOs() {
 	if ((dirtyUniforms_ & DIRTY_BASE_UNIFORMS) || baseBuf == VK_NULL_HANDLE) {
 		baseUBOOffset = shaderManager_->PushBaseBuffer(pushUBO_, &baseBuf);
 		dirtyUniforms_ &= ~DIRTY_BASE_UNIFORMS;
+		gpuStats.numUniformUploadBytes += (int)sizeof(UB_VS_FS_Base);
 	}
 	if ((dirtyUniforms_ & DIRTY_LIGHT_UNIFORMS) || lightBuf == VK_NULL_HANDLE) {
 		lightUBOOffset = shaderManager_->PushLightBuffer(pushUBO_, &lightBuf);
 		dirtyUniforms_ &= ~DIRTY_LIGHT_UNIFORMS;
+		gpuStats.numUniformUploadBytes += (int)sizeof(UB_VS_Lights);
 	}
-	if ((dirtyUniforms_ & DIRTY_BONE_UNIFORMS) || boneBuf == VK_NULL_HANDLE) {
-		boneUBOOffset = shaderManager_->PushBoneBuffer(pushUBO_, &boneBuf);
+	// Only the bones the current vertex format has get uploaded. If a later draw in the same
+	// frame uses more of them without the matrices changing, we still need to re-push.
+	const int numBones = (lastVType_ & GE_VTYPE_WEIGHT_MASK) ? vertTypeGetNumBoneWeights(lastVType_) : 0;
+	if ((dirtyUniforms_ & DIRTY_BONE_UNIFORMS) || boneBuf == VK_NULL_HANDLE || numBones > numBonesUploaded_) {
+		boneUBOOffset = shaderManager_->PushBoneBuffer(pushUBO_, &boneBuf, numBones);
+		numBonesUploaded_ = numBones;
 		dirtyUniforms_ &= ~DIRTY_BONE_UNIFORMS;
+		gpuStats.numUniformUploadBytes += numBones * (int)(12 * sizeof(float));
 	}
 }
 
@@ -235,6 +235,7 @@ private:
 	VkBuffer baseBuf = VK_NULL_HANDLE;
 	VkBuffer lightBuf = VK_NULL_HANDLE;
 	VkBuffer boneBuf = VK_NULL_HANDLE;
+	int numBonesUploaded_ = 0;  // how much of the current bone UBO is valid, in bones.
 	VkImageView imageView = VK_NULL_HANDLE;
 	VkSampler sampler = VK_NULL_HANDLE;
 
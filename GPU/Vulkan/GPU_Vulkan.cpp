@@ -93,52 +93,102 @@ GPU_Vulkan::GPU_Vulkan(GraphicsContext *gfxCtx, Draw::DrawContext *draw)
 	if (discID.size()) {
 		File::CreateFullPath(GetSysDirectory(DIRECTORY_APP_CACHE));
 		shaderCachePath_ = GetSysDirectory(DIRECTORY_APP_CACHE) / (discID + ".vkshadercache");
-		LoadCache(shaderCachePath_);
+		if (File::Exists(shaderCachePath_)) {
+			LoadCache(shaderCachePath_);
+		} else {
+			// First session for this game - look for a distributed cache on the memstick.
+			// These are just shader/pipeline key manifests (no driver binaries), so they can
+			// be shared between users and devices. Saves still go to the per-user path above.
+			Path seedCachePath = GetSysDirectory(DIRECTORY_CACHE) / (discID + ".vkshadercache");
+			if (File::Exists(seedCachePath)) {
+				INFO_LOG(Log::G3D, "Pre-warming pipelines from distributed cache '%s'", seedCachePath.c_str());
+				LoadCache(seedCachePath, false);
+			}
+		}
 	}
 }
 
-void GPU_Vulkan::LoadCache(const Path &filename) {
+void GPU_Vulkan::LoadCache(const Path &filename, bool deleteOnFailure) {
 	if (!g_Config.bShaderCache) {
 		WARN_LOG(Log::G3D, "Shader cache disabled. Not loading.");
 		return;
 	}
 
-	PSP_SetLoading("Loading shader cache...");
-	// Actually precompiled by IsReady() since we're single-threaded.
 	FILE *f = File::OpenCFile(filename, "rb");
 	if (!f)
 		return;
 
-	// First compile shaders to SPIR-V, then load the pipeline cache and recreate the pipelines.
-	// It's when recreating the pipelines that the pipeline cache is useful - in the ideal case,
-	// it can just memcpy the finished shader binaries out of the pipeline cache file.
+	// Only the headers are read here - the shaders and pipelines themselves are created in
+	// per-frame chunks by ProcessShaderCacheLoad(), so boot isn't blocked while hundreds of
+	// shaders compile. The IDs are stored most-used-first, so the shaders that matter get
+	// warmed up in the first few frames.
 	bool result = shaderManagerVulkan_->LoadCacheFlags(f, &drawEngine_);
-	if (!result) {
-		WARN_LOG(Log::G3D, "ShaderManagerVulkan failed to load cache header.");
-	}
 	if (result) {
 		// Reload use flags in case LoadCacheFlags() changed them.
 		if (drawEngineCommon_->EverUsedExactEqualDepth()) {
 			sawExactEqualDepth_ = true;
 		}
 		gstate_c.SetUseFlags(CheckGPUFeatures());
-		result = shaderManagerVulkan_->LoadCache(f);
-		if (!result) {
-			WARN_LOG(Log::G3D, "ShaderManagerVulkan failed to load cache.");
-		}
+		result = shaderManagerVulkan_->BeginLoadCache(f);
 	}
-	if (result) {
-		// WARNING: See comment in LoadPipelineCache if you are tempted to flip the second parameter to true.
-		result = pipelineManager_->LoadPipelineCache(f, false, shaderManagerVulkan_, draw_, drawEngine_.GetPipelineLayout(), msaaLevel_);
+	if (!result) {
+		WARN_LOG(Log::G3D, "ShaderManagerVulkan failed to load cache header.");
+		fclose(f);
+		// Bad cache file for this GPU/Driver/etc. Delete it, unless it's a
+		// distributed cache the user put there on purpose.
+		if (deleteOnFailure)
+			File::Delete(filename);
+		return;
+	}
+
+	cacheLoadFile_ = f;
+	cacheLoadPath_ = filename;
+	cacheLoadDeleteOnFailure_ = deleteOnFailure;
+	cacheLoadShadersDone_ = false;
+}
+
+void GPU_Vulkan::ProcessShaderCacheLoad() {
+	if (!cacheLoadFile_)
+		return;
+
+	// Budgets tuned to keep each slice well under a frame on slow devices. Shader generation
+	// (GLSL text) is cheap, and both module compilation and pipeline creation happen
+	// asynchronously on the compiler threads anyway - this just feeds them.
+	const int kShadersPerFrame = 64;
+	const int kPipelinesPerFrame = 128;
+
+	bool result = true;
+	bool done = false;
+	if (!cacheLoadShadersDone_) {
+		result = shaderManagerVulkan_->ContinueLoadCache(cacheLoadFile_, kShadersPerFrame, &done);
+		if (result && done) {
+			// All the shaders exist now, so the pipeline keys can be resolved.
+			// WARNING: See comment in LoadPipelineCache if you are tempted to flip the second parameter to true.
+			result = pipelineManager_->BeginLoadPipelineCache(cacheLoadFile_, false);
+			cacheLoadShadersDone_ = true;
+		}
+	} else {
+		result = pipelineManager_->ContinueLoadPipelineCache(cacheLoadFile_, kPipelinesPerFrame, shaderManagerVulkan_, draw_, drawEngine_.GetPipelineLayout(), msaaLevel_, &done);
+		if (result && done) {
+			fclose(cacheLoadFile_);
+			cacheLoadFile_ = nullptr;
+			INFO_LOG(Log::G3D, "Loaded Vulkan pipeline cache.");
+		}
 	}
-	fclose(f);
 
 	if (!result) {
 		WARN_LOG(Log::G3D, "Incompatible Vulkan pipeline cache - rebuilding.");
-		// Bad cache file for this GPU/Driver/etc. Delete it.
-		File::Delete(filename);
-	} else {
-		INFO_LOG(Log::G3D, "Loaded Vulkan pipeline cache.");
+		fclose(cacheLoadFile_);
+		cacheLoadFile_ = nullptr;
+		if (cacheLoadDeleteOnFailure_)
+			File::Delete(cacheLoadPath_);
+	}
+}
+
+void GPU_Vulkan::CancelShaderCacheLoad() {
+	if (cacheLoadFile_) {
+		fclose(cacheLoadFile_);
+		cacheLoadFile_ = nullptr;
 	}
 }
 
@@ -154,6 +204,14 @@ void GPU_Vulkan::SaveCache(const Path &filename) {
 		return;
 	}
 
+	if (cacheLoadFile_) {
+		// Still part-way through loading the previous cache - don't overwrite it with a
+		// truncated view of the world, the file on disk is more complete than we are.
+		INFO_LOG(Log::G3D, "Not saving shaders - cache load still in progress.");
+		CancelShaderCacheLoad();
+		return;
+	}
+
 	FILE *f = File::OpenCFile(filename, "wb");
 	if (!f)
 		return;
@@ -173,6 +231,7 @@ GPU_Vulkan::~GPU_Vulkan() {
 	}
 
 	SaveCache(shaderCachePath_);
+	CancelShaderCacheLoad();
 
 	// StopThreads should have ensured that no pipelines are queued to compile at this point. So we can tear it down.
 	delete pipelineManager_;
@@ -315,6 +374,9 @@ void GPU_Vulkan::BeginHostFrame() {
 		gstate_c.useFlagsChanged = false;
 	}
 
+	// Feed the next slice of the shader cache to the compiler threads, if a load is in progress.
+	ProcessShaderCacheLoad();
+
 	if (dumpNextFrame_) {
 		NOTICE_LOG(Log::G3D, "DUMPING THIS FRAME");
 		dumpThisFrame_ = true;
@@ -67,8 +67,11 @@ private:
 	void InitDeviceObjects();
 	void DestroyDeviceObjects();
 
-	void LoadCache(const Path &filename);
+	void LoadCache(const Path &filename, bool deleteOnFailure = true);
 	void SaveCache(const Path &filename);
+	// Drives the chunked shader/pipeline cache load, a slice per frame. Called from BeginHostFrame.
+	void ProcessShaderCacheLoad();
+	void CancelShaderCacheLoad();
 
 	FramebufferManagerVulkan *framebufferManagerVulkan_;
 	TextureCacheVulkan *textureCacheVulkan_;
@@ -81,4 +84,10 @@ private:
 	PipelineManagerVulkan *pipelineManager_;
 
 	Path shaderCachePath_;
+
+	// State of an in-progress chunked cache load, see ProcessShaderCacheLoad.
+	FILE *cacheLoadFile_ = nullptr;
+	Path cacheLoadPath_;
+	bool cacheLoadDeleteOnFailure_ = false;
+	bool cacheLoadShadersDone_ = false;
 };
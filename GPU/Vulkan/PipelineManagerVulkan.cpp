@@ -727,9 +727,10 @@ void PipelineManagerVulkan::SavePipelineCache(FILE *file, bool saveRawPipelineCa
 	}
 }
 
-bool PipelineManagerVulkan::LoadPipelineCache(FILE *file, bool loadRawPipelineCache, ShaderManagerVulkan *shaderManager, Draw::DrawContext *drawContext, VKRPipelineLayout *layout, int multiSampleLevel) {
-	VulkanRenderManager *rm = (VulkanRenderManager *)drawContext->GetNativeObject(Draw::NativeObject::RENDER_MANAGER);
-	VulkanQueueRunner *queueRunner = rm->GetQueueRunner();
+bool PipelineManagerVulkan::BeginLoadPipelineCache(FILE *file, bool loadRawPipelineCache) {
+	cacheLoadLeft_ = 0;
+	cacheLoadTotal_ = 0;
+	cacheLoadFailCount_ = 0;
 
 	uint32_t size = 0;
 	if (loadRawPipelineCache) {
@@ -783,20 +784,29 @@ bool PipelineManagerVulkan::LoadPipelineCache(FILE *file, bool loadRawPipelineCa
 	}
 
 	// Read the number of pipelines.
-	bool failed = fread(&size, sizeof(size), 1, file) != 1;
-
-	NOTICE_LOG(Log::G3D, "Creating %d pipelines from cache (%dx MSAA)...", size, (1 << multiSampleLevel));
-	int pipelineCreateFailCount = 0;
-	int shaderFailCount = 0;
-	for (uint32_t i = 0; i < size; i++) {
-		if (failed) {
-			break;
-		}
+	if (fread(&size, sizeof(size), 1, file) != 1) {
+		WARN_LOG(Log::G3D, "Truncated Vulkan pipeline cache file (no pipeline count)");
+		return false;
+	}
+
+	NOTICE_LOG(Log::G3D, "Creating %d pipelines from cache...", size);
+	cacheLoadLeft_ = (int)size;
+	cacheLoadTotal_ = (int)size;
+	return true;
+}
+
+bool PipelineManagerVulkan::ContinueLoadPipelineCache(FILE *file, int maxPipelines, ShaderManagerVulkan *shaderManager, Draw::DrawContext *drawContext, VKRPipelineLayout *layout, int multiSampleLevel, bool *done) {
+	*done = false;
+
+	VulkanRenderManager *rm = (VulkanRenderManager *)drawContext->GetNativeObject(Draw::NativeObject::RENDER_MANAGER);
+
+	while (cacheLoadLeft_ > 0 && maxPipelines > 0) {
+		cacheLoadLeft_--;
+		maxPipelines--;
 		StoredVulkanPipelineKey key;
-		failed = failed || fread(&key, sizeof(key), 1, file) != 1;
-		if (failed) {
+		if (fread(&key, sizeof(key), 1, file) != 1) {
 			ERROR_LOG(Log::G3D, "Truncated Vulkan pipeline cache file, stopping.");
-			break;
+			return false;
 		}
 
 		if (key.raster.topology == VK_PRIMITIVE_TOPOLOGY_POINT_LIST || key.raster.topology == VK_PRIMITIVE_TOPOLOGY_LINE_LIST) {
@@ -810,7 +820,7 @@ bool PipelineManagerVulkan::LoadPipelineCache(FILE *file, bool loadRawPipelineCa
 		if (!vs || !fs || (!gs && key.gShaderID.Bit(GS_BIT_ENABLED))) {
 			// We just ignore this one, it'll get created later if needed.
 			// Probably some useFlags mismatch.
-			WARN_LOG(Log::G3D, "Failed to find vs or fs in pipeline %d in cache, skipping pipeline", (int)i);
+			WARN_LOG(Log::G3D, "Failed to find vs or fs in pipeline %d in cache, skipping pipeline", cacheLoadTotal_ - cacheLoadLeft_ - 1);
 			continue;
 		}
 
@@ -830,13 +840,17 @@ bool PipelineManagerVulkan::LoadPipelineCache(FILE *file, bool loadRawPipelineCa
 		VulkanPipeline *pipeline = GetOrCreatePipeline(
 			rm, layout, key.raster, key.useHWTransform ? &fmt : 0, vs, fs, gs, key.useHWTransform, variantsToBuild, multiSampleLevel, true);
 		if (!pipeline) {
-			pipelineCreateFailCount += 1;
+			cacheLoadFailCount_ += 1;
 		}
 	}
 
+	// The pipelines get built asynchronously on the compiler threads, give them a poke per chunk.
 	rm->NudgeCompilerThread();
 
-	NOTICE_LOG(Log::G3D, "Recreated Vulkan pipeline cache (%d pipelines, %d failed).", (int)size, pipelineCreateFailCount);
-	// We just ignore any failures.
+	if (cacheLoadLeft_ == 0) {
+		NOTICE_LOG(Log::G3D, "Recreated Vulkan pipeline cache (%d pipelines, %d failed).", cacheLoadTotal_, cacheLoadFailCount_);
+		*done = true;
+	}
+	// We just ignore any creation failures.
 	return true;
 }
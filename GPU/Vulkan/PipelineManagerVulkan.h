@@ -101,10 +101,18 @@ public:
 
 	// Saves data for faster creation next time.
 	void SavePipelineCache(FILE *file, bool saveRawPipelineCache, ShaderManagerVulkan *shaderManager, Draw::DrawContext *drawContext);
-	bool LoadPipelineCache(FILE *file, bool loadRawPipelineCache, ShaderManagerVulkan *shaderManager, Draw::DrawContext *drawContext, VKRPipelineLayout *layout, int multiSampleLevel);
+	// Like the shader cache, loaded in per-frame chunks to avoid blocking boot.
+	// See GPU_Vulkan::ProcessShaderCacheLoad.
+	bool BeginLoadPipelineCache(FILE *file, bool loadRawPipelineCache);
+	bool ContinueLoadPipelineCache(FILE *file, int maxPipelines, ShaderManagerVulkan *shaderManager, Draw::DrawContext *drawContext, VKRPipelineLayout *layout, int multiSampleLevel, bool *done);
 
 private:
 	DenseHashMap<VulkanPipelineKey, VulkanPipeline *> pipelines_;
 	VkPipelineCache pipelineCache_ = VK_NULL_HANDLE;
 	VulkanContext *vulkan_;
+
+	// Progress of a chunked cache load.
+	int cacheLoadLeft_ = 0;
+	int cacheLoadTotal_ = 0;
+	int cacheLoadFailCount_ = 0;
 };
@@ -19,6 +19,8 @@
 //#define SHADERLOG
 #endif
 
+#include <algorithm>
+
 #include "Common/LogReporting.h"
 #include "Common/Math/lin/matrix4x4.h"
 #include "Common/Math/math_util.h"
@@ -315,6 +317,9 @@ void ShaderManagerVulkan::GetShaders(int prim, VertexDecoder *decoder, VulkanVer
 			vs = new VulkanVertexShader(vulkan, VSID, flags, codeBuffer_, useHWTransform);
 			vsCache_.Insert(VSID, vs);
 		}
+		// Counts shader switches rather than draws, which is cheap and good enough as a
+		// popularity metric for ordering the shader cache file.
+		vs->IncrementUseCount();
 		lastVShader_ = vs;
 		lastVSID_ = VSID;
 	} else {
@@ -343,6 +348,7 @@ void ShaderManagerVulkan::GetShaders(int prim, VertexDecoder *decoder, VulkanVer
 			fs = new VulkanFragmentShader(vulkan, FSID, flags, codeBuffer_);
 			fsCache_.Insert(FSID, fs);
 		}
+		fs->IncrementUseCount();
 		lastFShader_ = fs;
 		lastFSID_ = FSID;
 	} else {
@@ -373,6 +379,8 @@ void ShaderManagerVulkan::GetShaders(int prim, VertexDecoder *decoder, VulkanVer
 		} else {
 			gs = nullptr;
 		}
+		if (gs)
+			gs->IncrementUseCount();
 		lastGShader_ = gs;
 		lastGSID_ = GSID;
 	} else {
@@ -501,8 +509,9 @@ enum class VulkanCacheDetectFlags {
 	EQUAL_DEPTH = 1,
 };
 
-#define CACHE_HEADER_MAGIC 0xff51f420 
-#define CACHE_VERSION 52
+#define CACHE_HEADER_MAGIC 0xff51f420
+// 53: Shader IDs are now written in most-used-first order, see SaveCache.
+#define CACHE_VERSION 53
 
 struct VulkanCacheHeader {
 	uint32_t magic;
@@ -536,9 +545,13 @@ bool ShaderManagerVulkan::LoadCacheFlags(FILE *f, DrawEngineVulkan *drawEngine)
 	return true;
 }
 
-bool ShaderManagerVulkan::LoadCache(FILE *f) {
+bool ShaderManagerVulkan::BeginLoadCache(FILE *f) {
 	VulkanCacheHeader header{};
 	bool success = fread(&header, sizeof(header), 1, f) == 1;
+	if (!success) {
+		ERROR_LOG(Log::G3D, "Vulkan shader cache truncated (in header)");
+		return false;
+	}
 	// We don't need to validate magic/version again, done in LoadCacheFlags().
 
 	if (header.useFlags != gstate_c.GetUseFlags()) {
@@ -550,10 +563,20 @@ bool ShaderManagerVulkan::LoadCache(FILE *f) {
 		gstate_c.useFlagsChanged = false;
 	}
 
-	int failCount = 0;
+	cacheLoadVsLeft_ = cacheLoadVsTotal_ = header.numVertexShaders;
+	cacheLoadFsLeft_ = cacheLoadFsTotal_ = header.numFragmentShaders;
+	cacheLoadGsLeft_ = cacheLoadGsTotal_ = header.numGeometryShaders;
+	cacheLoadFailCount_ = 0;
+	return true;
+}
+
+bool ShaderManagerVulkan::ContinueLoadCache(FILE *f, int maxShaders, bool *done) {
+	*done = false;
 
 	VulkanContext *vulkan = (VulkanContext *)draw_->GetNativeObject(Draw::NativeObject::CONTEXT);
-	for (int i = 0; i < header.numVertexShaders; i++) {
+	while (cacheLoadVsLeft_ > 0 && maxShaders > 0) {
+		cacheLoadVsLeft_--;
+		maxShaders--;
 		VShaderID id;
 		if (fread(&id, sizeof(id), 1, f) != 1) {
 			ERROR_LOG(Log::G3D, "Vulkan shader cache truncated (in VertexShaders)");
@@ -567,19 +590,21 @@ bool ShaderManagerVulkan::LoadCache(FILE *f) {
 		if (!GenerateVertexShader(id, codeBuffer_, compat_, draw_->GetBugs(), &attributeMask, &uniformMask, &flags, &genErrorString)) {
 			ERROR_LOG(Log::G3D, "Failed to generate vertex shader during cache load");
 			// We just ignore this one and carry on.
-			failCount++;
+			cacheLoadFailCount_++;
 			continue;
 		}
 		_assert_msg_(strlen(codeBuffer_) < CODE_BUFFER_SIZE, "VS length error: %d", (int)strlen(codeBuffer_));
-		// Don't add the new shader if already compiled - though this should no longer happen.
+		// Don't add the new shader if already compiled - can happen if the game got ahead of the
+		// cache load and compiled it on the fly.
 		if (!vsCache_.ContainsKey(id)) {
 			VulkanVertexShader *vs = new VulkanVertexShader(vulkan, id, flags, codeBuffer_, useHWTransform);
 			vsCache_.Insert(id, vs);
 		}
 	}
-	uint32_t vendorID = vulkan->GetPhysicalDeviceProperties().properties.vendorID;
 
-	for (int i = 0; i < header.numFragmentShaders; i++) {
+	while (cacheLoadFsLeft_ > 0 && maxShaders > 0) {
+		cacheLoadFsLeft_--;
+		maxShaders--;
 		FShaderID id;
 		if (fread(&id, sizeof(id), 1, f) != 1) {
 			ERROR_LOG(Log::G3D, "Vulkan shader cache truncated (in FragmentShaders)");
@@ -591,7 +616,7 @@ bool ShaderManagerVulkan::LoadCache(FILE *f) {
 		if (!GenerateFragmentShader(id, codeBuffer_, compat_, draw_->GetBugs(), &uniformMask, &flags, &genErrorString)) {
 			ERROR_LOG(Log::G3D, "Failed to generate fragment shader during cache load");
 			// We just ignore this one and carry on.
-			failCount++;
+			cacheLoadFailCount_++;
 			continue;
 		}
 		_assert_msg_(strlen(codeBuffer_) < CODE_BUFFER_SIZE, "FS length error: %d", (int)strlen(codeBuffer_));
@@ -601,30 +626,42 @@ bool ShaderManagerVulkan::LoadCache(FILE *f) {
 		}
 	}
 
-	// If it's not enabled, don't create shaders cached from earlier runs - creation will likely fail.
-	if (gstate_c.Use(GPU_USE_GS_CULLING)) {
-		for (int i = 0; i < header.numGeometryShaders; i++) {
-			GShaderID id;
-			if (fread(&id, sizeof(id), 1, f) != 1) {
-				ERROR_LOG(Log::G3D, "Vulkan shader cache truncated (in GeometryShaders)");
-				return false;
-			}
-			std::string genErrorString;
-			if (!GenerateGeometryShader(id, codeBuffer_, compat_, draw_->GetBugs(), &genErrorString)) {
-				ERROR_LOG(Log::G3D, "Failed to generate geometry shader during cache load");
-				// We just ignore this one and carry on.
-				failCount++;
-				continue;
-			}
-			_assert_msg_(strlen(codeBuffer_) < CODE_BUFFER_SIZE, "GS length error: %d", (int)strlen(codeBuffer_));
-			if (!gsCache_.ContainsKey(id)) {
-				VulkanGeometryShader *gs = new VulkanGeometryShader(vulkan, id, codeBuffer_);
-				gsCache_.Insert(id, gs);
-			}
+	if (cacheLoadGsLeft_ > 0 && !gstate_c.Use(GPU_USE_GS_CULLING)) {
+		// If it's not enabled, don't create shaders cached from earlier runs - creation will likely fail.
+		// Just skip past the IDs to leave the file position consistent.
+		if (fseek(f, cacheLoadGsLeft_ * (long)sizeof(GShaderID), SEEK_CUR) != 0) {
+			ERROR_LOG(Log::G3D, "Vulkan shader cache truncated (in GeometryShaders)");
+			return false;
+		}
+		cacheLoadGsLeft_ = 0;
+	}
+
+	while (cacheLoadGsLeft_ > 0 && maxShaders > 0) {
+		cacheLoadGsLeft_--;
+		maxShaders--;
+		GShaderID id;
+		if (fread(&id, sizeof(id), 1, f) != 1) {
+			ERROR_LOG(Log::G3D, "Vulkan shader cache truncated (in GeometryShaders)");
+			return false;
+		}
+		std::string genErrorString;
+		if (!GenerateGeometryShader(id, codeBuffer_, compat_, draw_->GetBugs(), &genErrorString)) {
+			ERROR_LOG(Log::G3D, "Failed to generate geometry shader during cache load");
+			// We just ignore this one and carry on.
+			cacheLoadFailCount_++;
+			continue;
+		}
+		_assert_msg_(strlen(codeBuffer_) < CODE_BUFFER_SIZE, "GS length error: %d", (int)strlen(codeBuffer_));
+		if (!gsCache_.ContainsKey(id)) {
+			VulkanGeometryShader *gs = new VulkanGeometryShader(vulkan, id, codeBuffer_);
+			gsCache_.Insert(id, gs);
 		}
 	}
 
-	NOTICE_LOG(Log::G3D, "ShaderCache: Loaded %d vertex, %d fragment shaders and %d geometry shaders (failed %d)", header.numVertexShaders, header.numFragmentShaders, header.numGeometryShaders, failCount);
+	if (cacheLoadVsLeft_ == 0 && cacheLoadFsLeft_ == 0 && cacheLoadGsLeft_ == 0) {
+		NOTICE_LOG(Log::G3D, "ShaderCache: Loaded %d vertex, %d fragment shaders and %d geometry shaders (failed %d)", cacheLoadVsTotal_, cacheLoadFsTotal_, cacheLoadGsTotal_, cacheLoadFailCount_);
+		*done = true;
+	}
 	return true;
 }
 
@@ -640,15 +677,38 @@ void ShaderManagerVulkan::SaveCache(FILE *f, DrawEngineVulkan *drawEngine) {
 	header.numFragmentShaders = (int)fsCache_.size();
 	header.numGeometryShaders = (int)gsCache_.size();
 	bool writeFailed = fwrite(&header, sizeof(header), 1, f) != 1;
+
+	// Write the IDs most-used-first, so the chunked load on the next run warms up the shaders
+	// that matter before getting to the long tail.
+	std::vector<std::pair<int, VShaderID>> vsIDs;
+	vsIDs.reserve(vsCache_.size());
 	vsCache_.Iterate([&](const VShaderID &id, VulkanVertexShader *vs) {
-		writeFailed = writeFailed || fwrite(&id, sizeof(id), 1, f) != 1;
+		vsIDs.emplace_back(vs->UseCount(), id);
 	});
+	std::sort(vsIDs.begin(), vsIDs.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+	for (const auto &entry : vsIDs) {
+		writeFailed = writeFailed || fwrite(&entry.second, sizeof(entry.second), 1, f) != 1;
+	}
+
+	std::vector<std::pair<int, FShaderID>> fsIDs;
+	fsIDs.reserve(fsCache_.size());
 	fsCache_.Iterate([&](const FShaderID &id, VulkanFragmentShader *fs) {
-		writeFailed = writeFailed || fwrite(&id, sizeof(id), 1, f) != 1;
+		fsIDs.emplace_back(fs->UseCount(), id);
 	});
+	std::sort(fsIDs.begin(), fsIDs.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+	for (const auto &entry : fsIDs) {
+		writeFailed = writeFailed || fwrite(&entry.second, sizeof(entry.second), 1, f) != 1;
+	}
+
+	std::vector<std::pair<int, GShaderID>> gsIDs;
+	gsIDs.reserve(gsCache_.size());
 	gsCache_.Iterate([&](const GShaderID &id, VulkanGeometryShader *gs) {
-		writeFailed = writeFailed || fwrite(&id, sizeof(id), 1, f) != 1;
+		gsIDs.emplace_back(gs->UseCount(), id);
 	});
+	std::sort(gsIDs.begin(), gsIDs.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+	for (const auto &entry : gsIDs) {
+		writeFailed = writeFailed || fwrite(&entry.second, sizeof(entry.second), 1, f) != 1;
+	}
 	if (writeFailed) {
 		ERROR_LOG(Log::G3D, "Failed to write Vulkan shader cache, disk full?");
 	} else {
@@ -49,12 +49,17 @@ public:
 
 	FragmentShaderFlags Flags() const { return flags_;  }
 
-protected:	
+	// Rough popularity counter, used to order the shader cache file. See SaveCache.
+	void IncrementUseCount() { useCount_++; }
+	int UseCount() const { return useCount_; }
+
+protected:
 	Promise<VkShaderModule> *module_ = nullptr;
 
 	VulkanContext *vulkan_;
 	std::string source_;
 	bool failed_ = false;
+	int useCount_ = 0;
 	FShaderID id_;
 	FragmentShaderFlags flags_;
 };
@@ -73,12 +78,16 @@ public:
 	Promise<VkShaderModule> *GetModule() { return module_; }
 	const VShaderID &GetID() const { return id_; }
 
+	void IncrementUseCount() { useCount_++; }
+	int UseCount() const { return useCount_; }
+
 protected:
 	Promise<VkShaderModule> *module_ = nullptr;
 
 	VulkanContext *vulkan_;
 	std::string source_;
 	bool useHWTransform_;
+	int useCount_ = 0;
 	VShaderID id_;
 	VertexShaderFlags flags_;
 };
@@ -95,11 +104,15 @@ public:
 	Promise<VkShaderModule> *GetModule() const { return module_; }
 	const GShaderID &GetID() { return id_; }
 
+	void IncrementUseCount() { useCount_++; }
+	int UseCount() const { return useCount_; }
+
 protected:
 	Promise<VkShaderModule> *module_ = nullptr;
 
 	VulkanContext *vulkan_;
 	std::string source_;
+	int useCount_ = 0;
 	GShaderID id_;
 };
 
@@ -152,13 +165,24 @@ public:
 	uint32_t PushLightBuffer(VulkanPushPool *dest, VkBuffer *buf) const {
 		return dest->Push(&uniforms_->ub_lights, sizeof(uniforms_->ub_lights), uboAlignment_, buf);
 	}
-	// TODO: Only push half the bone buffer if we only have four bones.
-	uint32_t PushBoneBuffer(VulkanPushPool *dest, VkBuffer *buf) const {
-		return dest->Push(&uniforms_->ub_bones, sizeof(uniforms_->ub_bones), uboAlignment_, buf);
+	// Skinned shaders only read the bones the vertex format actually has, so we only write
+	// (and keep) that prefix of the block. The full block is still reserved up front so the
+	// descriptor range never runs off the end of the buffer - the unused tail is handed back.
+	uint32_t PushBoneBuffer(VulkanPushPool *dest, VkBuffer *buf, int numBones) const {
+		const VkDeviceSize bytes = numBones * sizeof(uniforms_->ub_bones.bones[0]);
+		uint32_t bindOffset;
+		uint8_t *ptr = dest->Allocate(sizeof(uniforms_->ub_bones), uboAlignment_, buf, &bindOffset);
+		memcpy(ptr, &uniforms_->ub_bones, bytes);
+		dest->TrimLastAllocation(bindOffset, bytes);
+		return bindOffset;
 	}
 
 	static bool LoadCacheFlags(FILE *f, DrawEngineVulkan *drawEngine);
-	bool LoadCache(FILE *f);
+	// The cache is loaded in chunks spread over multiple frames so we don't block boot while
+	// generating hundreds of shaders. BeginLoadCache reads the header, then ContinueLoadCache
+	// is called with a per-frame budget until *done. See GPU_Vulkan::ProcessShaderCacheLoad.
+	bool BeginLoadCache(FILE *f);
+	bool ContinueLoadCache(FILE *f, int maxShaders, bool *done);
 	void SaveCache(FILE *f, DrawEngineVulkan *drawEngine);
 
 private:
@@ -188,4 +212,13 @@ private:
 	FShaderID lastFSID_;
 	VShaderID lastVSID_;
 	GShaderID lastGSID_;
+
+	// Progress of a chunked cache load, see BeginLoadCache/ContinueLoadCache.
+	int cacheLoadVsLeft_ = 0;
+	int cacheLoadFsLeft_ = 0;
+	int cacheLoadGsLeft_ = 0;
+	int cacheLoadVsTotal_ = 0;
+	int cacheLoadFsTotal_ = 0;
+	int cacheLoadGsTotal_ = 0;
+	int cacheLoadFailCount_ = 0;
 };
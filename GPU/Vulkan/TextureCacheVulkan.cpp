@@ -107,6 +107,78 @@ void main() {
 
 )";
 
+// Decodes CLUT8 textures entirely on the GPU - the raw (possibly swizzled) index bytes go in
+// one buffer, the raw CLUT entries in another, and the deswizzle, palette lookup and format
+// expansion all happen in the shader. Saves a lot of emu thread time in CLUT8-heavy games.
+const char *clut8DecodeShader = R"(
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout (local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+uniform layout(set = 0, binding = 0, rgba8) writeonly image2D img;
+
+layout(std430, set = 0, binding = 1) readonly buffer Buf {
+	uint data[];
+} buf;
+
+layout(std430, set = 0, binding = 2) readonly buffer Clut {
+	uint data[];
+} clut;
+
+layout(push_constant) uniform Params {
+	int width;
+	int height;
+	int bufw;   // source stride in pixels (= bytes, since CLUT8)
+	int flags;  // bit 0: swizzled, bits 1-2: GEPaletteFormat
+} params;
+
+uint readIndex(uint x, uint y) {
+	uint byteIndex;
+	if ((params.flags & 1) != 0) {
+		// PSP swizzle: 16-byte-wide, 8-row tiles, stored tile after tile.
+		byteIndex = ((y >> 3u) * (uint(params.bufw) >> 4u) + (x >> 4u)) * 128u + (y & 7u) * 16u + (x & 15u);
+	} else {
+		byteIndex = y * uint(params.bufw) + x;
+	}
+	return (buf.data[byteIndex >> 2u] >> ((byteIndex & 3u) * 8u)) & 0xFFu;
+}
+
+vec4 lookupClut(uint index) {
+	int fmt = (params.flags >> 1) & 3;
+	if (fmt == 3) {  // GE_CMODE_32BIT_ABGR8888
+		return unpackUnorm4x8(clut.data[index]);
+	}
+	uint c = (clut.data[index >> 1u] >> ((index & 1u) * 16u)) & 0xFFFFu;
+	uint r, g, b, a;
+	if (fmt == 0) {  // GE_CMODE_16BIT_BGR5650
+		r = c & 0x1Fu;          r = (r << 3u) | (r >> 2u);
+		g = (c >> 5u) & 0x3Fu;  g = (g << 2u) | (g >> 4u);
+		b = (c >> 11u) & 0x1Fu; b = (b << 3u) | (b >> 2u);
+		a = 0xFFu;
+	} else if (fmt == 1) {  // GE_CMODE_16BIT_ABGR5551
+		r = c & 0x1Fu;          r = (r << 3u) | (r >> 2u);
+		g = (c >> 5u) & 0x1Fu;  g = (g << 3u) | (g >> 2u);
+		b = (c >> 10u) & 0x1Fu; b = (b << 3u) | (b >> 2u);
+		a = (c & 0x8000u) != 0u ? 0xFFu : 0u;
+	} else {  // GE_CMODE_16BIT_ABGR4444
+		r = (c & 0xFu) * 17u;
+		g = ((c >> 4u) & 0xFu) * 17u;
+		b = ((c >> 8u) & 0xFu) * 17u;
+		a = ((c >> 12u) & 0xFu) * 17u;
+	}
+	return unpackUnorm4x8(r | (g << 8u) | (b << 16u) | (a << 24u));
+}
+
+void main() {
+	uvec2 xy = gl_GlobalInvocationID.xy;
+	if (xy.x >= uint(params.width) || xy.y >= uint(params.height))
+		return;
+	imageStore(img, ivec2(xy), lookupClut(readIndex(xy.x, xy.y)));
+}
+
+)";
+
 static int VkFormatBytesPerPixel(VkFormat format) {
 	switch (format) {
 	case VULKAN_8888_FORMAT: return 4;
@@ -224,6 +296,10 @@ void TextureCacheVulkan::DeviceLost() {
 
 	if (uploadCS_ != VK_NULL_HANDLE)
 		vulkan->Delete().QueueDeleteShaderModule(uploadCS_);
+	if (clut8DecodeCS_ != VK_NULL_HANDLE) {
+		vulkan->Delete().QueueDeleteShaderModule(clut8DecodeCS_);
+		clut8DecodeCS_ = VK_NULL_HANDLE;
+	}
 
 	computeShaderManager_.DeviceLost();
 
@@ -252,6 +328,7 @@ void TextureCacheVulkan::DeviceRestore(Draw::DrawContext *draw) {
 	_assert_(res == VK_SUCCESS);
 
 	CompileScalingShader();
+	CompileDecodeShader();
 
 	computeShaderManager_.DeviceRestore(draw);
 }
@@ -304,6 +381,13 @@ void TextureCacheVulkan::CompileScalingShader() {
 	shaderScaleFactor_ = shaderInfo->scaleFactor;
 }
 
+void TextureCacheVulkan::CompileDecodeShader() {
+	VulkanContext *vulkan = (VulkanContext *)draw_->GetNativeObject(Draw::NativeObject::CONTEXT);
+	std::string error;
+	clut8DecodeCS_ = CompileShaderModule(vulkan, VK_SHADER_STAGE_COMPUTE_BIT, clut8DecodeShader, &error);
+	_dbg_assert_msg_(clut8DecodeCS_ != VK_NULL_HANDLE, "failed to compile clut8 decode shader");
+}
+
 void TextureCacheVulkan::ReleaseTexture(TexCacheEntry *entry, bool delete_them) {
 	delete entry->vkTex;
 	entry->vkTex = nullptr;
@@ -490,7 +574,35 @@ void TextureCacheVulkan::BuildTexture(TexCacheEntry *const entry) {
 		}
 	}
 
-	if (computeUpload) {
+	// GPU CLUT8 decode: upload the raw index bytes plus the CLUT, and do the deswizzle,
+	// palette lookup and format expansion in a compute shader instead of on the emu thread.
+	// CLUT8 is the dominant format in texture-decode-heavy games.
+	bool computeDecode = false;
+	if (clut8DecodeCS_ != VK_NULL_HANDLE && !computeUpload && !plan.doReplace && !plan.saveTexture &&
+		plan.scaleFactor == 1 && plan.depth == 1 && !plan.decodeToClut8 &&
+		entry->format == GE_TFMT_CLUT8 && gstate.isClutIndexSimple()) {
+		computeDecode = true;
+		for (int i = 0; i < plan.levelsToLoad; i++) {
+			int srcLevel = i == 0 ? plan.baseLevelSrc : i;
+			u32 texaddr = gstate.getTextureAddress(srcLevel);
+			int bufw = GetTextureBufw(srcLevel, texaddr, GE_TFMT_CLUT8);
+			// The shader assumes whole 16-byte swizzle tiles, and VRAM mirrors get special
+			// swizzle treatment in DecodeTextureLevel that we don't replicate.
+			if ((gstate.isTextureSwizzled() && (bufw & 15) != 0) ||
+				((texaddr & 0x00600000) != 0 && Memory::IsVRAMAddress(texaddr)) ||
+				!Memory::IsValidAddress(texaddr)) {
+				computeDecode = false;
+				break;
+			}
+		}
+	}
+	if (computeDecode) {
+		// The shader always expands to 8888.
+		dstFmt = VULKAN_8888_FORMAT;
+		actualFmt = VULKAN_8888_FORMAT;
+	}
+
+	if (computeUpload || computeDecode) {
 		usage |= VK_IMAGE_USAGE_STORAGE_BIT;
 		imageLayout = VK_IMAGE_LAYOUT_GENERAL;
 	}
@@ -539,6 +651,8 @@ void TextureCacheVulkan::BuildTexture(TexCacheEntry *const entry) {
 		plan.createH /= plan.scaleFactor;
 		plan.scaleFactor = 1;
 		actualFmt = dstFmt;
+		// The new image has no storage usage, so decode on the CPU after all.
+		computeDecode = false;
 
 		allocSuccess = image->CreateDirect(plan.createW, plan.createH, plan.depth, plan.levelsToCreate, actualFmt, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, &barrier, mapping);
 		barrier.Flush(cmdInit);
@@ -627,6 +741,37 @@ void TextureCacheVulkan::BuildTexture(TexCacheEntry *const entry) {
 				// 3D texturing.
 				loadLevel(uploadSize, i, byteStride, plan.scaleFactor);
 				entry->vkTex->CopyBufferToMipLevel(cmdInit, &copyBatch, 0, mipWidth, mipHeight, i, texBuf, bufferOffset, pixelStride);
+			} else if (computeDecode) {
+				int srcLevel = i == 0 ? plan.baseLevelSrc : i;
+				u32 texaddr = gstate.getTextureAddress(srcLevel);
+				int bufw = GetTextureBufw(srcLevel, texaddr, GE_TFMT_CLUT8);
+				const bool swizzled = gstate.isTextureSwizzled();
+				// Swizzled data occupies whole 8-row tiles - the CPU unswizzler reads the same.
+				// Round up to whole words since the shader fetches bytes out of a uint array.
+				int srcSize = (bufw * (swizzled ? (mipHeight + 7) & ~7 : mipHeight) + 3) & ~3;
+				data = pushBuffer->Allocate(srcSize, pushAlignment, &texBuf, &bufferOffset);
+				memcpy(data, Memory::GetPointerUnchecked(texaddr), srcSize);
+
+				const GEPaletteFormat clutFmt = gstate.getClutPaletteFormat();
+				const u32 clutBytes = clutFmt == GE_CMODE_32BIT_ABGR8888 ? 256 * 4 : 256 * 2;
+				VkBuffer clutVkBuf;
+				uint32_t clutOffset = pushBuffer->Push(clutBuf_, clutBytes, pushAlignment, &clutVkBuf);
+
+				VkImageView view = entry->vkTex->CreateViewForMip(i);
+				VkDescriptorSet descSet = computeShaderManager_.GetDescriptorSet(view, texBuf, bufferOffset, srcSize, clutVkBuf, clutOffset, clutBytes);
+				struct Params { int width; int height; int bufw; int flags; } params{
+					mipWidth, mipHeight, bufw, (swizzled ? 1 : 0) | ((int)clutFmt << 1) };
+				VK_PROFILE_BEGIN(vulkan, cmdInit, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+					"Compute CLUT8 Decode: %dx%d", mipWidth, mipHeight);
+				vkCmdBindPipeline(cmdInit, VK_PIPELINE_BIND_POINT_COMPUTE, computeShaderManager_.GetPipeline(clut8DecodeCS_));
+				vkCmdBindDescriptorSets(cmdInit, VK_PIPELINE_BIND_POINT_COMPUTE, computeShaderManager_.GetPipelineLayout(), 0, 1, &descSet, 0, nullptr);
+				vkCmdPushConstants(cmdInit, computeShaderManager_.GetPipelineLayout(), VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(params), &params);
+				vkCmdDispatch(cmdInit, (mipWidth + 7) / 8, (mipHeight + 7) / 8, 1);
+				VK_PROFILE_END(vulkan, cmdInit, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+				vulkan->Delete().QueueDeleteImageView(view);
+
+				// The shader doesn't scan alpha, so be conservative unless the palette format has none.
+				entry->SetAlphaStatus(clutFmt == GE_CMODE_16BIT_BGR5650 ? CHECKALPHA_FULL : CHECKALPHA_ANY, i);
 			} else if (computeUpload) {
 				int srcBpp = VkFormatBytesPerPixel(dstFmt);
 				int srcStride = mipUnscaledWidth * srcBpp;
@@ -677,14 +822,14 @@ void TextureCacheVulkan::BuildTexture(TexCacheEntry *const entry) {
 		VK_PROFILE_END(vulkan, cmdInit, VK_PIPELINE_STAGE_TRANSFER_BIT);
 	}
 
-	VkImageLayout layout = computeUpload ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-	VkPipelineStageFlags prevStage = computeUpload ? VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT;
+	VkImageLayout layout = (computeUpload || computeDecode) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	VkPipelineStageFlags prevStage = (computeUpload || computeDecode) ? VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT;
 
 	// Generate any additional mipmap levels.
 	// This will transition the whole stack to GENERAL if it wasn't already.
 	if (plan.levelsToLoad < plan.levelsToCreate) {
 		VK_PROFILE_BEGIN(vulkan, cmdInit, VK_PIPELINE_STAGE_TRANSFER_BIT, "Mipgen up to level %d", plan.levelsToCreate);
-		entry->vkTex->GenerateMips(cmdInit, plan.levelsToLoad, computeUpload);
+		entry->vkTex->GenerateMips(cmdInit, plan.levelsToLoad, computeUpload || computeDecode);
 		layout = VK_IMAGE_LAYOUT_GENERAL;
 		prevStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
 		VK_PROFILE_END(vulkan, cmdInit, VK_PIPELINE_STAGE_TRANSFER_BIT);
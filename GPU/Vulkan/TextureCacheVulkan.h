@@ -100,6 +100,7 @@ private:
 	void BuildTexture(TexCacheEntry *const entry) override;
 
 	void CompileScalingShader();
+	void CompileDecodeShader();
 
 	VulkanDeviceAllocator *allocator_ = nullptr;
 
@@ -111,6 +112,7 @@ private:
 
 	std::string textureShader_;
 	VkShaderModule uploadCS_ = VK_NULL_HANDLE;
+	VkShaderModule clut8DecodeCS_ = VK_NULL_HANDLE;
 
 	// Bound state to emulate an API similar to the others
 	VkImageView imageView_ = VK_NULL_HANDLE;
@@ -28,6 +28,16 @@ void System_AudioClear() {
 	g_resampler.Clear();
 }
 
+int System_AudioGetUnderrunCountTotal() {
+	return g_resampler.GetUnderrunCountTotal();
+}
+
+void System_AudioGetPullStats(int *devicePeriodFrames, int64_t *framesOutput, int64_t *framesPadded) {
+	*devicePeriodFrames = g_resampler.GetDevicePeriod();
+	*framesOutput = g_resampler.GetOutputFramesTotal();
+	*framesPadded = g_resampler.GetPaddedFramesTotal();
+}
+
 void System_AudioPushSamples(const int32_t *audio, int numSamples) {
 	if (audio) {
 		g_resampler.PushSamples(audio, numSamples);
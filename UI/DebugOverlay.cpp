@@ -6,6 +6,7 @@
 #include "Core/MIPS/MIPS.h"
 #include "Core/HW/Display.h"
 #include "Core/FrameTiming.h"
+#include "Core/HLE/__sceAudio.h"
 #include "Core/HLE/sceSas.h"
 #include "Core/HLE/sceKernel.h"
 #include "Core/HLE/scePower.h"
@@ -57,6 +58,8 @@ static void DrawAudioDebugStats(UIContext *ctx, const Bounds &bounds) {
 
 	char statbuf[4096] = { 0 };
 	System_AudioGetDebugStats(statbuf, sizeof(statbuf));
+	size_t len = strlen(statbuf);
+	__AudioGetDebugStats(statbuf + len, sizeof(statbuf) - len);
 
 	ctx->Flush();
 	ctx->BindFontTexture();
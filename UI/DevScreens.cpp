@@ -56,6 +56,7 @@
 #include "Core/System.h"
 #include "Core/Reporting.h"
 #include "Core/CoreParameter.h"
+#include "Core/FileLoaders/DiskCachingFileLoader.h"
 #include "Core/HLE/sceKernel.h"  // GPI/GPO
 #include "Core/MIPS/MIPSTables.h"
 #include "Core/MIPS/JitCommon/JitBlockCache.h"
@@ -160,6 +161,27 @@ void DevMenuScreen::CreatePopupContents(UI::ViewGroup *parent) {
 		return UI::EVENT_DONE;
 	});
 
+	items->Add(new Choice(dev->T("Create frame dump (5 frames)")))->OnClick.Add([](UI::EventParams &e) {
+		GPURecord::RecordNextFrames(5, [](const Path &dumpPath) {
+			NOTICE_LOG(Log::System, "Frame dump created at '%s'", dumpPath.c_str());
+			if (System_GetPropertyBool(SYSPROP_CAN_SHOW_FILE)) {
+				System_ShowFileInFolder(dumpPath);
+			} else {
+				g_OSD.Show(OSDType::MESSAGE_SUCCESS, dumpPath.ToVisualString(), 7.0f);
+			}
+		});
+		return UI::EVENT_DONE;
+	});
+
+	if (g_Config.bReplaceTextures) {
+		items->Add(new Choice(dev->T("Reload texture replacements")))->OnClick.Add([](UI::EventParams &e) {
+			if (gpu) {
+				gpu->ReloadTextureReplacementNextFrame();
+			}
+			return UI::EVENT_DONE;
+		});
+	}
+
 	// This one is not very useful these days, and only really on desktop. Hide it on other platforms.
 	if (System_GetPropertyInt(SYSPROP_DEVICE_TYPE) == DEVICE_TYPE_DESKTOP) {
 		items->Add(new Choice(dev->T("Dump next frame to log")))->OnClick.Add([](UI::EventParams &e) {
@@ -862,6 +884,18 @@ void SystemInfoScreen::CreateInternalsTab(UI::ViewGroup *internals) {
 		return UI::EVENT_DONE;
 	});
 
+	DiskCacheStats diskCacheStats = DiskCachingFileLoader::GetStats();
+	if (diskCacheStats.cachedFileCount > 0) {
+		internals->Add(new ItemHeader(si->T("Disk read cache")));
+		internals->Add(new InfoItem(si->T("Cached files"), StringFromFormat("%d", diskCacheStats.cachedFileCount)));
+		internals->Add(new InfoItem(si->T("Read from cache"), NiceSizeFormat(diskCacheStats.hitBytes)));
+		internals->Add(new InfoItem(si->T("Read from backend"), NiceSizeFormat(diskCacheStats.missBytes)));
+		u64 totalBytes = diskCacheStats.hitBytes + diskCacheStats.missBytes;
+		if (totalBytes > 0) {
+			internals->Add(new InfoItem(si->T("Hit rate"), StringFromFormat("%0.1f%%", 100.0 * (double)diskCacheStats.hitBytes / (double)totalBytes)));
+		}
+	}
+
 	internals->Add(new ItemHeader(si->T("Notification tests")));
 	internals->Add(new Choice(si->T("Error")))->OnClick.Add([&](UI::EventParams &) {
 		std::string str = "Error " + CodepointToUTF8(0x1F41B) + CodepointToUTF8(0x1F41C) + CodepointToUTF8(0x1F914);
@@ -146,6 +146,112 @@ static void __EmuScreenVblank()
 #endif
 }
 
+// Thermal-aware performance governor. When the platform reports that throttling is
+// imminent (SYSPROP_THERMAL_STATUS), trade quality for headroom in steps - first a
+// notch of rendering resolution, then frameskip - and restore with a long hysteresis
+// once the device has cooled, so we don't oscillate around the trip point. On
+// platforms that don't report thermal status this never does anything.
+class ThermalGovernor {
+public:
+	void Update() {
+		double now = time_now_d();
+		if (now - lastPollTime_ < 1.0)
+			return;
+		lastPollTime_ = now;
+
+		int status = System_GetPropertyInt(SYSPROP_THERMAL_STATUS);
+		if (status < 0 || !g_Config.bThermalGovernor) {
+			RestoreAll();
+			return;
+		}
+
+		if (status >= 2) {
+			coolSince_ = 0.0;
+			if (hotSince_ == 0.0)
+				hotSince_ = now;
+			// Give each step a few seconds to take effect before considering the next.
+			if (now - hotSince_ >= 3.0 && steps_ < MAX_STEPS) {
+				StepDown();
+				hotSince_ = now;
+			}
+		} else if (status == 0 && steps_ > 0) {
+			hotSince_ = 0.0;
+			if (coolSince_ == 0.0)
+				coolSince_ = now;
+			// Much slower on the way back up - restoring quality is what heated us up.
+			if (now - coolSince_ >= 60.0) {
+				StepUp();
+				coolSince_ = now;
+			}
+		} else {
+			// Warm but not throttling - hold the current level.
+			hotSince_ = 0.0;
+			coolSince_ = 0.0;
+		}
+	}
+
+	// Put the user's settings back, whether we're leaving the game or the governor
+	// got turned off.
+	void RestoreAll() {
+		while (steps_ > 0)
+			StepUp();
+		hotSince_ = 0.0;
+		coolSince_ = 0.0;
+	}
+
+private:
+	enum { MAX_STEPS = 2 };
+
+	void StepDown() {
+		switch (steps_) {
+		case 0:
+			savedInternalResolution_ = g_Config.iInternalResolution;
+			// 0 is auto, 1 is the floor - only step if there's an actual notch to drop.
+			if (g_Config.iInternalResolution > 1) {
+				g_Config.iInternalResolution--;
+				System_PostUIMessage(UIMessage::GPU_RENDER_RESIZED);
+			}
+			break;
+		case 1:
+			savedFrameSkip_ = g_Config.iFrameSkip;
+			if (g_Config.iFrameSkip < 1)
+				g_Config.iFrameSkip = 1;
+			break;
+		}
+		steps_++;
+		auto gr = GetI18NCategory(I18NCat::GRAPHICS);
+		g_OSD.Show(OSDType::MESSAGE_WARNING, gr->T("Device is hot - reducing rendering quality"), 3.0f, "thermal");
+	}
+
+	void StepUp() {
+		switch (steps_ - 1) {
+		case 0:
+			if (g_Config.iInternalResolution != savedInternalResolution_) {
+				g_Config.iInternalResolution = savedInternalResolution_;
+				System_PostUIMessage(UIMessage::GPU_RENDER_RESIZED);
+			}
+			break;
+		case 1:
+			g_Config.iFrameSkip = savedFrameSkip_;
+			break;
+		}
+		steps_--;
+		if (steps_ == 0) {
+			auto gr = GetI18NCategory(I18NCat::GRAPHICS);
+			g_OSD.Show(OSDType::MESSAGE_INFO, gr->T("Device cooled down - rendering quality restored"), 3.0f, "thermal");
+		}
+	}
+
+	double lastPollTime_ = 0.0;
+	double hotSince_ = 0.0;
+	double coolSince_ = 0.0;
+	int steps_ = 0;
+	int savedInternalResolution_ = 0;
+	int savedFrameSkip_ = 0;
+};
+
+static ThermalGovernor g_thermalGovernor;
+
 // Handles control rotation due to internal screen rotation.
 static void SetPSPAnalog(int stick, float x, float y) {
 	switch (g_Config.iInternalScreenRotation) {
@@ -455,6 +561,8 @@ EmuScreen::~EmuScreen() {
 	std::string gameID = g_paramSFO.GetValueString("DISC_ID");
 	g_Config.TimeTracker().Stop(gameID);
 
+	g_thermalGovernor.RestoreAll();
+
 	// If we were invalid, it would already be shutdown.
 	if (!invalid_ || bootPending_) {
 		PSP_Shutdown();
@@ -676,6 +784,23 @@ void EmuScreen::onVKey(int virtualKeyCode, bool down) {
 			g_Config.bShowImDebugger = !g_Config.bShowImDebugger;
 		}
 		break;
+#ifdef USE_PROFILER
+	case VIRTKEY_TRACE_CAPTURE:
+		if (down) {
+			if (internal_profiler_is_capturing()) {
+				Path path = GetSysDirectory(DIRECTORY_DUMP) / "ppsspp_trace.json";
+				if (internal_profiler_stop_capture_and_write(path.c_str())) {
+					g_OSD.Show(OSDType::MESSAGE_FILE_LINK, path.ToString(), 5.0f, "tracecapture");
+				} else {
+					g_OSD.Show(OSDType::MESSAGE_ERROR, path.ToVisualString(), 3.0f, "tracecapture");
+				}
+			} else {
+				internal_profiler_start_capture();
+				g_OSD.Show(OSDType::MESSAGE_INFO, mc->T("Trace Capture"), 2.0f, "tracecapture");
+			}
+		}
+		break;
+#endif
 	case VIRTKEY_FASTFORWARD:
 		if (down) {
 			if (coreState == CORE_STEPPING) {
@@ -1304,6 +1429,8 @@ void EmuScreen::update() {
 	if (invalid_)
 		return;
 
+	g_thermalGovernor.Update();
+
 	double now = time_now_d();
 
 	controlMapper_.Update(now);
@@ -25,6 +25,7 @@
 #include "Common/GPU/thin3d.h"
 #include "Common/Thread/ThreadManager.h"
 #include "Common/File/VFS/VFS.h"
+#include "Common/File/DirListing.h"
 #include "Common/File/FileUtil.h"
 #include "Common/File/Path.h"
 #include "Common/Render/ManagedTexture.h"
@@ -44,11 +45,71 @@
 
 GameInfoCache *g_gameInfoCache;
 
+// Persistent metadata cache. Same on-disk scheme as Common/UI/IconCache.cpp:
+// a fixed header, then one fixed entry header per game followed by its blobs.
+#define GAMEINFO_CACHE_VERSION 1
+#define MK_FOURCC(str) (str[0] | ((uint8_t)str[1] << 8) | ((uint8_t)str[2] << 16) | ((uint8_t)str[3] << 24))
+
+static const uint32_t GAMEINFO_CACHE_MAGIC = MK_FOURCC("pGIC");
+
+// Icons are normally a few tens of KB - anything bigger than this is suspect
+// and not worth persisting.
+static const size_t MAX_CACHED_BLOB_SIZE = 1024 * 1024;
+
+struct GameInfoCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entryCount;
+};
+
+struct GameInfoCacheEntryHeader {
+	uint32_t keyLen;
+	uint32_t titleLen;
+	uint32_t idLen;
+	uint32_t idVersionLen;
+	uint32_t sfoLen;
+	uint32_t iconLen;
+	uint64_t mtime;
+	uint64_t size;
+	int32_t fileType;
+	int32_t region;
+	int32_t discTotal;
+	int32_t discNumber;
+};
+
+static Path GameInfoCacheFilePath() {
+	return GetSysDirectory(DIRECTORY_CACHE) / "gameinfo.cache";
+}
+
+static bool ReadBlob(FILE *f, uint32_t len, std::string *dest) {
+	if (len > MAX_CACHED_BLOB_SIZE) {
+		// Corrupt file, most likely.
+		return false;
+	}
+	dest->resize(len);
+	return len == 0 || fread(&(*dest)[0], 1, len, f) == len;
+}
+
+// Only single-file types get persisted - for these, the mtime/size pair tells
+// the whole story about whether the entry is still valid.
+static bool IsDiskCacheableFileType(IdentifiedFileType fileType) {
+	switch (fileType) {
+	case IdentifiedFileType::PSP_ISO:
+	case IdentifiedFileType::PSP_ISO_NP:
+	case IdentifiedFileType::PSP_PBP:
+		return true;
+	default:
+		return false;
+	}
+}
+
 void GameInfoTex::Clear() {
 	if (!data.empty()) {
 		data.clear();
 		dataLoaded = false;
 	}
+	decoded.Free();
+	decodedReady = false;
 	if (texture) {
 		texture->Release();
 		texture = nullptr;
@@ -387,9 +448,14 @@ void GameInfo::SetupTexture(Draw::DrawContext *thin3d, GameInfoTex &tex) {
 		return;
 	}
 	using namespace Draw;
-	// TODO: Use TempImage to semi-load the image in the worker task, then here we
-	// could just call CreateTextureFromTempImage.
-	tex.texture = CreateTextureFromFileData(thin3d, (const uint8_t *)tex.data.data(), tex.data.size(), ImageFileType::DETECT, false, GetTitle().c_str());
+	if (tex.decodedReady && tex.decoded.numLevels > 0) {
+		// The worker already decoded the image - all that's left is the upload.
+		tex.texture = CreateTextureFromTempImage(thin3d, tex.decoded, false, GetTitle().c_str());
+		tex.decoded.Free();
+		tex.decodedReady = false;
+	} else {
+		tex.texture = CreateTextureFromFileData(thin3d, (const uint8_t *)tex.data.data(), tex.data.size(), ImageFileType::DETECT, false, GetTitle().c_str());
+	}
 	tex.timeLoaded = time_now_d();
 	if (!tex.texture) {
 		ERROR_LOG(Log::G3D, "Failed creating texture (%s) from %d-byte file", GetTitle().c_str(), (int)tex.data.size());
@@ -458,6 +524,15 @@ static bool ReadVFSToString(const char *filename, std::string *contents, std::mu
 	return true;
 }
 
+// Decodes an image on a worker thread, so the UI thread only has to do the GPU
+// upload. If the UI thread already created (or failed) the texture, does nothing.
+static void PreDecodeTex(GameInfoTex *tex) {
+	if (!tex->dataLoaded || tex->decodedReady || tex->data.empty() || tex->timeLoaded != 0.0)
+		return;
+	if (tex->decoded.LoadTextureLevelsFromFileData((const uint8_t *)tex->data.data(), tex->data.size()))
+		tex->decodedReady = true;
+}
+
 class GameInfoWorkItem : public Task {
 public:
 	GameInfoWorkItem(const Path &gamePath, std::shared_ptr<GameInfo> &info, GameInfoFlags flags)
@@ -810,6 +885,16 @@ handleELF:
 				break;
 		}
 
+		// Get the PNG decoding out of the way here too, before handing over to the
+		// UI thread, which then only has to do the upload.
+		if (flags_ & GameInfoFlags::ICON) {
+			PreDecodeTex(&info_->icon);
+		}
+		if (flags_ & GameInfoFlags::BG) {
+			PreDecodeTex(&info_->pic0);
+			PreDecodeTex(&info_->pic1);
+		}
+
 		if (flags_ & GameInfoFlags::PARAM_SFO) {
 			// We fetch the hasConfig together with the params, since that's what fills out the id.
 			info_->hasConfig = g_Config.hasGameConfig(info_->id);
@@ -838,9 +923,17 @@ handleELF:
 		}
 
 		// Time to update the flags.
-		std::unique_lock<std::mutex> lock(info_->lock);
-		info_->MarkReadyNoLock(flags_);
-		// INFO_LOG(Log::System, "Completed writing info for %s", info_->GetTitle().c_str());
+		{
+			std::unique_lock<std::mutex> lock(info_->lock);
+			info_->MarkReadyNoLock(flags_);
+			// INFO_LOG(Log::System, "Completed writing info for %s", info_->GetTitle().c_str());
+		}
+
+		// If we just read everything the game list wants from the actual file,
+		// refresh the persistent cache entry so the next launch doesn't have to.
+		if ((flags_ & GameInfoFlags::PARAM_SFO) && (flags_ & GameInfoFlags::ICON)) {
+			g_gameInfoCache->UpdateDiskCacheEntry(info_.get());
+		}
 	}
 
 private:
@@ -851,6 +944,63 @@ private:
 	DISALLOW_COPY_AND_ASSIGN(GameInfoWorkItem);
 };
 
+// Re-checks that a file still matches the disk cache entry it was displayed from.
+// Cheap (a single stat), runs at low priority so real scans go first.
+class DiskCacheValidationTask : public Task {
+public:
+	DiskCacheValidationTask(const Path &gamePath, uint64_t mtime, uint64_t size)
+		: gamePath_(gamePath), mtime_(mtime), size_(size) {}
+
+	TaskType Type() const override {
+		return TaskType::IO_BLOCKING;
+	}
+
+	TaskPriority Priority() const override {
+		return TaskPriority::LOW;
+	}
+
+	void Run() override {
+		File::FileInfo fi;
+		bool fresh = File::GetFileInfo(gamePath_, &fi) && fi.exists && fi.mtime == mtime_ && fi.size == size_;
+		if (!fresh) {
+			INFO_LOG(Log::Loader, "Cached game info stale for %s, re-scanning", gamePath_.ToVisualString().c_str());
+			g_gameInfoCache->InvalidatePath(gamePath_);
+		}
+	}
+
+private:
+	Path gamePath_;
+	uint64_t mtime_;
+	uint64_t size_;
+};
+
+// Decodes an icon that was restored from the metadata cache, off the UI thread.
+class IconDecodeTask : public Task {
+public:
+	IconDecodeTask(std::shared_ptr<GameInfo> info) : info_(std::move(info)) {}
+
+	TaskType Type() const override {
+		return TaskType::CPU_COMPUTE;
+	}
+
+	TaskPriority Priority() const override {
+		return TaskPriority::NORMAL;
+	}
+
+	void Run() override {
+		GameInfoTex *tex = &info_->icon;
+		if (!tex->data.empty() && tex->decoded.LoadTextureLevelsFromFileData((const uint8_t *)tex->data.data(), tex->data.size())) {
+			tex->decodedReady = true;
+		}
+		// Only flip this once the decoded image is in place - it's what the UI
+		// thread keys off.
+		tex->dataLoaded = true;
+	}
+
+private:
+	std::shared_ptr<GameInfo> info_;
+};
+
 GameInfoCache::GameInfoCache() {
 	Init();
 }
@@ -860,10 +1010,207 @@ GameInfoCache::~GameInfoCache() {
 	Shutdown();
 }
 
-void GameInfoCache::Init() {}
+void GameInfoCache::Init() {
+	LoadDiskCache();
+}
 
 void GameInfoCache::Shutdown() {
 	CancelAll();
+	SaveDiskCache();
+}
+
+void GameInfoCache::LoadDiskCache() {
+	FILE *f = File::OpenCFile(GameInfoCacheFilePath(), "rb");
+	if (!f) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(diskCacheLock_);
+
+	GameInfoCacheHeader header{};
+	if (fread(&header, 1, sizeof(header), f) != sizeof(header) ||
+		header.magic != GAMEINFO_CACHE_MAGIC || header.version != GAMEINFO_CACHE_VERSION) {
+		fclose(f);
+		return;
+	}
+
+	for (uint32_t i = 0; i < header.entryCount; i++) {
+		GameInfoCacheEntryHeader entryHeader{};
+		if (fread(&entryHeader, 1, sizeof(entryHeader), f) != sizeof(entryHeader)) {
+			break;
+		}
+
+		std::string key;
+		DiskCacheEntry entry;
+		if (!ReadBlob(f, entryHeader.keyLen, &key) ||
+			!ReadBlob(f, entryHeader.titleLen, &entry.title) ||
+			!ReadBlob(f, entryHeader.idLen, &entry.id) ||
+			!ReadBlob(f, entryHeader.idVersionLen, &entry.idVersion) ||
+			!ReadBlob(f, entryHeader.sfoLen, &entry.sfoData) ||
+			!ReadBlob(f, entryHeader.iconLen, &entry.iconData)) {
+			// Truncated or corrupt - keep what we got so far, it's still useful.
+			break;
+		}
+		entry.mtime = entryHeader.mtime;
+		entry.size = entryHeader.size;
+		entry.fileType = entryHeader.fileType;
+		entry.region = entryHeader.region;
+		entry.discTotal = entryHeader.discTotal;
+		entry.discNumber = entryHeader.discNumber;
+		diskCache_.emplace(key, std::move(entry));
+	}
+	fclose(f);
+
+	INFO_LOG(Log::Loader, "Loaded %d game info cache entries", (int)diskCache_.size());
+}
+
+void GameInfoCache::SaveDiskCache() {
+	std::lock_guard<std::mutex> lock(diskCacheLock_);
+	if (!diskCacheDirty_) {
+		return;
+	}
+
+	FILE *f = File::OpenCFile(GameInfoCacheFilePath(), "wb");
+	if (!f) {
+		return;
+	}
+
+	GameInfoCacheHeader header{};
+	header.magic = GAMEINFO_CACHE_MAGIC;
+	header.version = GAMEINFO_CACHE_VERSION;
+	header.entryCount = (uint32_t)diskCache_.size();
+	fwrite(&header, 1, sizeof(header), f);
+
+	for (const auto &iter : diskCache_) {
+		const DiskCacheEntry &entry = iter.second;
+		GameInfoCacheEntryHeader entryHeader{};
+		entryHeader.keyLen = (uint32_t)iter.first.size();
+		entryHeader.titleLen = (uint32_t)entry.title.size();
+		entryHeader.idLen = (uint32_t)entry.id.size();
+		entryHeader.idVersionLen = (uint32_t)entry.idVersion.size();
+		entryHeader.sfoLen = (uint32_t)entry.sfoData.size();
+		entryHeader.iconLen = (uint32_t)entry.iconData.size();
+		entryHeader.mtime = entry.mtime;
+		entryHeader.size = entry.size;
+		entryHeader.fileType = entry.fileType;
+		entryHeader.region = entry.region;
+		entryHeader.discTotal = entry.discTotal;
+		entryHeader.discNumber = entry.discNumber;
+		fwrite(&entryHeader, 1, sizeof(entryHeader), f);
+		fwrite(iter.first.data(), 1, iter.first.size(), f);
+		fwrite(entry.title.data(), 1, entry.title.size(), f);
+		fwrite(entry.id.data(), 1, entry.id.size(), f);
+		fwrite(entry.idVersion.data(), 1, entry.idVersion.size(), f);
+		fwrite(entry.sfoData.data(), 1, entry.sfoData.size(), f);
+		fwrite(entry.iconData.data(), 1, entry.iconData.size(), f);
+	}
+	fclose(f);
+	diskCacheDirty_ = false;
+}
+
+GameInfoFlags GameInfoCache::ApplyDiskCacheEntry(const std::shared_ptr<GameInfo> &info, GameInfoFlags wantFlags) {
+	GameInfoFlags satisfied = (GameInfoFlags)0;
+
+	std::lock_guard<std::mutex> lock(diskCacheLock_);
+	auto iter = diskCache_.find(info->GetFilePath().ToString());
+	if (iter == diskCache_.end()) {
+		return satisfied;
+	}
+	const DiskCacheEntry &entry = iter->second;
+
+	// We're the only owner of this GameInfo so far, so its lock isn't needed.
+	info->fileType = (IdentifiedFileType)entry.fileType;
+	satisfied |= GameInfoFlags::FILE_TYPE;
+
+	if (wantFlags & GameInfoFlags::PARAM_SFO) {
+		if (!entry.sfoData.empty()) {
+			info->paramSFO.ReadSFO((const u8 *)entry.sfoData.data(), entry.sfoData.size());
+		}
+		info->title = entry.title;
+		info->id = entry.id;
+		info->id_version = entry.idVersion;
+		info->region = entry.region;
+		info->disc_total = entry.discTotal;
+		info->disc_number = entry.discNumber;
+		info->hasConfig = g_Config.hasGameConfig(info->id);
+		satisfied |= GameInfoFlags::PARAM_SFO;
+	}
+
+	if (wantFlags & GameInfoFlags::ICON) {
+		info->icon.data = entry.iconData;
+		// Decode off the UI thread - dataLoaded flips once the image is ready.
+		g_threadManager.EnqueueTask(new IconDecodeTask(info));
+		satisfied |= GameInfoFlags::ICON;
+	}
+
+	// Kick off a freshness check in the background. If the file changed, the
+	// cached data gets dropped and the game re-scanned.
+	g_threadManager.EnqueueTask(new DiskCacheValidationTask(info->GetFilePath(), entry.mtime, entry.size));
+	return satisfied;
+}
+
+void GameInfoCache::UpdateDiskCacheEntry(GameInfo *info) {
+	if (!IsDiskCacheableFileType(info->fileType)) {
+		return;
+	}
+
+	File::FileInfo fi;
+	if (!File::GetFileInfo(info->GetFilePath(), &fi) || !fi.exists) {
+		return;
+	}
+
+	DiskCacheEntry entry;
+	entry.mtime = fi.mtime;
+	entry.size = fi.size;
+	{
+		std::lock_guard<std::mutex> lock(info->lock);
+		// Only persist entries that can satisfy the game list by themselves.
+		GameInfoFlags needed = GameInfoFlags::PARAM_SFO | GameInfoFlags::ICON;
+		if (((int)info->hasFlags & (int)needed) != (int)needed) {
+			return;
+		}
+		entry.fileType = (int)info->fileType;
+		entry.region = info->region;
+		entry.discTotal = info->disc_total;
+		entry.discNumber = info->disc_number;
+		entry.title = info->title;
+		entry.id = info->id;
+		entry.idVersion = info->id_version;
+		entry.iconData = info->icon.data;
+
+		u8 *sfoData = nullptr;
+		size_t sfoSize = 0;
+		info->paramSFO.WriteSFO(&sfoData, &sfoSize);
+		if (sfoData) {
+			entry.sfoData.assign((const char *)sfoData, sfoSize);
+			delete[] sfoData;
+		}
+	}
+	if (entry.iconData.size() > MAX_CACHED_BLOB_SIZE || entry.sfoData.size() > MAX_CACHED_BLOB_SIZE) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(diskCacheLock_);
+	diskCache_[info->GetFilePath().ToString()] = std::move(entry);
+	diskCacheDirty_ = true;
+}
+
+void GameInfoCache::InvalidatePath(const Path &path) {
+	{
+		std::lock_guard<std::mutex> lock(diskCacheLock_);
+		if (diskCache_.erase(path.ToString())) {
+			diskCacheDirty_ = true;
+		}
+	}
+
+	// Also drop the in-memory info that was filled in from the stale entry, so the
+	// next GetInfo does a real scan. If work is in flight for it, leave it alone -
+	// that work is reading the actual file anyway.
+	std::lock_guard<std::mutex> lock(mapLock_);
+	auto iter = info_.find(path.ToString());
+	if (iter != info_.end() && iter->second->pendingFlags == (GameInfoFlags)0) {
+		info_.erase(iter);
+	}
 }
 
 void GameInfoCache::Clear() {
@@ -981,8 +1328,19 @@ std::shared_ptr<GameInfo> GameInfoCache::GetInfo(Draw::DrawContext *draw, const
 	info_.insert(std::make_pair(pathStr, info));
 	mapLock_.unlock();
 
-	// Just get all the stuff we wanted.
-	GameInfoWorkItem *item = new GameInfoWorkItem(gamePath, info, wantFlags);
-	g_threadManager.EnqueueTask(item);
+	// See if the persistent metadata cache can satisfy the request right away,
+	// without touching the file (which might be on slow network storage).
+	GameInfoFlags cached = ApplyDiskCacheEntry(info, wantFlags);
+	if (cached != (GameInfoFlags)0) {
+		std::unique_lock<std::mutex> lock(info->lock);
+		info->MarkReadyNoLock(cached);
+	}
+
+	// Fetch whatever's left the normal way.
+	GameInfoFlags wanted = (GameInfoFlags)((int)wantFlags & ~(int)cached);
+	if (wanted != (GameInfoFlags)0) {
+		GameInfoWorkItem *item = new GameInfoWorkItem(gamePath, info, wanted);
+		g_threadManager.EnqueueTask(item);
+	}
 	return info;
 }
@@ -24,6 +24,7 @@
 #include <atomic>
 
 #include "Common/Thread/Event.h"
+#include "Common/Render/ManagedTexture.h"
 #include "Core/ELF/ParamSFO.h"
 #include "Common/File/Path.h"
 
@@ -67,11 +68,15 @@ enum class IdentifiedFileType;
 struct GameInfoTex {
 	std::string data;
 	Draw::Texture *texture = nullptr;
+	// Image pre-decoded on a worker thread, so the UI thread only has to do the
+	// GPU upload. Valid when decodedReady is set; SetupTexture consumes it.
+	TempImage decoded;
 	// The time at which the Icon and the BG were loaded.
 	// Can be useful to fade them in smoothly once they appear.
 	// Also, timeLoaded != 0 && texture == nullptr means that the load failed.
 	double timeLoaded = 0.0;
 	std::atomic<bool> dataLoaded{};
+	std::atomic<bool> decodedReady{};
 
 	// Can ONLY be called from the main thread!
 	void Clear();
@@ -191,6 +196,7 @@ protected:
 private:
 	DISALLOW_COPY_AND_ASSIGN(GameInfo);
 	friend class GameInfoWorkItem;
+	friend class GameInfoCache;
 };
 
 class GameInfoCache {
@@ -212,14 +218,46 @@ public:
 
 	void CancelAll();
 
+	// Persistent metadata cache (title, region, icon, etc) so game lists don't have to
+	// re-read ISO headers and icons on every launch - important for network storage.
+	// Loaded on startup, saved on shutdown. Called from worker threads.
+	void UpdateDiskCacheEntry(GameInfo *info);
+	// Called when a file turns out to have changed (or vanished) since its entry was
+	// written - drops the entry and the in-memory info so it gets re-scanned.
+	void InvalidatePath(const Path &path);
+
 private:
 	void Init();
 	void Shutdown();
 
-	// Maps ISO path to info. Need to use shared_ptr as we can return these pointers - 
+	void LoadDiskCache();
+	void SaveDiskCache();
+	// Fills in whatever the disk cache has for this info, returning the flags that
+	// were satisfied. The caller must be the sole owner of the GameInfo.
+	GameInfoFlags ApplyDiskCacheEntry(const std::shared_ptr<GameInfo> &info, GameInfoFlags wantFlags);
+
+	struct DiskCacheEntry {
+		uint64_t mtime = 0;
+		uint64_t size = 0;
+		int fileType = 0;
+		int region = -1;
+		int discTotal = 0;
+		int discNumber = 0;
+		std::string title;
+		std::string id;
+		std::string idVersion;
+		std::string sfoData;
+		std::string iconData;
+	};
+
+	// Maps ISO path to info. Need to use shared_ptr as we can return these pointers -
 	// and if they get destructed while being in use, that's bad.
 	std::map<std::string, std::shared_ptr<GameInfo> > info_;
 	std::mutex mapLock_;
+
+	std::map<std::string, DiskCacheEntry> diskCache_;
+	std::mutex diskCacheLock_;
+	bool diskCacheDirty_ = false;
 };
 
 // This one can be global, no good reason not to.
@@ -19,6 +19,10 @@
 // Callstack window
 #include "Core/MIPS/MIPSStackWalk.h"
 
+// Scheduler window
+#include "Common/TimeUtil.h"
+#include "Core/CoreTiming.h"
+
 #include "UI/ImDebugger/ImDebugger.h"
 
 void DrawRegisterView(MIPSDebugInterface *mipsDebug, bool *open) {
@@ -233,6 +237,59 @@ void DrawModules(MIPSDebugInterface *debug, bool *open) {
 	ImGui::End();
 }
 
+void DrawSchedulerView(bool *open) {
+	if (!ImGui::Begin("CoreTiming events", open)) {
+		ImGui::End();
+		return;
+	}
+
+	std::vector<CoreTiming::EventTypeStats> stats;
+	CoreTiming::GetEventTypeStats(&stats);
+
+	// Track per-type scheduling rates so event storms from HLE modules stand out.
+	static std::vector<u64> lastCounts;
+	static std::vector<float> rates;
+	static double lastTime;
+	double now = time_now_d();
+	if (lastCounts.size() != stats.size()) {
+		lastCounts.assign(stats.size(), 0);
+		rates.assign(stats.size(), 0.0f);
+		lastTime = now;
+	}
+	if (now - lastTime >= 1.0) {
+		for (size_t i = 0; i < stats.size(); i++) {
+			rates[i] = (float)((stats[i].scheduledCount - lastCounts[i]) / (now - lastTime));
+			lastCounts[i] = stats[i].scheduledCount;
+		}
+		lastTime = now;
+	}
+
+	if (ImGui::BeginTable("events", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersH)) {
+		ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableSetupColumn("Pending", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableSetupColumn("Events/sec", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableSetupColumn("Total", ImGuiTableColumnFlags_WidthFixed);
+
+		ImGui::TableHeadersRow();
+		ImGui::TableNextRow();
+
+		for (size_t i = 0; i < stats.size(); i++) {
+			ImGui::TableSetColumnIndex(0);
+			ImGui::Text("%s", stats[i].name);
+			ImGui::TableSetColumnIndex(1);
+			ImGui::Text("%d", stats[i].pendingCount);
+			ImGui::TableSetColumnIndex(2);
+			ImGui::Text("%0.1f", rates[i]);
+			ImGui::TableSetColumnIndex(3);
+			ImGui::Text("%llu", (unsigned long long)stats[i].scheduledCount);
+			ImGui::TableNextRow();
+		}
+
+		ImGui::EndTable();
+	}
+	ImGui::End();
+}
+
 void ImDebugger::Frame(MIPSDebugInterface *mipsDebug) {
 	// Snapshot the coreState to avoid inconsistency.
 	const CoreState coreState = ::coreState;
@@ -278,6 +335,7 @@ void ImDebugger::Frame(MIPSDebugInterface *mipsDebug) {
 			ImGui::Checkbox("Callstacks", &callstackOpen_);
 			ImGui::Checkbox("HLE Modules", &modulesOpen_);
 			ImGui::Checkbox("HLE Threads", &threadsOpen_);
+			ImGui::Checkbox("CoreTiming events", &schedulerOpen_);
 			ImGui::EndMenu();
 		}
 		ImGui::EndMainMenuBar();
@@ -306,6 +364,10 @@ void ImDebugger::Frame(MIPSDebugInterface *mipsDebug) {
 	if (modulesOpen_) {
 		DrawModules(mipsDebug, &modulesOpen_);
 	}
+
+	if (schedulerOpen_) {
+		DrawSchedulerView(&schedulerOpen_);
+	}
 }
 
 void ImDisasmWindow::Draw(MIPSDebugInterface *mipsDebug, bool *open, CoreState coreState) {
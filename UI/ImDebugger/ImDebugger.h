@@ -61,4 +61,5 @@ struct ImDebugger {
 	bool threadsOpen_ = true;
 	bool callstackOpen_ = true;
 	bool modulesOpen_ = true;
+	bool schedulerOpen_ = false;
 };
@@ -30,7 +30,8 @@ ImDisasmView::ImDisasmView() {
 }
 
 ImDisasmView::~ImDisasmView() {
-	manager.clear();
+	// Note: the manager's entries are shared and kept alive so reopening the
+	// window doesn't have to re-analyze everything.
 }
 
 void ImDisasmView::ScanVisibleFunctions() {
@@ -352,11 +352,14 @@ void JitCompareScreen::UpdateDisasm() {
 			"Num blocks: %d\n"
 			"Average Bloat: %0.2f%%\n"
 			"Min Bloat: %0.2f%%  (%08x)\n"
-			"Max Bloat: %0.2f%%  (%08x)\n",
+			"Max Bloat: %0.2f%%  (%08x)\n"
+			"Linked exits: %d of %d (%0.1f%%)\n",
 			blockCacheDebug->GetNumBlocks(),
 			100.0 * bcStats.avgBloat,
 			100.0 * bcStats.minBloat, bcStats.minBloatBlock,
-			100.0 * bcStats.maxBloat, bcStats.maxBloatBlock);
+			100.0 * bcStats.maxBloat, bcStats.maxBloatBlock,
+			bcStats.numLinkedExits, bcStats.numExits,
+			bcStats.numExits ? 100.0 * bcStats.numLinkedExits / bcStats.numExits : 0.0);
 
 		statsContainer_->Add(new TextView(stats));
 	}
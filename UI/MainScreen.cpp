@@ -700,6 +700,9 @@ void GameBrowser::Update() {
 	if ((listingPending_ && path_.IsListingReady()) || refreshPending_) {
 		Refresh();
 		refreshPending_ = false;
+	} else if (!listingPending_ && path_.GetListingGeneration() != shownListingGeneration_) {
+		// A background revalidation of a cached listing brought in new data.
+		Refresh();
 	}
 	if (searchPending_) {
 		ApplySearchFilter();
@@ -863,6 +866,7 @@ void GameBrowser::Refresh() {
 	std::vector<GameButton *> gameButtons;
 
 	listingPending_ = !path_.IsListingReady();
+	shownListingGeneration_ = path_.GetListingGeneration();
 
 	// TODO: If listing failed, show a special error message.
 
@@ -110,6 +110,7 @@ private:
 	bool listingPending_ = false;
 	bool searchPending_ = false;
 	bool refreshPending_ = false;
+	int shownListingGeneration_ = 0;
 	float lastScale_ = 1.0f;
 	bool lastLayoutWasGrid_ = true;
 	ScreenManager *screenManager_;
@@ -76,6 +76,7 @@
 #include "Common/File/VFS/DirectoryReader.h"
 #include "Common/CPUDetect.h"
 #include "Common/File/FileUtil.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Common/TimeUtil.h"
 #include "Common/StringUtils.h"
 #include "Common/Log/LogManager.h"
@@ -220,6 +221,31 @@ public:
 static LogListener *logger = nullptr;
 Path boot_filename;
 
+// Coarse startup timeline. The interesting phases don't repeat per frame so the
+// regular profiler isn't much help here - instead we log each phase's offset from
+// the start of NativeInit, which makes the critical path easy to read out of a
+// logcat on slow devices.
+static double startupTimeBase;
+
+static void StartupPhase(const char *phase) {
+	INFO_LOG(Log::System, "Startup: %s (+%0.1f ms)", phase, (time_now_d() - startupTimeBase) * 1000.0);
+}
+
+// Loading the achievements icon cache is pure file I/O, so it runs on a worker
+// while the rest of init proceeds. IconCache locks internally.
+class IconCacheLoadTask : public Task {
+public:
+	TaskType Type() const override { return TaskType::IO_BLOCKING; }
+	TaskPriority Priority() const override { return TaskPriority::NORMAL; }
+	void Run() override {
+		FILE *iconCacheFile = File::OpenCFile(GetSysDirectory(DIRECTORY_CACHE) / "icon.cache", "rb");
+		if (iconCacheFile) {
+			g_iconCache.LoadFromFile(iconCacheFile);
+			fclose(iconCacheFile);
+		}
+	}
+};
+
 int NativeMix(short *audio, int numSamples, int sampleRateHz) {
 	return __AudioMix(audio, numSamples, sampleRateHz);
 }
@@ -359,6 +385,8 @@ static void ClearFailedGPUBackends() {
 }
 
 void NativeInit(int argc, const char *argv[], const char *savegame_dir, const char *external_dir, const char *cache_dir) {
+	startupTimeBase = time_now_d();
+
 	net::Init();  // This needs to happen before we load the config. So on Windows we also run it in Main. It's fine to call multiple times.
 
 	ShaderTranslationInit();
@@ -527,6 +555,8 @@ void NativeInit(int argc, const char *argv[], const char *savegame_dir, const ch
 	g_Config.Load();
 #endif
 
+	StartupPhase("config loaded");
+
 	LogManager *logman = LogManager::GetInstance();
 
 	const char *fileToLog = nullptr;
@@ -677,6 +707,11 @@ void NativeInit(int argc, const char *argv[], const char *savegame_dir, const ch
 		LogManager::GetInstance()->SetAllLogLevels(logLevel);
 
 	PostLoadConfig();
+	StartupPhase("post-load config done");
+
+	// The theme selection is known now, so the theme list scan and atlas metadata
+	// reads can overlap the rest of init. UpdateTheme joins this during graphics init.
+	PreloadThemeMetadata();
 
 #if PPSSPP_PLATFORM(ANDROID)
 	logger = new AndroidLogger();
@@ -741,13 +776,13 @@ void NativeInit(int argc, const char *argv[], const char *savegame_dir, const ch
 	}
 
 	if (g_Config.bAchievementsEnable) {
-		FILE *iconCacheFile = File::OpenCFile(GetSysDirectory(DIRECTORY_CACHE) / "icon.cache", "rb");
-		if (iconCacheFile) {
-			g_iconCache.LoadFromFile(iconCacheFile);
-			fclose(iconCacheFile);
-		}
+		g_threadManager.EnqueueTask(new IconCacheLoadTask());
 	}
 
+	// Now that the directories are set up, the shader translation cache can persist
+	// alongside the shader caches.
+	ShaderTranslationSetCacheDir(GetSysDirectory(DIRECTORY_APP_CACHE));
+
 	DEBUG_LOG(Log::System, "ScreenManager!");
 	g_screenManager = new ScreenManager();
 	if (g_Config.memStickDirectory.empty()) {
@@ -791,6 +826,8 @@ void NativeInit(int argc, const char *argv[], const char *savegame_dir, const ch
 	// Initialize retro achievements runtime.
 	Achievements::Initialize();
 
+	StartupPhase("NativeInit done");
+
 	// Must be done restarting by now.
 	restarting = false;
 }
@@ -860,6 +897,7 @@ bool NativeInitGraphics(GraphicsContext *graphicsContext) {
 	}
 
 	INFO_LOG(Log::System, "NativeInitGraphics completed");
+	StartupPhase("NativeInitGraphics done");
 
 	return true;
 }
@@ -1106,6 +1144,9 @@ void NativeFrame(GraphicsContext *graphicsContext) {
 
 	ui_draw2d.PopDrawMatrix();
 
+	// Pull every frame so the accumulator doesn't chain across frames.
+	const uint64_t uiFrameHash = ui_draw2d.PullFrameDataHash();
+
 	g_draw->EndFrame();
 
 	// This, between EndFrame and Present, is where we should actually wait to do present time management.
@@ -1159,7 +1200,24 @@ void NativeFrame(GraphicsContext *graphicsContext) {
 		// TODO: We should ideally mix this with game audio.
 		g_BackgroundAudio.Play();
 
+		// If the UI has drawn the exact same vertex data for a few frames in a row
+		// (static menu, no animations, no OSD), drop to half rate. The presented
+		// content is identical so this isn't visible, and any change snaps us
+		// straight back to full rate.
+		static uint64_t lastUIFrameHash = 0;
+		static int staticUIFrames = 0;
+		if (uiFrameHash != 0 && uiFrameHash == lastUIFrameHash) {
+			if (staticUIFrames < 1000)
+				staticUIFrames++;
+		} else {
+			staticUIFrames = 0;
+			lastUIFrameHash = uiFrameHash;
+		}
+
 		float refreshRate = System_GetPropertyFloat(SYSPROP_DISPLAY_REFRESH_RATE);
+		if (staticUIFrames > 3) {
+			refreshRate *= 0.5f;
+		}
 		// Simple throttling to not burn the GPU in the menu.
 		// TODO: This should move into NativeFrame. Also, it's only necessary in MAILBOX or IMMEDIATE presentation modes.
 		double diffTime = time_now_d() - startTime;
@@ -26,6 +26,8 @@
 #include "Common/Data/Format/IniFile.h"
 #include "Common/File/DirListing.h"
 #include "Common/Log/LogManager.h"
+#include "Common/Thread/ThreadManager.h"
+#include "Common/Thread/Waitable.h"
 
 #include "Core/Config.h"
 
@@ -175,12 +177,7 @@ static void LoadAtlasMetadata(Atlas &metadata, const char *filename, bool requir
 	delete[] atlas_data;
 }
 
-void UpdateTheme(UIContext *ctx) {
-	// First run, get the default in at least
-	if (themeInfos.empty()) {
-		ReloadAllThemeInfo();
-	}
-
+static size_t FindSelectedThemeIndex() {
 	size_t i;
 	for (i = 0; i < themeInfos.size(); ++i) {
 		if (themeInfos[i].name == g_Config.sThemeName) {
@@ -193,6 +190,61 @@ void UpdateTheme(UIContext *ctx) {
 		g_Config.sThemeName = "Default";
 		i = 0;
 	}
+	return i;
+}
+
+static void LoadThemeAtlasMetadata(const ThemeInfo &themeInfo) {
+	// Load any missing atlas metadata (the images are loaded from UIContext).
+	LoadAtlasMetadata(ui_atlas, (themeInfo.sUIAtlas + ".meta").c_str(), true);
+#if !(PPSSPP_PLATFORM(WINDOWS) || PPSSPP_PLATFORM(ANDROID))
+	LoadAtlasMetadata(font_atlas, "font_atlas.meta", ui_atlas.num_fonts == 0);
+#else
+	LoadAtlasMetadata(font_atlas, "asciifont_atlas.meta", ui_atlas.num_fonts == 0);
+#endif
+}
+
+// The theme list and atlas metadata loads are pure I/O, so they can run on a worker
+// while graphics init proceeds. UpdateTheme joins before it touches the results.
+static LimitedWaitable *themePreloadWaitable;
+static bool themePreloadedAtlases;
+
+class ThemePreloadTask : public Task {
+public:
+	explicit ThemePreloadTask(LimitedWaitable *waitable) : waitable_(waitable) {}
+	TaskType Type() const override { return TaskType::IO_BLOCKING; }
+	TaskPriority Priority() const override { return TaskPriority::HIGH; }
+	void Run() override {
+		ReloadAllThemeInfo();
+		LoadThemeAtlasMetadata(themeInfos[FindSelectedThemeIndex()]);
+		themePreloadedAtlases = true;
+		waitable_->Notify();
+	}
+private:
+	LimitedWaitable *waitable_;
+};
+
+void PreloadThemeMetadata() {
+	if (themePreloadWaitable) {
+		return;
+	}
+	themePreloadWaitable = new LimitedWaitable();
+	g_threadManager.EnqueueTask(new ThemePreloadTask(themePreloadWaitable));
+}
+
+void UpdateTheme(UIContext *ctx) {
+	bool justPreloaded = false;
+	if (themePreloadWaitable) {
+		themePreloadWaitable->WaitAndRelease();
+		themePreloadWaitable = nullptr;
+		justPreloaded = themePreloadedAtlases;
+	}
+
+	// First run, get the default in at least
+	if (themeInfos.empty()) {
+		ReloadAllThemeInfo();
+	}
+
+	size_t i = FindSelectedThemeIndex();
 
 #if defined(USING_WIN_UI) || PPSSPP_PLATFORM(UWP) || defined(USING_QT_UI)
 	ui_theme.uiFont = UI::FontStyle(FontID("UBUNTU24"), g_Config.sFont.c_str(), 22);
@@ -222,13 +274,11 @@ void UpdateTheme(UIContext *ctx) {
 	ui_theme.popupStyle = MakeStyle(themeInfos[i].uItemStyleFg, themeInfos[i].uPopupStyleBg);
 	ui_theme.backgroundColor = themeInfos[i].uBackgroundColor;
 
-	// Load any missing atlas metadata (the images are loaded from UIContext).
-	LoadAtlasMetadata(ui_atlas, (themeInfos[i].sUIAtlas + ".meta").c_str(), true);
-#if !(PPSSPP_PLATFORM(WINDOWS) || PPSSPP_PLATFORM(ANDROID))
-	LoadAtlasMetadata(font_atlas, "font_atlas.meta", ui_atlas.num_fonts == 0);
-#else
-	LoadAtlasMetadata(font_atlas, "asciifont_atlas.meta", ui_atlas.num_fonts == 0);
-#endif
+	// The preload task already loaded the metadata for the selected theme - don't
+	// hit storage again for it.
+	if (!justPreloaded) {
+		LoadThemeAtlasMetadata(themeInfos[i]);
+	}
 
 	ctx->setUIAtlas(themeInfos[i].sUIAtlas + ".zim");
 }
@@ -25,6 +25,11 @@
 
 void ReloadAllThemeInfo();
 
+// Kicks off a background load of the theme list and the selected theme's atlas
+// metadata, so the first UpdateTheme doesn't have to hit storage. Call after the
+// config has been loaded; UpdateTheme joins the task.
+void PreloadThemeMetadata();
+
 std::vector<std::string> GetThemeInfoNames();
 void UpdateTheme(UIContext *ctx);
 Atlas *GetFontAtlas();
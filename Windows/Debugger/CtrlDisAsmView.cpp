@@ -206,7 +206,8 @@ CtrlDisAsmView::~CtrlDisAsmView()
 {
 	DeleteObject(font);
 	DeleteObject(boldfont);
-	manager.clear();
+	// Note: the manager's entries are shared and kept alive so reopening the
+	// window doesn't have to re-analyze everything.
 }
 
 static COLORREF scaleColor(COLORREF color, float factor)
@@ -77,6 +77,8 @@ void WindowsInputManager::Init() {
 }
 
 void WindowsInputManager::PollControllers() {
+	std::lock_guard<std::mutex> guard(pollMutex_);
+
 	static const int CHECK_FREQUENCY = 71;  // Just an arbitrary prime to try to not collide with other periodic checks.
 	if (checkCounter_++ > CHECK_FREQUENCY) {
 #ifndef _M_ARM
@@ -18,6 +18,8 @@
 #include <list>
 #include <memory>
 
+#include <mutex>
+
 #include "Common/CommonWindows.h"
 #include "Windows/InputDevice.h"
 
@@ -30,6 +32,8 @@ public:
 	void PollControllers();
 
 private:
+	// With InputLatePoll enabled, the emu thread polls too, not just the input thread.
+	std::mutex pollMutex_;
 	size_t numDinputDevices_ = 0;
 	std::list<std::unique_ptr<InputDevice>> input;
 
@@ -1325,21 +1325,41 @@ void AES_cbc_encrypt(AES_ctx *ctx, const u8 *src, u8 *dst, int size)
 	}
 }
 
+void (*AES_cbc_decrypt_parallel)(AES_ctx *ctx, const u8 *src, u8 *dst, int size) = 0;
+
 void AES_cbc_decrypt(AES_ctx *ctx, const u8 *src, u8 *dst, int size)
+{
+	//big buffers (whole EBOOT images) go through the host's parallel driver
+	if(AES_cbc_decrypt_parallel && size >= 64 * 1024)
+	{
+		AES_cbc_decrypt_parallel(ctx, src, dst, size);
+		return;
+	}
+	AES_cbc_decrypt_range(ctx, 0, src, dst, size);
+}
+
+void AES_cbc_decrypt_range(AES_ctx *ctx, const u8 *prev_block, const u8 *src, u8 *dst, int size)
 {
 	u8 block_buff[16];
 	u8 block_buff_previous[16];
-	int i;
-	
-	memcpy(block_buff, src, 16);
-	memcpy(block_buff_previous, src, 16);
-	AES_decrypt(ctx, src, dst);
-	
-	dst += 16;
-	src += 16;
-	
-	
-	for(i = 16; i < size; i+=16)
+	int i = 0;
+
+	if(prev_block)
+	{
+		memcpy(block_buff_previous, prev_block, 16);
+	}
+	else
+	{
+		//first block of the stream gets no XOR (no IV support)
+		memcpy(block_buff_previous, src, 16);
+		AES_decrypt(ctx, src, dst);
+
+		dst += 16;
+		src += 16;
+		i = 16;
+	}
+
+	for(; i < size; i+=16)
 	{
 		//step1: backup current block for next block decrypt
 		memcpy(block_buff, src, 16);
@@ -42,6 +42,18 @@ void AES_encrypt(AES_ctx *ctx, const u8 *src, u8 *dst);
 void AES_decrypt(AES_ctx *ctx, const u8 *src, u8 *dst);
 void AES_cbc_encrypt(AES_ctx *ctx, const u8 *src, u8 *dst, int size);
 void AES_cbc_decrypt(AES_ctx *ctx, const u8 *src, u8 *dst, int size);
+
+/* Decrypts part of a CBC stream given the previous ciphertext block.
+   Pass prev_block == NULL for the start of the stream (matches the no-IV
+   behavior of AES_cbc_decrypt). Like AES_cbc_decrypt, in-place operation
+   is fine as long as dst <= src. */
+void AES_cbc_decrypt_range(AES_ctx *ctx, const u8 *prev_block, const u8 *src, u8 *dst, int size);
+
+/* Optional driver for large CBC decrypts, installed by the host application.
+   CBC decryption only needs the previous ciphertext block per output block,
+   so the driver may split the buffer across threads using
+   AES_cbc_decrypt_range. */
+extern void (*AES_cbc_decrypt_parallel)(AES_ctx *ctx, const u8 *src, u8 *dst, int size);
 void AES_CMAC(AES_ctx *ctx, unsigned char *input, int length, unsigned char *mac);
 
 int	rijndaelKeySetupEnc(unsigned int [], const unsigned char [], int);
@@ -5,13 +5,17 @@
 // > --root pspautotests/tests/../ --compare --timeout=5 --graphics=software pspautotests/tests/cpu/cpu_alu/cpu_alu.prx
 
 #include "ppsspp_config.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <limits>
+#include <vector>
 #if PPSSPP_PLATFORM(ANDROID)
 #include <jni.h>
 #endif
 
+#include "ext/xxhash.h"
+
 #include "Common/Profiler/Profiler.h"
 #include "Common/System/NativeApp.h"
 #include "Common/System/Request.h"
@@ -24,6 +28,7 @@
 #include <csignal>
 #endif
 #include "Common/CPUDetect.h"
+#include "Common/Data/Format/JSONWriter.h"
 #include "Common/File/VFS/VFS.h"
 #include "Common/File/VFS/ZipFileReader.h"
 #include "Common/File/VFS/DirectoryReader.h"
@@ -31,14 +36,18 @@
 #include "Common/GraphicsContext.h"
 #include "Common/TimeUtil.h"
 #include "Common/Thread/ThreadManager.h"
+#include "Common/Thread/Waitable.h"
 #include "Core/Config.h"
 #include "Core/ConfigValues.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/MemMap.h"
+#include "Core/Replay.h"
 #include "Core/System.h"
 #include "Core/WebServer.h"
 #include "Core/HLE/sceUtility.h"
 #include "Core/SaveState.h"
+#include "GPU/GPU.h"
 #include "GPU/Common/FramebufferManagerCommon.h"
 #include "Common/Log.h"
 #include "Common/Log/LogManager.h"
@@ -138,6 +147,8 @@ bool System_MakeRequest(SystemRequestType type, int requestId, const std::string
 void System_AskForPermission(SystemPermission permission) {}
 PermissionStatus System_GetPermissionStatus(SystemPermission permission) { return PERMISSION_STATUS_GRANTED; }
 void System_AudioGetDebugStats(char *buf, size_t bufSize) { if (buf) buf[0] = '\0'; }
+int System_AudioGetUnderrunCountTotal() { return 0; }
+void System_AudioGetPullStats(int *devicePeriodFrames, int64_t *framesOutput, int64_t *framesPadded) { *devicePeriodFrames = 0; *framesOutput = 0; *framesPadded = 0; }
 void System_AudioClear() {}
 void System_AudioPushSamples(const s32 *audio, int numSamples) {}
 
@@ -172,6 +183,13 @@ int printUsage(const char *progname, const char *reason)
 	fprintf(stderr, "  -j                    use jit (default)\n");
 	fprintf(stderr, "  -c, --compare         compare with output in file.expected\n");
 	fprintf(stderr, "  --bench               run multiple times and output speed\n");
+	fprintf(stderr, "  --gpubench            report GE throughput stats (draws/sec, verts/sec)\n");
+	fprintf(stderr, "                        combine with a GE frame dump (.ppdmp) and --timeout\n");
+	fprintf(stderr, "  --bench-json=FILE     also write --gpubench results as JSON to FILE\n");
+	fprintf(stderr, "  --replay=FILE         execute a recorded input replay while running\n");
+	fprintf(stderr, "                        prints a RAM state hash for determinism checks;\n");
+	fprintf(stderr, "                        combine with --graphics=null for fastest verification\n");
+	fprintf(stderr, "  --replay-hash-interval=N  hash RAM every N frames (default 60, 0 = off)\n");
 	fprintf(stderr, "\nSee headless.txt for details.\n");
 
 	return 1;
@@ -194,9 +212,31 @@ static HeadlessHost *getHost(GPUCore gpuCore) {
 struct AutoTestOptions {
 	double timeout;
 	double maxScreenshotError;
+	const char *benchJsonFilename;
+	const char *replayFilename;
+	int replayHashInterval;
 	bool compare : 1;
 	bool verbose : 1;
 	bool bench : 1;
+	bool gpuBench : 1;
+};
+
+// Hashes a snapshot of emulated RAM on a worker, so replay verification can
+// overlap the hash with emulating the next frames.
+class ReplayHashTask : public Task {
+public:
+	ReplayHashTask(const std::vector<uint8_t> *snapshot, uint64_t *rollingHash, LimitedWaitable *waitable)
+		: snapshot_(snapshot), rollingHash_(rollingHash), waitable_(waitable) {}
+	TaskType Type() const override { return TaskType::CPU_COMPUTE; }
+	TaskPriority Priority() const override { return TaskPriority::NORMAL; }
+	void Run() override {
+		*rollingHash_ = XXH3_64bits_withSeed(snapshot_->data(), snapshot_->size(), *rollingHash_);
+		waitable_->Notify();
+	}
+private:
+	const std::vector<uint8_t> *snapshot_;
+	uint64_t *rollingHash_;
+	LimitedWaitable *waitable_;
 };
 
 bool RunAutoTest(HeadlessHost *headlessHost, CoreParameter &coreParameter, const AutoTestOptions &opt) {
@@ -232,7 +272,18 @@ bool RunAutoTest(HeadlessHost *headlessHost, CoreParameter &coreParameter, const
 
 	System_Notify(SystemNotification::BOOT_DONE);
 
-	Core_UpdateDebugStats((DebugOverlay)g_Config.iDebugOverlay == DebugOverlay::DEBUG_STATS || g_Config.bLogFrameDrops);
+	if (opt.replayFilename) {
+		if (!ReplayExecuteFile(Path(std::string(opt.replayFilename)))) {
+			fprintf(stderr, "Failed to load replay '%s'\n", opt.replayFilename);
+			TeamCityPrint("testFailed name='%s' message='Replay missing'", currentTestName.c_str());
+			GitHubActionsPrint("error", "Replay missing for %s", currentTestName.c_str());
+			PSP_Shutdown();
+			return false;
+		}
+	}
+
+	// The GPU benchmark needs debug stats collection on for the vertex decode timing.
+	Core_UpdateDebugStats((DebugOverlay)g_Config.iDebugOverlay == DebugOverlay::DEBUG_STATS || g_Config.bLogFrameDrops || opt.gpuBench);
 
 	PSP_BeginHostFrame();
 	Draw::DrawContext *draw = coreParameter.graphicsContext ? coreParameter.graphicsContext->GetDrawContext() : nullptr;
@@ -240,6 +291,23 @@ bool RunAutoTest(HeadlessHost *headlessHost, CoreParameter &coreParameter, const
 		draw->BeginFrame(Draw::DebugFlags::NONE);
 
 	bool passed = true;
+	// GE throughput accumulators for --gpubench. Per-frame counters are sampled and
+	// cleared at each flip, so loops around a GE frame dump measure steady state.
+	double benchStart = time_now_d();
+	double benchLastFlip = benchStart;
+	double benchDecodeSeconds = 0.0;
+	int benchFrames = 0;
+	int64_t benchDraws = 0, benchVertsSubmitted = 0, benchVertsDecoded = 0;
+	std::vector<double> benchFrameTimes;
+	// Replay verification state. Hashing runs on a worker against a RAM snapshot,
+	// overlapping with emulation of the following frames; the snapshot copy is the
+	// synchronization point, so results are deterministic.
+	std::vector<uint8_t> replaySnapshot;
+	LimitedWaitable *replayHashPending = nullptr;
+	uint64_t replayHash = 0;
+	int replayFrames = 0;
+	int replayHashSamples = 0;
+	bool replayDone = false;
 	double deadline = time_now_d() + opt.timeout;
 	coreState = coreParameter.startBreak ? CORE_STEPPING : CORE_RUNNING;
 	while (coreState == CORE_RUNNING || coreState == CORE_STEPPING)
@@ -251,11 +319,47 @@ bool RunAutoTest(HeadlessHost *headlessHost, CoreParameter &coreParameter, const
 		if (coreState == CORE_NEXTFRAME) {
 			coreState = CORE_RUNNING;
 			headlessHost->SwapBuffers();
+			if (opt.gpuBench) {
+				benchFrames++;
+				benchDraws += gpuStats.numDrawCalls;
+				benchVertsSubmitted += gpuStats.numVertsSubmitted;
+				benchVertsDecoded += gpuStats.numVertsDecoded;
+				benchDecodeSeconds += gpuStats.msVertexDecode;
+				double now = time_now_d();
+				benchFrameTimes.push_back(now - benchLastFlip);
+				benchLastFlip = now;
+				gpuStats.ResetFrame();
+			}
+			if (opt.replayFilename) {
+				replayFrames++;
+				if (opt.replayHashInterval > 0 && (replayFrames % opt.replayHashInterval) == 0) {
+					if (replayHashPending) {
+						replayHashPending->WaitAndRelease();
+						replayHashPending = nullptr;
+					}
+					replaySnapshot.resize(Memory::g_MemorySize);
+					Memory::MemcpyUnchecked(replaySnapshot.data(), PSP_GetKernelMemoryBase(), Memory::g_MemorySize);
+					replayHashSamples++;
+					replayHashPending = new LimitedWaitable();
+					g_threadManager.EnqueueTask(new ReplayHashTask(&replaySnapshot, &replayHash, replayHashPending));
+				}
+				if (!ReplayHasMoreEvents()) {
+					// Replay fully consumed - that's a successful verification run.
+					replayDone = true;
+					Core_Stop();
+					break;
+				}
+			}
 		}
 		if (coreState == CORE_STEPPING && !coreParameter.startBreak) {
 			break;
 		}
 		if (time_now_d() > deadline) {
+			// For a GPU benchmark, the timeout is simply the end of the measurement.
+			if (opt.gpuBench) {
+				Core_Stop();
+				break;
+			}
 			// Don't compare, print the output at least up to this point, and bail.
 			if (!opt.bench) {
 				printf("%s", output.c_str());
@@ -271,6 +375,77 @@ bool RunAutoTest(HeadlessHost *headlessHost, CoreParameter &coreParameter, const
 	}
 	PSP_EndHostFrame();
 
+	if (opt.replayFilename) {
+		if (replayHashPending)
+			replayHashPending->WaitAndRelease();
+		if (replayDone) {
+			printf("Replay verify: %d frames replayed\n", replayFrames);
+		} else {
+			printf("Replay verify: FAILED - stopped after %d frames with events remaining\n", replayFrames);
+			passed = false;
+		}
+		if (replayHashSamples > 0) {
+			printf("  state hash: %016llx (%d samples, every %d frames)\n",
+				(unsigned long long)replayHash, replayHashSamples, opt.replayHashInterval);
+		}
+	}
+
+	if (opt.gpuBench) {
+		double elapsed = time_now_d() - benchStart;
+		if (benchFrames > 0 && elapsed > 0.0) {
+			std::vector<double> sorted = benchFrameTimes;
+			std::sort(sorted.begin(), sorted.end());
+			double sum = 0.0;
+			for (double t : sorted)
+				sum += t;
+			double meanMs = 1000.0 * sum / sorted.size();
+			double p95Ms = 1000.0 * sorted[std::min(sorted.size() - 1, (sorted.size() * 95) / 100)];
+			double decodeMsPerFrame = 1000.0 * benchDecodeSeconds / benchFrames;
+
+			printf("GE bench: %d frames in %0.2fs (%0.1f FPS)\n", benchFrames, elapsed, benchFrames / elapsed);
+			printf("  frame time: mean %0.3f ms, p95 %0.3f ms\n", meanMs, p95Ms);
+			printf("  vertex decode: %0.3f ms/frame\n", decodeMsPerFrame);
+			printf("  draws: %lld (%0.0f/sec)\n", (long long)benchDraws, benchDraws / elapsed);
+			printf("  verts submitted: %lld (%0.0f/sec)\n", (long long)benchVertsSubmitted, benchVertsSubmitted / elapsed);
+			printf("  verts decoded: %lld (%0.0f/sec)\n", (long long)benchVertsDecoded, benchVertsDecoded / elapsed);
+
+			if (opt.benchJsonFilename) {
+				json::JsonWriter json(json::JsonWriter::PRETTY);
+				json.begin();
+				json.writeString("test", currentTestName);
+				json.writeString("api", draw ? draw->GetInfoString(Draw::InfoField::APINAME) : "Software");
+				json.writeInt("frames", benchFrames);
+				json.writeFloat("seconds", elapsed);
+				json.writeFloat("fps", benchFrames / elapsed);
+				json.writeFloat("frameTimeMsMean", meanMs);
+				json.writeFloat("frameTimeMsP95", p95Ms);
+				json.writeFloat("vertexDecodeMsPerFrame", decodeMsPerFrame);
+				json.writeFloat("drawsPerSec", benchDraws / elapsed);
+				json.writeFloat("vertsSubmittedPerSec", benchVertsSubmitted / elapsed);
+				json.writeFloat("vertsDecodedPerSec", benchVertsDecoded / elapsed);
+				// Formatted backend stats - includes shader/pipeline counts where the
+				// backend tracks them.
+				if (gpu) {
+					char statsBuf[8192];
+					gpu->GetStats(statsBuf, sizeof(statsBuf));
+					json.writeString("debugStats", statsBuf);
+				}
+				json.end();
+
+				FILE *jsonFp = File::OpenCFile(Path(std::string(opt.benchJsonFilename)), "wb");
+				if (jsonFp) {
+					std::string jsonStr = json.str();
+					fwrite(jsonStr.data(), 1, jsonStr.size(), jsonFp);
+					fclose(jsonFp);
+				} else {
+					fprintf(stderr, "Failed to write bench JSON to '%s'\n", opt.benchJsonFilename);
+				}
+			}
+		} else {
+			printf("GE bench: no frames completed\n");
+		}
+	}
+
 	if (draw) {
 		draw->BindFramebufferAsRenderTarget(nullptr, { Draw::RPAction::CLEAR, Draw::RPAction::DONT_CARE, Draw::RPAction::DONT_CARE }, "Headless");
 		// Vulkan may get angry if we don't do a final present.
@@ -334,6 +509,7 @@ int main(int argc, const char* argv[])
 
 	AutoTestOptions testOptions{};
 	testOptions.timeout = std::numeric_limits<double>::infinity();
+	testOptions.replayHashInterval = 60;
 	bool fullLog = false;
 	const char *stateToLoad = 0;
 	GPUCore gpuCore = GPUCORE_SOFTWARE;
@@ -374,6 +550,14 @@ int main(int argc, const char* argv[])
 			testOptions.compare = true;
 		else if (!strcmp(argv[i], "--bench"))
 			testOptions.bench = true;
+		else if (!strcmp(argv[i], "--gpubench"))
+			testOptions.gpuBench = true;
+		else if (!strncmp(argv[i], "--bench-json=", strlen("--bench-json=")) && strlen(argv[i]) > strlen("--bench-json="))
+			testOptions.benchJsonFilename = argv[i] + strlen("--bench-json=");
+		else if (!strncmp(argv[i], "--replay=", strlen("--replay=")) && strlen(argv[i]) > strlen("--replay="))
+			testOptions.replayFilename = argv[i] + strlen("--replay=");
+		else if (!strncmp(argv[i], "--replay-hash-interval=", strlen("--replay-hash-interval=")) && strlen(argv[i]) > strlen("--replay-hash-interval="))
+			testOptions.replayHashInterval = (int)strtoul(argv[i] + strlen("--replay-hash-interval="), nullptr, 10);
 		else if (!strcmp(argv[i], "-v") || !strcmp(argv[i], "--verbose"))
 			testOptions.verbose = true;
 		else if (!strcmp(argv[i], "--new-atrac"))
@@ -1960,6 +1960,8 @@ void System_AudioPushSamples(const int32_t *audio, int numSamples) {
 }
 
 void System_AudioGetDebugStats(char *buf, size_t bufSize) { if (buf) buf[0] = '\0'; }
+int System_AudioGetUnderrunCountTotal() { return 0; }
+void System_AudioGetPullStats(int *devicePeriodFrames, int64_t *framesOutput, int64_t *framesPadded) { *devicePeriodFrames = 0; *framesOutput = 0; *framesPadded = 0; }
 void System_AudioClear() {}
 
 #if PPSSPP_PLATFORM(ANDROID) || PPSSPP_PLATFORM(IOS)
@@ -49,6 +49,7 @@
 #include "Common/Data/Collections/TinySet.h"
 #include "Common/Data/Collections/FastVec.h"
 #include "Common/Data/Convert/SmallDataConvert.h"
+#include "Common/Data/Hash/Hash.h"
 #include "Common/Data/Text/Parsers.h"
 #include "Common/Data/Text/WrapText.h"
 #include "Common/Data/Encoding/Utf8.h"
@@ -73,6 +74,7 @@
 #include "Common/File/VFS/DirectoryReader.h"
 #include "Core/FileSystems/ISOFileSystem.h"
 #include "Core/MemMap.h"
+#include "Core/Util/BlockAllocator.h"
 #include "Core/KeyMap.h"
 #include "Core/MIPS/MIPSVFPUUtils.h"
 #include "GPU/Common/TextureDecoder.h"
@@ -104,6 +106,8 @@ bool System_GetPropertyBool(SystemProperty prop) {
 void System_Notify(SystemNotification notification) {}
 void System_PostUIMessage(UIMessage message, const std::string &param) {}
 void System_AudioGetDebugStats(char *buf, size_t bufSize) { if (buf) buf[0] = '\0'; }
+int System_AudioGetUnderrunCountTotal() { return 0; }
+void System_AudioGetPullStats(int *devicePeriodFrames, int64_t *framesOutput, int64_t *framesPadded) { *devicePeriodFrames = 0; *framesOutput = 0; *framesPadded = 0; }
 void System_AudioClear() {}
 void System_AudioPushSamples(const s32 *audio, int numSamples) {}
 
@@ -694,6 +698,204 @@ static bool TestMemMap() {
 	return true;
 }
 
+// Reference first-fit allocator, doing what BlockAllocator did before it got the free
+// block index: walk every block in address order and take the first free one that fits.
+// BlockAllocator must keep handing out identical addresses - games depend on them.
+struct RefBlockAllocator {
+	struct RefBlock {
+		u32 start;
+		u32 size;
+		bool taken;
+	};
+	std::vector<RefBlock> blocks;
+	u32 rangeSize_ = 0;
+	static const u32 grain_ = 16;
+
+	void Init(u32 rangeStart, u32 rangeSize) {
+		rangeSize_ = rangeSize;
+		blocks.clear();
+		blocks.push_back(RefBlock{ rangeStart, rangeSize, false });
+	}
+
+	u32 Take(size_t i, u32 offset, u32 size) {
+		// Split off the tail and the alignment slack, like InsertFreeAfter/Before do.
+		u32 needed = offset + size;
+		if (blocks[i].size > needed) {
+			RefBlock tail{ blocks[i].start + needed, blocks[i].size - needed, false };
+			blocks[i].size = needed;
+			blocks.insert(blocks.begin() + i + 1, tail);
+		}
+		if (offset >= grain_) {
+			RefBlock head{ blocks[i].start, offset, false };
+			blocks[i].start += offset;
+			blocks[i].size -= offset;
+			blocks.insert(blocks.begin() + i, head);
+			i++;
+		}
+		blocks[i].taken = true;
+		return blocks[i].start;
+	}
+
+	u32 AllocAligned(u32 &size, u32 sizeGrain, u32 grain, bool fromTop) {
+		if (size == 0 || size > rangeSize_)
+			return -1;
+		if (grain < grain_)
+			grain = grain_;
+		if (sizeGrain < grain_)
+			sizeGrain = grain_;
+		size = (size + sizeGrain - 1) & ~(sizeGrain - 1);
+		if (!fromTop) {
+			for (size_t i = 0; i < blocks.size(); ++i) {
+				RefBlock &b = blocks[i];
+				u32 offset = b.start % grain;
+				if (offset != 0)
+					offset = grain - offset;
+				if (!b.taken && b.size >= offset + size)
+					return Take(i, offset, size);
+			}
+		} else {
+			for (size_t i = blocks.size(); i-- > 0; ) {
+				RefBlock &b = blocks[i];
+				u32 offset = (b.start + b.size - size) % grain;
+				u32 needed = offset + size;
+				if (!b.taken && b.size >= needed) {
+					// Split off the head, then the alignment slack at the end.
+					if (blocks[i].size > needed) {
+						RefBlock head{ blocks[i].start, blocks[i].size - needed, false };
+						blocks[i].start += head.size;
+						blocks[i].size = needed;
+						blocks.insert(blocks.begin() + i, head);
+						i++;
+					}
+					if (offset >= grain_) {
+						RefBlock tail{ blocks[i].start + size, offset, false };
+						blocks[i].size = size;
+						blocks.insert(blocks.begin() + i + 1, tail);
+					}
+					blocks[i].taken = true;
+					return blocks[i].start;
+				}
+			}
+		}
+		return -1;
+	}
+
+	bool Free(u32 position) {
+		for (size_t i = 0; i < blocks.size(); ++i) {
+			RefBlock &b = blocks[i];
+			if (b.taken && b.start <= position && b.start + b.size > position) {
+				b.taken = false;
+				while (i + 1 < blocks.size() && !blocks[i + 1].taken) {
+					blocks[i].size += blocks[i + 1].size;
+					blocks.erase(blocks.begin() + i + 1);
+				}
+				while (i > 0 && !blocks[i - 1].taken) {
+					blocks[i - 1].size += blocks[i].size;
+					blocks.erase(blocks.begin() + i);
+					i--;
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+
+	u32 TotalFreeBytes() const {
+		u32 sum = 0;
+		for (const RefBlock &b : blocks) {
+			if (!b.taken)
+				sum += b.size;
+		}
+		return sum;
+	}
+};
+
+static bool TestBlockAllocator() {
+	BlockAllocator alloc(16);
+	alloc.Init(0x08800000, 0x00800000, false);
+
+	// Some basic scripted expectations first.
+	u32 size = 0x100;
+	EXPECT_EQ_HEX(alloc.Alloc(size, false, "a"), 0x08800000);
+	EXPECT_EQ_HEX(alloc.Alloc(size, false, "b"), 0x08800100);
+	EXPECT_EQ_HEX(alloc.Alloc(size, true, "c"), 0x08FFFF00);
+	size = 0x101;
+	EXPECT_EQ_HEX(alloc.Alloc(size, false, "d"), 0x08800200);
+	EXPECT_EQ_HEX(size, 0x110);
+	EXPECT_TRUE(alloc.Free(0x08800100));
+	// First fit finds the freed hole again.
+	size = 0x100;
+	EXPECT_EQ_HEX(alloc.Alloc(size, false, "e"), 0x08800100);
+	// Too big for the hole after we shrink it - even though it's first.
+	EXPECT_TRUE(alloc.Free(0x08800100));
+	size = 0x80;
+	EXPECT_EQ_HEX(alloc.Alloc(size, false, "f"), 0x08800100);
+	size = 0x100;
+	EXPECT_EQ_HEX(alloc.Alloc(size, false, "g"), 0x08800310);
+	// Aligned allocation skips the 0x80 hole and pads up to the grain.
+	size = 0x100;
+	EXPECT_EQ_HEX(alloc.AllocAligned(size, 0x100, 0x100, false, "h"), 0x08800500);
+	// AllocAt and exact free.
+	EXPECT_EQ_HEX(alloc.AllocAt(0x08801000, 0x100, "i"), 0x08801000);
+	EXPECT_FALSE(alloc.IsBlockFree(0x08801000));
+	EXPECT_TRUE(alloc.FreeExact(0x08801000));
+	EXPECT_TRUE(alloc.IsBlockFree(0x08801000));
+	// Freeing merges back into one big block eventually.
+	EXPECT_TRUE(alloc.Free(0x08800000));
+	EXPECT_TRUE(alloc.Free(0x08800200));
+	EXPECT_TRUE(alloc.Free(0x08800310));
+	EXPECT_TRUE(alloc.Free(0x08800100));
+	EXPECT_TRUE(alloc.Free(0x08800500));
+	EXPECT_TRUE(alloc.Free(0x08FFFF00));
+	EXPECT_EQ_HEX(alloc.GetLargestFreeBlockSize(), 0x00800000);
+	EXPECT_EQ_HEX(alloc.GetTotalFreeBytes(), 0x00800000);
+
+	// Now run a scrambled alloc/free pattern against the reference walk and make sure
+	// every returned address matches.
+	RefBlockAllocator ref;
+	ref.Init(0x08800000, 0x00800000);
+	std::vector<u32> live;
+	u32 rnd = 0x13377331;
+	auto next = [&rnd]() {
+		rnd = rnd * 1664525 + 1013904223;
+		return rnd >> 8;
+	};
+	for (int i = 0; i < 2000; ++i) {
+		u32 op = next() % 4;
+		if (op == 3 && !live.empty()) {
+			u32 pos = live[next() % live.size()];
+			EXPECT_TRUE(alloc.Free(pos));
+			EXPECT_TRUE(ref.Free(pos));
+			live.erase(std::find(live.begin(), live.end(), pos));
+		} else if (op == 2) {
+			u32 grain = 16 << (next() % 5);
+			u32 sz1 = next() % 0x3000 + 1;
+			u32 sz2 = sz1;
+			bool fromTop = (next() & 1) != 0;
+			u32 a = alloc.AllocAligned(sz1, 16, grain, fromTop);
+			u32 b = ref.AllocAligned(sz2, 16, grain, fromTop);
+			EXPECT_EQ_HEX(a, b);
+			EXPECT_EQ_HEX(sz1, sz2);
+			if (a != (u32)-1)
+				live.push_back(a);
+		} else {
+			u32 sz1 = next() % 0x8000 + 1;
+			u32 sz2 = sz1;
+			bool fromTop = (next() & 1) != 0;
+			u32 a = alloc.Alloc(sz1, fromTop);
+			u32 b = ref.AllocAligned(sz2, 16, 16, fromTop);
+			EXPECT_EQ_HEX(a, b);
+			EXPECT_EQ_HEX(sz1, sz2);
+			if (a != (u32)-1)
+				live.push_back(a);
+		}
+		if ((i & 63) == 0) {
+			EXPECT_EQ_HEX(alloc.GetTotalFreeBytes(), ref.TotalFreeBytes());
+		}
+	}
+	return true;
+}
+
 static bool TestPath() {
 	// Also test the Path class while we're at it.
 	Path path("/asdf/jkl/");
@@ -868,6 +1070,16 @@ static bool TestWrapText() {
 	return true;
 }
 
+static bool TestCrc32() {
+	// The classic CRC-32 check value, and chaining across a split should match one pass.
+	static const uint8_t check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	EXPECT_EQ_HEX(hash::Crc32(0, check, sizeof(check)), 0xCBF43926);
+	uint32_t chained = hash::Crc32(0, check, 4);
+	chained = hash::Crc32(chained, check + 4, sizeof(check) - 4);
+	EXPECT_EQ_HEX(chained, 0xCBF43926);
+	return true;
+}
+
 static bool TestSmallDataConvert() {
 	float f[4] = { 1.0f / 255.0f, 2.0f / 255.0f, 3.0f / 255.0f, 4.0f / 255.f };
 	uint32_t result = Float4ToUint8x4_NoClamp(f);
@@ -1031,6 +1243,30 @@ bool TestColorConv() {
 		EXPECT_EQ_INT(reference, value);
 	}
 
+	// Check the SIMD 32->16 conversions against the scalar per-pixel versions,
+	// including a length that exercises both the vector loop and the tail.
+	alignas(16) u32 src32[29];
+	alignas(16) u16 dst16[29];
+	for (int i = 0; i < 29; i++) {
+		src32[i] = (u32)(i * 0x01214387 + 0x39F01817);
+	}
+
+	ConvertRGBA8888ToRGB565(dst16, src32, 29);
+	for (int i = 0; i < 29; i++)
+		EXPECT_EQ_INT((u32)RGBA8888toRGB565(src32[i]), (u32)dst16[i]);
+
+	ConvertBGRA8888ToRGB565(dst16, src32, 29);
+	for (int i = 0; i < 29; i++)
+		EXPECT_EQ_INT((u32)BGRA8888toRGB565(src32[i]), (u32)dst16[i]);
+
+	ConvertRGBA8888ToRGBA5551(dst16, src32, 29);
+	for (int i = 0; i < 29; i++)
+		EXPECT_EQ_INT((u32)RGBA8888toRGBA5551(src32[i]), (u32)dst16[i]);
+
+	ConvertBGRA8888ToRGBA5551(dst16, src32, 29);
+	for (int i = 0; i < 29; i++)
+		EXPECT_EQ_INT((u32)BGRA8888toRGBA5551(src32[i]), (u32)dst16[i]);
+
 	return true;
 }
 
@@ -1066,6 +1302,7 @@ TestItem availableTests[] = {
 	TEST_ITEM(RiscVEmitter),
 #endif
 	TEST_ITEM(VertexJit),
+	TEST_ITEM(VertexJitBench),
 	TEST_ITEM(Asin),
 	TEST_ITEM(SinCos),
 	TEST_ITEM(VFPUSinCos),
@@ -1086,6 +1323,7 @@ TestItem availableTests[] = {
 	TEST_ITEM(WrapText),
 	TEST_ITEM(TinySet),
 	TEST_ITEM(FastVec),
+	TEST_ITEM(Crc32),
 	TEST_ITEM(SmallDataConvert),
 	TEST_ITEM(DepthMath),
 	TEST_ITEM(InputMapping),
@@ -1094,6 +1332,7 @@ TestItem availableTests[] = {
 	TEST_ITEM(Substitutions),
 	TEST_ITEM(IniFile),
 	TEST_ITEM(ColorConv),
+	TEST_ITEM(BlockAllocator),
 };
 
 int main(int argc, const char *argv[]) {